@@ -75,20 +75,13 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 		((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->next;
 	
 	/* Get the next expiry point */
-	P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) next_ep;
+	P2CONST(tpl_expiry_point, AUTOMATIC, OS_CONST) next_ep;
 		
 	P2CONST(tpl_action, AUTOMATIC, OS_APPL_DATA)  action_desc;
   VAR(tpl_action_count, AUTOMATIC)  i;
 	
-	VAR(tpl_tick, AUTOMATIC) before;
-	
 	/*VAR(tpl_expiry_count, AUTOMATIC) abs_deviation = ( ~(((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation - 1 ) );
 */
-	/*  Get the remaining time to fill the current schedule table
-	 period. This time is stored in the offset of the first expiry
-	 point                                                           */
-	before = (schedtable->expiry)[0]->sync_offset;
-	
 	/*  Reset the cycle of the time object                                  */
 	st->cycle = 0;
 	
@@ -104,10 +97,11 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 
 		/*  reset the state of the current schedule table               */
 		st->state = SCHEDULETABLE_STOPPED;
+		((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->first_adjustment = 0;
 		
     /*  Get the next expiry point                                        */
 		next_ep =
-		((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))next->b_desc.stat_part)->expiry[0];
+		&(((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))next->b_desc.stat_part)->expiry[0]);
 		
 		/* check if expiry point at offset=0 */
 		if (next_ep->offset == 0)
@@ -124,7 +118,7 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
       
       /* Change next expiry point */
       next_ep =
-      ((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))next->b_desc.stat_part)->expiry[1];
+      &(((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))next->b_desc.stat_part)->expiry[1]);
       
 		}	    
       
@@ -140,18 +134,21 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 	}
 	else if (schedtable->periodic == TRUE) {
 		
-		/* if first expiry point in the next ST is at offset=0, launch it directly  */
-		if(schedtable->expiry[0]->sync_offset == 0)
+		next_ep = &(schedtable->expiry[0]);
+
+		/* if first expiry point in the next ST is at offset=0 (once adjusted), launch it directly  */
+		if((next_ep->offset +
+		    (tpl_tick)((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->first_adjustment) == 0)
 		{		
       /*launch all the actions of the expiry point*/
-			for (i = 0; i < schedtable->expiry[0]->count; i++)
+			for (i = 0; i < next_ep->count; i++)
 			{
-				action_desc = (schedtable->expiry[0]->actions)[i];
+				action_desc = (next_ep->actions)[i];
 				(action_desc->action)(action_desc);
 			}
 						
-			/* reset the offset of the first expiry point too */
-			(schedtable->expiry)[0]->sync_offset = (schedtable->expiry)[0]->offset;
+			/* reset the adjustment of the first expiry point too */
+			((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->first_adjustment = 0;
 		
 			/*Increment index because the first one has just been launched*/
 			((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index = 0;
@@ -165,6 +162,7 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 	else {
 		/*  reset the state of the current schedule table               */
 		st->state = SCHEDULETABLE_STOPPED;
+		((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->first_adjustment = 0;
 	}
 }
 
@@ -344,6 +344,7 @@ FUNC(tpl_status, OS_CODE) tpl_terminate_application_service(
               tpl_remove_time_obj(&(schedtable->b_desc));
               schedtable->b_desc.state = SCHEDULETABLE_STOPPED;
               schedtable->index = 0;
+              schedtable->first_adjustment = 0;
             }
           }
         }
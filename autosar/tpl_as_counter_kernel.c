@@ -168,6 +168,9 @@ FUNC(tpl_status, OS_CODE) tpl_get_counter_value_service(
     /*  get the counter descriptor              */
     counter = tpl_counter_table[counter_id];
 
+    /*  in tickless mode, count the ticks elapsed since the last update */
+    TPL_UPDATE_COUNTER(counter);
+
     /*  copy its value in value ref             */
     *value = counter->current_date;
   }
@@ -236,6 +239,9 @@ FUNC(tpl_status, OS_CODE) tpl_get_elapsed_counter_value_service(
     /*  get the counter descriptor              */
     counter = tpl_counter_table[counter_id];
 
+    /*  in tickless mode, count the ticks elapsed since the last update */
+    TPL_UPDATE_COUNTER(counter);
+
     /*  get the current counter value           */
     cpt_val = counter->current_date;
     if (cpt_val < *previous_value) {
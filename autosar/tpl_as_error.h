@@ -704,7 +704,7 @@
         ((offset >                                                      \
          (tpl_schedtable_table[sched_table_id]->                        \
          b_desc.stat_part->counter->max_allowed_value -                 \
-		 (((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))((tpl_schedtable_table[sched_table_id])->b_desc.stat_part))->expiry[0])->offset) )     \
+		 (((P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))((tpl_schedtable_table[sched_table_id])->b_desc.stat_part))->expiry[0]).offset) )     \
 		 || (offset == (TickType)0)))                                       \
     {                                                                   \
         result = (tpl_status)E_OS_VALUE;                                \
@@ -58,7 +58,7 @@ FUNC(void, OS_CODE) tpl_start_sched_table_sync(
   st->date =  (st->stat_part->counter->current_date) + 
               (st->date) +
               ((schedtable->length) - sync_date) +
-              schedtable->expiry[0]->offset;
+              schedtable->expiry[0].offset;
 	
   if ( st->date > st->stat_part->counter->max_allowed_value )
   {
@@ -85,12 +85,11 @@ FUNC(void, OS_CODE) tpl_sync_sched_table(
   P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA) schedtable;
   /*  Get the current index                                               */
   VAR(tpl_expiry_count, AUTOMATIC)  index;
-  VAR(tpl_expiry_count, AUTOMATIC)  j;
 
   VAR(tpl_tick, AUTOMATIC)  drive_cnt_now;
   VAR(tpl_tick, AUTOMATIC)  drive_cnt_match;
   VAR(tpl_tick, AUTOMATIC)  position_on_tbl;
-  VAR(tpl_tick, AUTOMATIC)  next_ep_offset=0;
+  VAR(tpl_tick, AUTOMATIC)  next_ep_offset;
   VAR(sint32, AUTOMATIC)  deviation;
 
   /* get the current date of the counter which drives the schedule table  */
@@ -109,13 +108,9 @@ FUNC(void, OS_CODE) tpl_sync_sched_table(
      of tpl_schedule_table is a tpl_time_obj */
   index = ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index;
 
-  /* this loop calculates the offset of the next_expiry point
-     from the start of the schedule table */
-  for(j = 0; j <= index; j++)
-  {
-    next_ep_offset = next_ep_offset +
-                     (((schedtable->expiry)[j])->sync_offset);
-  }
+  /* get the offset of the next expiry point from the start of the
+     schedule table. Its adjustment, if any, is already in its date */
+  next_ep_offset = schedtable->expiry[index].table_offset;
 
   /* calculate the current position in the schedule table */
   position_on_tbl = next_ep_offset - (drive_cnt_match - drive_cnt_now);
@@ -60,6 +60,45 @@ typedef tpl_spinlock_id  SpinlockIdType;
  */
 typedef tpl_try_to_get_spinlock_type  TryToGetSpinlockType;
 
+/**
+ * @struct TPL_SPINLOCK_STATS
+ *
+ * Contention statistics of a spinlock as returned by
+ * GetSpinlockStatistics. The wait is in tpl_stats_time unit (see the os
+ * machine specifications).
+ */
+struct TPL_SPINLOCK_STATS
+{
+  VAR(uint32, TYPEDEF)
+  attempt_count;  /**< calls of GetSpinlock and TryToGetSpinlock    */
+  VAR(uint32, TYPEDEF)
+  spin_count;     /**< iterations of the wait loops                 */
+  VAR(tpl_stats_time, TYPEDEF)
+  max_wait;       /**< worst observed wait of GetSpinlock            */
+};
+
+/**
+ * @typedef tpl_spinlock_stats
+ *
+ * This is an alias for the #TPL_SPINLOCK_STATS structure
+ */
+typedef struct TPL_SPINLOCK_STATS tpl_spinlock_stats;
+
+/**
+ * @typedef SpinlockStatisticsType
+ *
+ * Contention statistics of a spinlock
+ */
+typedef tpl_spinlock_stats SpinlockStatisticsType;
+
+/**
+ * @typedef SpinlockStatisticsRefType
+ *
+ * References a #SpinlockStatisticsType
+ */
+typedef P2VAR(tpl_spinlock_stats, TYPEDEF, OS_APPL_DATA)
+  SpinlockStatisticsRefType;
+
 /*
  * Trampoline extra
  * GetSpinlock_IE : GetSpinlock with Interrupts Enabled
@@ -34,6 +34,9 @@
 #include "tpl_os_error.h"
 #include "tpl_os_definitions.h"
 #include "tpl_as_definitions.h"
+#if WITH_SPINLOCK_STATISTICS == YES
+#include "tpl_as_spinlock_stats_kernel.h"
+#endif
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
@@ -44,6 +47,170 @@
  */
 tpl_bool tpl_spinlock_resscheduler_taken[NUMBER_OF_CORES] = {FALSE};
 
+/*
+ * Takes the lock of a spinlock. Returns the number of iterations of the
+ * wait loop.
+ */
+STATIC FUNC(uint32, OS_CODE) tpl_lock_spinlock(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  CONSTP2VAR(tpl_spinlock, AUTOMATIC, OS_VAR)
+    spinlock = tpl_spinlock_table[spinlock_id];
+  VAR(uint32, AUTOMATIC) spins = 0;
+
+  switch (spinlock->type)
+  {
+    case SPINLOCK_TICKET :
+    {
+      CONSTP2VAR(tpl_ticket_lock, AUTOMATIC, OS_VAR) ticket = spinlock->ticket;
+      CONST(uint16, AUTOMATIC) my_ticket =
+        tpl_fetch_and_add(&(ticket->next_ticket), 1U);
+
+      while (tpl_atomic_load(&(ticket->now_serving)) != my_ticket)
+      {
+        tpl_cpu_relax();
+        spins++;
+      }
+      break;
+    }
+    case SPINLOCK_MCS :
+    {
+      CONSTP2VAR(tpl_mcs_lock, AUTOMATIC, OS_VAR) mcs = spinlock->mcs;
+      CONSTP2VAR(tpl_mcs_node, AUTOMATIC, OS_VAR) node = &(mcs->nodes[core_id]);
+      VAR(uint16, AUTOMATIC) previous;
+
+      node->next = 0;
+      node->waiting = 1U;
+      /* queue the node, the exchange publishes its initialization */
+      previous = tpl_atomic_exchange(&(mcs->tail), (uint16)(core_id + 1U));
+      if (previous != 0)
+      {
+        /* link it to the previous node and wait to be released */
+        (void)tpl_atomic_exchange(&(mcs->nodes[previous - 1U].next),
+                                  (uint16)(core_id + 1U));
+        while (tpl_atomic_load(&(node->waiting)) != 0)
+        {
+          tpl_cpu_relax();
+          spins++;
+        }
+      }
+      break;
+    }
+    default :
+    {
+#if WITH_SPINLOCK_STATISTICS == YES
+      /* same as tpl_get_lock, the iterations are counted */
+      VAR(tpl_try_to_get_spinlock_type, AUTOMATIC) success;
+
+      tpl_try_to_get_lock(&(spinlock->state), &success);
+      while (success != TRYTOGETSPINLOCK_SUCCESS)
+      {
+        spins++;
+        tpl_try_to_get_lock(&(spinlock->state), &success);
+      }
+#else
+      tpl_get_lock(&(spinlock->state));
+#endif
+      break;
+    }
+  }
+
+  return spins;
+}
+
+/*
+ * Takes the lock of a spinlock if it is free. A queued lock is free if no
+ * core owns it or waits for it.
+ */
+STATIC FUNC(tpl_try_to_get_spinlock_type, OS_CODE) tpl_try_to_lock_spinlock(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  CONSTP2VAR(tpl_spinlock, AUTOMATIC, OS_VAR)
+    spinlock = tpl_spinlock_table[spinlock_id];
+  VAR(tpl_try_to_get_spinlock_type, AUTOMATIC)
+    success = TRYTOGETSPINLOCK_NOSUCCESS;
+
+  switch (spinlock->type)
+  {
+    case SPINLOCK_TICKET :
+    {
+      CONSTP2VAR(tpl_ticket_lock, AUTOMATIC, OS_VAR) ticket = spinlock->ticket;
+      CONST(uint16, AUTOMATIC) serving =
+        tpl_atomic_load(&(ticket->now_serving));
+
+      if (tpl_compare_and_swap(&(ticket->next_ticket), serving,
+                               (uint16)(serving + 1U)))
+      {
+        success = TRYTOGETSPINLOCK_SUCCESS;
+      }
+      break;
+    }
+    case SPINLOCK_MCS :
+    {
+      CONSTP2VAR(tpl_mcs_lock, AUTOMATIC, OS_VAR) mcs = spinlock->mcs;
+      CONSTP2VAR(tpl_mcs_node, AUTOMATIC, OS_VAR) node = &(mcs->nodes[core_id]);
+
+      node->next = 0;
+      node->waiting = 0;
+      if (tpl_compare_and_swap(&(mcs->tail), 0, (uint16)(core_id + 1U)))
+      {
+        success = TRYTOGETSPINLOCK_SUCCESS;
+      }
+      break;
+    }
+    default :
+      tpl_try_to_get_lock(&(spinlock->state), &success);
+      break;
+  }
+
+  return success;
+}
+
+FUNC(void, OS_CODE) tpl_unlock_spinlock(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  CONSTP2VAR(tpl_spinlock, AUTOMATIC, OS_VAR)
+    spinlock = tpl_spinlock_table[spinlock_id];
+
+  switch (spinlock->type)
+  {
+    case SPINLOCK_TICKET :
+      /* hand the lock over to the next ticket */
+      (void)tpl_fetch_and_add(&(spinlock->ticket->now_serving), 1U);
+      break;
+    case SPINLOCK_MCS :
+    {
+      CONSTP2VAR(tpl_mcs_lock, AUTOMATIC, OS_VAR) mcs = spinlock->mcs;
+      CONSTP2VAR(tpl_mcs_node, AUTOMATIC, OS_VAR) node = &(mcs->nodes[core_id]);
+      VAR(uint16, AUTOMATIC) next = tpl_atomic_load(&(node->next));
+
+      if (next == 0)
+      {
+        /* no successor: empty the queue if this core is still its tail */
+        if (tpl_compare_and_swap(&(mcs->tail), (uint16)(core_id + 1U), 0))
+        {
+          break;
+        }
+        /* a core is queuing, wait until it is linked to this node */
+        do
+        {
+          tpl_cpu_relax();
+          next = tpl_atomic_load(&(node->next));
+        } while (next == 0);
+      }
+      /* hand the lock over to the next core */
+      (void)tpl_atomic_exchange(&(mcs->nodes[next - 1U].waiting), 0);
+      break;
+    }
+    default :
+      tpl_release_lock(&(spinlock->state));
+      break;
+  }
+}
+
 /*
  *
  */
@@ -54,7 +221,10 @@ FUNC(tpl_status, OS_CODE) tpl_get_spinlock_service(
 
   VAR(tpl_status, AUTOMATIC)  result = E_OK;
 
-  P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock = NULL_PTR;
+#if WITH_SPINLOCK_STATISTICS == YES
+  VAR(tpl_stats_time, AUTOMATIC) start_date;
+  VAR(uint32, AUTOMATIC) spins;
+#endif
 
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_GetSpinlock)
@@ -78,11 +248,15 @@ FUNC(tpl_status, OS_CODE) tpl_get_spinlock_service(
      * lock method */
     SPINLOCK_SUSPEND_INTERRUPTS(core_id, spinlock_id)
 
-    /*  get the lock descriptor                   */
-    lock = &(tpl_spinlock_table[spinlock_id]->state);
-
     /* get the lock, this call is blocking        */
-    tpl_get_lock(lock);
+#if WITH_SPINLOCK_STATISTICS == YES
+    start_date = tpl_get_stats_timer();
+    spins = tpl_lock_spinlock(core_id, spinlock_id);
+    tpl_spinlock_stats_on_get(core_id, spinlock_id, spins,
+                              tpl_get_stats_timer() - start_date);
+#else
+    (void)tpl_lock_spinlock(core_id, spinlock_id);
+#endif
 
     /* get the resscheduler if the spinlock has the associated method */
     SPINLOCK_GET_RESSCHEDULER(core_id, spinlock_id)
@@ -110,8 +284,6 @@ FUNC(tpl_status, OS_CODE) tpl_release_spinlock_service(
 
   VAR(tpl_status, AUTOMATIC)  result = E_OK;
 
-  P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock = NULL_PTR;
-
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_ReleaseSpinlock)
   STORE_SPINLOCK_ID(spinlock_id)
@@ -130,11 +302,8 @@ FUNC(tpl_status, OS_CODE) tpl_release_spinlock_service(
 
   IF_NO_EXTENDED_ERROR(result)
   {
-    /*  get the lock descriptor                   */
-    lock = &(tpl_spinlock_table[spinlock_id]->state);
-
-    /* get the lock, this call is blocking        */
-    tpl_release_lock(lock);
+    /* release the lock                           */
+    tpl_unlock_spinlock(core_id, spinlock_id);
 
     /* store id of last released spinlock, so we can check later the nesting order */
     REMOVE_LAST_TAKEN_SPINLOCK(core_id)
@@ -161,8 +330,6 @@ FUNC(tpl_status, OS_CODE) tpl_try_to_get_spinlock_service(
 
   VAR(tpl_status, AUTOMATIC)  result = E_OK;
 
-  P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock = NULL_PTR;
-
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_TryToGetSpinlock)
   STORE_SPINLOCK_ID(spinlock_id)
@@ -185,11 +352,11 @@ FUNC(tpl_status, OS_CODE) tpl_try_to_get_spinlock_service(
      * lock method */
     SPINLOCK_SUSPEND_INTERRUPTS(core_id, spinlock_id)
 
-    /*  get the lock descriptor                   */
-    lock = &(tpl_spinlock_table[spinlock_id]->state);
-
     /* get the lock, this call is not blocking        */
-    tpl_try_to_get_lock(lock, success);
+    *success = tpl_try_to_lock_spinlock(core_id, spinlock_id);
+#if WITH_SPINLOCK_STATISTICS == YES
+    tpl_spinlock_stats_on_try(core_id, spinlock_id);
+#endif
 
     if (*success == TRYTOGETSPINLOCK_SUCCESS) {
       /* get the resscheduler if the spinlock has the associated method */
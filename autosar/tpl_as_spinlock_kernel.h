@@ -30,6 +30,7 @@
 #include "tpl_os_custom_types.h"
 #include "tpl_os_timeobj_kernel.h"
 #include "tpl_os_resource.h"
+#include "tpl_as_spinlock.h"
 
 #if NUMBER_OF_CORES > 1
 
@@ -45,6 +46,67 @@
 #define LOCK_ALL_INTERRUPTS         3
 typedef uint8 tpl_lock_method;
 
+/**
+ * @typedef tpl_spinlock_type
+ *
+ * Algorithm of the lock of a spinlock (LOCKTYPE attribute).
+ * - SPINLOCK_TEST_AND_SET: the tpl_lock of the machine. The cores spin on
+ *   the same variable and the order in which they get it is not defined;
+ * - SPINLOCK_TICKET: the cores get it in the order they ask for it. They
+ *   spin on the same variable;
+ * - SPINLOCK_MCS: the cores get it in the order they ask for it. Each core
+ *   spins on its own node of the queue.
+ */
+#define SPINLOCK_TEST_AND_SET       0
+#define SPINLOCK_TICKET             1
+#define SPINLOCK_MCS                2
+typedef uint8 tpl_spinlock_type;
+
+/**
+ * @struct TPL_TICKET_LOCK
+ *
+ * State of a ticket lock. The lock is free when both tickets are equal.
+ */
+struct TPL_TICKET_LOCK {
+    VAR(uint16, TYPEDEF) next_ticket; /**< ticket given to the next core  */
+    VAR(uint16, TYPEDEF) now_serving; /**< ticket of the owner            */
+};
+
+typedef struct TPL_TICKET_LOCK tpl_ticket_lock;
+
+/**
+ * @struct TPL_MCS_NODE
+ *
+ * Node of a core in the queue of a MCS lock. Cores are numbered from 1 in
+ * the queue, 0 means no core. A node fills a cache line of the port
+ * (TPL_CACHE_LINE_SIZE in tpl_machine.h) and is word aligned, so next and
+ * waiting of two cores are never in the same line, wherever the lock is
+ * located.
+ */
+struct TPL_MCS_NODE {
+    VAR(uint16, TYPEDEF) next;    /**< next core in the queue             */
+    VAR(uint16, TYPEDEF) waiting; /**< 1 until the previous core releases
+                                       the lock                           */
+    VAR(uint32, TYPEDEF) padding[(TPL_CACHE_LINE_SIZE / sizeof(uint32)) - 1U];
+};
+
+typedef struct TPL_MCS_NODE tpl_mcs_node;
+
+/**
+ * @struct TPL_MCS_LOCK
+ *
+ * State of a MCS lock: the last core of the queue and the nodes of the
+ * cores. The lock is free when the queue is empty. tail is padded to a
+ * cache line so that it is not in the line of the first node.
+ */
+struct TPL_MCS_LOCK {
+    VAR(uint16, TYPEDEF) tail;
+    VAR(uint8, TYPEDEF) padding[TPL_CACHE_LINE_SIZE - sizeof(uint16)];
+    VAR(tpl_mcs_node, TYPEDEF) nodes[NUMBER_OF_CORES];
+};
+
+typedef struct TPL_MCS_LOCK tpl_mcs_lock;
+
 /**
  * @struct TPL_SPINLOCK
  *
@@ -52,8 +114,14 @@ typedef uint8 tpl_lock_method;
  */
 struct TPL_SPINLOCK {
     VAR(tpl_lock, TYPEDEF) state; /**< Lock state. Can be either UNLOCKED_LOCK
-                                       or LOCKED_LOCK                         */
+                                       or LOCKED_LOCK. Used by
+                                       SPINLOCK_TEST_AND_SET only          */
     CONST(tpl_lock_method, TYPEDEF) method;
+    CONST(tpl_spinlock_type, TYPEDEF) type;
+    CONSTP2VAR(tpl_ticket_lock, TYPEDEF, OS_VAR)
+        ticket;                     /**< SPINLOCK_TICKET only, NULL otherwise */
+    CONSTP2VAR(tpl_mcs_lock, TYPEDEF, OS_VAR)
+        mcs;                        /**< SPINLOCK_MCS only, NULL otherwise    */
 #if WITH_OS_EXTENDED == YES
     CONSTP2CONST(tpl_spinlock_successor_bitfield, TYPEDEF, OS_CONST)
         successors;                 /**< Array of bitfields indexed by a
@@ -72,6 +140,25 @@ struct TPL_SPINLOCK {
 typedef struct TPL_SPINLOCK tpl_spinlock;
 
 #if SPINLOCK_COUNT > 0
+#if WITH_SPINLOCK_STATISTICS == YES
+/**
+ * @struct TPL_SPINLOCK_CORE_STATS
+ *
+ * Contention statistics of the spinlocks updated by a core. They are kept
+ * out of the spinlocks, which the other cores poll, and each block starts
+ * with a cache line of padding (TPL_CACHE_LINE_SIZE in tpl_machine.h), so
+ * the counters of two cores are never in the same line.
+ */
+struct TPL_SPINLOCK_CORE_STATS {
+    VAR(uint32, TYPEDEF) padding[TPL_CACHE_LINE_SIZE / sizeof(uint32)];
+    VAR(tpl_spinlock_stats, TYPEDEF) stats[SPINLOCK_COUNT];
+};
+
+typedef struct TPL_SPINLOCK_CORE_STATS tpl_spinlock_core_stats;
+
+extern VAR(tpl_spinlock_core_stats, OS_VAR) tpl_spinlock_stats_table[NUMBER_OF_CORES];
+#endif
+
 extern CONSTP2VAR(tpl_spinlock, OS_CONST, OS_VAR) tpl_spinlock_table[SPINLOCK_COUNT];
 extern VAR(tpl_spinlock_id, OS_VAR) tpl_taken_spinlocks[NUMBER_OF_CORES][MAX_POSSESSED_SPINLOCKS];
 extern VAR(tpl_spinlock_id, OS_VAR) tpl_taken_spinlock_counter[NUMBER_OF_CORES];
@@ -112,11 +199,10 @@ extern VAR(tpl_spinlock_id, OS_VAR) tpl_taken_spinlock_counter[NUMBER_OF_CORES];
 #define RELEASE_ALL_SPINLOCKS(core_id)                                        \
     {                                                                         \
       VAR(sint32, AUTOMATIC) tmp;                                             \
-      for(tmp = 0; tmp < tpl_taken_spinlock_counter[core_id]; tmp++)          \
+      for(tmp = (sint32)tpl_taken_spinlock_counter[core_id] - 1;              \
+          tmp >= 0; tmp--)                                                    \
       {                                                                       \
-        P2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock;                              \
-        lock = &(tpl_spinlock_table[tmp]->state);                             \
-        tpl_release_lock(lock);                                               \
+        tpl_unlock_spinlock(core_id, tpl_taken_spinlocks[core_id][tmp]);      \
       }                                                                       \
       tpl_taken_spinlock_counter[core_id] = 0;                                \
     }
@@ -186,6 +272,19 @@ extern FUNC(void, OS_CODE) tpl_try_to_get_lock(
   CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
   P2VAR(tpl_try_to_get_spinlock_type, AUTOMATIC, OS_VAR) success);
 
+/**
+ * @internal
+ *
+ * Releases the lock of a spinlock taken by a core. The spinlock is not
+ * removed from the taken spinlocks of the core.
+ *
+ * @param core_id       core that took the spinlock
+ * @param spinlock_id   identifier of the spinlock
+ */
+extern FUNC(void, OS_CODE) tpl_unlock_spinlock(
+  CONST(uint16, AUTOMATIC)          core_id,
+  CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id);
+
 /**
  * Gets a Spinlock
  *
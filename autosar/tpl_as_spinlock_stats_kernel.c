@@ -0,0 +1,167 @@
+/**
+ * @file tpl_as_spinlock_stats_kernel.c
+ *
+ * @internal
+ *
+ * @section desc File description
+ *
+ * Trampoline autosar extension spinlock statistics functions
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005-2007
+ * Autosar extension is copyright (c) IRCCyN and ESEO 2007
+ * Trampoline and its Autosar extension are protected by the
+ * French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_as_spinlock_stats_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_errorhook.h"
+#include "tpl_machine_interface.h"
+#include "tpl_as_error.h"
+#include "tpl_os_error.h"
+#include "tpl_os_definitions.h"
+#include "tpl_as_definitions.h"
+
+#if WITH_MEMORY_PROTECTION == YES
+#include "tpl_os_mem_prot.h"
+#endif
+
+#if (WITH_SPINLOCK_STATISTICS == YES) && (NUMBER_OF_CORES > 1) && \
+    (SPINLOCK_COUNT > 0)
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+FUNC(void, OS_CODE) tpl_spinlock_stats_on_get(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id,
+    CONST(uint32, AUTOMATIC)          spins,
+    CONST(tpl_stats_time, AUTOMATIC)  wait)
+{
+  CONSTP2VAR(tpl_spinlock_stats, AUTOMATIC, OS_VAR)
+    stats = &(tpl_spinlock_stats_table[core_id].stats[spinlock_id]);
+
+  stats->attempt_count++;
+  stats->spin_count += spins;
+  if (wait > stats->max_wait)
+  {
+    stats->max_wait = wait;
+  }
+}
+
+FUNC(void, OS_CODE) tpl_spinlock_stats_on_try(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  tpl_spinlock_stats_table[core_id].stats[spinlock_id].attempt_count++;
+}
+
+/*
+ * The statistics of each core are only written by this core. They are
+ * summed without lock: a reading may miss the updates done meanwhile.
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_spinlock_statistics_service(
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id,
+    CONSTP2VAR(tpl_spinlock_stats, AUTOMATIC, OS_APPL_DATA) stats)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC)  result = E_OK;
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_GetSpinlockStatistics)
+  STORE_SPINLOCK_ID(spinlock_id)
+
+  /*  check a spinlock_id error                   */
+  CHECK_SPINLOCK_ID_ERROR(spinlock_id, result)
+
+  /*  check access rights */
+  CHECK_ACCESS_RIGHTS_SPINLOCK_ID(core_id, spinlock_id, result)
+
+  /* check stats is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, stats, result);
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    P2CONST(tpl_spinlock_stats, AUTOMATIC, OS_VAR) core_stats;
+    VAR(uint16, AUTOMATIC) core;
+
+    stats->attempt_count = 0;
+    stats->spin_count = 0;
+    stats->max_wait = 0;
+    for (core = 0; core < NUMBER_OF_CORES; core++)
+    {
+      core_stats = &(tpl_spinlock_stats_table[core].stats[spinlock_id]);
+      stats->attempt_count += core_stats->attempt_count;
+      stats->spin_count += core_stats->spin_count;
+      if (core_stats->max_wait > stats->max_wait)
+      {
+        stats->max_wait = core_stats->max_wait;
+      }
+    }
+  }
+
+  PROCESS_ERROR(result)
+
+  return result;
+}
+
+/*
+ * The statistics of the other cores are reset without lock: an update
+ * done meanwhile by one of them may be kept.
+ */
+FUNC(tpl_status, OS_CODE) tpl_reset_spinlock_statistics_service(
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC)  result = E_OK;
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_ResetSpinlockStatistics)
+  STORE_SPINLOCK_ID(spinlock_id)
+
+  /*  check a spinlock_id error                   */
+  CHECK_SPINLOCK_ID_ERROR(spinlock_id, result)
+
+  /*  check access rights */
+  CHECK_ACCESS_RIGHTS_SPINLOCK_ID(core_id, spinlock_id, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    P2VAR(tpl_spinlock_stats, AUTOMATIC, OS_VAR) core_stats;
+    VAR(uint16, AUTOMATIC) core;
+
+    for (core = 0; core < NUMBER_OF_CORES; core++)
+    {
+      core_stats = &(tpl_spinlock_stats_table[core].stats[spinlock_id]);
+      core_stats->attempt_count = 0;
+      core_stats->spin_count = 0;
+      core_stats->max_wait = 0;
+    }
+  }
+
+  PROCESS_ERROR(result)
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_SPINLOCK_STATISTICS && NUMBER_OF_CORES > 1 && SPINLOCK_COUNT > 0 */
+
+/* End of file tpl_as_spinlock_stats_kernel.c */
@@ -0,0 +1,102 @@
+/**
+ * @file tpl_as_spinlock_stats_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline autosar extension spinlock statistics header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005-2007
+ * Autosar extension is copyright (c) IRCCyN and ESEO 2007
+ * Trampoline and its Autosar extension are protected by the
+ * French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+#ifndef TPL_AS_SPINLOCK_STATS_KERNEL_H
+#define TPL_AS_SPINLOCK_STATS_KERNEL_H
+
+#include "tpl_as_spinlock_kernel.h"
+
+#if (WITH_SPINLOCK_STATISTICS == YES) && (NUMBER_OF_CORES > 1) && \
+    (SPINLOCK_COUNT > 0)
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Called by GetSpinlock once the lock is taken
+ *
+ * @param core_id       calling core
+ * @param spinlock_id   identifier of the spinlock
+ * @param spins         iterations of the wait loop
+ * @param wait          time spent to take the lock
+ */
+FUNC(void, OS_CODE) tpl_spinlock_stats_on_get(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id,
+    CONST(uint32, AUTOMATIC)          spins,
+    CONST(tpl_stats_time, AUTOMATIC)  wait);
+
+/**
+ * @internal
+ *
+ * Called by TryToGetSpinlock, whether the lock is taken or not
+ *
+ * @param core_id       calling core
+ * @param spinlock_id   identifier of the spinlock
+ */
+FUNC(void, OS_CODE) tpl_spinlock_stats_on_try(
+    CONST(uint16, AUTOMATIC)          core_id,
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id);
+
+/**
+ * Gives the contention statistics of a spinlock, for all the cores
+ *
+ * @param spinlock_id   identifier of the spinlock
+ * @param stats         reference of the variable where the statistics
+ *                      of the spinlock will be stored
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_ID     (extended error only) spinlock_id is invalid
+ * @retval  E_OS_ACCESS (extended error only) the spinlock cannot be
+ *                      accessed by the caller
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_spinlock_statistics_service(
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id,
+    CONSTP2VAR(tpl_spinlock_stats, AUTOMATIC, OS_APPL_DATA) stats);
+
+/**
+ * Resets the contention statistics of a spinlock
+ *
+ * @param spinlock_id   identifier of the spinlock
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_ID     (extended error only) spinlock_id is invalid
+ * @retval  E_OS_ACCESS (extended error only) the spinlock cannot be
+ *                      accessed by the caller
+ */
+FUNC(tpl_status, OS_CODE) tpl_reset_spinlock_statistics_service(
+    CONST(tpl_spinlock_id, AUTOMATIC) spinlock_id);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_SPINLOCK_STATISTICS && NUMBER_OF_CORES > 1 && SPINLOCK_COUNT > 0 */
+
+/* TPL_AS_SPINLOCK_STATS_KERNEL_H */
+#endif
+
+/* End of file tpl_as_spinlock_stats_kernel.h */
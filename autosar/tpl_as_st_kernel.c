@@ -40,15 +40,6 @@
 #endif /* WITH_MEMORY_PROTECTION == YES */
 
 
-#define OS_START_SEC_CODE
-#include "tpl_memmap.h"
-
-FUNC(tpl_tick, OS_CODE) tpl_min(
-   VAR(tpl_tick, AUTOMATIC) var_1,
-   VAR(tpl_tick, AUTOMATIC) var_2);
-#define OS_STOP_SEC_CODE
-#include "tpl_memmap.h"
-
 #define OS_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -65,24 +56,7 @@ CONST(tpl_schedtable_id, AUTOMATIC) INVALID_SCHEDULETABLE = SCHEDTABLE_COUNT;
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
-FUNC(tpl_tick, OS_CODE) tpl_min(
-   VAR(tpl_tick, AUTOMATIC) var_1,
-   VAR(tpl_tick, AUTOMATIC) var_2)
-{
-  VAR(tpl_tick, AUTOMATIC) return_value;
-
-  if(var_1 > var_2)
-  {
-    return_value = var_2;
-  }
-  else
-  {
-    return_value = var_1;
-  }
-  return return_value;
-}
-
-FUNC(void, OS_CODE) tpl_adjust_next_expiry_point(
+FUNC(sint32, OS_CODE) tpl_adjust_next_expiry_point(
 					P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) st,
 					VAR(tpl_expiry_count, AUTOMATIC) index,
 					VAR(tpl_bool, AUTOMATIC) last_expiry_point
@@ -95,70 +69,69 @@ FUNC(void, OS_CODE) tpl_adjust_next_expiry_point(
    */
   P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA) schedtable =
     (P2VAR(tpl_schedtable_static, AUTOMATIC, OS_APPL_DATA))st->stat_part;
-	
-  P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) next_ep;
-	
-  VAR(sint32, AUTOMATIC) deviation =
-    ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation;
-	
-  VAR(tpl_tick, AUTOMATIC) adjustment;
-  
-  /* if last expiry point */
+
+  P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA) table =
+    (P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st;
+
+  P2CONST(tpl_expiry_point, AUTOMATIC, OS_CONST) next_ep;
+
+  VAR(sint32, AUTOMATIC) deviation = table->deviation;
+
+  VAR(sint32, AUTOMATIC) adjustment;
+
+  /*
+   * Get the next expiry point. If last expiry point, this is the first one
+   * of the next period.
+   */
   if ( last_expiry_point == TRUE )
   {
-    /* Get the next expiry point */
-    next_ep = (schedtable->expiry)[0];
-    
-    /* Adjust it according to deviation */
-    if ( deviation <= 0 )
+    next_ep = &(schedtable->expiry[0]);
+  }
+  else
+  {
+    next_ep = &(schedtable->expiry[index+1]);
+  }
+
+  /* Adjust it according to deviation, within the bounds of the expiry point */
+  if ( deviation <= 0 )
+  {
+    adjustment = -deviation;
+    if ( adjustment > (sint32)(next_ep->max_retard) )
     {
-      adjustment = tpl_min(~(deviation - 1), (next_ep->max_retard));
-			
-      /* if adjustment > first.delay, adjust final.delay*/
-      if ( adjustment > next_ep->sync_offset)
-      {
-        (schedtable->expiry)[schedtable->count-1]->sync_offset -=
-          (adjustment - next_ep->sync_offset);
-        next_ep->sync_offset = 0;
-      }
-      else
-      {
-        next_ep->sync_offset -= adjustment;
-      }
-      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation +=
-        adjustment;
+      adjustment = (sint32)(next_ep->max_retard);
     }
-    else
+    table->deviation += adjustment;
+    adjustment = -adjustment;
+  }
+  else
+  {
+    adjustment = deviation;
+    if ( adjustment > (sint32)(next_ep->max_advance) )
     {
-      adjustment = tpl_min(deviation, (next_ep->max_advance));
-      next_ep->sync_offset += adjustment;
-      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation -=
-        adjustment;			 
+      adjustment = (sint32)(next_ep->max_advance);
     }
+    table->deviation -= adjustment;
   }
-  else
-  /* if not last expiry point */
+
+  if ( last_expiry_point == TRUE )
   {
-    
-    /* Get the next expiry point */
-    next_ep = (schedtable->expiry)[index+1];
-    
-    /* Adjust it according to deviation */
-    if ( deviation <= 0 )
+    /*
+     * The first expiry point is adjusted when the next period starts.
+     * if adjustment > first.delay, adjust final.delay now
+     */
+    if ( (-adjustment) > (sint32)(next_ep->offset) )
     {
-      adjustment = tpl_min(~(deviation - 1), (next_ep->max_retard));
-      next_ep->sync_offset -= adjustment;
-      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation +=
-        adjustment;
+      table->first_adjustment = -(sint32)(next_ep->offset);
+      adjustment += (sint32)(next_ep->offset);
     }
     else
     {
-      adjustment = tpl_min(deviation, (next_ep->max_advance));
-      next_ep->sync_offset += adjustment;
-      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation -=
-        adjustment;			 
+      table->first_adjustment = adjustment;
+      adjustment = 0;
     }
   }
+
+  return adjustment;
 }
 
 
@@ -194,8 +167,11 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
 	VAR(tpl_expiry_count, AUTOMATIC)  index_temp = index;
 	
   /*  Get the current expiry point                                        */
-  P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) current_ep =
-  	(schedtable->expiry)[index];
+  P2CONST(tpl_expiry_point, AUTOMATIC, OS_CONST) current_ep =
+  	&(schedtable->expiry[index]);
+
+  /*  Adjustment of the next expiry point for synchronization             */
+  VAR(sint32, AUTOMATIC) adjustment = 0;
 
   P2CONST(tpl_action, AUTOMATIC, OS_APPL_DATA)  action_desc;
   VAR(tpl_action_count, AUTOMATIC)  i;
@@ -211,12 +187,6 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
 	
   index = ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index;
 	
-  /*
-   * reset the offset of last expiry point to its default value, because
-   * adjustment for synchronisation of this expiry point has been done
-   */
-  (schedtable->expiry)[index_temp]->sync_offset = (schedtable->expiry)[index_temp]->offset;
-  
   /*if finalize expiry point and if repeating st hasn't got offset at 0 */
   if ( (index_temp == (schedtable->count - 1)) && ((schedtable->periodic == FALSE) || (next != NULL)))
   {
@@ -262,7 +232,7 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
           ((st->state & SCHEDULETABLE_ASYNC) != SCHEDULETABLE_ASYNC) &&
           (abs_deviation > (schedtable->precision)))
       {
-        tpl_adjust_next_expiry_point(
+        adjustment = tpl_adjust_next_expiry_point(
           st,
           index, 
           (( (index == (schedtable->count - 2)) ) &&
@@ -274,6 +244,14 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
     
     /*  Prepare the next expiry point                                       */
     index++;
+    if (index == 0)
+    {
+      /*  a new period starts, get the adjustment of its first expiry point */
+      adjustment = ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)
+        ->first_adjustment;
+      ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)
+        ->first_adjustment = 0;
+    }
     /*
      * The schedule table is not finished
      * Set the next cycle to the offset of the next expiry point
@@ -284,8 +262,8 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
      * This cast behaves correctly because the first member of
      * tpl_schedule_table is a tpl_time_obj
      */
-    st->cycle = (schedtable->expiry)[index]->sync_offset;
-    ((tpl_schedule_table *)st)->index = index;
+    st->cycle = schedtable->expiry[index].offset + (tpl_tick)adjustment;
+    ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index = index;
 	}
 }
 
@@ -324,7 +302,7 @@ FUNC(tpl_status, OS_CODE)  tpl_start_schedule_table_rel(
        if EXPLICIT, state = RUNNING and ASYNC  */
     st->b_desc.state = SCHEDULETABLE_RUNNING | SCHEDULETABLE_ASYNC;
 
-    date = cnt->current_date + offset + (schedtable->expiry[0])->offset;
+    date = cnt->current_date + offset + schedtable->expiry[0].offset;
 
     /* if date > max_allowed_value, take the modulus */
     if (date > cnt->max_allowed_value)
@@ -433,9 +411,9 @@ FUNC(tpl_status, OS_CODE)  tpl_start_schedule_table_abs(
       st->b_desc.state = SCHEDULETABLE_RUNNING | SCHEDULETABLE_ASYNC;
     }
 
-    date = (tick_val + (schedtable->expiry[0])->offset);
+    date = (tick_val + schedtable->expiry[0].offset);
 
-    /*printf("startstabs - tick_val=%d - (schedtable->expiry[0])->offset=%d - cnt->max_allowed_value=%d - cnt->current_date=%d\n",tick_val,(schedtable->expiry[0])->offset,cnt->max_allowed_value,cnt->current_date);*/
+    /*printf("startstabs - tick_val=%d - schedtable->expiry[0].offset=%d - cnt->max_allowed_value=%d - cnt->current_date=%d\n",tick_val,schedtable->expiry[0].offset,cnt->max_allowed_value,cnt->current_date);*/
     /* if <tick_val> is after current_date and first expiry point comes between current_date and <tick_val>
       or if <tick_val> is before current_date and first expiry point comes after current_date
       so, bootstrap is needed */
@@ -561,6 +539,7 @@ FUNC(tpl_status, OS_CODE) tpl_stop_schedule_table_service(
       tpl_remove_time_obj((tpl_time_obj *)st);
       st->b_desc.state = SCHEDULETABLE_STOPPED;
       st->index = 0; /* reset the expiry point index to 0 */
+      st->first_adjustment = 0;
     }
     else
     {
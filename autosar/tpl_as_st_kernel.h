@@ -44,20 +44,12 @@ typedef enum
 typedef VAR(uint16, TYPEDEF) tpl_action_count ;
 typedef VAR(uint16, TYPEDEF) tpl_expiry_count ;
 
-/**
- *
- * This returns the min of 2 values provided
- *
- */
-FUNC(tpl_tick, OS_CODE) tpl_min(
-	VAR(tpl_tick, AUTOMATIC) var_1,
-	VAR(tpl_tick, AUTOMATIC) var_2);
-
 /*
  * @def tpl_adjust_next_expiry_point
  *
- * tpl_adjust_next_expiry_point adjusts the next expiry point
- * of a schedule table, depending on its deviation.
+ * tpl_adjust_next_expiry_point computes the adjustment of the next expiry
+ * point of a schedule table, depending on its deviation, and updates the
+ * deviation accordingly.
  *
  * @param st schedule table's pointer
  * @param index index of the current expiry point
@@ -66,8 +58,10 @@ FUNC(tpl_tick, OS_CODE) tpl_min(
  * last one, the adjustment have to be done to the first one
  * of the next period of the schedule table).
  *
+ * @return the adjustment (in ticks) to add to the delay of the next
+ * expiry point
  */
-FUNC(void, OS_CODE) tpl_adjust_next_expiry_point(
+FUNC(sint32, OS_CODE) tpl_adjust_next_expiry_point(
 	 P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) st,
 	 VAR(tpl_expiry_count, AUTOMATIC) index,
 	 VAR(tpl_bool, AUTOMATIC) last_expiry_point
@@ -88,21 +82,23 @@ struct TPL_SCHEDTABLE_SYNC {
  * @struct TPL_EXPIRY_POINT
  *
  * This structure put together a time offset, the number of actions
- * associated with the expiry point and a pointer to an array
- * of actions to be done at that time offset for a schedule table.
+ * associated with the expiry point and a pointer to the actions
+ * to be done at that time offset for a schedule table.
  *
- * The offset of the first expiry point of a schedule table is the
- * period of the schedule table.
+ * The expiry points of a schedule table are stored in a constant array
+ * and the actions of all its expiry points in another one, both
+ * generated by goil. The offset of the first expiry point of a schedule
+ * table is the period of the schedule table.
  */
 struct TPL_EXPIRY_POINT {
-    VAR(tpl_tick, TYPEDEF)                     offset;     /**< offset of the actions recalculated
-                                                               for synchronization                */
-    VAR(tpl_tick, TYPEDEF)                     sync_offset;/**< offset of the actions from the
+    VAR(tpl_tick, TYPEDEF)                     offset;     /**< offset of the actions from the
+                                                               previous expiry point              */
+    VAR(tpl_tick, TYPEDEF)                     table_offset;/**< offset of the actions from the
                                                                start time of the schedule table   */
     VAR(tpl_action_count, TYPEDEF)             count;      /**< number of actions associated with
                                                                the expiry point                   */
-    P2CONST(tpl_action, TYPEDEF, OS_APPL_DATA) *actions;    /**< pointer to an array of actions to
-                                                               be done at that offset.            */
+    CONSTP2CONST(tpl_action, TYPEDEF, OS_CONST) *actions;  /**< pointer to the actions to be done
+                                                               at that offset.                    */
     VAR(tpl_tick, TYPEDEF)                     max_advance;/**< maximum advance deviation from
                                                                initial offset of expiry point
                                                                after synchronization              */
@@ -137,6 +133,10 @@ struct TPL_SCHEDULE_TABLE {
                                                                              table                      */
 	VAR(sint32, TYPEDEF)										deviation;                	/**< deviation of the schedule
 																			                                       table from counter synchro */
+  VAR(sint32, TYPEDEF)                                    first_adjustment; /**< adjustment of the
+                                                                             first expiry point in the
+                                                                             next period of the
+                                                                             schedule table             */
 };
 
 /**
@@ -163,7 +163,7 @@ typedef struct TPL_SCHEDULE_TABLE tpl_schedule_table;
 struct TPL_SCHEDTABLE_STATIC {
     VAR(tpl_time_obj_static, TYPEDEF)                b_desc;     /**< common part of all objects that
                                                                      derive from tpl_time_obj.          */
-    P2VAR(tpl_expiry_point, TYPEDEF, OS_APPL_DATA)   *expiry;     /**< pointer to an array of expiry
+    P2CONST(tpl_expiry_point, TYPEDEF, OS_CONST)     expiry;     /**< pointer to an array of expiry
                                                                      points                             */
     VAR(tpl_expiry_count, TYPEDEF)                   count;      /**< number of expiry points in the
                                                                      schedule table                     */
@@ -225,19 +225,18 @@ extern CONSTP2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA)
  * point and execute the corresponding actions. Then the alarm is updated to
  * match the offset of the next expiry point.
  *
- * For adjustable schedule table, if the actual expiry point is the finalize one,
- * the sync_offset has to be restored.
- *
- * Otherwise, first change the state of the
+ * If the schedule table goes on, first change the state of the
  * schedule table, depending to Duration. If EXPLICIT, RUNNING_AND_SYNCHRONOUS,
  * if IMPLICIT, non-synchronised schedule table or asynchronous schedule table,
  * RUNNING.
  * Next, if actual expiry point is the last one, adjust the first expiry point
- * (next one), if repeating schedule table (careful to the adjustment, if superior
- * to first.delay, adjust the finalize expiry point too), otherwise (next and
+ * (next one), if repeating schedule table (the adjustment is kept in
+ * first_adjustment and, if superior to first.delay, the finalize expiry point
+ * is adjusted too), otherwise (next and
  * single shot), place the finalize expiry point in the queue. Otherwise (not last
  * expiry point), adjust the next expiry point.
- * Increment index and store it and store cycle.
+ * Increment index and store it and store cycle. The cycle is the offset of
+ * the next expiry point plus its adjustment.
  *
  */
 extern FUNC(void, OS_CODE) tpl_process_schedtable(
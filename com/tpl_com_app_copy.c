@@ -141,6 +141,114 @@ FUNC(tpl_status, OS_CODE) tpl_copy_from_queued(
   return result;
 }
 
+/*!
+ *  \brief  Copy a message from an unqueued message object of a zero copy
+ *          sending message object to an application data.
+ *
+ *  The message is copied from the slot of the pool the unqueued
+ *  receiving message object refers to.
+ *
+ *  @param  rmo     a pointer to the receiving message object that refers
+ *                  to the message to be copied.
+ *  @param  data    a pointer to the application data where the message
+ *                  will be copied.
+ *  @return         the status code. Since this function cannot fail (provided
+ *                  the parameters are ok), it is always E_OK.
+ */
+FUNC(tpl_status, OS_CODE) tpl_copy_from_shared_unqueued(
+  P2VAR(tpl_com_data, AUTOMATIC, OS_APPL_DATA)  data,
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo)
+{
+  CONSTP2CONST(tpl_internal_receiving_shared_unqueued_mo, AUTOMATIC, OS_CONST)
+  rum = rmo;
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool = rum->pool;
+
+  /*  get the slot of the current message                                 */
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR) p =
+    TPL_COM_POOL_SLOT(pool, *rum->slot);
+
+  VAR(uint32, AUTOMATIC) size = pool->element_size;
+  while (size-- > 0) {
+    *data++ = *p++;
+  }
+
+  return E_OK;
+}
+
+/*!
+ *  \brief  Copy a message from a queued message object of a zero copy
+ *          sending message object to an application data.
+ *
+ *  The queue stores slot indexes. The message is copied from the slot
+ *  at the head of the queue and the reference of the queue to the slot
+ *  is released.
+ *
+ *  @param  rmo     a pointer to the receiving message object that store
+ *                  the message to be copied.
+ *  @param  data    a pointer to the application data where the message
+ *                  will be copied.
+ *  @return         the status code, see tpl_copy_from_queued.
+ */
+FUNC(tpl_status, OS_CODE) tpl_copy_from_shared_queued(
+  P2VAR(tpl_com_data, AUTOMATIC, OS_APPL_DATA)  data,
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo)
+{
+  /*  Default result status to E_OK                                       */
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  CONSTP2CONST(tpl_internal_receiving_shared_queued_mo, AUTOMATIC, OS_CONST)
+  rqm = rmo;
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool = rqm->pool;
+  CONSTP2CONST(tpl_queue, AUTOMATIC, OS_CONST) queue = &(rqm->queue);
+
+  /*  Get the queue dynamic descriptor                                    */
+  CONSTP2VAR(struct TPL_QUEUE_DYNAMIC, AUTOMATIC, OS_VAR)
+  dq = queue->dyn_desc;
+
+  /*  Get a pointer to the slot index at the head of the queue            */
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)
+  e = tpl_queue_element_for_read(queue);
+
+  if (e != NULL)
+  {
+      CONST(tpl_com_slot, AUTOMATIC) slot = *((const tpl_com_slot *)e);
+      P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)
+      p = TPL_COM_POOL_SLOT(pool, slot);
+      VAR(uint32, AUTOMATIC) size = pool->element_size;
+
+      while (size-- > 0)
+      {
+          *data++ = *p++;
+      }
+
+      /*  the queue does not refer to the slot anymore  */
+      pool->ref_count[slot]--;
+
+      /*  dec the queue size  */
+      dq->size -= queue->element_size;
+      /*   adjust the index   */
+      dq->index += queue->element_size;
+
+      if (dq->index >= queue->max_size)
+      {
+          dq->index = 0;
+      }
+
+  /* if an overflow occured in the previous sent message */
+      if (dq->overflow)
+      {
+          dq->overflow = FALSE;
+          result =  E_COM_LIMIT;
+      }
+  }
+  else
+  {
+      result = E_COM_NOMSG;
+  }
+
+  return result;
+}
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -29,5 +29,13 @@ tpl_status tpl_copy_from_queued(P2VAR(tpl_com_data, AUTOMATIC, OS_APPL_DATA)
                                     data,
                                 CONSTP2CONST(void, AUTOMATIC, OS_CONST) rmo);
 
+FUNC(tpl_status, OS_CODE)
+tpl_copy_from_shared_unqueued(P2VAR(tpl_com_data, AUTOMATIC, OS_APPL_DATA) data,
+                              CONSTP2CONST(void, AUTOMATIC, OS_CONST) rmo);
+
+FUNC(tpl_status, OS_CODE)
+tpl_copy_from_shared_queued(P2VAR(tpl_com_data, AUTOMATIC, OS_APPL_DATA) data,
+                            CONSTP2CONST(void, AUTOMATIC, OS_CONST) rmo);
+
 #endif
 /*  __TPL_COM_APP_COPY_H__   */
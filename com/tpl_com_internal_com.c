@@ -85,6 +85,27 @@ FUNC(tpl_status, OS_CODE) tpl_send_static_internal_message(
   return result;
 }
 
+/*
+ * tpl_send_shared_internal_message sends a message from a zero copy
+ * internal sending message object. The message is copied once in a slot
+ * of the pool of the message object and the receivers get the slot.
+ * this function is attached to the sending message object.
+ */
+FUNC(tpl_status, OS_CODE) tpl_send_shared_internal_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
+{
+  /*  cast the base mo to the correct type of mo                          */
+  CONSTP2CONST(tpl_internal_sending_shared_mo, AUTOMATIC, OS_CONST)
+  ssmo = smo;
+
+  /*  the receivers are walked like for a static internal message, they
+      take a reference to the slot instead of copying the data            */
+  return tpl_send_static_internal_message(
+    &(ssmo->base_mo),
+    tpl_com_pool_write(ssmo->pool, data));
+}
+
 /*
  * tpl_send_zero_internal_message sends a 0 length message from an internal
  * only sending message object to a set of internal receiving message objects.
@@ -210,6 +231,92 @@ FUNC(tpl_status, OS_CODE) tpl_receive_static_internal_queued_message(
 	return result;
 }
 
+/*
+ * tpl_receive_shared_internal_unqueued_message gets a message from a slot
+ * of the pool of a zero copy sending message object. The unqueued message
+ * object refers to the slot instead of storing a copy of the message.
+ * This function is attached to the receiving message object.
+ */
+FUNC(tpl_status, OS_CODE) tpl_receive_shared_internal_unqueued_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   rmo,
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)  data)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_COM_FILTEREDOUT;
+
+  /*  cast the base receiving mo to the correct type of mo                */
+  CONSTP2CONST(tpl_internal_receiving_shared_unqueued_mo, AUTOMATIC, OS_CONST)
+  rum = rmo;
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool = rum->pool;
+
+  /*  reception filtering                                                 */
+  if (tpl_filtering(
+    TPL_COM_POOL_SLOT(pool, *rum->slot),
+    data,
+    rum->base_mo.filter))
+  {
+    result = E_OK;
+    /*  refer to the slot of the new message                              */
+    tpl_com_pool_set(pool, rum->slot, TPL_COM_POOL_SLOT_OF(pool, data));
+  }
+
+  return result;
+}
+
+/*!
+ * tpl_receive_shared_internal_queued_message gets a message from a slot
+ * of the pool of a zero copy sending message object and puts the index
+ * of the slot in the queue of the queued message object.
+ * This function is attached to the receiving message object.
+ */
+FUNC(tpl_status, OS_CODE) tpl_receive_shared_internal_queued_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   rmo,
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)  data)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_COM_FILTEREDOUT;
+  /* cast the base receiving mo to the correct type of mo */
+  CONSTP2CONST(tpl_internal_receiving_shared_queued_mo, AUTOMATIC, OS_CONST)
+  rqm = rmo;
+  /* get the queue */
+  CONSTP2CONST(tpl_queue, AUTOMATIC, OS_CONST) rq = &(rqm->queue);
+  /* get the dynamic part of the queue */
+  CONSTP2VAR(tpl_queue_dyn, AUTOMATIC, OS_VAR) dq = rq->dyn_desc;
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool = rqm->pool;
+  /* get the slot of the last value */
+  CONSTP2VAR(tpl_com_slot, AUTOMATIC, OS_VAR) last =
+    (tpl_com_slot *)rq->last;
+
+  /*
+   * filter the message
+   */
+  if (tpl_filtering(
+    TPL_COM_POOL_SLOT(pool, *last),
+    data,
+    rqm->base_mo.filter))
+  {
+    /* destination element of the queue */
+    P2VAR(tpl_com_data, AUTOMATIC, OS_VAR) dst = NULL;
+    CONST(tpl_com_slot, AUTOMATIC) slot = TPL_COM_POOL_SLOT_OF(pool, data);
+    result = E_OK;
+    /* get the element to perform the write */
+    dst = tpl_queue_element_for_write(rq);
+    if (dst != NULL)
+    {
+      /* the queue and the last value both refer to the slot */
+      tpl_com_pool_set(pool, last, slot);
+      *((tpl_com_slot *)dst) = slot;
+      pool->ref_count[slot]++;
+
+      /* update the current size of the queue */
+      dq->size += rq->element_size;
+    }
+    else
+    {
+      dq->overflow = TRUE;
+    }
+  }
+  return result;
+}
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -39,6 +39,18 @@ FUNC(tpl_status, OS_CODE) tpl_receive_static_internal_queued_message(
   CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
   CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
+FUNC(tpl_status, OS_CODE) tpl_send_shared_internal_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
+
+FUNC(tpl_status, OS_CODE) tpl_receive_shared_internal_unqueued_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
+
+FUNC(tpl_status, OS_CODE) tpl_receive_shared_internal_queued_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -43,6 +43,7 @@
 /*#if COM_EXTENDED == YES*/
 #include "tpl_com_internal_com.h"
 /*#endif*/
+#include "tpl_com_app_copy.h"
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
@@ -81,10 +82,19 @@ FUNC(tpl_status, OS_CODE) tpl_get_message_status_service(
     {
 		/*  get the message object from its id			*/          
 		rmo = (tpl_data_receiving_mo *)tpl_receive_message_table[mess_id];
-		queue = &((tpl_internal_receiving_queued_mo *)rmo)->queue;
 		
-		/* if message queued							*/
-		if( queue->element_size != 0 )
+		/* if message queued. The copier tells the kind of the message
+		   object since the zero copy one has another layout			*/
+		if (rmo->copier == tpl_copy_from_queued)
+		{
+			queue = &((tpl_internal_receiving_queued_mo *)rmo)->queue;
+		}
+		else if (rmo->copier == tpl_copy_from_shared_queued)
+		{
+			queue = &((tpl_internal_receiving_shared_queued_mo *)rmo)->queue;
+		}
+		
+		if (queue != NULL)
 		{
 			struct TPL_QUEUE_DYNAMIC    *dq = queue->dyn_desc;
 			tpl_com_data    *p = tpl_queue_element_for_read(queue);
@@ -19,6 +19,7 @@
 #include "tpl_com_base_mo.h"
 #include "tpl_com_queue.h"
 #include "tpl_com_buffer.h"
+#include "tpl_com_pool.h"
 #include "tpl_com_net_messages.h"
 
 /*
@@ -35,6 +36,20 @@ typedef struct TPL_INTERNAL_SENDING_MO tpl_internal_sending_mo;
 
 typedef tpl_internal_sending_mo tpl_internal_sending_zero_mo;
 
+/*
+ * tpl_internal_sending_shared_mo is an internal only sending message
+ * object that writes the message once in a pool shared by its receivers
+ * (zero copy).
+ */
+struct TPL_INTERNAL_SENDING_SHARED_MO {
+  /*  common to the internal sending mo                   */
+  tpl_internal_sending_mo         base_mo;
+  /*  pool of the message slots                           */
+  const tpl_com_pool              *pool;
+};
+
+typedef struct TPL_INTERNAL_SENDING_SHARED_MO tpl_internal_sending_shared_mo;
+
 /*!
  *  \struct tpl_internal_receiving_zero_mo
  *
@@ -93,5 +108,48 @@ typedef struct TPL_RECEIVING_QUEUED_MO
 typedef struct TPL_RECEIVING_QUEUED_MO
     tpl_internal_receiving_queued_mo;
 
+/*!
+ *  \struct TPL_RECEIVING_SHARED_UNQUEUED_MO
+ *
+ *  \brief  Structure for internal communication unqueued receiving
+ *          message objects of a zero copy sending message object
+ *
+ *  The message is not copied in the receiving message object, which
+ *  keeps the index of the slot of the pool that stores the message.
+ */
+struct TPL_RECEIVING_SHARED_UNQUEUED_MO {
+    /*! common part of the data receiving message objects       */
+    tpl_data_receiving_mo   base_mo;
+    /*! pool of the sending message object                      */
+    const tpl_com_pool      *pool;
+    /*! slot of the current message                             */
+    tpl_com_slot            *slot;
+};
+
+typedef struct TPL_RECEIVING_SHARED_UNQUEUED_MO
+    tpl_internal_receiving_shared_unqueued_mo;
+
+/*!
+ *  \struct TPL_RECEIVING_SHARED_QUEUED_MO
+ *
+ *  \brief  Structure for internal communication queued receiving
+ *          message objects of a zero copy sending message object
+ *
+ *  The queue stores the indexes of the slots of the pool that store the
+ *  messages. The last member of the queue points to the index of the
+ *  slot of the last message, used for filtering.
+ */
+struct TPL_RECEIVING_SHARED_QUEUED_MO {
+    /*! common part of the data receiving message objects       */
+    tpl_data_receiving_mo   base_mo;
+    /*! queue of slot indexes                                   */
+    tpl_queue               queue;
+    /*! pool of the sending message object                      */
+    const tpl_com_pool      *pool;
+};
+
+typedef struct TPL_RECEIVING_SHARED_QUEUED_MO
+    tpl_internal_receiving_shared_queued_mo;
+
 #endif
 /*  TPL_COM_MO_H    */
@@ -0,0 +1,89 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline Communication shared buffer pool implementation
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os_definitions.h"
+#include "tpl_com_definitions.h"
+#include "tpl_com_pool.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+/*!
+ *  \brief  Get a free slot of a pool and copy a message in it
+ *
+ *  The slot is returned with a reference counter of 0. It is freed
+ *  again by the next call if no receiver takes a reference to it.
+ *
+ *  @param  pool    pointer to the pool
+ *  @param  data    pointer to the message
+ *
+ *  @return         a pointer to the slot
+ */
+FUNC(tpl_com_data, OS_CODE) *tpl_com_pool_write(
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool,
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)        data)
+{
+  VAR(tpl_com_slot, AUTOMATIC)            slot = *pool->next;
+  VAR(uint32, AUTOMATIC)                  size = pool->element_size;
+  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)  p;
+  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)  dst;
+
+  /*  look for a free slot. There is always one since the pool has one
+      slot more than the maximum number of references                 */
+  while (pool->ref_count[slot] != 0)
+  {
+    slot++;
+    if (slot == pool->slot_count)
+    {
+      slot = 0;
+    }
+  }
+
+  /*  the next allocation starts after this slot, so that the slot
+      that was just freed by a receiver is not reused immediately     */
+  *pool->next = (tpl_com_slot)((slot + 1U == pool->slot_count) ? 0 : slot + 1U);
+
+  /*  copy the message                                                */
+  p = TPL_COM_POOL_SLOT(pool, slot);
+  dst = p;
+  while (size-- > 0)
+  {
+    *dst++ = *data++;
+  }
+
+  return p;
+}
+
+/*!
+ *  \brief  Replace the slot referenced by a receiver
+ *
+ *  @param  pool    pointer to the pool
+ *  @param  ref     pointer to the slot index kept by the receiver
+ *  @param  slot    index of the new slot
+ */
+FUNC(void, OS_CODE) tpl_com_pool_set(
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool,
+  CONSTP2VAR(tpl_com_slot, AUTOMATIC, OS_VAR)     ref,
+  CONST(tpl_com_slot, AUTOMATIC)                  slot)
+{
+  pool->ref_count[slot]++;
+  pool->ref_count[*ref]--;
+  *ref = slot;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_com_pool.c */
@@ -0,0 +1,86 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline Communication shared buffer pool header
+ *
+ * $Date$ - $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_COM_POOL_H
+#define TPL_COM_POOL_H
+
+#include "tpl_com_private_types.h"
+#include "tpl_com_base_mo.h"
+
+/*!
+ *  Index of a slot in a pool
+ */
+typedef uint16 tpl_com_slot;
+
+/*!
+ *  \brief  Pool of message slots shared by the receivers of a zero copy
+ *          sending message object
+ *
+ *  A message is written once in a free slot of the pool of its sending
+ *  message object. The receiving message objects keep the index of the
+ *  slots they refer to instead of a copy of the message. A slot is not
+ *  modified while it is referenced and it is free again when its
+ *  reference counter drops to 0. goil sizes the pool so that a free slot
+ *  always exists when a message is sent.
+ */
+struct TPL_COM_POOL {
+  /*! pointer to the slots                                            */
+  tpl_com_data            *buffer;
+  /*! reference counters of the slots                                 */
+  tpl_com_slot            *ref_count;
+  /*! first slot to look at for the next allocation                   */
+  tpl_com_slot            *next;
+  /*! size of a slot (size of the message)                            */
+  uint32                  element_size;
+  /*! number of slots                                                 */
+  tpl_com_slot            slot_count;
+};
+
+typedef struct TPL_COM_POOL tpl_com_pool;
+
+/*!
+ *  Pointer to the data of a slot
+ */
+#define TPL_COM_POOL_SLOT(pool, slot)                                          \
+  ((pool)->buffer + ((uint32)(slot) * (pool)->element_size))
+
+/*!
+ *  Index of the slot that contains a data
+ */
+#define TPL_COM_POOL_SLOT_OF(pool, data)                                       \
+  ((tpl_com_slot)((uint32)((data) - (pool)->buffer) / (pool)->element_size))
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+/*
+ *  Get a free slot of the pool and copy the message in it
+ */
+FUNC(tpl_com_data, OS_CODE) *tpl_com_pool_write(
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool,
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)        data);
+
+/*
+ *  Replace the slot referenced by ref by slot
+ */
+FUNC(void, OS_CODE) tpl_com_pool_set(
+  CONSTP2CONST(tpl_com_pool, AUTOMATIC, OS_CONST) pool,
+  CONSTP2VAR(tpl_com_slot, AUTOMATIC, OS_VAR)     ref,
+  CONST(tpl_com_slot, AUTOMATIC)                  slot);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif
+/* TPL_COM_POOL_H */
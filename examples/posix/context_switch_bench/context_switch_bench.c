@@ -0,0 +1,82 @@
+/*
+ * Context switch benchmark.
+ *
+ * The pong task has the highest priority and waits for the wake event.
+ * The ping task sets the event ROUNDS times: each SetEvent switches to
+ * pong, which clears the event and waits again, switching back to ping.
+ * A round is a SetEvent and a WaitEvent, each with a context switch.
+ *
+ * The mean cost of a round and of a context switch (half a round) are
+ * printed, in cycles on x86 (rdtsc), in ticks of the virtual counter on
+ * aarch64 and in nanoseconds elsewhere.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "tpl_os.h"
+
+#if WITH_POSIX_FAST_CONTEXT == YES
+#define CONTEXT_SWITCH_NAME "fast"
+#else
+#define CONTEXT_SWITCH_NAME "setjmp/longjmp"
+#endif
+
+#define ROUNDS 100000
+
+static uint64_t bench_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+DeclareTask(ping);
+DeclareTask(pong);
+DeclareEvent(wake);
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(ping)
+{
+  unsigned int round;
+  uint64_t cost;
+  uint64_t start = bench_now();
+
+  for (round = 0; round < ROUNDS; round++)
+  {
+    SetEvent(pong, wake);
+  }
+  cost = bench_now() - start;
+
+  printf("%s context switch, %d rounds\r\n", CONTEXT_SWITCH_NAME, ROUNDS);
+  printf("  SetEvent + WaitEvent : %llu\r\n",
+         (unsigned long long)(cost / ROUNDS));
+  printf("  Context switch       : %llu\r\n",
+         (unsigned long long)(cost / (2 * ROUNDS)));
+  ShutdownOS(E_OK);
+  TerminateTask();
+}
+
+TASK(pong)
+{
+  while (1)
+  {
+    WaitEvent(wake);
+    ClearEvent(wake);
+  }
+}
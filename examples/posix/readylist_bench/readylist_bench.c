@@ -0,0 +1,151 @@
+/*
+ * Ready list benchmark.
+ *
+ * The bench task activates 4 times each of the 16 worker tasks, so that
+ * 64 jobs are put in the ready list, then it activates the last task and
+ * terminates. The workers run and terminate, the last task runs at the end
+ * and reactivates the bench task until ROUNDS rounds have been done.
+ *
+ * Two figures are printed:
+ * - the mean cost of an ActivateTask that inserts a job in a populated
+ *   ready list (no rescheduling occurs since workers have a lower priority);
+ * - the mean cost of a job in the drain phase, that is removing the front
+ *   of the ready list, switching to it and terminating it.
+ *
+ * Costs are given in cycles on x86 (rdtsc), in ticks of the virtual counter
+ * on aarch64 and in nanoseconds elsewhere.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "tpl_os.h"
+
+#if WITH_BITMAP_READY_LIST == YES
+#define READY_LIST_NAME   "bitmap"
+#else
+#define READY_LIST_NAME   "heap"
+#endif
+
+#define ROUNDS            1000
+#define WORKER_COUNT      16
+#define WORKER_ACTIVATION 4
+#define JOBS_PER_ROUND    (WORKER_COUNT * WORKER_ACTIVATION)
+
+static uint64_t bench_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+DeclareTask(bench);
+DeclareTask(last);
+DeclareTask(worker_0);
+DeclareTask(worker_1);
+DeclareTask(worker_2);
+DeclareTask(worker_3);
+DeclareTask(worker_4);
+DeclareTask(worker_5);
+DeclareTask(worker_6);
+DeclareTask(worker_7);
+DeclareTask(worker_8);
+DeclareTask(worker_9);
+DeclareTask(worker_10);
+DeclareTask(worker_11);
+DeclareTask(worker_12);
+DeclareTask(worker_13);
+DeclareTask(worker_14);
+DeclareTask(worker_15);
+
+static unsigned int round_count = 0;
+static uint64_t activate_cost = 0;
+static uint64_t drain_cost = 0;
+static uint64_t drain_start;
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(bench)
+{
+  /* task ids are constant objects, not constant expressions */
+  const TaskType workers[WORKER_COUNT] = {
+    worker_0, worker_1, worker_2, worker_3, worker_4, worker_5, worker_6,
+    worker_7, worker_8, worker_9, worker_10, worker_11, worker_12, worker_13,
+    worker_14, worker_15
+  };
+  int activation;
+  int worker;
+  uint64_t start = bench_now();
+
+  for (activation = 0; activation < WORKER_ACTIVATION; activation++)
+  {
+    for (worker = 0; worker < WORKER_COUNT; worker++)
+    {
+      ActivateTask(workers[worker]);
+    }
+  }
+  activate_cost += bench_now() - start;
+
+  ActivateTask(last);
+  drain_start = bench_now();
+  TerminateTask();
+}
+
+#define WORKER(n)       \
+  TASK(worker_##n)      \
+  {                     \
+    TerminateTask();    \
+  }
+
+WORKER(0)
+WORKER(1)
+WORKER(2)
+WORKER(3)
+WORKER(4)
+WORKER(5)
+WORKER(6)
+WORKER(7)
+WORKER(8)
+WORKER(9)
+WORKER(10)
+WORKER(11)
+WORKER(12)
+WORKER(13)
+WORKER(14)
+WORKER(15)
+
+TASK(last)
+{
+  drain_cost += bench_now() - drain_start;
+  round_count++;
+
+  if (round_count < ROUNDS)
+  {
+    ChainTask(bench);
+  }
+  else
+  {
+    printf("%s ready list, %d jobs per round, %d rounds\r\n",
+           READY_LIST_NAME, JOBS_PER_ROUND, ROUNDS);
+    printf("  ActivateTask       : %llu\r\n",
+           (unsigned long long)(activate_cost / (ROUNDS * JOBS_PER_ROUND)));
+    printf("  Switch + Terminate : %llu\r\n",
+           (unsigned long long)(drain_cost / (ROUNDS * JOBS_PER_ROUND)));
+    ShutdownOS(E_OK);
+  }
+  TerminateTask();
+}
@@ -128,6 +128,85 @@ class TraceReaderFile(TraceReader):
         for event in self.trace:
             yield event
 
+class TraceReaderBinary(TraceReader):
+    ''' Get trace events from a binary file, as written by the posix
+        trace backend (TRACE FORMAT = binary). The file is a header followed
+        by fixed-size records (see machines/posix/tpl_trace.c):
+          header: magic (8 bytes), version (u16), record size (u16),
+                  record count (u32)
+          record: timestamp (u32), type (u8), kind (u8), id (u16), value (u32)
+        Events are decoded to the same raw events as the serial reader.
+    '''
+    headerFormat = '=8sHHI'
+    recordFormat = '=IBBHI'
+    magic = b'TPLTRACE'
+
+    def __init__(self,inputFileName):
+        super().__init__()
+        self.trace = []
+        if inputFileName:
+            self.readBinaryTrace(inputFileName)
+
+    def readBinaryTrace(self,filename):
+        import struct
+        try:
+            with open(filename,'rb') as traceFile:
+                data = traceFile.read()
+        except OSError as e:
+            print('trace file not found ('+filename+'). '
+                  'Maybe, you should run your application first?')
+            sys.exit(1)
+        headerSize = struct.calcsize(self.headerFormat)
+        (magic,version,recordSize,count) = struct.unpack_from(self.headerFormat,data)
+        if magic != self.magic or version != 1 or recordSize != struct.calcsize(self.recordFormat):
+            print('ERROR: '+filename+' is not a binary trace file')
+            sys.exit(1)
+        #the header count is updated by the target while running
+        count = min(count,(len(data)-headerSize)//recordSize)
+        for (ts,evtType,kind,ident,value) in struct.iter_unpack(self.recordFormat,
+                data[headerSize:headerSize+count*recordSize]):
+            self.trace.append(self.decodeRecord(ts,evtType,kind,ident,value))
+
+    def decodeRecord(self,ts,evtType,kind,ident,value):
+        '''decode a binary record (private)'''
+        evt = {}
+        evt['ts'] = ts
+        evt['type'] = self.eventType[evtType]
+        if evt['type'] == 'proc':
+            evt['proc_id'] = ident
+            evt['target_state'] = value
+        elif evt['type'] == 'resource':
+            evt['resource_id'] = ident
+            evt['target_state'] = value
+        elif evt['type'] == 'event':
+            evt['event'] = value
+            if kind == 0:
+                evt['kind'] = 'set'
+                evt['target_task_id'] = ident
+            else:
+                evt['kind'] = 'reset'
+        elif evt['type'] == 'timeobj':
+            evt['timeobj_id'] = ident
+            if kind == 0:
+                evt['kind'] = 'update_state'
+                evt['target_state'] = value
+            else:
+                evt['kind'] = 'expire'
+        elif evt['type'] == 'message':
+            evt['msg_id'] = ident
+            evt['kind'] = ['send','send_zero','receive'][kind]
+        elif evt['type'] == 'ioc':
+            evt['ioc_id'] = ident
+            evt['kind'] = ['send','receive'][kind]
+        elif evt['type'] == 'overflow':
+            evt['lost'] = value
+        return evt
+
+    def getEvent(self):
+        ''' Generator that send raw events one by one'''
+        for event in self.trace:
+            yield event
+
 class TraceReaderSerial(TraceReader):
     ''' Get trace events from a Serial interface
         We only deal with ids for events here.
@@ -40,6 +40,10 @@
 
 #if COMPILE_FOR_WINDOWS == 1
   #include <sys/stat.h>
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
 #endif
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -212,6 +216,82 @@ bool C_FileManager::binaryDataWithContentOfFile (const C_String & inFilePath,
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Map file in memory
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_MappedFileContents::C_MappedFileContents (void) :
+mData (nullptr),
+mLength (0),
+mIsMapped (false),
+mBuffer () {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_MappedFileContents::~ C_MappedFileContents (void) {
+  unmap () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_MappedFileContents::unmap (void) {
+  #if COMPILE_FOR_WINDOWS == 0
+    if (mIsMapped) {
+      ::munmap ((void *) mData, (size_t) mLength) ;
+    }
+  #endif
+  mBuffer.free () ;
+  mData = nullptr ;
+  mLength = 0 ;
+  mIsMapped = false ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// The pages of a mapped file are loaded on demand and can be dropped by the kernel under memory pressure: reading a
+// large file does not increase the resident memory by the file size, as a copy in a buffer does.
+
+bool C_FileManager::mapFileContents (const C_String & inFilePath,
+                                     C_MappedFileContents & outContents) {
+  outContents.unmap () ;
+  bool ok = false ;
+  #if COMPILE_FOR_WINDOWS == 0
+    const C_String nativePath = nativePathWithUnixPath (inFilePath) ;
+    const int fd = ::open (nativePath.cString (HERE), O_RDONLY) ;
+    ok = fd >= 0 ;
+    struct stat fileStat ;
+    if (ok) {
+      ok = (::fstat (fd, & fileStat) == 0) && (fileStat.st_size <= INT32_MAX) ;
+    }
+    if (ok && (fileStat.st_size > 0)) {
+      void * p = ::mmap (nullptr, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0) ;
+      ok = p != MAP_FAILED ;
+      if (ok) {
+        #ifdef MADV_SEQUENTIAL
+          ::madvise (p, (size_t) fileStat.st_size, MADV_SEQUENTIAL) ;
+        #endif
+        outContents.mData = (const uint8_t *) p ;
+        outContents.mLength = (int32_t) fileStat.st_size ;
+        outContents.mIsMapped = true ;
+      }
+    }
+    if (fd >= 0) {
+      ::close (fd) ;
+    }
+  #else
+    ok = binaryDataWithContentOfFile (inFilePath, outContents.mBuffer) ;
+    if (ok) {
+      outContents.mData = outContents.mBuffer.unsafeDataPointer () ;
+      outContents.mLength = outContents.mBuffer.count () ;
+    }
+  #endif
+  return ok ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Read text file at once
 #endif
@@ -1080,6 +1160,37 @@ void C_FileManager::findAllFilesInDirectoryFromExtension (const C_String & inDir
 
 //----------------------------------------------------------------------------------------------------------------------
 
+void C_FileManager::findRegularFileNamesInDirectory (const C_String & inDirectoryPath,
+                                                     TC_UniqueArray <C_String> & outFileNames) {
+  const C_String nativeDirectoryPath = nativePathWithUnixPath (inDirectoryPath) ;
+  DIR * dir = ::opendir (nativeDirectoryPath.cString (HERE)) ;
+  if (dir != nullptr) {
+    struct dirent  * current = readdir (dir) ;
+    while (current != nullptr) {
+      if ((strcmp (current->d_name, ".") != 0) && (strcmp (current->d_name, "..") != 0)) {
+      //--- The entry type avoids a stat call, when the file system provides it
+        #ifdef _DIRENT_HAVE_D_TYPE
+          const bool typeIsKnown = (current->d_type != DT_UNKNOWN) && (current->d_type != DT_LNK) ;
+          const bool isRegularFile = current->d_type == DT_REG ;
+        #else
+          const bool typeIsKnown = false ;
+          const bool isRegularFile = false ;
+        #endif
+        C_String name = inDirectoryPath ;
+        name.appendCString ("/") ;
+        name.appendCString (current->d_name) ;
+        if (typeIsKnown ? isRegularFile : fileExistsAtPath (name)) {
+          outFileNames.appendObject (C_String (current->d_name)) ;
+        }
+      }
+      current = readdir (dir) ;
+    }
+    closedir (dir) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Files Modification Time
 #endif
@@ -25,6 +25,36 @@
 #include "strings/C_String.h"
 #include "utilities/C_Data.h"
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//   Read only file contents, mapped in memory (read at once on platforms without mmap)
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class C_MappedFileContents final {
+  public: C_MappedFileContents (void) ;
+  public: ~ C_MappedFileContents (void) ;
+
+//--- Release the mapping (or the buffer)
+  public: void unmap (void) ;
+
+//--- Contents
+  public: inline const uint8_t * data (void) const { return mData ; }
+  public: inline int32_t length (void) const { return mLength ; }
+
+//--- Private attributes
+  private: const uint8_t * mData ;
+  private: int32_t mLength ;
+  private: bool mIsMapped ; // false: mData points to mBuffer contents
+  private: C_Data mBuffer ;
+
+//--- No copy
+  private: C_MappedFileContents (const C_MappedFileContents &) = delete ;
+  private: C_MappedFileContents & operator = (const C_MappedFileContents &) = delete ;
+
+  friend class C_FileManager ;
+} ;
+
 //----------------------------------------------------------------------------------------------------------------------
 
 class C_FileManager final {
@@ -47,6 +77,10 @@ class C_FileManager final {
   public: static bool binaryDataWithContentOfFile (const C_String & inFilePath,
                                                     C_Data & outBinaryData) ;
 
+//--- Map binary file in memory, read only
+  public: static bool mapFileContents (const C_String & inFilePath,
+                                       C_MappedFileContents & outContents) ;
+
 //--- Read text file at once
   public: static C_String stringWithContentOfFile (const C_String & inFilePath) ;
 
@@ -91,6 +125,11 @@ class C_FileManager final {
                                                              const C_String & inExtension,
                                                              TC_UniqueArray <C_String> & outFoundFilePathes) ;
 
+//--- Find the names of the regular files of a directory, without searching subdirectories. The names are appended
+//    to outFileNames. If inDirectoryPath is not a directory, this method does nothing.
+  public: static void findRegularFileNamesInDirectory (const C_String & inDirectoryPath,
+                                                       TC_UniqueArray <C_String> & outFileNames) ;
+
 //--- Path handling
   public: static bool isAbsolutePath (const C_String & inPath) ;
   public: static C_String absolutePathFromCurrentDirectory (const C_String & inPath) ;
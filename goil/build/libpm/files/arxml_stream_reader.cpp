@@ -0,0 +1,570 @@
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Streaming reader of arxml files (readArxmlFile extern proc of arxml_parser.galgas).
+//
+//  Reads a memory mapped arxml file in one pass and builds the element tree of the <arxml_start_symbol> rule, without
+//  the token list of the lexique. goil only converts the ECUC-MODULE-DEF and ECUC-MODULE-CONFIGURATION-VALUES
+//  elements of the AR-PACKAGE elements: the other elements of an AR-PACKAGE's ELEMENTS are skipped and never
+//  materialized. Their closing tags are not checked.
+//  Names start with an ASCII letter or a non ASCII character, and go on with these characters, digits, '-' and ':'.
+//  Text is expected in UTF-8.
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "all-declarations-6.h"
+#include "files/C_FileManager.h"
+#include "galgas2/C_galgas_CLI_Options.h"
+#include "strings/unicode_character_base.h"
+#include "utilities/C_Data.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class cArxmlStreamReader final {
+  public: cArxmlStreamReader (C_Compiler * inCompiler,
+                              const uint8_t * inData,
+                              const int32_t inLength,
+                              const C_SourceTextInString & inSourceText,
+                              const bool inIncludeComments,
+                              const bool inDoNotCondenseWhiteSpaces) ;
+
+  public: bool parse (GALGAS_arxmlNode & outRootNode) ;
+
+//--- Private methods
+  private: inline bool startsWith (const char * inString) const {
+    const int32_t length = (int32_t) strlen (inString) ;
+    return ((mIndex + length) <= mLength) && (memcmp (& mData [mIndex], inString, (size_t) length) == 0) ;
+  }
+  private: inline uint8_t currentByte (void) const { return (mIndex < mLength) ? mData [mIndex] : 0 ; }
+  private: static inline bool isNameStart (const uint8_t inByte) {
+    return ((inByte >= 'a') && (inByte <= 'z')) || ((inByte >= 'A') && (inByte <= 'Z')) || (inByte >= 0x80) ;
+  }
+  private: static inline bool isNameCharacter (const uint8_t inByte) {
+    return isNameStart (inByte) || ((inByte >= '0') && (inByte <= '9')) || (inByte == '-') || (inByte == ':') ;
+  }
+  private: int32_t indexOfByte (const uint8_t inByte, const int32_t inStartIndex) const ;
+  private: int32_t indexOfString (const char * inString, const int32_t inStartIndex) const ;
+  private: void advanceTo (const int32_t inIndex) ;
+  private: C_LocationInSource currentLocation (void) const ;
+  private: void error (const C_String & inMessage) ;
+  private: void skipSeparators (void) ;
+  private: void accept (const char * inDelimiter) ;
+  private: bool elementNameIs (const char * inName) const ;
+  private: void appendDecodedString (const int32_t inStartIndex,
+                                     const int32_t inEndIndex,
+                                     const bool inDecodeCodePoints,
+                                     C_String & ioString) const ;
+  private: GALGAS_lstring readName (void) ;
+  private: GALGAS_lstring readAttributeValue (void) ;
+  private: void readAttributes (GALGAS_arxmlAttributeMap & ioAttributeMap) ;
+  private: void addText (GALGAS_arxmlNodeList & ioNodes) ;
+  private: void readComment (GALGAS_arxmlNodeList & ioNodes) ;
+  private: void readNodeList (GALGAS_arxmlNodeList & ioNodes, const bool inParentIsPackage, const bool inSkipNonEcuc) ;
+  private: void readElement (GALGAS_arxmlNodeList & ioNodes, const bool inParentIsPackage) ;
+  private: void skipElement (void) ;
+
+//--- Private attributes
+  private: C_Compiler * mCompiler ;
+  private: const uint8_t * mData ;
+  private: const int32_t mLength ;
+  private: int32_t mIndex ;
+  private: int32_t mCharacterIndex ;
+  private: int32_t mLineNumber ;
+  private: int32_t mLineStartCharacterIndex ;
+  private: const C_SourceTextInString mSourceText ;
+  private: const bool mIncludeComments ;
+  private: const bool mDoNotCondenseWhiteSpaces ;
+  private: bool mOk ;
+
+//--- No copy
+  private: cArxmlStreamReader (const cArxmlStreamReader &) = delete ;
+  private: cArxmlStreamReader & operator = (const cArxmlStreamReader &) = delete ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cArxmlStreamReader::cArxmlStreamReader (C_Compiler * inCompiler,
+                                        const uint8_t * inData,
+                                        const int32_t inLength,
+                                        const C_SourceTextInString & inSourceText,
+                                        const bool inIncludeComments,
+                                        const bool inDoNotCondenseWhiteSpaces) :
+mCompiler (inCompiler),
+mData (inData),
+mLength (inLength),
+mIndex (0),
+mCharacterIndex (0),
+mLineNumber (1),
+mLineStartCharacterIndex (0),
+mSourceText (inSourceText),
+mIncludeComments (inIncludeComments),
+mDoNotCondenseWhiteSpaces (inDoNotCondenseWhiteSpaces),
+mOk (true) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int32_t cArxmlStreamReader::indexOfByte (const uint8_t inByte, const int32_t inStartIndex) const {
+  const void * p = (inStartIndex < mLength)
+    ? memchr (& mData [inStartIndex], inByte, (size_t) (mLength - inStartIndex))
+    : nullptr ;
+  return (p == nullptr) ? mLength : (int32_t) ((const uint8_t *) p - mData) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int32_t cArxmlStreamReader::indexOfString (const char * inString, const int32_t inStartIndex) const {
+  const int32_t length = (int32_t) strlen (inString) ;
+  int32_t idx = indexOfByte ((uint8_t) inString [0], inStartIndex) ;
+  while (((idx + length) <= mLength) && (memcmp (& mData [idx], inString, (size_t) length) != 0)) {
+    idx = indexOfByte ((uint8_t) inString [0], idx + 1) ;
+  }
+  return ((idx + length) <= mLength) ? idx : mLength ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+// The locations are given in characters of the source text, as C_String::parseUTF8 decodes it: a UTF-8 sequence is
+// one character, and CR LF is one end of line.
+
+void cArxmlStreamReader::advanceTo (const int32_t inIndex) {
+  for (int32_t idx=mIndex ; idx<inIndex ; idx++) {
+    const uint8_t c = mData [idx] ;
+    if (c == '\r') {
+      mCharacterIndex += 1 ;
+      mLineNumber += 1 ;
+      mLineStartCharacterIndex = mCharacterIndex ;
+    }else if (c == '\n') {
+      if ((idx == 0) || (mData [idx - 1] != '\r')) {
+        mCharacterIndex += 1 ;
+        mLineNumber += 1 ;
+        mLineStartCharacterIndex = mCharacterIndex ;
+      }
+    }else if ((c & 0xC0) != 0x80) {
+      mCharacterIndex += 1 ;
+    }
+  }
+  mIndex = inIndex ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_LocationInSource cArxmlStreamReader::currentLocation (void) const {
+  return C_LocationInSource (mSourceText, mCharacterIndex, mLineNumber, mCharacterIndex - mLineStartCharacterIndex + 1) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cArxmlStreamReader::error (const C_String & inMessage) {
+  if (mOk) {
+    mOk = false ;
+    const C_LocationInSource location = currentLocation () ;
+    mCompiler->semanticErrorAtLocation (GALGAS_location (location, location, mSourceText),
+                                        inMessage,
+                                        TC_Array <C_FixItDescription> ()
+                                        COMMA_HERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cArxmlStreamReader::skipSeparators (void) {
+  int32_t idx = mIndex ;
+  while ((idx < mLength) && (mData [idx] >= 1) && (mData [idx] <= ' ')) {
+    idx += 1 ;
+  }
+  advanceTo (idx) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cArxmlStreamReader::accept (const char * inDelimiter) {
+  skipSeparators () ;
+  if (startsWith (inDelimiter)) {
+    advanceTo (mIndex + (int32_t) strlen (inDelimiter)) ;
+  }else{
+    C_String message ;
+    message << "the '" << inDelimiter << "' delimitor is expected" ;
+    error (message) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// mIndex is on the '<' of a start tag
+
+bool cArxmlStreamReader::elementNameIs (const char * inName) const {
+  const int32_t length = (int32_t) strlen (inName) ;
+  const int32_t endIndex = mIndex + 1 + length ;
+  return (endIndex < mLength)
+    && (memcmp (& mData [mIndex + 1], inName, (size_t) length) == 0)
+    && ! isNameCharacter (mData [endIndex]) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Same replacements as the arxml_scanner lexique; '&#...;' code points are only replaced in text
+
+void cArxmlStreamReader::appendDecodedString (const int32_t inStartIndex,
+                                              const int32_t inEndIndex,
+                                              const bool inDecodeCodePoints,
+                                              C_String & ioString) const {
+  int32_t idx = inStartIndex ;
+  while (idx < inEndIndex) {
+    int32_t ampersandIndex = indexOfByte ('&', idx) ;
+    if (ampersandIndex > inEndIndex) {
+      ampersandIndex = inEndIndex ;
+    }
+    ioString.appendCString ((const char *) & mData [idx], ampersandIndex - idx) ;
+    idx = ampersandIndex ;
+    if (idx < inEndIndex) {
+      static const char * kEntities [5] = {"&amp;", "&lt;", "&gt;", "&quot;", "&apos;"} ;
+      static const char kCharacters [5] = {'&', '<', '>', '"', '\''} ;
+      bool found = false ;
+      for (int32_t i=0 ; (i<5) && ! found ; i++) {
+        const int32_t length = (int32_t) strlen (kEntities [i]) ;
+        found = ((idx + length) <= inEndIndex) && (memcmp (& mData [idx], kEntities [i], (size_t) length) == 0) ;
+        if (found) {
+          ioString.appendUnicodeCharacter (TO_UNICODE ((uint32_t) kCharacters [i]) COMMA_HERE) ;
+          idx += length ;
+        }
+      }
+      if (! found && inDecodeCodePoints && ((idx + 1) < inEndIndex) && (mData [idx + 1] == '#')) {
+        const int32_t semicolonIndex = indexOfByte (';', idx + 2) ;
+        if (semicolonIndex < inEndIndex) {
+          const bool hex = (mData [idx + 2] == 'x') || (mData [idx + 2] == 'X') ;
+          uint32_t code = 0 ;
+          bool ok = semicolonIndex > (idx + (hex ? 3 : 2)) ;
+          for (int32_t i = idx + (hex ? 3 : 2) ; (i < semicolonIndex) && ok ; i++) {
+            const uint32_t c = mData [i] ;
+            if ((c >= '0') && (c <= '9')) {
+              code = code * (hex ? 16 : 10) + c - '0' ;
+            }else if (hex && (c >= 'a') && (c <= 'f')) {
+              code = code * 16 + c + 10 - 'a' ;
+            }else if (hex && (c >= 'A') && (c <= 'F')) {
+              code = code * 16 + c + 10 - 'A' ;
+            }else{
+              ok = false ;
+            }
+          }
+          found = ok && isUnicodeCharacterAssigned (TO_UNICODE (code)) ;
+          if (found) {
+            ioString.appendUnicodeCharacter (TO_UNICODE (code) COMMA_HERE) ;
+            idx = semicolonIndex + 1 ;
+          }
+        }
+      }
+      if (! found) {
+        ioString.appendUnicodeCharacter (TO_UNICODE ('&') COMMA_HERE) ;
+        idx += 1 ;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_lstring cArxmlStreamReader::readName (void) {
+  skipSeparators () ;
+  GALGAS_lstring result ;
+  if (isNameStart (currentByte ())) {
+    const C_LocationInSource startLocation = currentLocation () ;
+    int32_t idx = mIndex + 1 ;
+    while ((idx < mLength) && isNameCharacter (mData [idx])) {
+      idx += 1 ;
+    }
+    C_String name ;
+    name.appendCString ((const char *) & mData [mIndex], idx - mIndex) ;
+    advanceTo (idx - 1) ;
+    const C_LocationInSource endLocation = currentLocation () ;
+    advanceTo (idx) ;
+    result = GALGAS_lstring (GALGAS_string (name), GALGAS_location (startLocation, endLocation, mSourceText)) ;
+  }else{
+    error ("a name is expected") ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+GALGAS_lstring cArxmlStreamReader::readAttributeValue (void) {
+  skipSeparators () ;
+  GALGAS_lstring result ;
+  const uint8_t quote = currentByte () ;
+  if ((quote == '"') || (quote == '\'')) {
+    const C_LocationInSource startLocation = currentLocation () ;
+    const int32_t endIndex = indexOfByte (quote, mIndex + 1) ;
+    if (endIndex < mLength) {
+      C_String value ;
+      appendDecodedString (mIndex + 1, endIndex, false, value) ;
+      advanceTo (endIndex) ;
+      const C_LocationInSource endLocation = currentLocation () ;
+      advanceTo (endIndex + 1) ;
+      result = GALGAS_lstring (GALGAS_string (value), GALGAS_location (startLocation, endLocation, mSourceText)) ;
+    }else{
+      error ("attribute value should be enclosed between apostrophes (') or quotation marks (\")") ;
+    }
+  }else{
+    error ("an attribute value is expected") ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cArxmlStreamReader::readAttributes (GALGAS_arxmlAttributeMap & ioAttributeMap) {
+  skipSeparators () ;
+  while (mOk && isNameStart (currentByte ())) {
+    const GALGAS_lstring attributeName = readName () ;
+    accept ("=") ;
+    const GALGAS_lstring attributeValue = readAttributeValue () ;
+    if (mOk) {
+      ioAttributeMap.setter_insertKey (attributeName, attributeValue, mCompiler COMMA_HERE) ;
+    }
+    skipSeparators () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Text up to the next '<', as the addText routine
+
+void cArxmlStreamReader::addText (GALGAS_arxmlNodeList & ioNodes) {
+  const int32_t endIndex = indexOfByte ('<', mIndex) ;
+  bool hasCharacters = false ;
+  for (int32_t i=mIndex ; (i<endIndex) && ! hasCharacters ; i++) {
+    hasCharacters = mData [i] > ' ' ;
+  }
+  if (hasCharacters) {
+    C_String text ;
+    appendDecodedString (mIndex, endIndex, true, text) ;
+    if (! mDoNotCondenseWhiteSpaces) {
+      text = text.stringByTrimmingSeparators () ;
+    }
+    advanceTo (endIndex) ;
+    const C_LocationInSource location = currentLocation () ;
+    const GALGAS_lstring textString (GALGAS_string (text), GALGAS_location (location, location, mSourceText)) ;
+    ioNodes.addAssign_operation (GALGAS_arxmlTextNode::constructor_new (textString COMMA_HERE) COMMA_HERE) ;
+  }else{
+    advanceTo (endIndex) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cArxmlStreamReader::readComment (GALGAS_arxmlNodeList & ioNodes) {
+  const C_LocationInSource startLocation = currentLocation () ;
+  const int32_t endIndex = indexOfString ("-->", mIndex + 4) ;
+  if (endIndex < mLength) {
+    if (mIncludeComments) {
+      C_String comment ;
+      appendDecodedString (mIndex + 4, endIndex, false, comment) ;
+      advanceTo (endIndex + 2) ;
+      const GALGAS_lstring commentString (GALGAS_string (comment),
+                                          GALGAS_location (startLocation, currentLocation (), mSourceText)) ;
+      ioNodes.addAssign_operation (GALGAS_arxmlCommentNode::constructor_new (commentString COMMA_HERE) COMMA_HERE) ;
+    }
+    advanceTo (endIndex + 3) ;
+  }else{
+    error ("incorrect XML comment") ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Reads until a closing tag or the end of file
+
+void cArxmlStreamReader::readNodeList (GALGAS_arxmlNodeList & ioNodes,
+                                       const bool inParentIsPackage,
+                                       const bool inSkipNonEcuc) {
+  bool loop = true ;
+  while (mOk && loop) {
+    addText (ioNodes) ;
+    if ((mIndex >= mLength) || startsWith ("</")) {
+      loop = false ;
+    }else if (startsWith ("<!--")) {
+      readComment (ioNodes) ;
+    }else if (inSkipNonEcuc && ! elementNameIs ("ECUC-MODULE-DEF") && ! elementNameIs ("ECUC-MODULE-CONFIGURATION-VALUES")) {
+      skipElement () ;
+    }else{
+      readElement (ioNodes, inParentIsPackage) ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cArxmlStreamReader::readElement (GALGAS_arxmlNodeList & ioNodes, const bool inParentIsPackage) {
+  accept ("<") ;
+  const GALGAS_lstring name = readName () ;
+  GALGAS_arxmlAttributeMap attributeMap = GALGAS_arxmlAttributeMap::constructor_emptyMap (HERE) ;
+  readAttributes (attributeMap) ;
+  GALGAS_arxmlNodeList nodeList = GALGAS_arxmlNodeList::constructor_emptyList (HERE) ;
+  if (! mOk) {
+  }else if (startsWith ("/>")) {
+    advanceTo (mIndex + 2) ;
+  }else{
+    accept (">") ;
+    const C_String elementName = name.readProperty_string ().stringValue () ;
+    readNodeList (nodeList,
+                  elementName.compare ("AR-PACKAGE") == 0,
+                  inParentIsPackage && (elementName.compare ("ELEMENTS") == 0)) ;
+    if (mOk && (mIndex >= mLength)) {
+      error ("the '</' delimitor is expected") ;
+    }else if (mOk) {
+      advanceTo (mIndex + 2) ;
+      const GALGAS_lstring closingName = readName () ;
+      if (mOk && (closingName.readProperty_string ().stringValue () != elementName)) {
+        C_String message ;
+        message << "incorrect closing tag </" << closingName.readProperty_string ().stringValue ()
+                << "> instead of </" << elementName << ">" ;
+        error (message) ;
+      }
+      accept (">") ;
+    }
+  }
+  if (mOk) {
+    ioNodes.addAssign_operation (GALGAS_arxmlElementNode::constructor_new (name, attributeMap, nodeList COMMA_HERE) COMMA_HERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// mIndex is on the '<' of a start tag; only the nesting of the tags is followed
+
+void cArxmlStreamReader::skipElement (void) {
+  int32_t depth = 0 ;
+  int32_t idx = mIndex ;
+  bool loop = true ;
+  while (loop) {
+    if ((idx + 4 <= mLength) && (memcmp (& mData [idx], "<!--", 4) == 0)) {
+      idx = indexOfString ("-->", idx + 4) + 3 ;
+    }else if ((idx + 1 < mLength) && (mData [idx + 1] == '/')) {
+      depth -= 1 ;
+      idx = indexOfByte ('>', idx) + 1 ;
+    }else{
+    //--- Start tag: look for its end, outside of attribute values
+      idx += 1 ;
+      while ((idx < mLength) && (mData [idx] != '>')) {
+        if ((mData [idx] == '"') || (mData [idx] == '\'')) {
+          idx = indexOfByte (mData [idx], idx + 1) ;
+        }
+        idx += 1 ;
+      }
+      if ((idx < mLength) && (mData [idx - 1] != '/') && (mData [idx - 1] != '?')) {
+        depth += 1 ;
+      }
+      idx += 1 ;
+    }
+    if (idx > mLength) {
+      idx = mLength ;
+    }
+    loop = (depth > 0) && (idx < mLength) ;
+    if (loop) {
+      idx = indexOfByte ('<', idx) ;
+    }
+  }
+  if (depth > 0) {
+    advanceTo (mLength) ;
+    error ("unexpected end of file in a skipped element") ;
+  }else{
+    advanceTo (idx) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cArxmlStreamReader::parse (GALGAS_arxmlNode & outRootNode) {
+//--- UTF-8 byte order mark, not in the source text
+  if (startsWith ("\xEF\xBB\xBF")) {
+    mIndex = 3 ;
+  }
+  if (! startsWith ("<?")) {
+    error ("No character is allowed before XML header") ;
+  }
+  accept ("<?") ;
+  const GALGAS_lstring name = readName () ;
+  GALGAS_arxmlAttributeMap attributes = GALGAS_arxmlAttributeMap::constructor_emptyMap (HERE) ;
+  readAttributes (attributes) ;
+  accept ("?>") ;
+  GALGAS_arxmlNodeList nodes = GALGAS_arxmlNodeList::constructor_emptyList (HERE) ;
+  readNodeList (nodes, false, false) ;
+  if (mOk && (mIndex < mLength)) {
+    error ("unexpected closing tag") ;
+  }
+  if (mOk) {
+    outRootNode = GALGAS_arxmlElementNode::constructor_new (name, attributes, nodes COMMA_HERE) ;
+  }
+  return mOk ;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// The scanner is only used as compiler: its source text is the decoded file, that the locations refer to.
+
+void routine_readArxmlFile (const GALGAS_lstring constinArgument0,
+                            const GALGAS_bool constinArgument1,
+                            const GALGAS_bool constinArgument2,
+                            GALGAS_arxmlNode & outArgument3,
+                            GALGAS_bool & outArgument4,
+                            C_Compiler * inCompiler
+                            COMMA_UNUSED_LOCATION_ARGS) {
+  outArgument3.drop () ;
+  outArgument4 = GALGAS_bool (false) ;
+  if (constinArgument0.isValid () && constinArgument1.isValid ()
+   && constinArgument2.isValid ()) {
+    C_String filePath = constinArgument0.readProperty_string ().stringValue () ;
+    if (! C_FileManager::isAbsolutePath (filePath)) {
+      filePath = inCompiler->sourceFilePath ().stringByDeletingLastPathComponent ().stringByAppendingPathComponent (filePath) ;
+    }
+    C_MappedFileContents contents ;
+    C_String sourceString ;
+    bool ok = C_FileManager::fileExistsAtPath (filePath) ;
+    if (! ok) {
+      C_String message ;
+      message << "the '" << filePath << "' file does not exist" ;
+      inCompiler->semanticErrorAtLocation (constinArgument0.readProperty_location (), message,
+                                           TC_Array <C_FixItDescription> () COMMA_HERE) ;
+    }else if (! C_FileManager::mapFileContents (filePath, contents)) {
+      ok = false ;
+      C_String message ;
+      message << "the '" << filePath << "' file exists, but cannot be read" ;
+      inCompiler->semanticErrorAtLocation (constinArgument0.readProperty_location (), message,
+                                           TC_Array <C_FixItDescription> () COMMA_HERE) ;
+    }else{
+    //--- The byte order mark is not in the source text
+      const int32_t offset = ((contents.length () >= 3) && (memcmp (contents.data (), "\xEF\xBB\xBF", 3) == 0)) ? 3 : 0 ;
+      C_Data data ;
+      data.appendDataFromPointer (contents.data (), contents.length ()) ;
+      ok = C_String::parseUTF8 (data, offset, sourceString) ;
+      if (! ok) {
+        C_String message ;
+        message << "the '" << filePath << "' file is not encoded in UTF-8" ;
+        inCompiler->semanticErrorAtLocation (constinArgument0.readProperty_location (), message,
+                                             TC_Array <C_FixItDescription> () COMMA_HERE) ;
+      }
+    }
+    if (ok) {
+      C_Lexique_arxml_5F_scanner * scanner = NULL ;
+      macroMyNew (scanner, C_Lexique_arxml_5F_scanner (inCompiler, sourceString, filePath COMMA_HERE)) ;
+      scanner->logFileRead (filePath) ;
+      cArxmlStreamReader reader (scanner, contents.data (), contents.length (), scanner->sourceText (),
+                                 constinArgument1.boolValue (),
+                                 constinArgument2.boolValue ()) ;
+      ok = reader.parse (outArgument3) ;
+      macroDetachSharedObject (scanner) ;
+      outArgument4 = GALGAS_bool (ok && ! executionModeIsSyntaxAnalysisOnly ()) ;
+    }
+    contents.unmap () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
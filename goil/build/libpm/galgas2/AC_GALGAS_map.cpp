@@ -28,7 +28,12 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include <atomic>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 class cMapNode ;
+class cMapIndex ;
 
 //----------------------------------------------------------------------------------------------------------------------
 //
@@ -42,6 +47,9 @@ class cSharedMapRoot : public C_SharedObject {
   private: uint32_t mCount ;
   protected: cSharedMapRoot * mOverridenMap ;
   private: bool mActivateReplacementSuggestions ;
+//--- Hash index of the nodes, built by the first search in a map with at least kIndexedMapMinimumCount nodes;
+//    maintained by insertions and removals afterwards
+  private: mutable std::atomic <cMapIndex *> mIndex ;
 
 
 //--------------------------------- Accessors
@@ -78,9 +86,19 @@ class cSharedMapRoot : public C_SharedObject {
                                                         COMMA_LOCATION_ARGS) ;
 
 //--------------------------------- Search
+  private: VIRTUAL_IN_DEBUG cMapIndex * index (void) const ;
+
+  private: VIRTUAL_IN_DEBUG cMapNode * findNode (const C_String & inKey,
+                                                  const uint32_t inKeyHash) const ;
+
+  private: VIRTUAL_IN_DEBUG cMapNode * findNodeForWriting (const C_String & inKey,
+                                                            const uint32_t inKeyHash) ;
+
   private: VIRTUAL_IN_DEBUG cMapNode * findEntryInMap (const C_String & inKey,
                                                         const cSharedMapRoot * inFirstMap) const ;
 
+  private: VIRTUAL_IN_DEBUG cMapNode * findEntryInMapForWriting (const C_String & inKey) ;
+
   private: VIRTUAL_IN_DEBUG cMapNode * findEntryInMapAtLevel (const C_String & inKey,
                                                                const uint32_t inLevel,
                                                                const cSharedMapRoot * inFirstMap) const ;
@@ -165,14 +183,19 @@ class cMapNode {
   public: cMapNode * mInfPtr ;
   public: cMapNode * mSupPtr ;
   public: int32_t mBalance ;
+//--- Nodes are shared by the copies of a map, a node is duplicated when a copy modifies it.
+//    Atomic, as map copies may be used by several threads (see GTL 'write to')
+  public: std::atomic <uint32_t> mRetainCount ;
+  public: const uint32_t mKeyHash ;
   public: const C_String mKey ;
   public: capCollectionElement mAttributes ;
 
 //--- Constructors
   public: cMapNode (const C_String & inKey,
+                     const uint32_t inKeyHash,
                      const capCollectionElement & inAttributes) ;
 
-  public: cMapNode (cMapNode * inNode) ;
+  public: cMapNode (const cMapNode * inNode) ;
 
 //--- Destructor
   public: virtual ~ cMapNode (void) ;
@@ -184,28 +207,197 @@ class cMapNode {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  c M a p I n d e x
+//
+//  Open addressing hash table (linear probing) of the nodes of a map tree, keyed by the cached key hash. The tree
+//  is kept for enumerating the keys in ascending order.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static const uint32_t kIndexedMapMinimumCount = 16 ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class cMapIndex final {
+  private: cMapNode * * mSlots ;
+  private: uint32_t mCapacity ; // Power of 2
+  private: uint32_t mShift ;
+  private: uint32_t mCount ;
+
+//--- Constructor, destructor
+  public: cMapIndex (const uint32_t inNodeCount) ;
+  public: ~ cMapIndex (void) ;
+
+//--- No copy
+  private: cMapIndex (const cMapIndex &) ;
+  private: cMapIndex & operator = (const cMapIndex &) ;
+
+//--- Accessors
+  public: inline uint32_t count (void) const { return mCount ; }
+
+  public: cMapNode * find (const C_String & inKey, const uint32_t inKeyHash) const ;
+
+//--- Modifiers
+  public: void insert (cMapNode * inNode) ;
+  public: void replace (const cMapNode * inNode, cMapNode * inNewNode) ;
+  public: void remove (const cMapNode * inNode) ;
+
+//--- Internal
+  private: inline uint32_t homeSlot (const uint32_t inKeyHash) const {
+    return (inKeyHash * 2654435769U) >> mShift ; // Fibonacci hashing, C_String::hash is weak in its high bits
+  }
+  private: uint32_t slotOfNode (const cMapNode * inNode) const ;
+  private: void setCapacity (const uint32_t inCapacity) ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapIndex::cMapIndex (const uint32_t inNodeCount) :
+mSlots (nullptr),
+mCapacity (0),
+mShift (32),
+mCount (0) {
+  uint32_t capacity = 16 ;
+  while (capacity < (2 * inNodeCount)) {
+    capacity *= 2 ;
+  }
+  setCapacity (capacity) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapIndex::~ cMapIndex (void) {
+  macroMyDeletePODArray (mSlots) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cMapIndex::setCapacity (const uint32_t inCapacity) {
+  cMapNode * * oldSlots = mSlots ;
+  const uint32_t oldCapacity = mCapacity ;
+  mSlots = nullptr ;
+  macroMyNewPODArray (mSlots, cMapNode *, inCapacity) ;
+  for (uint32_t i=0 ; i<inCapacity ; i++) {
+    mSlots [i] = nullptr ;
+  }
+  mCapacity = inCapacity ;
+  mShift = 32 ;
+  for (uint32_t c = inCapacity ; c > 1 ; c >>= 1) {
+    mShift -- ;
+  }
+  mCount = 0 ;
+  for (uint32_t i=0 ; i<oldCapacity ; i++) {
+    if (nullptr != oldSlots [i]) {
+      insert (oldSlots [i]) ;
+    }
+  }
+  macroMyDeletePODArray (oldSlots) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapNode * cMapIndex::find (const C_String & inKey, const uint32_t inKeyHash) const {
+  cMapNode * result = nullptr ;
+  uint32_t idx = homeSlot (inKeyHash) ;
+  while ((nullptr == result) && (nullptr != mSlots [idx])) {
+    const cMapNode * node = mSlots [idx] ;
+    if ((node->mKeyHash == inKeyHash) && (node->mKey == inKey)) {
+      result = mSlots [idx] ;
+    }
+    idx = (idx + 1) & (mCapacity - 1) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint32_t cMapIndex::slotOfNode (const cMapNode * inNode) const {
+  uint32_t idx = homeSlot (inNode->mKeyHash) ;
+  while (mSlots [idx] != inNode) {
+    MF_Assert (nullptr != mSlots [idx], "node not found in map index", 0, 0) ;
+    idx = (idx + 1) & (mCapacity - 1) ;
+  }
+  return idx ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cMapIndex::insert (cMapNode * inNode) {
+  if ((2 * (mCount + 1)) > mCapacity) {
+    setCapacity (2 * mCapacity) ;
+  }
+  uint32_t idx = homeSlot (inNode->mKeyHash) ;
+  while (nullptr != mSlots [idx]) {
+    idx = (idx + 1) & (mCapacity - 1) ;
+  }
+  mSlots [idx] = inNode ;
+  mCount ++ ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cMapIndex::replace (const cMapNode * inNode, cMapNode * inNewNode) {
+  mSlots [slotOfNode (inNode)] = inNewNode ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cMapIndex::remove (const cMapNode * inNode) {
+  uint32_t freeIdx = slotOfNode (inNode) ;
+  mSlots [freeIdx] = nullptr ;
+  mCount -- ;
+//--- Backward shift the following nodes of the cluster that are not at or after their home slot
+  uint32_t idx = (freeIdx + 1) & (mCapacity - 1) ;
+  while (nullptr != mSlots [idx]) {
+    const uint32_t home = homeSlot (mSlots [idx]->mKeyHash) ;
+    const bool inPlace = (freeIdx <= idx)
+      ? ((freeIdx < home) && (home <= idx))
+      : ((freeIdx < home) || (home <= idx)) ;
+    if (! inPlace) {
+      mSlots [freeIdx] = mSlots [idx] ;
+      mSlots [idx] = nullptr ;
+      freeIdx = idx ;
+    }
+    idx = (idx + 1) & (mCapacity - 1) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 cSharedMapRoot::cSharedMapRoot (const bool inActivateReplacementSuggestions COMMA_LOCATION_ARGS) :
 C_SharedObject (THERE),
 mRoot (nullptr),
 mCount (0),
 mOverridenMap (nullptr),
-mActivateReplacementSuggestions (inActivateReplacementSuggestions) {
+mActivateReplacementSuggestions (inActivateReplacementSuggestions),
+mIndex (nullptr) {
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static void releaseNode (cMapNode * & ioNode) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
 cSharedMapRoot::~ cSharedMapRoot (void) {
-  macroMyDelete (mRoot) ;
+  releaseNode (mRoot) ;
+  cMapIndex * index = mIndex.load (std::memory_order_relaxed) ;
+  macroMyDelete (index) ;
   macroDetachSharedObject (mOverridenMap) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 cMapNode::cMapNode (const C_String & inKey,
+                    const uint32_t inKeyHash,
                     const capCollectionElement & inAttributes) :
 mInfPtr (nullptr),
 mSupPtr (nullptr),
 mBalance (0),
+mRetainCount (1),
+mKeyHash (inKeyHash),
 mKey (inKey),
 mAttributes (inAttributes) {
 }
@@ -213,8 +405,45 @@ mAttributes (inAttributes) {
 //----------------------------------------------------------------------------------------------------------------------
 
 cMapNode::~cMapNode (void) {
-  macroMyDelete (mInfPtr) ;
-  macroMyDelete (mSupPtr) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void retainNode (cMapNode * inNode) {
+  if (nullptr != inNode) {
+    inNode->mRetainCount.fetch_add (1, std::memory_order_relaxed) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void releaseNode (cMapNode * & ioNode) {
+  if (nullptr != ioNode) {
+    macroValidPointer (ioNode) ;
+    if (ioNode->mRetainCount.fetch_sub (1, std::memory_order_acq_rel) == 1) {
+      releaseNode (ioNode->mInfPtr) ;
+      releaseNode (ioNode->mSupPtr) ;
+      macroMyDelete (ioNode) ;
+    }
+    ioNode = nullptr ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Before a node is modified, it is duplicated if it is shared with an other map. Its parent should have been
+//  insulated before, so that the copy is referenced by the current map only.
+
+static void insulateNode (cMapNode * & ioNode,
+                          cMapIndex * ioIndex) {
+  if (ioNode->mRetainCount.load (std::memory_order_acquire) > 1) {
+    cMapNode * p = nullptr ;
+    macroMyNew (p, cMapNode (ioNode)) ;
+    if (nullptr != ioIndex) {
+      ioIndex->replace (ioNode, p) ;
+    }
+    releaseNode (ioNode) ;
+    ioNode = p ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -227,13 +456,19 @@ cMapNode::~cMapNode (void) {
 
 #ifndef DO_NOT_GENERATE_CHECKINGS
   static void checkNode (const cMapNode * inNode,
-                         uint32_t & ioCount) {
+                         const cMapIndex * inIndex,
+                         uint32_t & ioCount,
+                         uint32_t & ioNodeCount) {
     if (nullptr != inNode) {
-     checkNode (inNode->mInfPtr, ioCount) ;
+     checkNode (inNode->mInfPtr, inIndex, ioCount, ioNodeCount) ;
      if (inNode->mAttributes.ptr () != nullptr) {
        ioCount ++ ;
      }
-     checkNode (inNode->mSupPtr, ioCount) ;
+     ioNodeCount ++ ;
+     MF_Assert (inNode->mKeyHash == inNode->mKey.hash (), "invalid cached key hash", 0, 0) ;
+     MF_Assert ((nullptr == inIndex) || (inIndex->find (inNode->mKey, inNode->mKeyHash) == inNode),
+                "node not found in map index", 0, 0) ;
+     checkNode (inNode->mSupPtr, inIndex, ioCount, ioNodeCount) ;
     }
   }
 #endif
@@ -243,8 +478,12 @@ cMapNode::~cMapNode (void) {
 #ifndef DO_NOT_GENERATE_CHECKINGS
   void cSharedMapRoot::checkMap (LOCATION_ARGS) const {
     uint32_t n = 0 ;
-    checkNode (mRoot, n) ;
+    uint32_t nodeCount = 0 ;
+    const cMapIndex * index = mIndex.load (std::memory_order_acquire) ;
+    checkNode (mRoot, index, n, nodeCount) ;
     MF_AssertThere (n == mCount, "n (%lld) != mCount (%lld)", n, mCount) ;
+    MF_AssertThere ((nullptr == index) || (index->count () == nodeCount),
+                    "index count (%lld) != node count (%lld)", (nullptr == index) ? 0 : index->count (), nodeCount) ;
   }
 #endif
 
@@ -376,6 +615,86 @@ void AC_GALGAS_map::description (C_String & ioString,
 
 //----------------------------------------------------------------------------------------------------------------------
 
+cMapIndex * cSharedMapRoot::index (void) const {
+  cMapIndex * result = mIndex.load (std::memory_order_acquire) ;
+  if ((nullptr == result) && (mCount >= kIndexedMapMinimumCount)) {
+  //--- Build the index; a shared map may be searched by several threads, only one index is published
+    TC_UniqueArray <cMapNode *> stack ;
+    cMapIndex * newIndex = nullptr ;
+    macroMyNew (newIndex, cMapIndex (mCount)) ;
+    cMapNode * node = mRoot ;
+    while ((nullptr != node) || (stack.count () > 0)) {
+      if (nullptr != node) {
+        stack.appendObject (node) ;
+        node = node->mInfPtr ;
+      }else{
+        node = stack.lastObject (HERE) ;
+        stack.removeLastObject (HERE) ;
+        newIndex->insert (node) ;
+        node = node->mSupPtr ;
+      }
+    }
+    if (mIndex.compare_exchange_strong (result, newIndex, std::memory_order_acq_rel)) {
+      result = newIndex ;
+    }else{
+      macroMyDelete (newIndex) ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cMapNode * cSharedMapRoot::findNode (const C_String & inKey,
+                                     const uint32_t inKeyHash) const {
+  cMapNode * result = nullptr ;
+  const cMapIndex * mapIndex = index () ;
+  if (nullptr != mapIndex) {
+    result = mapIndex->find (inKey, inKeyHash) ;
+  }else{
+    cMapNode * currentNode = mRoot ;
+    while ((currentNode != nullptr) && (nullptr == result)) {
+      macroValidPointer (currentNode) ;
+      const int32_t comparaison = currentNode->mKey.compare (inKey) ;
+      if (comparaison > 0) {
+        currentNode = currentNode->mInfPtr ;
+      }else if (comparaison < 0) {
+        currentNode = currentNode->mSupPtr ;
+      }else{ // Found
+        result = currentNode ;
+      }
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  The nodes from the root to the returned node are insulated, so that the returned node can be modified.
+
+cMapNode * cSharedMapRoot::findNodeForWriting (const C_String & inKey,
+                                               const uint32_t inKeyHash) {
+  cMapNode * result = nullptr ;
+  if (nullptr != findNode (inKey, inKeyHash)) {
+    cMapIndex * mapIndex = mIndex.load (std::memory_order_relaxed) ;
+    cMapNode * * currentNodePtr = & mRoot ;
+    while (nullptr == result) {
+      insulateNode (*currentNodePtr, mapIndex) ;
+      cMapNode * currentNode = *currentNodePtr ;
+      const int32_t comparaison = currentNode->mKey.compare (inKey) ;
+      if (comparaison > 0) {
+        currentNodePtr = & currentNode->mInfPtr ;
+      }else if (comparaison < 0) {
+        currentNodePtr = & currentNode->mSupPtr ;
+      }else{ // Found
+        result = currentNode ;
+      }
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 cMapNode * cSharedMapRoot::findEntryInMapAtLevel (const C_String & inKey,
                                                   const uint32_t inLevel,
                                                   const cSharedMapRoot * inFirstMap) const {
@@ -384,18 +703,7 @@ cMapNode * cSharedMapRoot::findEntryInMapAtLevel (const C_String & inKey,
   uint32_t level = 0 ;
   while ((nullptr != currentMap) && (nullptr == result)) {
     if (inLevel == level) {
-      cMapNode * currentNode = currentMap->mRoot ;
-      while ((currentNode != nullptr) && (nullptr == result)) {
-        macroValidPointer (currentNode) ;
-        const int32_t comparaison = currentNode->mKey.compare (inKey) ;
-        if (comparaison > 0) {
-          currentNode = currentNode->mInfPtr ;
-        }else if (comparaison < 0) {
-          currentNode = currentNode->mSupPtr ;
-        }else{ // Found
-          result = currentNode ;
-        }
-      }
+      result = currentMap->findNode (inKey, inKey.hash ()) ;
     }
     level ++ ;
     currentMap = currentMap->mOverridenMap ;
@@ -408,20 +716,24 @@ cMapNode * cSharedMapRoot::findEntryInMapAtLevel (const C_String & inKey,
 cMapNode * cSharedMapRoot::findEntryInMap (const C_String & inKey,
                                            const cSharedMapRoot * inFirstMap) const {
   cMapNode * result = nullptr ;
+  const uint32_t keyHash = inKey.hash () ;
   const cSharedMapRoot * currentMap = inFirstMap ;
   while ((nullptr != currentMap) && (nullptr == result)) {
-    cMapNode * currentNode = currentMap->mRoot ;
-    while ((currentNode != nullptr) && (nullptr == result)) {
-      macroValidPointer (currentNode) ;
-      const int32_t comparaison = currentNode->mKey.compare (inKey) ;
-      if (comparaison > 0) {
-        currentNode = currentNode->mInfPtr ;
-      }else if (comparaison < 0) {
-        currentNode = currentNode->mSupPtr ;
-      }else{ // Found
-        result = currentNode ;
-      }
-    }
+    result = currentMap->findNode (inKey, keyHash) ;
+    currentMap = currentMap->mOverridenMap ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Nodes are insulated in the map where the key is found, so that the returned node is not shared with an other map.
+
+cMapNode * cSharedMapRoot::findEntryInMapForWriting (const C_String & inKey) {
+  cMapNode * result = nullptr ;
+  const uint32_t keyHash = inKey.hash () ;
+  cSharedMapRoot * currentMap = this ;
+  while ((nullptr != currentMap) && (nullptr == result)) {
+    result = currentMap->findNodeForWriting (inKey, keyHash) ;
     currentMap = currentMap->mOverridenMap ;
   }
   return result ;
@@ -484,7 +796,7 @@ cCollectionElement * AC_GALGAS_map::readWriteAccessForWithInstructionWithErrorMe
   if (isValid () && inKey.isValid ()) {
     insulate (HERE) ;
     const C_String key = inKey.mProperty_string.stringValue () ;
-    cMapNode * node = mSharedMap->findEntryInMap (key, mSharedMap) ;
+    cMapNode * node = mSharedMap->findEntryInMapForWriting (key) ;
     if (nullptr == node) {
       TC_UniqueArray <C_String> nearestKeyArray ;
       if (mActivateReplacementSuggestions) {
@@ -506,7 +818,10 @@ cCollectionElement * AC_GALGAS_map::readWriteAccessForWithInstructionWithErrorMe
 
 //----------------------------------------------------------------------------------------------------------------------
 
-static void rotateLeft (cMapNode * & ioRootPtr) {
+static void rotateLeft (cMapNode * & ioRootPtr,
+                        cMapIndex * ioIndex) {
+  insulateNode (ioRootPtr, ioIndex) ;
+  insulateNode (ioRootPtr->mSupPtr, ioIndex) ;
   cMapNode * b = ioRootPtr->mSupPtr ;
   ioRootPtr->mSupPtr = b->mInfPtr ;
   b->mInfPtr = ioRootPtr;
@@ -527,7 +842,10 @@ static void rotateLeft (cMapNode * & ioRootPtr) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
-static void rotateRight (cMapNode * & ioRootPtr) {
+static void rotateRight (cMapNode * & ioRootPtr,
+                         cMapIndex * ioIndex) {
+  insulateNode (ioRootPtr, ioIndex) ;
+  insulateNode (ioRootPtr->mInfPtr, ioIndex) ;
   cMapNode * b = ioRootPtr->mInfPtr ;
   ioRootPtr->mInfPtr = b->mSupPtr ;
   b->mSupPtr = ioRootPtr ;
@@ -549,41 +867,47 @@ static void rotateRight (cMapNode * & ioRootPtr) {
 
 static bool internalInsertOrReplace (cMapNode * & ioRootPtr,
                                      const C_String & inKey,
+                                     const uint32_t inKeyHash,
                                      const capCollectionElement & ioAttributeArray,
+                                     cMapIndex * ioIndex,
                                      bool & ioExtension) {
   bool anObjectHasBeenAdded = false ;
   if (ioRootPtr == nullptr) {
-    macroMyNew (ioRootPtr, cMapNode (inKey, ioAttributeArray)) ;
+    macroMyNew (ioRootPtr, cMapNode (inKey, inKeyHash, ioAttributeArray)) ;
+    if (nullptr != ioIndex) {
+      ioIndex->insert (ioRootPtr) ;
+    }
     ioExtension = true ;
     anObjectHasBeenAdded = true ;
   }else{
     macroValidPointer (ioRootPtr) ;
+    insulateNode (ioRootPtr, ioIndex) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
-      anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mInfPtr, inKey, ioAttributeArray, ioExtension) ;
+      anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mInfPtr, inKey, inKeyHash, ioAttributeArray, ioIndex, ioExtension) ;
       if (ioExtension) {
         ioRootPtr->mBalance++;
         if (ioRootPtr->mBalance == 0) {
           ioExtension = false;
         }else if (ioRootPtr->mBalance == 2) {
           if (ioRootPtr->mInfPtr->mBalance == -1) {
-            rotateLeft (ioRootPtr->mInfPtr) ;
+            rotateLeft (ioRootPtr->mInfPtr, ioIndex) ;
           }
-          rotateRight (ioRootPtr) ;
+          rotateRight (ioRootPtr, ioIndex) ;
           ioExtension = false;
         }
       }
     }else if (comparaison < 0) {
-      anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mSupPtr, inKey, ioAttributeArray, ioExtension) ;
+      anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mSupPtr, inKey, inKeyHash, ioAttributeArray, ioIndex, ioExtension) ;
       if (ioExtension) {
         ioRootPtr->mBalance-- ;
         if (ioRootPtr->mBalance == 0) {
           ioExtension = false ;
         }else if (ioRootPtr->mBalance == -2) {
           if (ioRootPtr->mSupPtr->mBalance == 1) {
-            rotateRight (ioRootPtr->mSupPtr) ;
+            rotateRight (ioRootPtr->mSupPtr, ioIndex) ;
           }
-          rotateLeft (ioRootPtr) ;
+          rotateLeft (ioRootPtr, ioIndex) ;
           ioExtension = false;
         }
       }
@@ -607,7 +931,8 @@ void cSharedMapRoot::performInsertOrReplace (const capCollectionElement & inAttr
     const C_String key = string_key.stringValue () ;
   //--- Insert or replace
     bool extension ; // Unused here
-    const bool anObjectHasBeenAdded = internalInsertOrReplace (mRoot, key, inAttributes, extension) ;
+    const bool anObjectHasBeenAdded = internalInsertOrReplace (mRoot, key, key.hash (), inAttributes,
+                                                               mIndex.load (std::memory_order_relaxed), extension) ;
     if (anObjectHasBeenAdded) {
       mCount ++ ;
     }
@@ -636,18 +961,18 @@ void AC_GALGAS_map::performInsertOrReplace (const capCollectionElement & inAttri
 
 //----------------------------------------------------------------------------------------------------------------------
 
-cMapNode::cMapNode (cMapNode * inNode) :
-mInfPtr (nullptr),
-mSupPtr (nullptr),
+//--- The copy of a node shares the subtrees of the original node
+
+cMapNode::cMapNode (const cMapNode * inNode) :
+mInfPtr (inNode->mInfPtr),
+mSupPtr (inNode->mSupPtr),
 mBalance (inNode->mBalance),
+mRetainCount (1),
+mKeyHash (inNode->mKeyHash),
 mKey (inNode->mKey),
 mAttributes (inNode->mAttributes) {
-  if (inNode->mInfPtr != nullptr) {
-    macroMyNew (mInfPtr, cMapNode (inNode->mInfPtr)) ;
-  }
-  if (inNode->mSupPtr != nullptr) {
-    macroMyNew (mSupPtr, cMapNode (inNode->mSupPtr)) ;
-  }
+  retainNode (mInfPtr) ;
+  retainNode (mSupPtr) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -659,9 +984,8 @@ void cSharedMapRoot::copyFrom (const cSharedMapRoot * inSource) {
   #endif
   macroValidSharedObject (inSource, cSharedMapRoot) ;
   mCount = inSource->mCount ;
-  if (nullptr != inSource->mRoot) {
-    macroMyNew (mRoot, cMapNode (inSource->mRoot)) ;
-  }
+  mRoot = inSource->mRoot ;
+  retainNode (mRoot) ;
   macroAssignSharedObject (mOverridenMap, inSource->mOverridenMap) ;
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkMap (HERE) ;
@@ -689,9 +1013,8 @@ void cSharedMapRoot::copyCurrentAndOverridenMapsFrom (const cSharedMapRoot * inS
   #endif
   macroValidSharedObject (inSource, cSharedMapRoot) ;
   mCount = inSource->mCount ;
-  if (nullptr != inSource->mRoot) {
-    macroMyNew (mRoot, cMapNode (inSource->mRoot)) ;
-  }
+  mRoot = inSource->mRoot ;
+  retainNode (mRoot) ;
   if (nullptr != inSource->mOverridenMap) {
     macroMyNew (mOverridenMap, cSharedMapRoot (mActivateReplacementSuggestions COMMA_HERE)) ;
     mOverridenMap->copyCurrentAndOverridenMapsFrom (inSource->mOverridenMap) ;
@@ -705,7 +1028,7 @@ void cSharedMapRoot::copyCurrentAndOverridenMapsFrom (const cSharedMapRoot * inS
 
 void AC_GALGAS_map::insulateCurrentAndOverridenMaps (LOCATION_ARGS) {
   if (nullptr != mSharedMap) {
-  //--- Perform a deep copy if any of the overriden maps is shared
+  //--- Copy the maps if any of the overriden maps is shared
     bool performDeepCopy = !mSharedMap->isUniquelyReferenced () ;
     cSharedMapRoot * overridenMap = mSharedMap->mOverridenMap ;
     while ((nullptr != overridenMap) && !performDeepCopy) {
@@ -732,42 +1055,50 @@ void AC_GALGAS_map::insulateCurrentAndOverridenMaps (LOCATION_ARGS) {
 
 static cMapNode * internalInsert (cMapNode * & ioRootPtr,
                                   const C_String & inKey,
+                                  const uint32_t inKeyHash,
                                   const capCollectionElement & inAttributes,
+                                  cMapIndex * ioIndex,
                                   bool & outEntryAlreadyExists,
                                   bool & ioExtension) {
   cMapNode * matchingEntry = nullptr ;
   if (ioRootPtr == nullptr) {
-    macroMyNew (ioRootPtr, cMapNode (inKey, inAttributes)) ;
+    macroMyNew (ioRootPtr, cMapNode (inKey, inKeyHash, inAttributes)) ;
+    if (nullptr != ioIndex) {
+      ioIndex->insert (ioRootPtr) ;
+    }
     ioExtension = true ;
     matchingEntry = ioRootPtr ;
   }else{
     macroValidPointer (ioRootPtr) ;
+    insulateNode (ioRootPtr, ioIndex) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
-      matchingEntry = internalInsert (ioRootPtr->mInfPtr, inKey, inAttributes, outEntryAlreadyExists, ioExtension) ;
+      matchingEntry = internalInsert (ioRootPtr->mInfPtr, inKey, inKeyHash, inAttributes, ioIndex,
+                                      outEntryAlreadyExists, ioExtension) ;
       if (ioExtension) {
         ioRootPtr->mBalance ++ ;
         if (ioRootPtr->mBalance == 0) {
           ioExtension = false;
         }else if (ioRootPtr->mBalance == 2) {
           if (ioRootPtr->mInfPtr->mBalance == -1) {
-            rotateLeft (ioRootPtr->mInfPtr) ;
+            rotateLeft (ioRootPtr->mInfPtr, ioIndex) ;
           }
-          rotateRight (ioRootPtr) ;
+          rotateRight (ioRootPtr, ioIndex) ;
           ioExtension = false;
         }
       }
     }else if (comparaison < 0) {
-      matchingEntry = internalInsert (ioRootPtr->mSupPtr, inKey, inAttributes, outEntryAlreadyExists, ioExtension) ;
+      matchingEntry = internalInsert (ioRootPtr->mSupPtr, inKey, inKeyHash, inAttributes, ioIndex,
+                                      outEntryAlreadyExists, ioExtension) ;
       if (ioExtension) {
         ioRootPtr->mBalance-- ;
         if (ioRootPtr->mBalance == 0) {
           ioExtension = false ;
         }else if (ioRootPtr->mBalance == -2) {
           if (ioRootPtr->mSupPtr->mBalance == 1) {
-            rotateRight (ioRootPtr->mSupPtr) ;
+            rotateRight (ioRootPtr->mSupPtr, ioIndex) ;
           }
-          rotateLeft (ioRootPtr) ;
+          rotateLeft (ioRootPtr, ioIndex) ;
           ioExtension = false;
         }
       }
@@ -800,7 +1131,8 @@ cMapNode * cSharedMapRoot::performInsert (const capCollectionElement & inAttribu
   //--- Insert or replace
     bool extension = false ; // Unused here
     bool entryAlreadyExists = false ;
-    cMapNode * matchingEntry = internalInsert (mRoot, key, inAttributes, entryAlreadyExists, extension) ;
+    cMapNode * matchingEntry = internalInsert (mRoot, key, key.hash (), inAttributes, mIndex.load (std::memory_order_relaxed),
+                                               entryAlreadyExists, extension) ;
     if (! entryAlreadyExists) {
       result = matchingEntry ;
       mCount ++ ;
@@ -1265,7 +1597,7 @@ cMapElement * cSharedMapRoot::searchForReadWriteAttribute (const GALGAS_string &
   cMapElement * result = nullptr ;
   if (inKey.isValid ()) {
     const C_String key = inKey.stringValue () ;
-    cMapNode * node = findEntryInMap (key, this) ;
+    cMapNode * node = findEntryInMapForWriting (key) ;
     if (nullptr != node) {
       node->mAttributes.insulate () ;
       result = (cMapElement *) node->mAttributes.ptr () ;
@@ -1314,7 +1646,7 @@ cMapElement * cSharedMapRoot::searchForReadWriteAttribute (const GALGAS_lstring
   cMapElement * result = nullptr ;
   if (inKey.isValid ()) {
     const C_String key = inKey.mProperty_string.stringValue () ;
-    cMapNode * node = findEntryInMap (key, this) ;
+    cMapNode * node = findEntryInMapForWriting (key) ;
     if (nullptr != node) {
       node->mAttributes.insulate () ;
       result = (cMapElement *) node->mAttributes.ptr () ;
@@ -1356,6 +1688,7 @@ cMapElement * AC_GALGAS_map::searchForReadWriteAttribute (const GALGAS_lstring &
 //----------------------------------------------------------------------------------------------------------------------
 
 static void supBranchDecreased (cMapNode * & ioRoot,
+                                cMapIndex * ioIndex,
                                 bool & ioBranchHasBeenRemoved) {
   ioRoot->mBalance ++ ;
   switch (ioRoot->mBalance) {
@@ -1367,15 +1700,15 @@ static void supBranchDecreased (cMapNode * & ioRoot,
   case 2:
     switch (ioRoot->mInfPtr->mBalance) {
     case -1:
-      rotateLeft (ioRoot->mInfPtr) ;
-      rotateRight (ioRoot) ;
+      rotateLeft (ioRoot->mInfPtr, ioIndex) ;
+      rotateRight (ioRoot, ioIndex) ;
       break;
     case 0:
-      rotateRight (ioRoot) ;
+      rotateRight (ioRoot, ioIndex) ;
       ioBranchHasBeenRemoved = false;
       break;
     case 1:
-      rotateRight (ioRoot) ;
+      rotateRight (ioRoot, ioIndex) ;
       break;
     }
     break;
@@ -1385,6 +1718,7 @@ static void supBranchDecreased (cMapNode * & ioRoot,
 //----------------------------------------------------------------------------------------------------------------------
 
 static void infBranchDecreased (cMapNode * & ioRoot,
+                                cMapIndex * ioIndex,
                                 bool & ioBranchHasBeenRemoved) {
   ioRoot->mBalance -- ;
   switch (ioRoot->mBalance) {
@@ -1396,15 +1730,15 @@ static void infBranchDecreased (cMapNode * & ioRoot,
   case -2:
     switch (ioRoot->mSupPtr->mBalance) {
     case 1:
-      rotateRight (ioRoot->mSupPtr) ;
-      rotateLeft (ioRoot) ;
+      rotateRight (ioRoot->mSupPtr, ioIndex) ;
+      rotateLeft (ioRoot, ioIndex) ;
       break;
     case 0:
-      rotateLeft (ioRoot) ;
+      rotateLeft (ioRoot, ioIndex) ;
       ioBranchHasBeenRemoved = false;
       break;
     case -1:
-      rotateLeft (ioRoot) ;
+      rotateLeft (ioRoot, ioIndex) ;
       break;
     }
     break;
@@ -1415,15 +1749,17 @@ static void infBranchDecreased (cMapNode * & ioRoot,
 
 static void getPreviousElement (cMapNode * & ioRoot,
                                 cMapNode * & ioElement,
+                                cMapIndex * ioIndex,
                                 bool & ioBranchHasBeenRemoved) {
+  insulateNode (ioRoot, ioIndex) ;
   if (ioRoot->mSupPtr == nullptr) {
     ioElement = ioRoot ;
     ioRoot = ioRoot->mInfPtr ;
     ioBranchHasBeenRemoved = true ;
   }else{
-    getPreviousElement (ioRoot->mSupPtr, ioElement, ioBranchHasBeenRemoved) ;
+    getPreviousElement (ioRoot->mSupPtr, ioElement, ioIndex, ioBranchHasBeenRemoved) ;
     if (ioBranchHasBeenRemoved) {
-      supBranchDecreased (ioRoot, ioBranchHasBeenRemoved) ;
+      supBranchDecreased (ioRoot, ioIndex, ioBranchHasBeenRemoved) ;
     }
   }
 }
@@ -1432,19 +1768,21 @@ static void getPreviousElement (cMapNode * & ioRoot,
 
 static cMapNode * internalRemoveEntry (const C_String & inKeyToRemove,
                                        cMapNode * & ioRoot,
+                                       cMapIndex * ioIndex,
                                        bool & ioBranchHasBeenRemoved) {
   cMapNode * removedNode = nullptr ;
   if (ioRoot != nullptr) {
+    insulateNode (ioRoot, ioIndex) ;
     const int32_t comparaison = ioRoot->mKey.compare (inKeyToRemove) ;
     if (comparaison > 0) {
-      removedNode = internalRemoveEntry (inKeyToRemove, ioRoot->mInfPtr, ioBranchHasBeenRemoved);
+      removedNode = internalRemoveEntry (inKeyToRemove, ioRoot->mInfPtr, ioIndex, ioBranchHasBeenRemoved);
       if (ioBranchHasBeenRemoved) {
-        infBranchDecreased (ioRoot, ioBranchHasBeenRemoved) ;
+        infBranchDecreased (ioRoot, ioIndex, ioBranchHasBeenRemoved) ;
       }
     }else if (comparaison < 0) {
-      removedNode = internalRemoveEntry (inKeyToRemove, ioRoot->mSupPtr, ioBranchHasBeenRemoved);
+      removedNode = internalRemoveEntry (inKeyToRemove, ioRoot->mSupPtr, ioIndex, ioBranchHasBeenRemoved);
       if (ioBranchHasBeenRemoved) {
-        supBranchDecreased (ioRoot, ioBranchHasBeenRemoved);
+        supBranchDecreased (ioRoot, ioIndex, ioBranchHasBeenRemoved);
       }
     }else{ // Found
       removedNode = ioRoot ;
@@ -1458,7 +1796,7 @@ static cMapNode * internalRemoveEntry (const C_String & inKeyToRemove,
         p->mInfPtr = nullptr;
         ioBranchHasBeenRemoved = true;
       }else{
-        getPreviousElement (p->mInfPtr, ioRoot, ioBranchHasBeenRemoved) ;
+        getPreviousElement (p->mInfPtr, ioRoot, ioIndex, ioBranchHasBeenRemoved) ;
         ioRoot->mSupPtr = p->mSupPtr;
         p->mSupPtr = nullptr;
         ioRoot->mInfPtr = p->mInfPtr;
@@ -1466,7 +1804,7 @@ static cMapNode * internalRemoveEntry (const C_String & inKeyToRemove,
         ioRoot->mBalance = p->mBalance;
         p->mBalance = 0;
         if (ioBranchHasBeenRemoved) {
-          infBranchDecreased (ioRoot, ioBranchHasBeenRemoved) ;
+          infBranchDecreased (ioRoot, ioIndex, ioBranchHasBeenRemoved) ;
         }
       }
     }
@@ -1485,7 +1823,8 @@ void cSharedMapRoot::performRemove (GALGAS_lstring & inKey,
   if (inKey.isValid ()) {
     const C_String key = inKey.mProperty_string.stringValue () ;
     bool branchHasBeenRemoved = false ;
-    cMapNode * node = internalRemoveEntry (key, mRoot, branchHasBeenRemoved) ;
+    cMapIndex * mapIndex = mIndex.load (std::memory_order_relaxed) ;
+    cMapNode * node = internalRemoveEntry (key, mRoot, mapIndex, branchHasBeenRemoved) ;
     if (nullptr == node) {
     //--- Build error message
       C_String message ;
@@ -1510,7 +1849,10 @@ void cSharedMapRoot::performRemove (GALGAS_lstring & inKey,
       inCompiler->semanticErrorAtLocation (key_location, message, TC_Array <C_FixItDescription> () COMMA_THERE) ;
     }else{ // Ok, found
       outResult = node->mAttributes ;
-      macroMyDelete (node) ;
+      if (nullptr != mapIndex) {
+        mapIndex->remove (node) ;
+      }
+      releaseNode (node) ;
       mCount -- ;
     }
   }
@@ -0,0 +1,507 @@
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Build manifest: skips the generation from a source file when its inputs did not change.
+//
+//  While a manifest is recorded, the files read or tested for existence and the templates, functions, getters and
+//  setters executed are noted as inputs of the innermost output block rendered by the current thread, or as global
+//  inputs outside of the blocks. A missing file is recorded with the '-' hash, so a failed lookup, like the OIL
+//  include path search, is invalidated when the file appears. A block is reusable by a later run when it cannot
+//  have an effect other than writing its files: it is isolated, it prints nothing and raises no error or warning;
+//  the caller may prevent its reuse for other reasons. A previous run is reused only if the tool version, the
+//  command line, the global inputs and the listing of the directories did not change. The contents of the files are
+//  hashed when the manifest is stored.
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "galgas2/C_BuildManifest.h"
+#include "galgas2/C_Compiler.h"
+#include "galgas2/C_galgas_io.h"
+#include "galgas2/F_verbose_output.h"
+#include "files/C_FileManager.h"
+#include "command_line_interface/F_Analyze_CLI_Options.h"
+#include "utilities/C_Data.h"
+#include "utilities/md5.h"
+#include "all-predefined-types.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static const char * kBuildManifestFormat = "goil build manifest 1" ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class cBuildManifestBlock final {
+  public: cBuildManifestBlock (void) :
+  mFileName (),
+  mInputs (),
+  mOutputs (),
+  mIsReusable (true) {
+  }
+
+  public: std::string mFileName ;
+//--- File path -> content hash, only known for the blocks of the previous run
+  public: std::map <std::string, std::string> mInputs ;
+  public: std::map <std::string, std::string> mOutputs ;
+  public: bool mIsReusable ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool gManifestIsRecorded = false ;
+
+static C_String gManifestFilePath ;
+
+static std::string gManifestCommandLine ;
+
+static void (* gDirectoryEnumerator) (TC_UniqueArray <C_String> & outDirectories) = nullptr ;
+
+static std::mutex gManifestMutex ;
+
+//--- Inputs of the generation outside of the blocks
+static std::map <std::string, std::string> gManifestInputs ;
+
+//--- Outermost blocks, by file name
+static std::multimap <std::string, cBuildManifestBlock> gManifestBlocks ;
+
+//--- Reusable blocks of the previous run, by file name; they are only read while the manifest is recorded
+static std::map <std::string, cBuildManifestBlock> gReusableManifestBlocks ;
+
+//--- Content hashes of the inputs
+static std::unordered_map <std::string, std::string> gInputContentHashes ;
+
+static thread_local cBuildManifestBlock * gCurrentManifestBlock = nullptr ;
+
+//--- Incremented each time the current block changes
+static thread_local uint32_t gManifestBlockGeneration = 0 ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool buildManifestIsRecorded (void) {
+  return gManifestIsRecorded ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void setBuildManifestDirectoryEnumerator (void (* inEnumerator) (TC_UniqueArray <C_String> & outDirectories)) {
+  gDirectoryEnumerator = inEnumerator ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::string fileContentHash (const std::string & inFilePath) {
+  std::string result ("-") ; // No file, or a file that cannot be read
+  C_Data data ;
+  if (C_FileManager::binaryDataWithContentOfFile (C_String (inFilePath.c_str ()), data)) {
+    uint8_t digest [16] ;
+    MD5_CTX context ;
+    MD5_Init (& context) ;
+    MD5_Update (& context, data.unsafeDataPointer (), (unsigned long) data.count ()) ;
+    MD5_Final (digest, & context) ;
+    char s [40] ;
+    result.clear () ;
+    for (uint32_t i=0 ; i<16 ; i++) {
+      snprintf (s, 40, "%02X", digest [i]) ;
+      result += s ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Inputs are not written by the generation: their hash is computed once.
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::string inputContentHash (const std::string & inFilePath) {
+  std::lock_guard <std::mutex> lock (gManifestMutex) ;
+  std::unordered_map <std::string, std::string>::const_iterator it = gInputContentHashes.find (inFilePath) ;
+  if (it == gInputContentHashes.end ()) {
+    it = gInputContentHashes.insert (std::make_pair (inFilePath, fileContentHash (inFilePath))).first ;
+  }
+  return it->second ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static int32_t compareFileNames (const C_String & inLeft, const C_String & inRight) {
+  return inLeft.compare (inRight) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::string directoryListingHash (const std::string & inDirectoryPath) {
+  TC_UniqueArray <C_String> fileNames ;
+  C_FileManager::findRegularFileNamesInDirectory (C_String (inDirectoryPath.c_str ()), fileNames) ;
+  fileNames.sortArrayUsingFunction (compareFileNames) ;
+  C_String listing ;
+  for (int32_t i=0 ; i<fileNames.count () ; i++) {
+    listing << fileNames (i COMMA_HERE) << "\n" ;
+  }
+  return listing.md5 ().cString (HERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void noteManifestInputPath (const C_String & inFilePath) {
+  if (inFilePath.length () > 0) {
+    const std::string filePath (inFilePath.cString (HERE)) ;
+    cBuildManifestBlock * block = gCurrentManifestBlock ;
+    if (nullptr != block) {
+      block->mInputs [filePath] ;
+    }else{
+      std::lock_guard <std::mutex> lock (gManifestMutex) ;
+      gManifestInputs [filePath] ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void noteFileReadInManifest (const C_String & inFilePath) {
+  if (gManifestIsRecorded) {
+    noteManifestInputPath (inFilePath) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void noteBuildManifestInput (const GALGAS_string & inFilePath) {
+  if (gManifestIsRecorded && inFilePath.isValid ()) {
+    noteManifestInputPath (inFilePath.stringValue ()) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Called for each function, getter and setter call: the source text of the last call is remembered, as the calls
+//  of a loop are usually in the same file.
+//----------------------------------------------------------------------------------------------------------------------
+
+void noteBuildManifestInput (const GALGAS_location & inLocation) {
+  static thread_local C_SourceTextInString gLastSourceText ;
+  static thread_local uint32_t gLastBlockGeneration = 0 ;
+  if (gManifestIsRecorded && inLocation.isValid ()) {
+    const C_SourceTextInString sourceText = inLocation.sourceText () ;
+    if ((sourceText != gLastSourceText) || (gLastBlockGeneration != gManifestBlockGeneration)) {
+      gLastSourceText = sourceText ;
+      gLastBlockGeneration = gManifestBlockGeneration ;
+      noteManifestInputPath (sourceText.sourceFilePath ()) ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void preventReuseOfCurrentBuildManifestBlock (void) {
+  cBuildManifestBlock * block = gCurrentManifestBlock ;
+  if (nullptr != block) {
+    block->mIsReusable = false ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  The command line is hashed with the current directory and the configuration given by the caller.
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::string commandLineHash (const C_String & inConfiguration) {
+  C_String commandLine ;
+  commandLine << C_FileManager::currentDirectory () << "\n" ;
+  for (uint32_t i=1 ; i<commandLineArgumentCount () ; i++) {
+    commandLine << commandLineArgumentAtIndex (i) << "\n" ;
+  }
+  commandLine << inConfiguration << "\n" ;
+  return commandLine.md5 ().cString (HERE) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void appendManifestBlock (const cBuildManifestBlock & inBlock) {
+  cBuildManifestBlock * enclosingBlock = gCurrentManifestBlock ;
+  if (nullptr != enclosingBlock) {
+    enclosingBlock->mInputs.insert (inBlock.mInputs.begin (), inBlock.mInputs.end ()) ;
+    enclosingBlock->mOutputs.insert (inBlock.mOutputs.begin (), inBlock.mOutputs.end ()) ;
+    enclosingBlock->mIsReusable = enclosingBlock->mIsReusable && inBlock.mIsReusable ;
+  }else{
+    std::lock_guard <std::mutex> lock (gManifestMutex) ;
+    gManifestBlocks.insert (std::make_pair (inBlock.mFileName, inBlock)) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool manifestBlockIsUnchanged (const cBuildManifestBlock & inBlock) {
+  bool result = true ;
+  for (std::map <std::string, std::string>::const_iterator it = inBlock.mInputs.begin () ;
+       result && (it != inBlock.mInputs.end ()) ; ++it) {
+    result = inputContentHash (it->first) == it->second ;
+  }
+  for (std::map <std::string, std::string>::const_iterator it = inBlock.mOutputs.begin () ;
+       result && (it != inBlock.mOutputs.end ()) ; ++it) {
+    result = fileContentHash (it->first) == it->second ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  A block of the previous run is reused when its inputs and the files it wrote did not change.
+//----------------------------------------------------------------------------------------------------------------------
+
+bool reuseBuildManifestBlock (const GALGAS_string & inFileName) {
+  bool result = false ;
+  if (gManifestIsRecorded && inFileName.isValid ()) {
+    std::map <std::string, cBuildManifestBlock>::const_iterator it = gReusableManifestBlocks.find (inFileName.stringValue ().cString (HERE)) ;
+    result = (it != gReusableManifestBlocks.end ()) && manifestBlockIsUnchanged (it->second) ;
+    if (result) {
+      appendManifestBlock (it->second) ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_BuildManifestBlockRecorder::C_BuildManifestBlockRecorder (const GALGAS_string & inFileName,
+                                                            const bool inIsIsolated) :
+mBlock (nullptr),
+mEnclosingBlock (gCurrentManifestBlock),
+mErrorCount (0),
+mWarningCount (0),
+mFileWritten (false) {
+  if (gManifestIsRecorded && inFileName.isValid ()) {
+    mBlock = new cBuildManifestBlock () ;
+    mBlock->mFileName = inFileName.stringValue ().cString (HERE) ;
+    mBlock->mIsReusable = inIsIsolated ;
+    mErrorCount = totalErrorCount () ;
+    mWarningCount = totalWarningCount () ;
+    gCurrentManifestBlock = mBlock ;
+    gManifestBlockGeneration += 1 ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  A block that does not write its file is not reusable.
+//----------------------------------------------------------------------------------------------------------------------
+
+C_BuildManifestBlockRecorder::~ C_BuildManifestBlockRecorder (void) {
+  if (nullptr != mBlock) {
+    gCurrentManifestBlock = mEnclosingBlock ;
+    gManifestBlockGeneration += 1 ;
+    mBlock->mIsReusable = mBlock->mIsReusable
+      && mFileWritten
+      && (mErrorCount == totalErrorCount ())
+      && (mWarningCount == totalWarningCount ()) ;
+    appendManifestBlock (* mBlock) ;
+    delete mBlock ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_BuildManifestBlockRecorder::noteFileWritten (void) {
+  if (nullptr != mBlock) {
+    mBlock->mOutputs [mBlock->mFileName] ;
+    mFileWritten = true ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_BuildManifestBlockRecorder::preventReuse (void) {
+  if (nullptr != mBlock) {
+    mBlock->mIsReusable = false ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Splits a '<keyword> <hash> <path>' line of the manifest.
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool parseManifestLine (const std::string & inLine,
+                               std::string & outKeyword,
+                               std::string & outHash,
+                               std::string & outPath) {
+  const size_t firstSpace = inLine.find (' ') ;
+  const bool result = firstSpace != std::string::npos ;
+  outKeyword = inLine.substr (0, firstSpace) ;
+  outHash.clear () ;
+  outPath.clear () ;
+  if (result) {
+    const size_t secondSpace = inLine.find (' ', firstSpace + 1) ;
+    if (secondSpace == std::string::npos) {
+      outHash = inLine.substr (firstSpace + 1) ;
+    }else{
+      outHash = inLine.substr (firstSpace + 1, secondSpace - firstSpace - 1) ;
+      outPath = inLine.substr (secondSpace + 1) ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Loads the blocks of the previous run if its global inputs did not change. Returns true if the generation is up
+//  to date: all its blocks are unchanged.
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool loadBuildManifest (const C_String & inManifestFilePath) {
+  TC_UniqueArray <C_String> lines ;
+  if (C_FileManager::fileExistsAtPath (inManifestFilePath)) {
+    C_FileManager::stringWithContentOfFile (inManifestFilePath).componentsSeparatedByString ("\n", lines) ;
+  }
+  bool ok = (lines.count () > 2)
+    && (lines (0 COMMA_HERE) == C_String (kBuildManifestFormat))
+    && (lines (1 COMMA_HERE) == C_String ("version ") + projectVersionString ())
+    && (lines (2 COMMA_HERE) == C_String ("command-line ") + gManifestCommandLine.c_str ()) ;
+  bool upToDate = ok ;
+  cBuildManifestBlock * block = nullptr ;
+  for (int32_t i=3 ; ok && (i<lines.count ()) ; i++) {
+    const std::string line (lines (i COMMA_HERE).cString (HERE)) ;
+    std::string keyword ;
+    std::string hash ;
+    std::string path ;
+    const bool hasHash = parseManifestLine (line, keyword, hash, path) ;
+    if (line.length () == 0) { // Last line
+    }else if ((nullptr == block) && (keyword == "input") && (path.length () > 0)) {
+      ok = inputContentHash (path) == hash ;
+    }else if ((nullptr == block) && (keyword == "directory") && (path.length () > 0)) {
+      ok = directoryListingHash (path) == hash ;
+    }else if ((nullptr == block) && (keyword == "block") && hasHash) {
+      block = & gReusableManifestBlocks [path] ;
+      block->mFileName = path ;
+      block->mIsReusable = hash == "reusable" ;
+    }else if ((nullptr != block) && (keyword == "input") && (path.length () > 0)) {
+      block->mInputs [path] = hash ;
+    }else if ((nullptr != block) && (keyword == "output") && (path.length () > 0)) {
+      block->mOutputs [path] = hash ;
+    }else if ((nullptr != block) && (line == "end")) {
+      upToDate = upToDate && manifestBlockIsUnchanged (* block) ;
+      if (! block->mIsReusable) {
+        gReusableManifestBlocks.erase (block->mFileName) ;
+      }
+      block = nullptr ;
+    }else{
+      ok = false ;
+    }
+  }
+  ok = ok && (nullptr == block) ;
+  if (! ok) {
+    gReusableManifestBlocks.clear () ;
+  }
+  return ok && upToDate ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void closeBuildManifest (void) {
+  if (gManifestIsRecorded) {
+    C_Compiler::setFileReadObserver (nullptr) ;
+    gManifestIsRecorded = false ;
+  }
+  gManifestInputs.clear () ;
+  gManifestBlocks.clear () ;
+  gReusableManifestBlocks.clear () ;
+  gInputContentHashes.clear () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'openBuildManifest'
+//
+//  The manifest of a source file is in its build directory. Unless it is forced, the generation is up to date when
+//  the manifest tells that nothing changed since the run that wrote it; otherwise the generation is recorded until
+//  storeBuildManifest. The manifest is not used when the files are not generated.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_openBuildManifest (const GALGAS_string constinArgument0,
+                                const GALGAS_string constinArgument1,
+                                const GALGAS_bool constinArgument2,
+                                const GALGAS_bool constinArgument3,
+                                GALGAS_bool & outArgument4,
+                                C_Compiler * /* inCompiler */
+                                COMMA_UNUSED_LOCATION_ARGS) {
+  closeBuildManifest () ;
+  bool upToDate = false ;
+  if (constinArgument0.isValid () && constinArgument1.isValid () && constinArgument2.isValid ()
+   && constinArgument3.isValid () && constinArgument2.boolValue () && C_Compiler::performGeneration ()) {
+    const C_String sourceFilePath = C_FileManager::absolutePathFromCurrentDirectory (constinArgument0.stringValue ()) ;
+    gManifestFilePath = sourceFilePath.stringByDeletingLastPathComponent () + "/build/" + sourceFilePath.lastPathComponent () + ".manifest" ;
+    gManifestCommandLine = commandLineHash (constinArgument1.stringValue ()) ;
+    if (! constinArgument3.boolValue ()) {
+      upToDate = loadBuildManifest (gManifestFilePath) ;
+    }
+    if (upToDate) {
+      gReusableManifestBlocks.clear () ;
+      if (verboseOutput ()) {
+        ggs_printMessage (C_String ("Files generated from '") + constinArgument0.stringValue () + "' are up to date.\n" COMMA_HERE) ;
+      }
+    }else{
+      gManifestIsRecorded = true ;
+      gManifestBlockGeneration += 1 ;
+      C_Compiler::setFileReadObserver (noteFileReadInManifest) ;
+    }
+  }
+  outArgument4 = GALGAS_bool (upToDate) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'storeBuildManifest'
+//
+//  A failed generation removes the manifest. A file written by several blocks is not reusable.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_storeBuildManifest (C_Compiler * /* inCompiler */
+                                 COMMA_UNUSED_LOCATION_ARGS) {
+  if (gManifestIsRecorded && ((totalErrorCount () > 0) || (totalWarningCount () > 0))) {
+    C_FileManager::deleteFile (gManifestFilePath) ;
+  }else if (gManifestIsRecorded) {
+    C_String s ;
+    s << kBuildManifestFormat << "\n"
+      << "version " << projectVersionString () << "\n"
+      << "command-line " << gManifestCommandLine.c_str () << "\n" ;
+    for (std::map <std::string, std::string>::const_iterator it = gManifestInputs.begin () ; it != gManifestInputs.end () ; ++it) {
+      s << "input " << inputContentHash (it->first).c_str () << " " << it->first.c_str () << "\n" ;
+    }
+    TC_UniqueArray <C_String> directories ;
+    if (nullptr != gDirectoryEnumerator) {
+      gDirectoryEnumerator (directories) ;
+    }
+    directories.sortArrayUsingFunction (compareFileNames) ;
+    for (int32_t i=0 ; i<directories.count () ; i++) {
+      const std::string directory (directories (i COMMA_HERE).cString (HERE)) ;
+      s << "directory " << directoryListingHash (directory).c_str () << " " << directory.c_str () << "\n" ;
+    }
+    for (std::multimap <std::string, cBuildManifestBlock>::const_iterator it = gManifestBlocks.begin () ; it != gManifestBlocks.end () ; ++it) {
+      const cBuildManifestBlock & block = it->second ;
+      const bool reusable = block.mIsReusable && (gManifestBlocks.count (it->first) == 1) ;
+      s << "block " << (reusable ? "reusable" : "-") << " " << block.mFileName.c_str () << "\n" ;
+      for (std::map <std::string, std::string>::const_iterator in = block.mInputs.begin () ; in != block.mInputs.end () ; ++in) {
+        s << "input " << inputContentHash (in->first).c_str () << " " << in->first.c_str () << "\n" ;
+      }
+      for (std::map <std::string, std::string>::const_iterator out = block.mOutputs.begin () ; out != block.mOutputs.end () ; ++out) {
+        s << "output " << fileContentHash (out->first).c_str () << " " << out->first.c_str () << "\n" ;
+      }
+      s << "end\n" ;
+    }
+    C_FileManager::writeStringToFile (s, gManifestFilePath) ;
+  }
+  closeBuildManifest () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
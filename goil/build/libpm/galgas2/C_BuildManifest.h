@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Build manifest: skips the generation from a source file when its inputs did not change.
+//
+//  The manifest of a source file is stored in its build directory. It records the tool version, the command line
+//  and the content hashes of the files read or looked up by the generation, of the listing of some directories and
+//  of the files written by the output blocks. The inputs of an output block are recorded apart: when only some of
+//  them changed, the other blocks are not rendered again. When nothing changed, the source file is not even parsed.
+//
+//  The manifest is opened and stored by the openBuildManifest and storeBuildManifest routines, the extern procs
+//  declared in goil_routines.galgas.
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "strings/C_String.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class GALGAS_location ;
+class GALGAS_string ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Inputs of the generation, noted while a manifest is recorded
+//----------------------------------------------------------------------------------------------------------------------
+
+bool buildManifestIsRecorded (void) ;
+
+void noteBuildManifestInput (const GALGAS_string & inFilePath) ;
+
+void noteBuildManifestInput (const GALGAS_location & inLocation) ;
+
+//--- The current output block prints a message or hands a part of its work over to a job: it cannot be reused
+void preventReuseOfCurrentBuildManifestBlock (void) ;
+
+//--- The enumerator gives the directories whose listing is an input; it is called when the manifest is stored
+void setBuildManifestDirectoryEnumerator (void (* inEnumerator) (TC_UniqueArray <C_String> & outDirectories)) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Output blocks
+//----------------------------------------------------------------------------------------------------------------------
+
+//--- Returns true if the block writing the file in the previous run can be reused: the file is not written again
+bool reuseBuildManifestBlock (const GALGAS_string & inFileName) ;
+
+//--- Records the rendering of a block writing a file by the current thread. A block is reusable if it is isolated, if
+//    it writes its file and if it raises no error or warning.
+class C_BuildManifestBlockRecorder final {
+  public: C_BuildManifestBlockRecorder (const GALGAS_string & inFileName,
+                                        const bool inIsIsolated) ;
+
+  public: ~ C_BuildManifestBlockRecorder (void) ;
+
+  public: inline bool isActive (void) const { return nullptr != mBlock ; }
+
+  public: void noteFileWritten (void) ;
+
+  public: void preventReuse (void) ;
+
+//--- No copy
+  private: C_BuildManifestBlockRecorder (const C_BuildManifestBlockRecorder &) = delete ;
+  private: C_BuildManifestBlockRecorder & operator = (const C_BuildManifestBlockRecorder &) = delete ;
+
+//--- Private properties
+  private: class cBuildManifestBlock * mBlock ;
+  private: class cBuildManifestBlock * mEnclosingBlock ;
+  private: int32_t mErrorCount ;
+  private: int32_t mWarningCount ;
+  private: bool mFileWritten ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -243,10 +243,31 @@ void C_Compiler::printMessage (const C_String & inMessage
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static void (* gFileReadObserver) (const C_String & inFilePath) = nullptr ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_Compiler::setFileReadObserver (void (* inObserver) (const C_String & inFilePath)) {
+  gFileReadObserver = inObserver ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void C_Compiler::logFileRead (const C_String & inFilePath) {
   if (performLogFileRead ()) {
     printf ("Reading '%s' file.\n", inFilePath.cString (HERE)) ;
   }
+  if (nullptr != gFileReadObserver) {
+    gFileReadObserver (inFilePath) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_Compiler::logFileProbe (const C_String & inFilePath) {
+  if (nullptr != gFileReadObserver) {
+    gFileReadObserver (inFilePath) ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -193,6 +193,12 @@ class C_Compiler : public C_SharedObject {
 
   public: void logFileRead (const C_String & inFilePath) ;
 
+//--- Notes a test of the existence of a file: the result of the test depends on the file
+  public: static void logFileProbe (const C_String & inFilePath) ;
+
+//--- The observer is called for every file read or probed, from the thread that reads it
+  public: static void setFileReadObserver (void (* inObserver) (const C_String & inFilePath)) ;
+
 //--- File generation
   public: static bool performGeneration (void) ;
 
@@ -28,6 +28,10 @@
 #include "galgas2/cIndexingDictionary.h"
 #include "files/C_FileManager.h"
 #include "galgas2/F_verbose_output.h"
+#include "command_line_interface/F_Analyze_CLI_Options.h"
+#include "utilities/C_Data.h"
+#include "time/C_Timer.h"
+#include "time/C_DateTime.h"
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -35,6 +39,11 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <atomic>
+#include <map>
+#include <typeindex>
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -98,6 +107,7 @@ mDebugDepthCounter (0),
 mDebugIsRunning (false),
 mArrayForSecondPassParsing (),
 mIndexForSecondPassParsing (0),
+mSourceTextIsFile (false),
 mLatexOutputString (),
 mLatexNextCharacterToEnterIndex (0) {
 //---
@@ -113,6 +123,7 @@ mLatexNextCharacterToEnterIndex (0) {
       resetAndLoadSourceFromText (source) ;
       mTokenStartLocation.resetWithSourceText (source) ;
       mTokenEndLocation.resetWithSourceText (source) ;
+      mSourceTextIsFile = true ;
     }else if (inCallerCompiler != nullptr) {
       C_String errorMessage ; 
       errorMessage << "cannot read '" << inSourceFileName << "': this file does not exist or is not encoded in UTF8" ;
@@ -143,6 +154,7 @@ mDebugDepthCounter (0),
 mDebugIsRunning (false),
 mArrayForSecondPassParsing (),
 mIndexForSecondPassParsing (0),
+mSourceTextIsFile (false),
 mLatexOutputString (),
 mLatexNextCharacterToEnterIndex (0) {
   const C_SourceTextInString source (inSourceString, inStringForError, verboseOutput ()) ;
@@ -299,6 +311,7 @@ int32_t C_Lexique::findTemplateDelimiterIndex (const cTemplateDelimiter inTempla
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_Lexique::performLexicalAnalysis (void) {
+  const C_PhaseTimer phaseTimer ("lexing") ;
   if (executionModeIsLexicalAnalysisOnly ()) {
     co << "*** PERFORM LEXICAL ANALYSIS ONLY (--mode=lexical-only option) ***\n" ;
   }
@@ -374,9 +387,12 @@ bool C_Lexique::testForInputUTF32String (const utf32 * inTestCstring,
                                          const int32_t inStringLength,
                                          const bool inAdvanceOnMatch) {
 //--- Test
-  bool ok = utf32_strncmp (sourceText ().temporaryUTF32StringAtIndex (mCurrentLocation.index () COMMA_HERE),
-                           inTestCstring,
-                           inStringLength) == 0 ;
+  const C_SourceTextInString source = sourceText () ;
+  const int32_t startIndex = mCurrentLocation.index () ;
+  bool ok = true ;
+  for (int32_t i=0 ; (i<inStringLength) && ok ; i++) {
+    ok = UNICODE_VALUE (source.readCharOrNul (startIndex + i COMMA_HERE)) == UNICODE_VALUE (inTestCstring [i]) ;
+  }
 //--- Avancer dans la lecture si test ok et fin de source non atteinte
   if (ok && inAdvanceOnMatch) {
     advance (inStringLength) ;
@@ -797,7 +813,17 @@ bool C_Lexique::performTopDownParsing (const int32_t inProductions [],
                                        const int32_t inDecisionTable [],
                                        const int32_t inDecisionTableIndexes [],
                                        const int32_t inProgramCounterInitialValue) {
+  const C_PhaseTimer phaseTimer (C_String ("parsing ") + sourceFilePath ().lastPathComponent ()) ;
   bool result = false ;
+//--- Try to reload lexical and first pass parsing from the parse cache
+  const C_String cacheFilePath = parseCacheFilePath (inProgramCounterInitialValue) ;
+  const C_String cacheHeader = (cacheFilePath.length () > 0) ? parseCacheHeader (inProgramCounterInitialValue) : C_String () ;
+  if ((cacheFilePath.length () > 0) && loadParseCache (cacheFilePath, cacheHeader)) {
+    resetForSecondPass () ;
+    return true ;
+  }
+  const int32_t errorCountBeforeParsing = totalErrorCount () ;
+  const int32_t warningCountBeforeParsing = totalWarningCount () ;
 //--- Lexical analysis
   performLexicalAnalysis () ;
   if (! executionModeIsLexicalAnalysisOnly ()) {
@@ -1055,6 +1081,13 @@ bool C_Lexique::performTopDownParsing (const int32_t inProductions [],
          << (result ? "yes" : "no")
          << ") ***\n" ;
     }
+  //--- Only a source text that has been analyzed without any diagnostic is cached
+    if (result
+     && (cacheFilePath.length () > 0)
+     && (totalErrorCount () == errorCountBeforeParsing)
+     && (totalWarningCount () == warningCountBeforeParsing)) {
+      storeParseCache (cacheFilePath, cacheHeader) ;
+    }
   }
 //---
   return result ;
@@ -1062,6 +1095,269 @@ bool C_Lexique::performTopDownParsing (const int32_t inProductions [],
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Parse cache
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//   A cache file contains:
+//     - a header string, that identifies the compiler version and build, the MD5 of the lexique tables, the grammar
+//       entry point, the source file path and the MD5 of the source text; the cache file is used only if its header
+//       is identical;
+//     - the token list, each token with its locations, its template and separator strings, and its attributes;
+//     - the execution array for second pass parsing.
+//   Integers are stored little endian on 4 bytes, strings are stored as a character count followed by UTF-32
+//   characters.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static const char * kParseCacheFormat = "GALGAS parse cache 2" ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_Lexique::appendUInt32ToData (const uint32_t inValue, C_Data & ioData) {
+  ioData.appendByte ((uint8_t) (inValue & 255)) ;
+  ioData.appendByte ((uint8_t) ((inValue >> 8) & 255)) ;
+  ioData.appendByte ((uint8_t) ((inValue >> 16) & 255)) ;
+  ioData.appendByte ((uint8_t) ((inValue >> 24) & 255)) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_Lexique::appendStringToData (const C_String & inString, C_Data & ioData) {
+  const int32_t length = inString.length () ;
+  appendUInt32ToData ((uint32_t) length, ioData) ;
+  for (int32_t i=0 ; i<length ; i++) {
+    appendUInt32ToData (UNICODE_VALUE (inString (i COMMA_HERE)), ioData) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint32_t C_Lexique::uint32FromData (const C_Data & inData, int32_t & ioIndex, bool & ioOk) {
+  uint32_t result = 0 ;
+  if (ioOk && ((ioIndex + 4) <= inData.count ())) {
+    for (int32_t i=3 ; i>=0 ; i--) {
+      result = (result << 8) | inData (ioIndex + i COMMA_HERE) ;
+    }
+    ioIndex += 4 ;
+  }else{
+    ioOk = false ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_String C_Lexique::stringFromData (const C_Data & inData, int32_t & ioIndex, bool & ioOk) {
+  C_String result ;
+  const uint32_t length = uint32FromData (inData, ioIndex, ioOk) ;
+  if (ioOk && (length <= (uint32_t) ((inData.count () - ioIndex) / 4))) {
+    result.setCapacity (length) ;
+    for (uint32_t i=0 ; i<length ; i++) {
+      result.appendUnicodeCharacter (TO_UNICODE (uint32FromData (inData, ioIndex, ioOk)) COMMA_HERE) ;
+    }
+  }else{
+    ioOk = false ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TokenAttributeCoder::C_TokenAttributeCoder (void) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TokenAttributeCoder::~ C_TokenAttributeCoder (void) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Coders are registered by prologue actions, before any source text is parsed: the map is not modified afterwards.
+
+static std::map <std::type_index, const C_TokenAttributeCoder *> & tokenAttributeCoders (void) {
+  static std::map <std::type_index, const C_TokenAttributeCoder *> coders ;
+  return coders ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_TokenAttributeCoder::registerCoder (const std::type_info & inScannerClass,
+                                           const C_TokenAttributeCoder * inCoder) {
+  tokenAttributeCoders () [std::type_index (inScannerClass)] = inCoder ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+const C_TokenAttributeCoder * C_TokenAttributeCoder::coderForScanner (const std::type_info & inScannerClass) {
+  const std::map <std::type_index, const C_TokenAttributeCoder *> & coders = tokenAttributeCoders () ;
+  const std::map <std::type_index, const C_TokenAttributeCoder *>::const_iterator it = coders.find (std::type_index (inScannerClass)) ;
+  return (it == coders.end ()) ? nullptr : it->second ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Returns an empty string if the source text should not be cached
+
+C_String C_Lexique::parseCacheFilePath (const int32_t inProgramCounterInitialValue) const {
+  C_String result ;
+  if (mSourceTextIsFile
+   && (nullptr != C_TokenAttributeCoder::coderForScanner (typeid (*this)))
+   && (executionMode () == kExecutionModeNormal)
+   && ! gOption_galgas_5F_builtin_5F_options_outputConcreteSyntaxTree.mValue) {
+    const C_String directory = parseCacheDirectory () ;
+    if (directory.length () > 0) {
+      C_String key = sourceFilePath () ;
+      key << ":" << cStringWithSigned (inProgramCounterInitialValue) ;
+      result = directory.stringByAppendingPathComponent (key.md5 () + ".parse-cache") ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// The terminal symbols of the scanner, with their keywords and delimiters, and the format of the token attributes.
+
+C_String C_Lexique::lexiqueTablesMD5 (void) const {
+  C_String s ;
+  s << typeid (*this).name () << "\n"
+    << C_TokenAttributeCoder::coderForScanner (typeid (*this))->formatString () << "\n" ;
+  const int32_t terminalCount = terminalVocabularyCount () ;
+  for (int32_t i=0 ; i<terminalCount ; i++) {
+    s << getMessageForTerminal (i) << "\n" ;
+  }
+  return s.md5 () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// The MD5 of the source text is the validity check: the source file has already been read, so its
+// modification date would not save anything. The build id changes whenever the compiler is rebuilt, as the
+// grammar tables the execution array depends on may have changed without a change of the version string.
+
+C_String C_Lexique::parseCacheHeader (const int32_t inProgramCounterInitialValue) const {
+  C_String result ;
+  result << kParseCacheFormat << "\n"
+         << projectVersionString () << "\n"
+         << "build " __DATE__ " " __TIME__ ", tool modified " << C_DateTime::currentToolModificationTime () << "\n"
+         << lexiqueTablesMD5 () << "\n"
+         << cStringWithSigned (terminalVocabularyCount ()) << "\n"
+         << cStringWithSigned (inProgramCounterInitialValue) << "\n"
+         << sourceFilePath () << "\n"
+         << sourceText ().sourceString ().md5 () << "\n" ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool C_Lexique::loadParseCache (const C_String & inCacheFilePath,
+                                const C_String & inHeader) {
+  const C_TokenAttributeCoder * coder = C_TokenAttributeCoder::coderForScanner (typeid (*this)) ;
+  C_Data data ;
+  bool ok = C_FileManager::binaryDataWithContentOfFile (inCacheFilePath, data) ;
+  int32_t idx = 0 ;
+  ok = ok && (stringFromData (data, idx, ok) == inHeader) ;
+//--- Tokens
+  cToken * firstToken = nullptr ;
+  cToken * lastToken = nullptr ;
+  const uint32_t tokenCount = uint32FromData (data, idx, ok) ;
+  for (uint32_t i=0 ; (i<tokenCount) && ok ; i++) {
+    const int32_t tokenCode = (int32_t) uint32FromData (data, idx, ok) ;
+    int32_t locationValues [6] ;
+    for (int32_t j=0 ; j<6 ; j++) {
+      locationValues [j] = (int32_t) uint32FromData (data, idx, ok) ;
+    }
+    const C_String templateString = stringFromData (data, idx, ok) ;
+    const C_String separatorString = stringFromData (data, idx, ok) ;
+    cToken * token = coder->newTokenWithAttributesFromData (data, idx, ok) ;
+    token->mTokenCode = tokenCode ;
+    token->mStartLocation = C_LocationInSource (sourceText (), locationValues [0], locationValues [1], locationValues [2]) ;
+    token->mEndLocation = C_LocationInSource (sourceText (), locationValues [3], locationValues [4], locationValues [5]) ;
+    token->mTemplateStringBeforeToken = templateString ;
+    token->mSeparatorStringBeforeToken = separatorString ;
+    if (lastToken == nullptr) {
+      firstToken = token ;
+    }else{
+      lastToken->mNextToken = token ;
+    }
+    lastToken = token ;
+  }
+//--- Execution array for second pass parsing
+  TC_UniqueArray <int32_t> arrayForSecondPassParsing ;
+  const uint32_t arrayCount = uint32FromData (data, idx, ok) ;
+  ok = ok && (arrayCount <= (uint32_t) ((data.count () - idx) / 4)) ;
+  if (ok) {
+    arrayForSecondPassParsing.setCapacity ((int32_t) arrayCount) ;
+  }
+  for (uint32_t i=0 ; (i<arrayCount) && ok ; i++) {
+    arrayForSecondPassParsing.appendObject ((int32_t) uint32FromData (data, idx, ok)) ;
+  }
+  ok = ok && (idx == data.count ()) ;
+//--- Install the token list, or discard it if the cache file is invalid
+  if (ok) {
+    mFirstToken = firstToken ;
+    mLastToken = lastToken ;
+    arrayForSecondPassParsing.copyTo (mArrayForSecondPassParsing) ;
+    if (verboseOutput ()) {
+      co << "Parse cache hit for '" << sourceFilePath () << "'\n" ;
+    }
+  }else{
+    while (firstToken != nullptr) {
+      cToken * p = firstToken->mNextToken ;
+      macroMyDelete (firstToken) ;
+      firstToken = p ;
+    }
+  }
+  return ok ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// A failure to write the cache is not an error: the source text will be analyzed again next time.
+
+void C_Lexique::storeParseCache (const C_String & inCacheFilePath,
+                                 const C_String & inHeader) const {
+  const C_TokenAttributeCoder * coder = C_TokenAttributeCoder::coderForScanner (typeid (*this)) ;
+  C_Data data ;
+  appendStringToData (inHeader, data) ;
+//--- Tokens
+  uint32_t tokenCount = 0 ;
+  for (const cToken * p = mFirstToken ; p != nullptr ; p = p->mNextToken) {
+    tokenCount ++ ;
+  }
+  appendUInt32ToData (tokenCount, data) ;
+  for (const cToken * p = mFirstToken ; p != nullptr ; p = p->mNextToken) {
+    appendUInt32ToData ((uint32_t) p->mTokenCode, data) ;
+    appendUInt32ToData ((uint32_t) p->mStartLocation.index (), data) ;
+    appendUInt32ToData ((uint32_t) p->mStartLocation.lineNumber (), data) ;
+    appendUInt32ToData ((uint32_t) p->mStartLocation.columnNumber (), data) ;
+    appendUInt32ToData ((uint32_t) p->mEndLocation.index (), data) ;
+    appendUInt32ToData ((uint32_t) p->mEndLocation.lineNumber (), data) ;
+    appendUInt32ToData ((uint32_t) p->mEndLocation.columnNumber (), data) ;
+    appendStringToData (p->mTemplateStringBeforeToken, data) ;
+    appendStringToData (p->mSeparatorStringBeforeToken, data) ;
+    coder->appendTokenAttributesToData (p, data) ;
+  }
+//--- Execution array for second pass parsing
+  appendUInt32ToData ((uint32_t) mArrayForSecondPassParsing.count (), data) ;
+  for (int32_t i=0 ; i<mArrayForSecondPassParsing.count () ; i++) {
+    appendUInt32ToData ((uint32_t) mArrayForSecondPassParsing (i COMMA_HERE), data) ;
+  }
+//--- Write to a temporary file, then rename, so that a concurrent compiler never reads a partial cache file
+  if (C_FileManager::makeDirectoryIfDoesNotExist (inCacheFilePath.stringByDeletingLastPathComponent ())) {
+    C_String temporaryFilePath = inCacheFilePath ;
+    static std::atomic <uint32_t> gTemporaryFileIndex (0) ; // Templates may be parsed by several threads
+    temporaryFilePath << "." << cStringWithUnsigned ((uint64_t) ::getpid ())
+                      << "." << cStringWithUnsigned (gTemporaryFileIndex.fetch_add (1)) ;
+    if (C_FileManager::writeBinaryDataToFile (data, temporaryFilePath)) {
+      if (::rename (temporaryFilePath.cString (HERE), inCacheFilePath.cString (HERE)) != 0) {
+        C_FileManager::deleteFile (temporaryFilePath) ;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Bottom up parsing
 #endif
@@ -1141,6 +1437,7 @@ bool C_Lexique::performBottomUpParsing (const int32_t inActionTable [],
                                         const uint32_t inActionTableIndex [],
                                         const int32_t * inSuccessorTable [],
                                         const int32_t inProductionsTable []) {
+  const C_PhaseTimer phaseTimer (C_String ("parsing ") + sourceFilePath ().lastPathComponent ()) ;
   bool result = false ;
   performLexicalAnalysis () ;
   if (! executionModeIsLexicalAnalysisOnly ()) {
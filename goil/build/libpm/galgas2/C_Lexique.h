@@ -31,6 +31,39 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 class cIndexingDictionary ;
+class C_Data ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Token attribute coder for the parse cache. C_Lexique does not know the lexical attributes of the tokens: the
+//  source texts of a scanner are cached only if a coder is registered for the class of the scanner. A coder is
+//  registered by a prologue action, and its format string is part of the header of the cache files.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class C_TokenAttributeCoder {
+  public: C_TokenAttributeCoder (void) ;
+
+  public: virtual ~ C_TokenAttributeCoder (void) ;
+
+  public: virtual const char * formatString (void) const = 0 ;
+
+  public: virtual void appendTokenAttributesToData (const cToken * inToken,
+                                                    C_Data & ioData) const = 0 ;
+
+  public: virtual cToken * newTokenWithAttributesFromData (const C_Data & inData,
+                                                           int32_t & ioIndex,
+                                                           bool & ioOk) const = 0 ;
+
+  public: static void registerCoder (const std::type_info & inScannerClass,
+                                     const C_TokenAttributeCoder * inCoder) ;
+
+  public: static const C_TokenAttributeCoder * coderForScanner (const std::type_info & inScannerClass) ;
+
+//--- No copy
+  private: C_TokenAttributeCoder (const C_TokenAttributeCoder &) = delete ;
+  private: C_TokenAttributeCoder & operator = (const C_TokenAttributeCoder &) = delete ;
+} ;
 
 //----------------------------------------------------------------------------------------------------------------------
 //
@@ -221,6 +254,22 @@ class C_Lexique : public C_Compiler {
   private: TC_UniqueArray <int32_t> mArrayForSecondPassParsing ;
   private: int32_t mIndexForSecondPassParsing ;
 
+//--- Parse cache: the token list and the execution array built during first pass are stored on disk,
+//    and reloaded instead of performing lexical analysis and first pass when the source text is unchanged.
+//    Only source files are cached, and only by scanners that have a token attribute coder.
+  private: bool mSourceTextIsFile ;
+  private: C_String parseCacheFilePath (const int32_t inProgramCounterInitialValue) const ;
+  private: C_String parseCacheHeader (const int32_t inProgramCounterInitialValue) const ;
+  private: C_String lexiqueTablesMD5 (void) const ;
+  private: bool loadParseCache (const C_String & inCacheFilePath,
+                                const C_String & inHeader) ;
+  private: void storeParseCache (const C_String & inCacheFilePath,
+                                 const C_String & inHeader) const ;
+  public: static void appendUInt32ToData (const uint32_t inValue, C_Data & ioData) ;
+  public: static void appendStringToData (const C_String & inString, C_Data & ioData) ;
+  public: static uint32_t uint32FromData (const C_Data & inData, int32_t & ioIndex, bool & ioOk) ;
+  public: static C_String stringFromData (const C_Data & inData, int32_t & ioIndex, bool & ioOk) ;
+
 //--- Latex string (for --mode=latex command line option)
   private: C_String mLatexOutputString ;
   private: int32_t mLatexNextCharacterToEnterIndex ;
@@ -33,6 +33,18 @@ mSourceText () {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+C_LocationInSource::C_LocationInSource (const C_SourceTextInString & inSourceText,
+                                        const int32_t inIndex,
+                                        const int32_t inLineNumber,
+                                        const int32_t inColumnNumber) :
+mIndex (inIndex),
+mLineNumber (inLineNumber),
+mColumnNumber (inColumnNumber),
+mSourceText (inSourceText) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void C_LocationInSource::gotoNextLocation (void) {
   if (mIndex < mSourceText.sourceString ().length ()) {
     const utf32 currentChar = mSourceText.sourceString () (mIndex COMMA_HERE) ;
@@ -44,6 +44,12 @@ class C_LocationInSource final {
 
   public: C_LocationInSource (void) ;
 
+//--- Used for restoring a location from the parse cache
+  public: C_LocationInSource (const C_SourceTextInString & inSourceText,
+                              const int32_t inIndex,
+                              const int32_t inLineNumber,
+                              const int32_t inColumnNumber) ;
+
   public: void gotoNextLocation (void) ;
 
   public: void goForward (const uint32_t inCount) ;
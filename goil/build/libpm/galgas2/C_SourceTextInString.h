@@ -102,10 +102,6 @@ class C_SourceTextInString {
     return (mObject == nullptr) ? TO_UNICODE (0) : mObject->mSourceString.readCharOrNul (inIndex COMMA_THERE) ;
   }
 
-  public: const utf32 * temporaryUTF32StringAtIndex (const int32_t inIndex COMMA_LOCATION_ARGS) const {
-    return (mObject == nullptr) ? nullptr : & (mObject->mSourceString.utf32String (THERE)) [inIndex] ;
-  }
-
   public: C_String getLineForLocation (const class C_LocationInSource & inLocation) const ;
 
   public: void appendSourceContents (C_String & ioMessage) const ;
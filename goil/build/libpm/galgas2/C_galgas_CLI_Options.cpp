@@ -25,6 +25,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 C_BoolCommandLineOption gOption_galgas_5F_builtin_5F_options_outputConcreteSyntaxTree ("galgas_builtin_options",
                                          "outputConcreteSyntaxTree",
                                          0,
@@ -96,6 +100,35 @@ C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_outputKeywordList
                                          "Output a Latex file containing keyword list",
                                          "") ;
 
+C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_parse_5F_cache ("galgas_cli_options",
+                                         "parse_cache",
+                                         0,
+                                         "parse-cache",
+                                         "Directory of the parse cache ('none' disables the cache)",
+                                         "") ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//   PARSE CACHE
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+C_String parseCacheDirectory (void) {
+  C_String result = gOption_galgas_5F_builtin_5F_options_parse_5F_cache.mValue ;
+  if (result == "none") {
+    result = "" ;
+  }else if (result == "") {
+    const char * xdgCacheHome = ::getenv ("XDG_CACHE_HOME") ;
+    const char * home = ::getenv ("HOME") ;
+    if ((xdgCacheHome != nullptr) && (xdgCacheHome [0] != '\0')) {
+      result << xdgCacheHome << "/galgas" ;
+    }else if ((home != nullptr) && (home [0] != '\0')) {
+      result << home << "/.cache/galgas" ;
+    }
+  }
+  return result ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //   EXECUTION MODE
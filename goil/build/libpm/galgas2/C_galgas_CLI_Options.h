@@ -60,6 +60,15 @@ extern C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_outputKeyw
 
 //----------------------------------------------------------------------------------------------------------------------
 
+extern C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_parse_5F_cache ;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Returns the directory of the parse cache, an empty string if the cache is disabled
+
+C_String parseCacheDirectory (void) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void setExecutionMode (C_String & outErrorMessage) ;
 
 typedef enum {
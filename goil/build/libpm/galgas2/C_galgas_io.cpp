@@ -28,6 +28,13 @@
 #include "galgas2/F_verbose_output.h"
 #include "galgas2/cIssueDescriptor.h"
 #include "galgas2/C_Compiler.h"
+#include "time/C_Timer.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -85,6 +92,270 @@ const char * max_warning_count_reached_exception::what (void) const throw () {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Output journal
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static thread_local C_OutputJournal * gOutputJournal = nullptr ;
+
+//--- Only used by the main thread, as a journal is attached to the other ones
+static void (* gPendingOutputHandler) (void) = nullptr ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_OutputJournal::C_OutputJournal (void) :
+mEntries (),
+mBaseErrorCount (totalErrorCount ()),
+mBaseWarningCount (totalWarningCount ()),
+mErrorCount (0),
+mWarningCount (0) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OutputJournal::appendEntry (const std::function <void (void)> & inEntry) {
+  mEntries.appendObject (inEntry) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OutputJournal::replay (void) {
+  MF_Assert (nullptr == gOutputJournal, "a journal is attached to the current thread", 0, 0) ;
+  for (int32_t i=0 ; i<mEntries.count () ; i++) {
+    mEntries (i COMMA_HERE) () ;
+  }
+  mEntries.removeAllKeepingCapacity () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void setOutputJournalForCurrentThread (C_OutputJournal * inJournal) {
+  gOutputJournal = inJournal ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_OutputJournal * outputJournalForCurrentThread (void) {
+  return gOutputJournal ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool recordInOutputJournal (const int32_t inErrorCount,
+                            const int32_t inWarningCount,
+                            const std::function <void (void)> & inEntry) {
+  C_OutputJournal * journal = gOutputJournal ;
+  const bool recorded = nullptr != journal ;
+  if (recorded) {
+    journal->mErrorCount += inErrorCount ;
+    journal->mWarningCount += inWarningCount ;
+    journal->appendEntry (inEntry) ;
+  }else{
+    flushPendingOutput () ;
+  }
+  return recorded ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void setPendingOutputHandler (void (* inHandler) (void)) {
+  gPendingOutputHandler = inHandler ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void flushPendingOutput (void) {
+  void (* handler) (void) = gPendingOutputHandler ;
+  if (nullptr != handler) {
+    gPendingOutputHandler = nullptr ;
+    handler () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Ordered jobs
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_OrderedJob::C_OrderedJob (void) :
+mJournal (),
+mException (),
+mStarted (false),
+mDone (false) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_OrderedJob::~ C_OrderedJob (void) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OrderedJob::willReplay (void) {
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+//--- The scheduler whose pending jobs are replayed by the pending output handler; only used by the main thread
+static C_OrderedJobScheduler * gSchedulerWithPendingJobs = nullptr ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_OrderedJobScheduler::C_OrderedJobScheduler (const uint32_t inThreadCount) :
+mMaxPendingJobCount (4 * inThreadCount),
+mMutex (),
+mJobAvailable (),
+mJobDone (),
+mQueuedJobs (),
+mPendingJobs (),
+mWorkers (),
+mStopping (false) {
+  for (uint32_t i=0 ; i<inThreadCount ; i++) {
+    mWorkers.push_back (std::thread ([this] () { work () ; })) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_OrderedJobScheduler::~ C_OrderedJobScheduler (void) {
+  if (gSchedulerWithPendingJobs == this) {
+    gSchedulerWithPendingJobs = nullptr ;
+    setPendingOutputHandler (nullptr) ;
+  }
+  { std::lock_guard <std::mutex> lock (mMutex) ;
+    mStopping = true ;
+  }
+  mJobAvailable.notify_all () ;
+  for (size_t i=0 ; i<mWorkers.size () ; i++) {
+    mWorkers [i].join () ;
+  }
+  while (! mPendingJobs.empty ()) {
+    delete mPendingJobs.front () ;
+    mPendingJobs.pop_front () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint32_t C_OrderedJobScheduler::threadCountForJobs (const uint32_t inJobs) {
+  uint32_t result = 1 ;
+  #ifdef DO_NOT_GENERATE_CHECKINGS
+    if (! C_PhaseTimer::phaseTimingEnabled ()) {
+      result = inJobs ;
+      if (result == 0) {
+        result = std::thread::hardware_concurrency () ;
+      }
+    }
+  #else
+    (void) inJobs ;
+  #endif
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OrderedJobScheduler::execute (C_OrderedJob * inJob) {
+  setOutputJournalForCurrentThread (& inJob->mJournal) ;
+  try{
+    inJob->execute () ;
+  }catch (...) {
+    inJob->mException = std::current_exception () ;
+  }
+  setOutputJournalForCurrentThread (nullptr) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OrderedJobScheduler::replayAllPendingJobs (void) {
+  if (nullptr != gSchedulerWithPendingJobs) {
+    gSchedulerWithPendingJobs->replay (0) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OrderedJobScheduler::work (void) {
+  std::unique_lock <std::mutex> lock (mMutex) ;
+  while (! mStopping) {
+    if (mQueuedJobs.empty ()) {
+      mJobAvailable.wait (lock) ;
+    }else{
+      C_OrderedJob * job = mQueuedJobs.front () ;
+      mQueuedJobs.pop_front () ;
+      job->mStarted = true ;
+      lock.unlock () ;
+      execute (job) ;
+      lock.lock () ;
+      job->mDone = true ;
+      mJobDone.notify_all () ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OrderedJobScheduler::start (C_OrderedJob * inJob) {
+  if (mPendingJobs.size () >= mMaxPendingJobCount) {
+    replay (mMaxPendingJobCount - 1) ;
+  }
+  { std::lock_guard <std::mutex> lock (mMutex) ;
+    mQueuedJobs.push_back (inJob) ;
+  }
+  mJobAvailable.notify_one () ;
+  mPendingJobs.push_back (inJob) ;
+  gSchedulerWithPendingJobs = this ;
+  setPendingOutputHandler (replayAllPendingJobs) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_OrderedJobScheduler::replay (const size_t inMaxPendingJobCount) {
+  setPendingOutputHandler (nullptr) ;
+  while (mPendingJobs.size () > inMaxPendingJobCount) {
+    std::unique_ptr <C_OrderedJob> job (mPendingJobs.front ()) ;
+    mPendingJobs.pop_front () ;
+    bool executeHere = false ;
+    { std::unique_lock <std::mutex> lock (mMutex) ;
+      if (! job->mStarted) {
+        std::deque <C_OrderedJob *>::iterator it = std::find (mQueuedJobs.begin (), mQueuedJobs.end (), job.get ()) ;
+        mQueuedJobs.erase (it) ;
+        job->mStarted = true ;
+        executeHere = true ;
+      }else{
+        mJobDone.wait (lock, [&job] () { return job->mDone ; }) ;
+      }
+    }
+    if (executeHere) {
+      execute (job.get ()) ;
+    }
+    job->willReplay () ;
+    job->mJournal.replay () ;
+    if (job->mException != nullptr) {
+      std::rethrow_exception (job->mException) ;
+    }
+  }
+  if (! mPendingJobs.empty ()) {
+    setPendingOutputHandler (replayAllPendingJobs) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::shared_ptr <TC_UniqueArray <C_String> > sharedCopy (const TC_UniqueArray <C_String> & inArray) {
+  std::shared_ptr <TC_UniqueArray <C_String> > result = std::make_shared <TC_UniqueArray <C_String> > () ;
+  for (int32_t i=0 ; i<inArray.count () ; i++) {
+    result->appendObject (inArray (i COMMA_HERE)) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Class C_galgas_io
 #endif
@@ -98,10 +369,11 @@ int32_t maxErrorCount (void) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
-static int32_t mErrorTotalCount ;
+static std::atomic <int32_t> mErrorTotalCount ;
 
 int32_t totalErrorCount (void) {
-  return mErrorTotalCount ;
+  const C_OutputJournal * journal = outputJournalForCurrentThread () ;
+  return (nullptr == journal) ? mErrorTotalCount.load () : journal->errorCount () ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -113,10 +385,11 @@ int32_t maxWarningCount (void) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
-static int32_t mTotalWarningCount ;
+static std::atomic <int32_t> mTotalWarningCount ;
 
 int32_t totalWarningCount (void) {
-  return mTotalWarningCount ;
+  const C_OutputJournal * journal = outputJournalForCurrentThread () ;
+  return (nullptr == journal) ? mTotalWarningCount.load () : journal->warningCount () ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -195,6 +468,11 @@ void signalLexicalWarning (C_Compiler * inCompiler,
                            const C_IssueWithFixIt & inIssue,
                            const C_String & inLexicalWarningMessage
                            COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (0, 1, [=] () {
+    signalLexicalWarning (inCompiler, inSourceText, inIssue, inLexicalWarningMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment warning count
   mTotalWarningCount ++ ;
 //--- Construct location warning message
@@ -221,6 +499,11 @@ void signalLexicalError (C_Compiler * inCompiler,
                          const C_IssueWithFixIt & inIssue,
                          const C_String & inLexicalErrorMessage
                          COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (1, 0, [=] () {
+    signalLexicalError (inCompiler, inSourceText, inIssue, inLexicalErrorMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment error count
   mErrorTotalCount ++ ;
 //--- Construct parsing error message
@@ -248,6 +531,12 @@ void signalParsingError (C_Compiler * inCompiler,
                          const C_String & inFoundTokenMessage,
                          const TC_UniqueArray <C_String> & inAcceptedTokenNames
                          COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (1, 0, [=, acceptedTokenNames = sharedCopy (inAcceptedTokenNames)] () {
+    signalParsingError (inCompiler, inSourceText, inPreviousTokenEndLocation, inIssue, inFoundTokenMessage,
+                        *acceptedTokenNames COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment error count
   mErrorTotalCount ++ ;
 //--- Construct location error message
@@ -284,6 +573,11 @@ void signalExtractError (C_Compiler * inCompiler,
                          const TC_UniqueArray <C_String> & inExpectedClassesErrorStringsArray,
                          const C_String & inActualFoundClassErrorString
                          COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (1, 0, [=, expectedClasses = sharedCopy (inExpectedClassesErrorStringsArray)] () {
+    signalExtractError (inCompiler, inSourceText, inIssue, *expectedClasses, inActualFoundClassErrorString COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment error count
   mErrorTotalCount ++ ;
 //--- Construct location error message
@@ -336,6 +630,12 @@ void signalCastError (C_Compiler * inCompiler,
                       const bool inUseKindOfClass,
                       const C_String & inActualFoundClassErrorString
                       COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (1, 0, [=] () {
+    signalCastError (inCompiler, inSourceText, inIssue, inBaseClass, inUseKindOfClass, inActualFoundClassErrorString
+                     COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment error count
   mErrorTotalCount ++ ;
 //--- Construct expected class message array
@@ -413,6 +713,11 @@ void signalSemanticWarning (C_Compiler * inCompiler,
                             const C_IssueWithFixIt & inIssue,
                             const C_String & inWarningMessage
                             COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (0, 1, [=] () {
+    signalSemanticWarning (inCompiler, inSourceText, inIssue, inWarningMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment warning count
   mTotalWarningCount ++ ;
 //--- Construct location error message
@@ -435,6 +740,11 @@ void signalSemanticError (C_Compiler * inCompiler,
                           const C_IssueWithFixIt & inIssue,
                           const C_String & inErrorMessage
                           COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (1, 0, [=] () {
+    signalSemanticError (inCompiler, inSourceText, inIssue, inErrorMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
   const C_LocationInSource inEndErrorLocation = inIssue.mStartLocation ;
 //--- Increment error count
   mErrorTotalCount ++ ;
@@ -455,6 +765,11 @@ void signalSemanticError (C_Compiler * inCompiler,
 void signalRunTimeError (C_Compiler * inCompiler,
                          const C_String & inRunTimeErrorMessage
                          COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (1, 0, [=] () {
+    signalRunTimeError (inCompiler, inRunTimeErrorMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment error count
   mErrorTotalCount ++ ;
 //--- Construct location error message
@@ -473,6 +788,11 @@ void signalRunTimeError (C_Compiler * inCompiler,
 void signalRunTimeWarning (C_Compiler * inCompiler,
                            const C_String & inWarningMessage
                            COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (0, 1, [=] () {
+    signalRunTimeWarning (inCompiler, inWarningMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Increment warning count
   mTotalWarningCount ++ ;
 //--- Construct location error message
@@ -508,6 +828,11 @@ void ggs_printError (C_Compiler * inCompiler,
                      const C_IssueWithFixIt & inIssue,
                      const C_String & inMessage
                      COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (0, 0, [=] () {
+    ggs_printError (inCompiler, inSourceText, inIssue, inMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Append to issue array
   const cIssueDescriptor issue (
     true,
@@ -552,6 +877,7 @@ void ggs_printError (C_Compiler * inCompiler,
 void fatalError (const C_String & inErrorMessage,
                  const char * inSourceFile,
                  const int inSourceLine) {
+  flushPendingOutput () ;
 //--- Increment error count
   mErrorTotalCount ++ ;
 //--- Error message
@@ -598,6 +924,11 @@ void ggs_printWarning (C_Compiler * inCompiler,
                        const C_IssueWithFixIt & inIssue,
                        const C_String & inMessage
                        COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (0, 0, [=] () {
+    ggs_printWarning (inCompiler, inSourceText, inIssue, inMessage COMMA_THERE) ;
+  })) {
+    return ;
+  }
 //--- Append to issue array
   const cIssueDescriptor issue (
     false,
@@ -647,6 +978,9 @@ void ggs_printWarning (C_Compiler * inCompiler,
 //----------------------------------------------------------------------------------------------------------------------
 
 void ggs_printFileOperationSuccess (const C_String & inMessage) {
+  if (recordInOutputJournal (0, 0, [=] () { ggs_printFileOperationSuccess (inMessage) ; })) {
+    return ;
+  }
   if (! executionModeIsIndexing ()) {
     if (cocoaOutput ()) {
       co.setForeColor (kGreenForeColor) ;
@@ -671,6 +1005,9 @@ void ggs_printFileOperationSuccess (const C_String & inMessage) {
 //----------------------------------------------------------------------------------------------------------------------
 
 void ggs_printFileCreationSuccess (const C_String & inMessage) {
+  if (recordInOutputJournal (0, 0, [=] () { ggs_printFileCreationSuccess (inMessage) ; })) {
+    return ;
+  }
   if (! executionModeIsIndexing ()) {
     if (cocoaOutput ()) {
       co.setForeColor (kBlueForeColor) ;
@@ -696,6 +1033,9 @@ void ggs_printFileCreationSuccess (const C_String & inMessage) {
 
 void ggs_printMessage (const C_String & inMessage
                        COMMA_LOCATION_ARGS) {
+  if (recordInOutputJournal (0, 0, [=] () { ggs_printMessage (inMessage COMMA_THERE) ; })) {
+    return ;
+  }
   if (! executionModeIsIndexing ()) {
     C_String message = inMessage ;
     #ifndef DO_NOT_GENERATE_CHECKINGS
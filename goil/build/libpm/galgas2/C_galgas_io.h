@@ -23,6 +23,13 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 #include <typeinfo>
+#include <functional>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -134,7 +141,142 @@ class C_parsingContext {
 
 //----------------------------------------------------------------------------------------------------------------------
 //
-//         Abstract class for GALGAS input/output                                                
+//     Output journal
+//
+//  While a journal is attached to the current thread, the errors, warnings and messages are not printed: they are
+//  recorded in the journal, with any action appended by the caller, and performed later by the main thread, in
+//  the recording order, when it calls replay. In the thread the journal is attached to, totalErrorCount and
+//  totalWarningCount return the counts when the journal was created plus the ones recorded in it, so that they
+//  do not depend on the journals the main thread replays meanwhile.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class C_OutputJournal final {
+  public: C_OutputJournal (void) ;
+
+//--- No copy
+  private: C_OutputJournal (const C_OutputJournal &) = delete ;
+  private: C_OutputJournal & operator = (const C_OutputJournal &) = delete ;
+
+//--- Record an action
+  public: void appendEntry (const std::function <void (void)> & inEntry) ;
+
+//--- Perform the recorded actions; no journal should be attached to the current thread
+  public: void replay (void) ;
+
+//--- Error and warning counts when the journal was created, plus the recorded ones
+  public: inline int32_t errorCount (void) const { return mBaseErrorCount + mErrorCount ; }
+  public: inline int32_t warningCount (void) const { return mBaseWarningCount + mWarningCount ; }
+
+//--- Private properties
+  private: TC_UniqueArray <std::function <void (void)> > mEntries ;
+  private: const int32_t mBaseErrorCount ;
+  private: const int32_t mBaseWarningCount ;
+  private: int32_t mErrorCount ;
+  private: int32_t mWarningCount ;
+
+  friend bool recordInOutputJournal (const int32_t inErrorCount,
+                                     const int32_t inWarningCount,
+                                     const std::function <void (void)> & inEntry) ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void setOutputJournalForCurrentThread (C_OutputJournal * inJournal) ;
+
+C_OutputJournal * outputJournalForCurrentThread (void) ;
+
+//--- Records the entry if a journal is attached to the current thread and returns true. Otherwise, pending output
+//    is flushed and false is returned: the caller performs the action.
+bool recordInOutputJournal (const int32_t inErrorCount,
+                            const int32_t inWarningCount,
+                            const std::function <void (void)> & inEntry) ;
+
+//--- The handler is called (and removed) before the first output that is not journaled; it lets the main thread
+//    replay the journals of the jobs it has started, so that their output comes first.
+void setPendingOutputHandler (void (* inHandler) (void)) ;
+
+void flushPendingOutput (void) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//     Ordered jobs
+//
+//  The main thread starts jobs that worker threads execute, each with its own output journal attached. replay
+//  performs, in the start order, the output of the jobs that have not been replayed yet; it is also called before
+//  the first output of the main thread that is not journaled, so that the output is the same as in a sequential
+//  execution. A job that no worker has started when it is replayed is executed by the main thread. An exception
+//  raised by a job is rethrown by the main thread when the job is replayed.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class C_OrderedJob {
+  public: C_OrderedJob (void) ;
+
+  public: virtual ~ C_OrderedJob (void) ;
+
+//--- Executed by a worker thread or by the main thread, with the journal of the job attached
+  protected: virtual void execute (void) = 0 ;
+
+//--- Called by the main thread before the journal of the job is replayed
+  protected: virtual void willReplay (void) ;
+
+//--- No copy
+  private: C_OrderedJob (const C_OrderedJob &) = delete ;
+  private: C_OrderedJob & operator = (const C_OrderedJob &) = delete ;
+
+//--- Private properties
+  private: C_OutputJournal mJournal ;
+  private: std::exception_ptr mException ;
+  private: bool mStarted ; // Protected by the mutex of the scheduler
+  private: bool mDone ; // Protected by the mutex of the scheduler
+
+  friend class C_OrderedJobScheduler ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class C_OrderedJobScheduler final {
+  public: C_OrderedJobScheduler (const uint32_t inThreadCount) ;
+
+//--- Waits for the worker threads and drops the jobs that have not been replayed (an exception is propagating)
+  public: ~ C_OrderedJobScheduler (void) ;
+
+//--- Called by the main thread, that takes ownership of the job; at most 4 jobs per thread are pending, starting
+//    one more replays the oldest one first
+  public: void start (C_OrderedJob * inJob) ;
+
+//--- Called by the main thread: replays the oldest jobs until inMaxPendingJobCount are pending
+  public: void replay (const size_t inMaxPendingJobCount) ;
+
+//--- Thread count for a number of jobs given on the command line (0: one per processor). It is 1 when the
+//    checkings of libpm, that are not thread safe, are generated and when the phases are timed, so that they nest.
+  public: static uint32_t threadCountForJobs (const uint32_t inJobs) ;
+
+  private: void work (void) ;
+
+  private: static void execute (C_OrderedJob * inJob) ;
+
+  private: static void replayAllPendingJobs (void) ;
+
+//--- No copy
+  private: C_OrderedJobScheduler (const C_OrderedJobScheduler &) = delete ;
+  private: C_OrderedJobScheduler & operator = (const C_OrderedJobScheduler &) = delete ;
+
+//--- Private properties
+  private: const size_t mMaxPendingJobCount ;
+  private: std::mutex mMutex ;
+  private: std::condition_variable mJobAvailable ;
+  private: std::condition_variable mJobDone ;
+  private: std::deque <C_OrderedJob *> mQueuedJobs ; // Protected by mMutex
+  private: std::deque <C_OrderedJob *> mPendingJobs ; // Only used by the main thread
+  private: std::vector <std::thread> mWorkers ;
+  private: bool mStopping ; // Protected by mMutex
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//         Abstract class for GALGAS input/output                                            
 //
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -45,7 +45,7 @@ mValue (inValue) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOk ;
+static thread_local bool gOk ;
 
 GALGAS_bigint::GALGAS_bigint (const char * inDecimalString, C_Compiler * inCompiler COMMA_LOCATION_ARGS) :
 AC_GALGAS_root (),
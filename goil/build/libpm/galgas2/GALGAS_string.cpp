@@ -255,12 +255,7 @@ GALGAS_string GALGAS_string::constructor_stringWithSequenceOfCharacters (const G
                                                                          COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result ;
   if ((inCount.isValid ()) && (inCharacter.isValid ())) {
-    const utf32 character = inCharacter.charValue () ;
-    C_String s ;
-    for (uint32_t i=0 ; i<inCount.uintValue () ; i++) {
-      s.appendUnicodeCharacter (character COMMA_HERE) ;
-    }
-    result = GALGAS_string (s) ;
+    result = GALGAS_string (C_String::stringWithRepeatedCharacter (inCharacter.charValue (), inCount.uintValue ())) ;
   }
   return result ;
 }
@@ -495,6 +490,7 @@ GALGAS_lstring GALGAS_string::getter_here (C_Compiler * inCompiler COMMA_LOCATIO
 GALGAS_bool GALGAS_string::getter_fileExists (UNUSED_LOCATION_ARGS) const {
   GALGAS_bool result ;
   if (isValid ()) {
+    C_Compiler::logFileProbe (mString) ;
     result = GALGAS_bool (C_FileManager::fileExistsAtPath (mString)) ;
   }
   return result ;
@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Token attribute coder of the GTL scanner, for the parse cache.
+//
+//  The GTL lexique is generated from the GTL sources, that are not part of goil; the coder is written by hand and
+//  must be updated when a lexical attribute is added to the GTL scanner. Changing the encoding requires changing
+//  the format string.
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+#include "all-declarations-0.h"
+#include "galgas2/C_Lexique.h"
+#include "utilities/C_Data.h"
+#include "utilities/C_PrologueEpilogue.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <string.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlScannerAttributeCoder final : public C_TokenAttributeCoder {
+  public: virtual const char * formatString (void) const override {
+    return "gtl_scanner 1: a_string charValue floatValue functionContent identifierString intValue tokenString "
+           "uint32value" ;
+  }
+
+  public: virtual void appendTokenAttributesToData (const cToken * inToken,
+                                                    C_Data & ioData) const override ;
+
+  public: virtual cToken * newTokenWithAttributesFromData (const C_Data & inData,
+                                                           int32_t & ioIndex,
+                                                           bool & ioOk) const override ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cGtlScannerAttributeCoder::appendTokenAttributesToData (const cToken * inToken,
+                                                             C_Data & ioData) const {
+  const cTokenFor_gtl_5F_scanner * ptr = (const cTokenFor_gtl_5F_scanner *) inToken ;
+  C_Lexique::appendStringToData (ptr->mLexicalAttribute_a_5F_string, ioData) ;
+  C_Lexique::appendUInt32ToData (UNICODE_VALUE (ptr->mLexicalAttribute_charValue), ioData) ;
+  uint64_t floatBits = 0 ;
+  ::memcpy (&floatBits, &ptr->mLexicalAttribute_floatValue, sizeof (floatBits)) ;
+  C_Lexique::appendUInt32ToData ((uint32_t) floatBits, ioData) ;
+  C_Lexique::appendUInt32ToData ((uint32_t) (floatBits >> 32), ioData) ;
+  C_Lexique::appendStringToData (ptr->mLexicalAttribute_functionContent, ioData) ;
+  C_Lexique::appendStringToData (ptr->mLexicalAttribute_identifierString, ioData) ;
+  C_Lexique::appendStringToData (ptr->mLexicalAttribute_intValue.decimalString (), ioData) ;
+  C_Lexique::appendStringToData (ptr->mLexicalAttribute_tokenString, ioData) ;
+  C_Lexique::appendUInt32ToData (ptr->mLexicalAttribute_uint_33__32_value, ioData) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cToken * cGtlScannerAttributeCoder::newTokenWithAttributesFromData (const C_Data & inData,
+                                                                    int32_t & ioIndex,
+                                                                    bool & ioOk) const {
+  cTokenFor_gtl_5F_scanner * token = nullptr ;
+  macroMyNew (token, cTokenFor_gtl_5F_scanner) ;
+  token->mLexicalAttribute_a_5F_string = C_Lexique::stringFromData (inData, ioIndex, ioOk) ;
+  token->mLexicalAttribute_charValue = TO_UNICODE (C_Lexique::uint32FromData (inData, ioIndex, ioOk)) ;
+  uint64_t floatBits = C_Lexique::uint32FromData (inData, ioIndex, ioOk) ;
+  floatBits |= ((uint64_t) C_Lexique::uint32FromData (inData, ioIndex, ioOk)) << 32 ;
+  ::memcpy (&token->mLexicalAttribute_floatValue, &floatBits, sizeof (floatBits)) ;
+  token->mLexicalAttribute_functionContent = C_Lexique::stringFromData (inData, ioIndex, ioOk) ;
+  token->mLexicalAttribute_identifierString = C_Lexique::stringFromData (inData, ioIndex, ioOk) ;
+  const C_String intValue = C_Lexique::stringFromData (inData, ioIndex, ioOk) ;
+  if (ioOk) {
+    token->mLexicalAttribute_intValue = C_BigInt (intValue.cString (HERE), 10, ioOk) ;
+  }
+  token->mLexicalAttribute_tokenString = C_Lexique::stringFromData (inData, ioIndex, ioOk) ;
+  token->mLexicalAttribute_uint_33__32_value = C_Lexique::uint32FromData (inData, ioIndex, ioOk) ;
+  return token ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static const cGtlScannerAttributeCoder gGtlScannerAttributeCoder ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void registerGtlScannerAttributeCoder (void) {
+  C_TokenAttributeCoder::registerCoder (typeid (C_Lexique_gtl_5F_scanner), & gGtlScannerAttributeCoder) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PrologueEpilogue gGtlScannerAttributeCoderRegistration (registerGtlScannerAttributeCoder, nullptr) ;
+
+//----------------------------------------------------------------------------------------------------------------------
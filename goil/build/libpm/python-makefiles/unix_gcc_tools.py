@@ -23,7 +23,7 @@ def buildForUnix (dictionary, jsonFilePath, EXECUTABLE, BUILD_DIR_NAME, GOAL, ma
   gmf.mBuildDirName = BUILD_DIR_NAME
 #---
   gmf.mCompilerTool = ["gcc"]
-  gmf.mLinkerTool   = ["g++"]
+  gmf.mLinkerTool   = ["g++", "-pthread"]
   gmf.mStripTool    = ["strip"]
   gmf.mSudoTool     = ["sudo"]
 
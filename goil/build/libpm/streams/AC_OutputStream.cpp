@@ -101,14 +101,24 @@ void AC_OutputStream::genericUnicodeArrayOutput (const utf32 * inCharArray, cons
 
 //----------------------------------------------------------------------------------------------------------------------
 
+//--- The UTF-8 representation is output as is, unless indentation could split a multi-byte sequence
+
 void AC_OutputStream::appendString (const C_String inString) {
-  genericUnicodeArrayOutput (inString.utf32String (HERE), inString.length ()) ;
+  const int32_t byteCount = inString.utf8Length () ;
+  if ((mIndentation == 0) || (byteCount == inString.length ())) {
+    genericCharArrayOutput (inString.cString (HERE), byteCount) ;
+  }else{
+    for (int32_t i=0 ; i<inString.length () ; i++) {
+      const utf32 c = inString (i COMMA_HERE) ;
+      genericUnicodeArrayOutput (& c, 1) ;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 AC_OutputStream & AC_OutputStream::operator << (const C_String inString) {
-  genericUnicodeArrayOutput (inString.utf32String (HERE), inString.length ()) ;
+  appendString (inString) ;
   return *this ;
 }
 
@@ -147,10 +157,9 @@ void AC_OutputStream::appendUTF32String (const utf32 * inUTF32String) {
 //----------------------------------------------------------------------------------------------------------------------
 
 void AC_OutputStream::appendUTF32LiteralStringConstant (const C_String & inString) {
-  const utf32 * str = inString.utf32String (HERE) ;
   appendUnicodeCharacter (TO_UNICODE ('{') COMMA_HERE) ;
-  while (UNICODE_VALUE (* str) != 0) {
-    const utf32 c = * str ;
+  for (int32_t i=0 ; (i<inString.length ()) && (UNICODE_VALUE (inString (i COMMA_HERE)) != 0) ; i++) {
+    const utf32 c = inString (i COMMA_HERE) ;
     appendCString ("\n  TO_UNICODE (") ;
     if (isprint ((int) UNICODE_VALUE (c))) {
       appendCLiteralCharConstant (c) ;
@@ -158,7 +167,6 @@ void AC_OutputStream::appendUTF32LiteralStringConstant (const C_String & inStrin
       appendUnsigned (UNICODE_VALUE (c)) ;
     }
     appendCString ("),") ;
-    str ++ ;
   }
   appendCString ("\n  TO_UNICODE (0)\n}") ;
 }
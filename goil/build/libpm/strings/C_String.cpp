@@ -53,22 +53,37 @@
   #pragma mark cEmbeddedString
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  A shared string stores its characters in Latin-1 (one byte per character), until a character greater than U+00FF
+//  is stored: the string is then widened to UTF-32. While mIsASCII is true, the Latin-1 string is also the UTF-8
+//  representation of the string.
+//
+//  The index that follows the last '\n' is maintained by appends, so that the current column of a long generated text
+//  is known without scanning it; other modifications make it unknown until the next '\n' is appended.
+//
 //----------------------------------------------------------------------------------------------------------------------
 
-static const utf32 kEmptyUTF32String [1] = {TO_UNICODE (0)} ;
+static const uint32_t kUnknownLineStart = UINT32_MAX ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 class cEmbeddedString : public C_SharedObject {
-  public: uint32_t mCapacity ; // Maximun allowed length of the following C string
-  public: uint32_t mLength ; // Current length of the following C string
-  public: char * mEncodedCString ;
-  public: utf32 * mString ; // Zero terminated string
-
-  public: cEmbeddedString (const uint32_t inCapacity COMMA_LOCATION_ARGS) ;
+  public: uint32_t mCapacity ; // Allocated size of the following string, including the terminating zero
+  public: uint32_t mLength ; // Current length of the following string
+  public: uint32_t mLineStart ; // Index following the last '\n' (0 if none), or kUnknownLineStart
+  public: bool mIsASCII ; // If false, the string may nevertheless contain only ASCII characters
+  public: char * mEncodedCString ; // Built on demand when mIsASCII is false
+  public: uint8_t * mLatin1String ; // Zero terminated string, nullptr if the string is wide
+  public: utf32 * mUTF32String ; // Zero terminated string, nullptr if the string is not wide
+
+  public: cEmbeddedString (const uint32_t inCapacity,
+                            const bool inWide
+                            COMMA_LOCATION_ARGS) ;
 
   public: cEmbeddedString (const cEmbeddedString * inEmbeddedString,
-                            const uint32_t inCapacity
+                            const uint32_t inCapacity,
+                            const bool inWide
                             COMMA_LOCATION_ARGS) ;
 
   public: virtual ~cEmbeddedString (void) ;
@@ -81,14 +96,47 @@ class cEmbeddedString : public C_SharedObject {
     public: void checkEmbeddedString (LOCATION_ARGS) const ;
   #endif
 
+  public: inline bool isWide (void) const {
+    return mUTF32String != nullptr ;
+  }
+
+  public: inline utf32 characterAtIndex (const uint32_t inIndex) const {
+    return (mUTF32String != nullptr) ? mUTF32String [inIndex] : TO_UNICODE (mLatin1String [inIndex]) ;
+  }
+
+//--- The string should have been widened if inCharacter is greater than U+00FF
+  public: inline void setCharacterAtIndex (const utf32 inCharacter, const uint32_t inIndex) {
+    if (mUTF32String != nullptr) {
+      mUTF32String [inIndex] = inCharacter ;
+    }else{
+      mLatin1String [inIndex] = (uint8_t) (UNICODE_VALUE (inCharacter) & 255) ;
+      if (UNICODE_VALUE (inCharacter) >= 0x80) {
+        mIsASCII = false ;
+      }
+    }
+  }
+
+//--- Call after characters have been appended from inFirstAppendedIndex to mLength
+  public: inline void updateLineStart (const uint32_t inFirstAppendedIndex) {
+    bool found = false ;
+    for (uint32_t i=mLength ; (i>inFirstAppendedIndex) && ! found ; i--) {
+      found = UNICODE_VALUE (characterAtIndex (i - 1)) == '\n' ;
+      if (found) {
+        mLineStart = i ;
+      }
+    }
+  }
+
   public: void reallocEmbeddedString (const uint32_t inCapacity) ;
+
+  public: void widen (void) ;
 } ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 static uint32_t stringGoodSize (const uint32_t inCurrentCapacity,
                                 const uint32_t inCapacity) {
-  uint32_t newCapacity = (inCurrentCapacity < 128) ? 128 : inCurrentCapacity ;
+  uint32_t newCapacity = (inCurrentCapacity < 32) ? 32 : inCurrentCapacity ;
   while (newCapacity < inCapacity) {
     newCapacity <<= 1 ;
   }
@@ -97,70 +145,85 @@ static uint32_t stringGoodSize (const uint32_t inCurrentCapacity,
 
 //----------------------------------------------------------------------------------------------------------------------
 
-cEmbeddedString::cEmbeddedString (const uint32_t inCapacity COMMA_LOCATION_ARGS) :
+cEmbeddedString::cEmbeddedString (const uint32_t inCapacity,
+                                  const bool inWide
+                                  COMMA_LOCATION_ARGS) :
 C_SharedObject (THERE),
 mCapacity (0),
 mLength (0),
+mLineStart (0),
+mIsASCII (true),
 mEncodedCString (nullptr),
-mString (nullptr) {
+mLatin1String (nullptr),
+mUTF32String (nullptr) {
   const uint32_t newCapacity = stringGoodSize (0, inCapacity) ;
-  macroMyNewPODArray (mString, utf32, newCapacity) ;
+  if (inWide) {
+    macroMyNewPODArray (mUTF32String, utf32, newCapacity) ;
+    mUTF32String [0] = TO_UNICODE ('\0') ;
+    mIsASCII = false ;
+  }else{
+    macroMyNewPODArray (mLatin1String, uint8_t, newCapacity) ;
+    mLatin1String [0] = '\0' ;
+  }
   mCapacity = newCapacity ;
-  mString [0] = TO_UNICODE ('\0') ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 cEmbeddedString::cEmbeddedString (const cEmbeddedString * inEmbeddedString,
-                                  const uint32_t inCapacity
+                                  const uint32_t inCapacity,
+                                  const bool inWide
                                   COMMA_LOCATION_ARGS) :
 C_SharedObject (THERE),
 mCapacity (0),
 mLength (0),
+mLineStart (0),
+mIsASCII (true),
 mEncodedCString (nullptr),
-mString (nullptr) {
+mLatin1String (nullptr),
+mUTF32String (nullptr) {
   macroValidPointer (inEmbeddedString) ;
-  macroValidPointer (inEmbeddedString->mString) ;
-  MF_Assert (inCapacity > inEmbeddedString->mLength, "inCapacity (%lld) < inEmbeddedString->mLength (%lld)", inCapacity, inEmbeddedString->mLength) ;
-  const uint32_t newCapacity = stringGoodSize (inEmbeddedString->mCapacity, inCapacity) ;
-  macroMyNewPODArray (mString, utf32, newCapacity) ;
-  mCapacity = newCapacity ;
-  MF_Assert (inEmbeddedString->mLength < mCapacity, "inEmbeddedString->mLength (%lld) >= mCapacity (%lld)", inEmbeddedString->mLength, mCapacity) ;
-  for (uint32_t i=0 ; i<=inEmbeddedString->mLength ; i++) {
-    mString [i] = inEmbeddedString->mString [i] ;
+  const uint32_t newCapacity = stringGoodSize (
+    inEmbeddedString->mCapacity,
+    (inCapacity > inEmbeddedString->mLength) ? inCapacity : (inEmbeddedString->mLength + 1)
+  ) ;
+  if (inWide || inEmbeddedString->isWide ()) {
+    macroMyNewPODArray (mUTF32String, utf32, newCapacity) ;
+    for (uint32_t i=0 ; i<=inEmbeddedString->mLength ; i++) {
+      mUTF32String [i] = inEmbeddedString->characterAtIndex (i) ;
+    }
+    mIsASCII = false ;
+  }else{
+    macroMyNewPODArray (mLatin1String, uint8_t, newCapacity) ;
+    memcpy (mLatin1String, inEmbeddedString->mLatin1String, inEmbeddedString->mLength + 1) ;
+    mIsASCII = inEmbeddedString->mIsASCII ;
   }
+  mCapacity = newCapacity ;
   mLength = inEmbeddedString->mLength ;
+  mLineStart = inEmbeddedString->mLineStart ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 cEmbeddedString::~cEmbeddedString (void) {
   macroMyDeletePODArray (mEncodedCString) ;
-  macroMyDeletePODArray (mString) ;
+  macroMyDeletePODArray (mLatin1String) ;
+  macroMyDeletePODArray (mUTF32String) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 #ifndef DO_NOT_GENERATE_CHECKINGS
   void cEmbeddedString::checkEmbeddedString (LOCATION_ARGS) const {
-    if (mCapacity == 0) {
-      MF_AssertThere (UNICODE_VALUE (mString [0]) == '\0', "mString [0] (%lld) != '\\0'",
-                      (int32_t) UNICODE_VALUE (mString [0]), '\0') ;
-      MF_AssertThere (mLength == 0, "mLength (%ld) != 0", mLength, 0) ;
-    }else{
-      MF_AssertThere (mLength <= mCapacity, "mLength (%ld) > mCapacity (%ld)", mLength, mCapacity) ;
-      MF_AssertThere (UNICODE_VALUE (mString [mLength]) == '\0',
-                      "mString [mLength] == %ld != '\\0'",
-                      (int32_t) UNICODE_VALUE (mString [mLength]), '\0') ;
-      if (mEncodedCString != nullptr) {
-        macroValidPointer (mEncodedCString) ;
-        for (uint32_t i=0 ; i<=mLength ; i++) {
-          MF_AssertThere (UNICODE_VALUE (mString [i]) == (uint32_t) mEncodedCString [i],
-                          "mString [i] (%ld) != mEncodedCString [i] (%ld)",
-                          UNICODE_VALUE (mString [i]), (uint32_t) mEncodedCString [i]) ;
-        }
-      }
-    }
+    MF_AssertThere ((mLatin1String == nullptr) != (mUTF32String == nullptr), "invalid string buffers", 0, 0) ;
+    MF_AssertThere (mLength < mCapacity, "mLength (%ld) >= mCapacity (%ld)", mLength, mCapacity) ;
+    MF_AssertThere (UNICODE_VALUE (characterAtIndex (mLength)) == '\0',
+                    "string [mLength] == %ld != '\\0'",
+                    (int32_t) UNICODE_VALUE (characterAtIndex (mLength)), '\0') ;
+    MF_AssertThere (! (mIsASCII && isWide ()), "wide string flagged as ASCII", 0, 0) ;
+    MF_AssertThere ((mLineStart == kUnknownLineStart) || (mLineStart <= mLength), "mLineStart (%ld) > mLength (%ld)", mLineStart, mLength) ;
+    MF_AssertThere ((mLineStart == kUnknownLineStart) || (mLineStart == 0) || (UNICODE_VALUE (characterAtIndex (mLineStart - 1)) == '\n'),
+                    "no '\\n' before mLineStart (%ld)", mLineStart, 0) ;
   }
 #endif
 
@@ -172,7 +235,11 @@ void cEmbeddedString::reallocEmbeddedString (const uint32_t inCapacity) {
   #endif
   if (inCapacity > mCapacity) {
     const uint32_t newCapacity = stringGoodSize (mCapacity, inCapacity) ;
-    macroMyReallocPODArray (mString, utf32, newCapacity) ;
+    if (isWide ()) {
+      macroMyReallocPODArray (mUTF32String, utf32, newCapacity) ;
+    }else{
+      macroMyReallocPODArray (mLatin1String, uint8_t, newCapacity) ;
+    }
     mCapacity = newCapacity ;
     #ifndef DO_NOT_GENERATE_CHECKINGS
       checkEmbeddedString (HERE) ;
@@ -182,6 +249,19 @@ void cEmbeddedString::reallocEmbeddedString (const uint32_t inCapacity) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+void cEmbeddedString::widen (void) {
+  if (! isWide ()) {
+    macroMyNewPODArray (mUTF32String, utf32, mCapacity) ;
+    for (uint32_t i=0 ; i<=mLength ; i++) {
+      mUTF32String [i] = TO_UNICODE (mLatin1String [i]) ;
+    }
+    macroMyDeletePODArray (mLatin1String) ;
+    mIsASCII = false ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Constructors & destructor
 #endif
@@ -193,13 +273,15 @@ void cEmbeddedString::reallocEmbeddedString (const uint32_t inCapacity) {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String::C_String (void) :
-mEmbeddedString (nullptr) {
+mInlineLength (0) {
+  mInlineString [0] = '\0' ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String::C_String (const char * inCstring) :
-mEmbeddedString (nullptr) {
+mInlineLength (0) {
+  mInlineString [0] = '\0' ;
   if (inCstring != nullptr) {
     genericCharArrayOutput (inCstring, (int32_t) (strlen (inCstring) & UINT32_MAX)) ;
   }
@@ -208,7 +290,8 @@ mEmbeddedString (nullptr) {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String::C_String (const utf32 * inUTF32String) :
-mEmbeddedString (nullptr) {
+mInlineLength (0) {
+  mInlineString [0] = '\0' ;
   if (inUTF32String != nullptr) {
     genericUnicodeArrayOutput (inUTF32String, utf32_strlen (inUTF32String)) ;
   }
@@ -218,8 +301,13 @@ mEmbeddedString (nullptr) {
 
 C_String::C_String (const C_String & inSource) : // Copy constructor
 AC_OutputStream (inSource),
-mEmbeddedString (nullptr) {
-  macroAssignSharedObject (mEmbeddedString, inSource.mEmbeddedString) ;
+mInlineLength (inSource.mInlineLength) {
+  if (inSource.isInline ()) {
+    memcpy (mInlineString, inSource.mInlineString, (size_t) mInlineLength + 1) ;
+  }else{
+    mEmbeddedString = nullptr ;
+    macroAssignSharedObject (mEmbeddedString, inSource.mEmbeddedString) ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -238,7 +326,9 @@ C_String C_String::newWithStdIn (void) {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String::~C_String (void) {
-  macroDetachSharedObject (mEmbeddedString) ;
+  if (! isInline ()) {
+    macroDetachSharedObject (mEmbeddedString) ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -254,7 +344,7 @@ C_String C_String::spaces (const int32_t inSpaceCount) {
 //----------------------------------------------------------------------------------------------------------------------
 
 uint32_t C_String::capacity (void) const {
-  return (mEmbeddedString == nullptr) ? 0 : mEmbeddedString->mCapacity ;
+  return isInline () ? (uint32_t) (kInlineCapacity + 1) : mEmbeddedString->mCapacity ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -268,7 +358,19 @@ C_String & C_String::operator = (const C_String & inSource) {
     checkString (HERE) ;
     inSource.checkString (HERE) ;
   #endif
-  macroAssignSharedObject (mEmbeddedString, inSource.mEmbeddedString) ;
+  if (this != & inSource) {
+    if (inSource.isInline ()) {
+      releaseString () ;
+      mInlineLength = inSource.mInlineLength ;
+      memcpy (mInlineString, inSource.mInlineString, (size_t) mInlineLength + 1) ;
+    }else{
+      if (isInline ()) {
+        mInlineLength = kHeapString ;
+        mEmbeddedString = nullptr ;
+      }
+      macroAssignSharedObject (mEmbeddedString, inSource.mEmbeddedString) ;
+    }
+  }
   return * this ;
 }
 
@@ -278,19 +380,29 @@ void C_String::releaseString (void) {
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  macroDetachSharedObject (mEmbeddedString) ;
-  mEmbeddedString = nullptr ;
+  if (! isInline ()) {
+    macroDetachSharedObject (mEmbeddedString) ;
+  }
+  mInlineLength = 0 ;
+  mInlineString [0] = '\0' ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+inline utf32 C_String::characterAtIndex (const int32_t inIndex) const {
+  return isInline ()
+    ? TO_UNICODE ((uint32_t) mInlineString [inIndex])
+    : mEmbeddedString->characterAtIndex ((uint32_t) inIndex) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 uint32_t C_String::hash (void) const {
   uint32_t h = 0 ;
-  if (mEmbeddedString != nullptr) {
-    for (uint32_t i=0 ; i<mEmbeddedString->mLength ; i++) {
-      h <<= 3 ;
-      h ^= UNICODE_VALUE (mEmbeddedString->mString [i]) ;
-    }
+  const int32_t stringLength = length () ;
+  for (int32_t i=0 ; i<stringLength ; i++) {
+    h <<= 3 ;
+    h ^= UNICODE_VALUE (characterAtIndex (i)) ;
   }
   return h ;
 }
@@ -299,8 +411,14 @@ uint32_t C_String::hash (void) const {
 
 #ifndef DO_NOT_GENERATE_CHECKINGS
   void C_String::checkString (LOCATION_ARGS) const {
-    if (mEmbeddedString != nullptr) {
-      macroValidSharedObject (mEmbeddedString, cEmbeddedString) ;
+    if (isInline ()) {
+      MF_AssertThere (mInlineLength <= kInlineCapacity, "mInlineLength (%ld) > %ld", mInlineLength, kInlineCapacity) ;
+      MF_AssertThere (mInlineString [mInlineLength] == '\0', "inline string is not zero terminated", 0, 0) ;
+      for (int32_t i=0 ; i<mInlineLength ; i++) {
+        MF_AssertThere ((mInlineString [i] & 0x80) == 0, "non ASCII inline character (%ld)", mInlineString [i], 0) ;
+      }
+    }else{
+      macroValidSharedObjectThere (mEmbeddedString, cEmbeddedString) ;
       mEmbeddedString->checkEmbeddedString (THERE) ;
     }
   }
@@ -316,21 +434,16 @@ utf32 C_String::operator () (const int32_t inIndex COMMA_LOCATION_ARGS) const {
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (THERE) ;
   #endif
-  macroValidSharedObjectThere (mEmbeddedString, cEmbeddedString) ;
   MF_AssertThere (inIndex >= 0, "inIndex (%ld) < 0", inIndex, 0) ;
-  MF_AssertThere ((uint32_t) inIndex < mEmbeddedString->mLength,
-                 "inIndex (%ld) >= string length (%ld)",
-                 inIndex, mEmbeddedString->mLength) ;
-  return mEmbeddedString->mString [inIndex] ;
+  MF_AssertThere (inIndex < length (), "inIndex (%ld) >= string length (%ld)", inIndex, length ()) ;
+  return characterAtIndex (inIndex) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 utf32 C_String::readCharOrNul (const int32_t inIndex COMMA_LOCATION_ARGS) const {
   MF_AssertThere (inIndex >= 0, "inIndex (%ld) < 0", inIndex, 0) ;
-  return ((mEmbeddedString == nullptr) || ((uint32_t) inIndex >= mEmbeddedString->mLength))
-    ? TO_UNICODE ('\0')
-    : mEmbeddedString->mString [inIndex] ;
+  return (inIndex >= length ()) ? TO_UNICODE ('\0') : characterAtIndex (inIndex) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -340,9 +453,9 @@ utf32 C_String::readCharOrNul (const int32_t inIndex COMMA_LOCATION_ARGS) const
 //----------------------------------------------------------------------------------------------------------------------
 
 utf32 C_String::lastCharacter (LOCATION_ARGS) const {
-  const uint32_t stringLength = mEmbeddedString->mLength ;
+  const int32_t stringLength = length () ;
   MF_AssertThere (stringLength > 0, "length == 0", 0, 0) ;
-  return (stringLength == 0) ? TO_UNICODE ('\0') : mEmbeddedString->mString [stringLength - 1] ;
+  return (stringLength == 0) ? TO_UNICODE ('\0') : characterAtIndex (stringLength - 1) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -352,10 +465,9 @@ bool C_String::containsCharacter (const utf32 inCharacter) const {
     checkString (HERE) ;
   #endif
   bool found = false ;
-  if (nullptr != mEmbeddedString) {
-    for (uint32_t i=0 ; (i<mEmbeddedString->mLength) && ! found ; i++) {
-      found = UNICODE_VALUE (mEmbeddedString->mString [i]) == UNICODE_VALUE (inCharacter) ;
-    }
+  const int32_t stringLength = length () ;
+  for (int32_t i=0 ; (i<stringLength) && ! found ; i++) {
+    found = UNICODE_VALUE (characterAtIndex (i)) == UNICODE_VALUE (inCharacter) ;
   }
   return found ;
 }
@@ -368,14 +480,14 @@ bool C_String::containsCharacterInRange (const utf32 inFirstCharacter,
     checkString (HERE) ;
   #endif
   bool found = false ;
-  if (nullptr != mEmbeddedString) {
-    for (uint32_t i=0 ; (i<mEmbeddedString->mLength) && ! found ; i++) {
-      found =
-        (UNICODE_VALUE (mEmbeddedString->mString [i]) >= UNICODE_VALUE (inFirstCharacter))
-      &&
-        (UNICODE_VALUE (mEmbeddedString->mString [i]) <= UNICODE_VALUE (inLastCharacter))
-      ;
-    }
+  const int32_t stringLength = length () ;
+  for (int32_t i=0 ; (i<stringLength) && ! found ; i++) {
+    const utf32 c = characterAtIndex (i) ;
+    found =
+      (UNICODE_VALUE (c) >= UNICODE_VALUE (inFirstCharacter))
+    &&
+      (UNICODE_VALUE (c) <= UNICODE_VALUE (inLastCharacter))
+    ;
   }
   return found ;
 }
@@ -386,49 +498,67 @@ int32_t C_String::length (void) const {
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  return (mEmbeddedString == nullptr) ? 0 : (int32_t) mEmbeddedString->mLength ;
+  return isInline () ? (int32_t) mInlineLength : (int32_t) mEmbeddedString->mLength ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 const char * C_String::cString (UNUSED_LOCATION_ARGS) const {
-  const char * result = "" ;
-  if (nullptr != mEmbeddedString) {
+  const char * result = mInlineString ;
+  if (! isInline ()) {
     macroValidSharedObject (mEmbeddedString, cEmbeddedString) ;
-    if (nullptr == mEmbeddedString->mEncodedCString) {
-      uint32_t allocatedSize = mEmbeddedString->mLength + 1 ;
-      macroMyReallocPODArray (mEmbeddedString->mEncodedCString, char, allocatedSize) ;
-      uint32_t idx = 0 ;
-      for (uint32_t i=0 ; i<mEmbeddedString->mLength ; i++) {
-        char buffer [5] ;
-        const int32_t n = UTF8StringFromUTF32Character (mEmbeddedString->mString [i], buffer) ;
-        for (int32_t j=0 ; j<n ; j++) {
-          if (allocatedSize == idx) {
-            allocatedSize *= 2 ;
-            macroMyReallocPODArray (mEmbeddedString->mEncodedCString, char, allocatedSize) ;
+    if (mEmbeddedString->mIsASCII) {
+      result = (const char *) mEmbeddedString->mLatin1String ;
+    }else{
+    //--- The encoded string is built in a local buffer and then published: a shared string can be read by several
+    //    threads, the one that loses the race releases its buffer.
+      char * encodedCString = __atomic_load_n (& mEmbeddedString->mEncodedCString, __ATOMIC_ACQUIRE) ;
+      if (nullptr == encodedCString) {
+        uint32_t allocatedSize = mEmbeddedString->mLength + 1 ;
+        macroMyReallocPODArray (encodedCString, char, allocatedSize) ;
+        uint32_t idx = 0 ;
+        for (uint32_t i=0 ; i<mEmbeddedString->mLength ; i++) {
+          char buffer [5] ;
+          const int32_t n = UTF8StringFromUTF32Character (mEmbeddedString->characterAtIndex (i), buffer) ;
+          for (int32_t j=0 ; j<n ; j++) {
+            if (allocatedSize == idx) {
+              allocatedSize *= 2 ;
+              macroMyReallocPODArray (encodedCString, char, allocatedSize) ;
+            }
+            encodedCString [idx] = buffer [j] ;
+            idx ++ ;
           }
-          mEmbeddedString->mEncodedCString [idx] = buffer [j] ;
-          idx ++ ;
+        }
+      //---
+        if (allocatedSize == idx) {
+          allocatedSize *= 2 ;
+          macroMyReallocPODArray (encodedCString, char, allocatedSize) ;
+        }
+        encodedCString [idx] = '\0' ;
+      //--- Publish
+        char * expected = nullptr ;
+        if (! __atomic_compare_exchange_n (& mEmbeddedString->mEncodedCString, & expected, encodedCString,
+                                           false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+          macroMyDeletePODArray (encodedCString) ;
+          encodedCString = expected ;
         }
       }
-    //---
-      if (allocatedSize == idx) {
-        allocatedSize *= 2 ;
-        macroMyReallocPODArray (mEmbeddedString->mEncodedCString, char, allocatedSize) ;
-      }
-      mEmbeddedString->mEncodedCString [idx] = '\0' ;
+      result = encodedCString ;
     }
-    result = mEmbeddedString->mEncodedCString ;
   }
   return result ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-const utf32 * C_String::utf32String (UNUSED_LOCATION_ARGS) const {
-  const utf32 * result = kEmptyUTF32String ;
-  if (nullptr != mEmbeddedString) {
-    result = mEmbeddedString->mString ;
+int32_t C_String::utf8Length (void) const {
+  int32_t result = length () ;
+  if (! isInline () && ! mEmbeddedString->mIsASCII) {
+    result = 0 ;
+    for (uint32_t i=0 ; i<mEmbeddedString->mLength ; i++) {
+      char buffer [5] ;
+      result += UTF8StringFromUTF32Character (mEmbeddedString->characterAtIndex (i), buffer) ;
+    }
   }
   return result ;
 }
@@ -440,25 +570,38 @@ const utf32 * C_String::utf32String (UNUSED_LOCATION_ARGS) const {
 #endif
 
 //----------------------------------------------------------------------------------------------------------------------
+//  On return, the string is stored in a uniquely referenced embedded string, that can be modified
 
-void C_String::insulateEmbeddedString (const uint32_t inNewCapacity) const {
-  if (mEmbeddedString == nullptr) {
-    macroMyNew (mEmbeddedString, cEmbeddedString (inNewCapacity COMMA_HERE)) ;
+void C_String::insulateEmbeddedString (const uint32_t inNewCapacity, const bool inWide) {
+  if (isInline ()) {
+    cEmbeddedString * p = nullptr ;
+    const uint32_t newCapacity = (inNewCapacity > mInlineLength) ? inNewCapacity : (uint32_t) (mInlineLength + 1) ;
+    macroMyNew (p, cEmbeddedString (newCapacity, inWide COMMA_HERE)) ;
+    for (uint32_t i=0 ; i<=mInlineLength ; i++) {
+      p->setCharacterAtIndex (TO_UNICODE ((uint32_t) mInlineString [i]), i) ;
+    }
+    p->mLength = mInlineLength ;
+    p->updateLineStart (0) ;
+    mInlineLength = kHeapString ;
+    mEmbeddedString = p ;
   }else{
     macroValidSharedObject (mEmbeddedString, cEmbeddedString) ;
     if (mEmbeddedString->isUniquelyReferenced ()) {
       macroMyDeletePODArray (mEmbeddedString->mEncodedCString) ;
       mEmbeddedString->reallocEmbeddedString (inNewCapacity) ;
+      if (inWide) {
+        mEmbeddedString->widen () ;
+      }
     }else{
       cEmbeddedString * p = nullptr ;
-      macroMyNew (p, cEmbeddedString (mEmbeddedString, inNewCapacity COMMA_HERE)) ;
+      macroMyNew (p, cEmbeddedString (mEmbeddedString, inNewCapacity, inWide COMMA_HERE)) ;
       macroAssignSharedObject (mEmbeddedString, p) ;
       macroDetachSharedObject (p) ;
     }
-    #ifndef DO_NOT_GENERATE_CHECKINGS
-      checkString (HERE) ;
-    #endif
   }
+  #ifndef DO_NOT_GENERATE_CHECKINGS
+    checkString (HERE) ;
+  #endif
   MF_Assert (capacity () >= inNewCapacity, "capacity (%lld) < inNewCapacity (%lld)", capacity (), inNewCapacity) ;
   macroValidSharedObject (mEmbeddedString, cEmbeddedString) ;
   macroUniqueSharedObject (mEmbeddedString) ;
@@ -470,15 +613,17 @@ void C_String::setLengthToZero (void) {
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  if (mEmbeddedString != nullptr) {
-    if (mEmbeddedString->isUniquelyReferenced ()) {
-      macroMyDeletePODArray (mEmbeddedString->mEncodedCString) ;
-      mEmbeddedString->mLength = 0 ;
-      mEmbeddedString->mString [0] = TO_UNICODE ('\0') ;
-    }else{
-      macroDetachSharedObject (mEmbeddedString) ;
-      mEmbeddedString = nullptr ;
-    }
+  if (isInline ()) {
+    mInlineLength = 0 ;
+    mInlineString [0] = '\0' ;
+  }else if (mEmbeddedString->isUniquelyReferenced ()) {
+    macroMyDeletePODArray (mEmbeddedString->mEncodedCString) ;
+    mEmbeddedString->mLength = 0 ;
+    mEmbeddedString->mLineStart = 0 ;
+    mEmbeddedString->setCharacterAtIndex (TO_UNICODE ('\0'), 0) ;
+    mEmbeddedString->mIsASCII = ! mEmbeddedString->isWide () ;
+  }else{
+    releaseString () ;
   }
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
@@ -488,7 +633,12 @@ void C_String::setLengthToZero (void) {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_String::insulate (void) const {
-  insulateEmbeddedString ((uint32_t) length ()) ;
+  if (! isInline () && ! mEmbeddedString->isUniquelyReferenced ()) {
+    cEmbeddedString * p = nullptr ;
+    macroMyNew (p, cEmbeddedString (mEmbeddedString, mEmbeddedString->mLength + 1, false COMMA_HERE)) ;
+    macroAssignSharedObject (mEmbeddedString, p) ;
+    macroDetachSharedObject (p) ;
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -498,9 +648,7 @@ void C_String::insulate (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_String::setFromString (const C_String & inString) {
-  if (this != & inString) {
-    macroAssignSharedObject (mEmbeddedString, inString.mEmbeddedString) ;
-  }
+  *this = inString ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -513,33 +661,14 @@ void C_String::setCapacity (const uint32_t inNewCapacity) {
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  if (mEmbeddedString != nullptr) {
-    macroMyDeletePODArray (mEmbeddedString->mEncodedCString) ;
-    if ((mEmbeddedString->mLength < inNewCapacity) && (mEmbeddedString->mCapacity < inNewCapacity)) {
-      if (mEmbeddedString->isUniquelyReferenced ()) {
-        macroMyDeletePODArray (mEmbeddedString->mEncodedCString) ;
-        mEmbeddedString->reallocEmbeddedString (inNewCapacity) ;
-      }else{
-        cEmbeddedString * p = nullptr ;
-        macroMyNew (p, cEmbeddedString (mEmbeddedString, inNewCapacity COMMA_HERE)) ;
-        macroAssignSharedObject (mEmbeddedString, p)  ;
-        macroDetachSharedObject (p) ;
-      }
-      #ifndef DO_NOT_GENERATE_CHECKINGS
-        checkString (HERE) ;
-      #endif
+  if (isInline ()) {
+    if (inNewCapacity > (uint32_t) (kInlineCapacity + 1)) {
+      insulateEmbeddedString (inNewCapacity, false) ;
     }
-  }else if (inNewCapacity > 0) {
-    macroMyNew (mEmbeddedString, cEmbeddedString (inNewCapacity COMMA_HERE)) ;
-    #ifndef DO_NOT_GENERATE_CHECKINGS
-      checkString (HERE) ;
-    #endif
+  }else if ((mEmbeddedString->mLength < inNewCapacity) && (mEmbeddedString->mCapacity < inNewCapacity)) {
+    insulateEmbeddedString (inNewCapacity, false) ;
   }
   MF_Assert (capacity () >= inNewCapacity, "capacity (%lld) < inNewCapacity (%lld)", capacity (), inNewCapacity) ;
-  if (mEmbeddedString != nullptr) {
-    macroValidSharedObject (mEmbeddedString, cEmbeddedString) ;
-    macroUniqueSharedObject (mEmbeddedString) ;
-  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -550,19 +679,33 @@ void C_String::performActualUnicodeArrayOutput (const utf32 * inUTF32CharArray,
     checkString (HERE) ;
   #endif
   if (inArrayCount > 0) {
-    const int32_t kNewLength = length () + inArrayCount ;
-    insulateEmbeddedString ((uint32_t) (kNewLength + 1)) ;
-    MF_Assert (mEmbeddedString->isUniquelyReferenced (), "mEmbeddedString->isUniquelyReferenced () is false", 0, 0) ;
+  //--- Characters are all ASCII if the bitwise or is lower than 0x80, all Latin-1 if it is lower than 0x100
+    uint32_t characterBits = 0 ;
     for (int32_t i=0 ; i<inArrayCount ; i++) {
-      mEmbeddedString->mString [mEmbeddedString->mLength + (uint32_t) i] = inUTF32CharArray [i] ;
+      characterBits |= UNICODE_VALUE (inUTF32CharArray [i]) ;
+    }
+    const int32_t currentLength = length () ;
+    const int32_t newLength = currentLength + inArrayCount ;
+    if (isInline () && (characterBits < 0x80) && (newLength <= kInlineCapacity)) {
+      for (int32_t i=0 ; i<inArrayCount ; i++) {
+        mInlineString [currentLength + i] = (char) UNICODE_VALUE (inUTF32CharArray [i]) ;
+      }
+      mInlineString [newLength] = '\0' ;
+      mInlineLength = (uint8_t) newLength ;
+    }else{
+      insulateEmbeddedString ((uint32_t) (newLength + 1), characterBits > 0xFF) ;
+      for (int32_t i=0 ; i<inArrayCount ; i++) {
+        mEmbeddedString->setCharacterAtIndex (inUTF32CharArray [i], (uint32_t) (currentLength + i)) ;
+      }
+      mEmbeddedString->setCharacterAtIndex (TO_UNICODE ('\0'), (uint32_t) newLength) ;
+      mEmbeddedString->mLength = (uint32_t) newLength ;
+      mEmbeddedString->updateLineStart ((uint32_t) currentLength) ;
+      MF_Assert (capacity () > (uint32_t) newLength, "capacity (%lld) <= newLength (%lld)", capacity (), newLength) ;
+      macroUniqueSharedObject (mEmbeddedString) ;
     }
-    mEmbeddedString->mLength = (uint32_t) kNewLength ;
-    mEmbeddedString->mString [kNewLength] = TO_UNICODE ('\0') ;
     #ifndef DO_NOT_GENERATE_CHECKINGS
       checkString (HERE) ;
     #endif
-    MF_Assert (capacity () > (uint32_t) kNewLength, "capacity (%lld) <= kNewLength (%lld)", capacity (), kNewLength) ;
-    macroUniqueSharedObject (mEmbeddedString) ;
   }
 }
 
@@ -573,29 +716,54 @@ void C_String::performActualCharArrayOutput (const char * inCharArray,
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  if (inArrayCount != 0) {
-    insulateEmbeddedString ((uint32_t) (length () + inArrayCount + 1)) ;
-    int32_t newLength = (int32_t) mEmbeddedString->mLength ;
-    int32_t idx = 0 ;
-    bool ok = true ;
-    while ((idx < inArrayCount) && ok) {
-      if ((inCharArray [idx] & 0x80) == 0) { // ASCII
-        mEmbeddedString->mString [newLength] = TO_UNICODE ((uint32_t) inCharArray [idx]) ;
-        idx ++ ;
-        newLength ++ ;
+  bool isASCII = true ;
+  for (int32_t i=0 ; (i<inArrayCount) && isASCII ; i++) {
+    isASCII = (inCharArray [i] & 0x80) == 0 ;
+  }
+  if (inArrayCount <= 0) {
+  //--- Nothing to append
+  }else if (isASCII) { // Appended as is
+    const int32_t currentLength = length () ;
+    const int32_t newLength = currentLength + inArrayCount ;
+    if (isInline () && (newLength <= kInlineCapacity)) {
+      memcpy (& mInlineString [currentLength], inCharArray, (size_t) inArrayCount) ;
+      mInlineString [newLength] = '\0' ;
+      mInlineLength = (uint8_t) newLength ;
+    }else{
+      insulateEmbeddedString ((uint32_t) (newLength + 1), false) ;
+      if (mEmbeddedString->isWide ()) {
+        for (int32_t i=0 ; i<inArrayCount ; i++) {
+          mEmbeddedString->mUTF32String [currentLength + i] = TO_UNICODE ((uint32_t) inCharArray [i]) ;
+        }
       }else{
-        const utf32 unicodeChar = utf32CharacterForPointer ((const uint8_t *) inCharArray, idx, inArrayCount, ok) ;
-        mEmbeddedString->mString [newLength] = unicodeChar ;
-        newLength ++ ;
+        memcpy (& mEmbeddedString->mLatin1String [currentLength], inCharArray, (size_t) inArrayCount) ;
       }
+      mEmbeddedString->setCharacterAtIndex (TO_UNICODE ('\0'), (uint32_t) newLength) ;
       mEmbeddedString->mLength = (uint32_t) newLength ;
-      mEmbeddedString->mString [newLength] = TO_UNICODE ('\0') ;
+      mEmbeddedString->updateLineStart ((uint32_t) currentLength) ;
+      macroUniqueSharedObject (mEmbeddedString) ;
     }
     #ifndef DO_NOT_GENERATE_CHECKINGS
       checkString (HERE) ;
     #endif
-    MF_Assert (capacity () > (uint32_t) newLength, "capacity (%lld) <= kNewLength (%lld)", capacity (), newLength) ;
-    macroUniqueSharedObject (mEmbeddedString) ;
+  }else{ // UTF-8 sequences are decoded by chunks; decoding stops on an invalid sequence
+    const int32_t kBufferSize = 64 ;
+    utf32 buffer [kBufferSize] ;
+    int32_t idx = 0 ;
+    bool ok = true ;
+    while ((idx < inArrayCount) && ok) {
+      int32_t count = 0 ;
+      while ((idx < inArrayCount) && ok && (count < kBufferSize)) {
+        if ((inCharArray [idx] & 0x80) == 0) { // ASCII
+          buffer [count] = TO_UNICODE ((uint32_t) inCharArray [idx]) ;
+          idx ++ ;
+        }else{
+          buffer [count] = utf32CharacterForPointer ((const uint8_t *) inCharArray, idx, inArrayCount, ok) ;
+        }
+        count ++ ;
+      }
+      performActualUnicodeArrayOutput (buffer, count) ;
+    }
   }
 }
 
@@ -612,14 +780,14 @@ void C_String::setUnicodeCharacterAtIndex (const utf32 inCharacter,
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  macroValidPointerThere (mEmbeddedString) ;
   MF_AssertThere (inIndex >= 0, "inIndex (%ld) < 0", inIndex, 0) ;
-  if (nullptr != mEmbeddedString) {
-    MF_AssertThere ((uint32_t) inIndex < mEmbeddedString->mLength,
-                    "inIndex (%ld) >= string length (%ld)",
-                    inIndex, mEmbeddedString->mLength) ;
-    insulateEmbeddedString (mEmbeddedString->mCapacity) ;
-    mEmbeddedString->mString [inIndex] = inCharacter ;
+  MF_AssertThere (inIndex < length (), "inIndex (%ld) >= string length (%ld)", inIndex, length ()) ;
+  if (isInline () && (UNICODE_VALUE (inCharacter) < 0x80)) {
+    mInlineString [inIndex] = (char) UNICODE_VALUE (inCharacter) ;
+  }else{
+    insulateEmbeddedString ((uint32_t) (length () + 1), UNICODE_VALUE (inCharacter) > 0xFF) ;
+    mEmbeddedString->setCharacterAtIndex (inCharacter, (uint32_t) inIndex) ;
+    mEmbeddedString->mLineStart = kUnknownLineStart ;
     macroUniqueSharedObject (mEmbeddedString) ;
   }
 }
@@ -634,31 +802,33 @@ void C_String::suppress (const int32_t inLocation,
                          const int32_t inLength
                          COMMA_LOCATION_ARGS) {
   if (inLength > 0) {
-    insulateEmbeddedString (mEmbeddedString->mCapacity) ;
     #ifndef DO_NOT_GENERATE_CHECKINGS
       checkString (HERE) ;
     #endif
-    macroValidPointerThere (mEmbeddedString) ;
+    const int32_t stringLength = length () ;
     MF_AssertThere (inLocation >= 0, "inLocation (%ld) < 0", inLocation, 0) ;
-    MF_AssertThere ((uint32_t) inLocation <= mEmbeddedString->mLength,
-                   "inLocation (%ld) > mLength (%ld)",
-                    inLocation, mEmbeddedString->mLength) ;
-    MF_AssertThere ((uint32_t) inLength <= mEmbeddedString->mLength,
-                   "inLength (%ld) > string length (%ld)",
-                    inLength, mEmbeddedString->mLength) ;
-    const int32_t bytesToMove = 1 + ((int32_t) mEmbeddedString->mLength) - inLength - inLocation ;
-    if ((inLocation >= 0) && (bytesToMove > 0)) {
-      for (int32_t i=0 ; i<bytesToMove ; i++) {
-        mEmbeddedString->mString [inLocation + i] = mEmbeddedString->mString [inLocation + i + inLength] ;
+    MF_AssertThere (inLocation <= stringLength, "inLocation (%ld) > length (%ld)", inLocation, stringLength) ;
+    MF_AssertThere (inLength <= stringLength, "inLength (%ld) > string length (%ld)", inLength, stringLength) ;
+    const int32_t charactersToMove = 1 + stringLength - inLength - inLocation ; // Includes terminating zero
+    if ((inLocation >= 0) && (charactersToMove > 0)) {
+      if (isInline ()) {
+        memmove (& mInlineString [inLocation], & mInlineString [inLocation + inLength], (size_t) charactersToMove) ;
+        mInlineLength = (uint8_t) (stringLength - inLength) ;
+      }else{
+        insulateEmbeddedString ((uint32_t) (stringLength + 1), false) ;
+        for (int32_t i=0 ; i<charactersToMove ; i++) {
+          mEmbeddedString->setCharacterAtIndex (
+            mEmbeddedString->characterAtIndex ((uint32_t) (inLocation + i + inLength)),
+            (uint32_t) (inLocation + i)
+          ) ;
+        }
+        mEmbeddedString->mLength -= (uint32_t) inLength ;
+        mEmbeddedString->mLineStart = kUnknownLineStart ;
+        macroUniqueSharedObject (mEmbeddedString) ;
       }
-      MF_Assert (mEmbeddedString->mLength >= (uint32_t) inLength,
-                 "mLength (%lld) < inLength (%lld)",
-                 mEmbeddedString->mLength, inLength) ;
-      mEmbeddedString->mLength -= (uint32_t) inLength ;
       #ifndef DO_NOT_GENERATE_CHECKINGS
         checkString (HERE) ;
       #endif
-      macroUniqueSharedObject (mEmbeddedString) ;
     }
   }
 }
@@ -672,26 +842,72 @@ void C_String::suppress (const int32_t inLocation,
 void C_String::insertCharacterAtIndex (const utf32 inChar,
                                        const int32_t inIndex
                                        COMMA_LOCATION_ARGS) {
-  const uint32_t kNewLength = ((uint32_t) length ()) + 1 ;
-  insulateEmbeddedString (kNewLength) ;
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  macroValidPointerThere (mEmbeddedString) ;
+  const int32_t stringLength = length () ;
   MF_AssertThere (inIndex >= 0, "inIndex (%ld) < 0", inIndex, 0) ;
-  MF_AssertThere ((uint32_t) inIndex <= mEmbeddedString->mLength,
-                 "inIndex (%ld) > mLength (%ld)",
-                  inIndex, mEmbeddedString->mLength) ;
-  const int32_t bytesToMove = 1 + ((int32_t) mEmbeddedString->mLength) - inIndex ;
-  for (int32_t i=bytesToMove ; i>0 ; i--) {
-    mEmbeddedString->mString [inIndex + i] = mEmbeddedString->mString [inIndex + i - 1] ;
-  }
-  mEmbeddedString->mString [inIndex] = inChar ;
-  mEmbeddedString->mLength += 1 ;
+  MF_AssertThere (inIndex <= stringLength, "inIndex (%ld) > length (%ld)", inIndex, stringLength) ;
+  if (isInline () && (UNICODE_VALUE (inChar) < 0x80) && (stringLength < kInlineCapacity)) {
+    memmove (& mInlineString [inIndex + 1], & mInlineString [inIndex], (size_t) (stringLength - inIndex + 1)) ;
+    mInlineString [inIndex] = (char) UNICODE_VALUE (inChar) ;
+    mInlineLength = (uint8_t) (stringLength + 1) ;
+  }else{
+    insulateEmbeddedString ((uint32_t) (stringLength + 2), UNICODE_VALUE (inChar) > 0xFF) ;
+    for (int32_t i=stringLength + 1 ; i>inIndex ; i--) {
+      mEmbeddedString->setCharacterAtIndex (mEmbeddedString->characterAtIndex ((uint32_t) (i - 1)), (uint32_t) i) ;
+    }
+    mEmbeddedString->setCharacterAtIndex (inChar, (uint32_t) inIndex) ;
+    mEmbeddedString->mLength += 1 ;
+    mEmbeddedString->mLineStart = kUnknownLineStart ;
+    macroUniqueSharedObject (mEmbeddedString) ;
+  }
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkString (HERE) ;
   #endif
-  macroUniqueSharedObject (mEmbeddedString) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+int32_t C_String::indexOfString (const C_String & inSearchedString,
+                                 const int32_t inStartIndex) const {
+  const int32_t searchedStringLength = inSearchedString.length () ;
+  const int32_t lastIndex = length () - searchedStringLength ;
+  int32_t result = -1 ;
+  for (int32_t i=inStartIndex ; (i<=lastIndex) && (result < 0) ; i++) {
+    bool found = true ;
+    for (int32_t j=0 ; (j<searchedStringLength) && found ; j++) {
+      found = UNICODE_VALUE (characterAtIndex (i + j)) == UNICODE_VALUE (inSearchedString.characterAtIndex (j)) ;
+    }
+    if (found) {
+      result = i ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_String::appendSubString (const C_String & inSource,
+                                const int32_t inStartIndex,
+                                const int32_t inLength) {
+  if (inSource.isInline () || inSource.mEmbeddedString->mIsASCII) {
+    genericCharArrayOutput (& (inSource.cString (HERE) [inStartIndex]), inLength) ;
+  }else{
+    const int32_t kBufferSize = 64 ;
+    utf32 buffer [kBufferSize] ;
+    int32_t idx = inStartIndex ;
+    const int32_t endIndex = inStartIndex + inLength ;
+    while (idx < endIndex) {
+      int32_t count = 0 ;
+      while ((idx < endIndex) && (count < kBufferSize)) {
+        buffer [count] = inSource.characterAtIndex (idx) ;
+        idx ++ ;
+        count ++ ;
+      }
+      genericUnicodeArrayOutput (buffer, count) ;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -714,7 +930,7 @@ void C_String::linesArray (TC_UniqueArray <C_String> & outStringArray) const {
     typedef enum {kAppendToCurrentLine, kGotCarriageReturn, kGotLineFeed} enumState ;
     enumState state = kAppendToCurrentLine ;
     for (int32_t i=0 ; i<currentStringLength ; i++) {
-      const utf32 c = mEmbeddedString->mString [i] ;
+      const utf32 c = characterAtIndex (i) ;
       switch (state) {
       case kAppendToCurrentLine :
         switch (UNICODE_VALUE (c)) {
@@ -781,14 +997,13 @@ LineColumnContents C_String::lineAndColumnFromIndex (const int32_t inIndex) cons
   LineColumnContents result ;
   const int32_t receiverLength = length () ;
   if (inIndex < receiverLength) {
-    const utf32 * ptr = utf32String (HERE) ;
     int32_t lineNumber = 0 ;
     int32_t startOfLineIndex = 0 ;
     int32_t idx = 0 ;
     bool parseLine = true ;
     while ((idx < receiverLength) && parseLine) {
       while ((idx < receiverLength) && parseLine) {
-        parseLine = UNICODE_VALUE (ptr [idx]) != '\n' ;
+        parseLine = UNICODE_VALUE (characterAtIndex (idx)) != '\n' ;
         idx += parseLine ;
       }
       if (idx < inIndex) {
@@ -828,16 +1043,7 @@ int32_t C_String::indexFromLineAndColumn (const int32_t inLineNumber,
 //----------------------------------------------------------------------------------------------------------------------
 
 bool C_String::containsString (const C_String & inSearchedString) const {
-  const utf32 * source = utf32String (HERE) ;
-  bool contains = source != nullptr ;
-  if (contains) {
-    const utf32 * searchedString = inSearchedString.utf32String (HERE) ;
-    contains = searchedString == nullptr ;
-    if (! contains) {
-      contains = ::utf32_strstr (source, searchedString) != nullptr ;
-    }
-  }
-  return contains ;
+  return indexOfString (inSearchedString, 0) >= 0 ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -849,24 +1055,21 @@ bool C_String::containsString (const C_String & inSearchedString) const {
 void C_String::componentsSeparatedByString (const C_String & inSeparatorString,
                                             TC_UniqueArray <C_String> & outResult) const {
   outResult.removeAllKeepingCapacity () ;
-  const utf32 * sourcePtr = utf32String (HERE) ;
-  if (sourcePtr == nullptr) {
-    outResult.appendObject (C_String ()) ;
-  }else{
-    const int32_t splitStringLength = inSeparatorString.length () ;
-    const utf32 * separator = inSeparatorString.utf32String (HERE) ;
-    if (splitStringLength > 0) {
-      const utf32 * p = ::utf32_strstr (sourcePtr, separator) ;
-      while (p != nullptr) {
-        C_String s ;
-        s.genericUnicodeArrayOutput (sourcePtr, (int32_t) ((p - sourcePtr) & INT32_MAX)) ;
-        outResult.appendObject (s) ;
-        sourcePtr = p + splitStringLength ;
-        p = ::utf32_strstr (sourcePtr, separator) ;
-      }
+  const int32_t splitStringLength = inSeparatorString.length () ;
+  int32_t startIndex = 0 ;
+  if (splitStringLength > 0) {
+    int32_t idx = indexOfString (inSeparatorString, startIndex) ;
+    while (idx >= 0) {
+      C_String s ;
+      s.appendSubString (*this, startIndex, idx - startIndex) ;
+      outResult.appendObject (s) ;
+      startIndex = idx + splitStringLength ;
+      idx = indexOfString (inSeparatorString, startIndex) ;
     }
-    outResult.appendObject (C_String (sourcePtr)) ;
   }
+  C_String s ;
+  s.appendSubString (*this, startIndex, length () - startIndex) ;
+  outResult.appendObject (s) ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -898,12 +1101,9 @@ C_String C_String::stringByDeletingTailFromString (const C_String & inSearchedSt
   C_String result = * this ;
   const int32_t searchedStringLength = inSearchedString.length () ;
   if (searchedStringLength > 0) {
-    const utf32 * sourcePtr = utf32String (HERE) ;
-    const utf32 * p = ::utf32_strstr (sourcePtr,
-                                      inSearchedString.utf32String (HERE)) ;
-    if (p != nullptr) {
-      result.setLengthToZero () ;
-      result.genericUnicodeArrayOutput (sourcePtr, (int32_t) ((p - sourcePtr) & INT32_MAX)) ;
+    const int32_t idx = indexOfString (inSearchedString, 0) ;
+    if (idx >= 0) {
+      result = leftSubString (idx) ;
     }
   }
   return result ;
@@ -974,23 +1174,17 @@ C_String C_String::stringByReplacingStringByString (const C_String inSearchedStr
   outReplacementCount = 0 ;
   outOk = inSearchedString.length () != 0 ;
   if (outOk) {
-    const utf32 * sourceString = utf32String (HERE) ;
-    const int32_t sourceLength = length () ;
-    const utf32 * searchedString = inSearchedString.utf32String (HERE) ;
     const int32_t searchedStringLength = inSearchedString.length () ;
     int32_t index = 0 ;
-    while (index <= (sourceLength - searchedStringLength)) {
-      const bool found = utf32_strncmp (& sourceString [index], searchedString, searchedStringLength) == 0 ;
-      if (found) {
-        result << (inReplacementString) ;
-        index += searchedStringLength ;
-        outReplacementCount ++ ;
-      }else{
-        result.appendUnicodeCharacter (sourceString [index] COMMA_HERE) ;
-        index ++ ;
-      }
+    int32_t foundIndex = indexOfString (inSearchedString, index) ;
+    while (foundIndex >= 0) {
+      result.appendSubString (*this, index, foundIndex - index) ;
+      result << (inReplacementString) ;
+      index = foundIndex + searchedStringLength ;
+      outReplacementCount ++ ;
+      foundIndex = indexOfString (inSearchedString, index) ;
     }
-    result.appendUTF32String (& sourceString [index]) ;
+    result.appendSubString (*this, index, length () - index) ;
   }
   return result ;
 }
@@ -1012,11 +1206,10 @@ C_String C_String::stringByReplacingStringByString (const C_String inSearchedStr
 
 int32_t C_String::lastOccurrenceIndexOfChar (const utf32 inChar) const {
   int32_t result = length () ;
-  const utf32 * ptr = utf32String (HERE) ;
   bool notFound = true ;
   while ((result > 0) && notFound) {
     result -- ;
-    notFound = UNICODE_VALUE (ptr [result]) != UNICODE_VALUE (inChar) ;
+    notFound = UNICODE_VALUE (characterAtIndex (result)) != UNICODE_VALUE (inChar) ;
   }
   if (notFound) {
     result = -1 ;
@@ -1035,9 +1228,8 @@ C_String C_String::subString (const int32_t inStartIndex,
     if (last > receiver_length) {
       last = receiver_length ;
     }
-    const utf32 * ptr = utf32String (HERE) ;
-    for (int32_t i=inStartIndex ; i<last ; i++) {
-      s.appendUnicodeCharacter (ptr [i] COMMA_HERE) ;
+    if (last > inStartIndex) {
+      s.appendSubString (*this, inStartIndex, last - inStartIndex) ;
     }
   }
   return s ;
@@ -1049,11 +1241,10 @@ C_String C_String::stringByCapitalizingFirstCharacter (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   if (receiver_length > 0) {
-    s.appendUnicodeCharacter (unicodeToUpper (ptr [0]) COMMA_HERE) ;
+    s.appendUnicodeCharacter (unicodeToUpper (characterAtIndex (0)) COMMA_HERE) ;
     for (int32_t i=1 ; i<receiver_length ; i++) {
-      s.appendUnicodeCharacter (ptr [i] COMMA_HERE) ;
+      s.appendUnicodeCharacter (characterAtIndex (i) COMMA_HERE) ;
     }
   }
   return s ;
@@ -1065,9 +1256,8 @@ C_String C_String::lowercaseString (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    s.appendUnicodeCharacter (unicodeToLower (ptr [i]) COMMA_HERE) ;
+    s.appendUnicodeCharacter (unicodeToLower (characterAtIndex (i)) COMMA_HERE) ;
   }
   return s ;
 }
@@ -1078,16 +1268,15 @@ C_String C_String::stringByTrimmingSeparators (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
 //--- Trim left
   int32_t idx = 0 ;
-  while ((idx < receiver_length) && ((UNICODE_VALUE (ptr [idx]) == ' ') || (UNICODE_VALUE (ptr [idx]) == '\n'))) {
+  while ((idx < receiver_length) && ((UNICODE_VALUE (characterAtIndex (idx)) == ' ') || (UNICODE_VALUE (characterAtIndex (idx)) == '\n'))) {
     idx ++ ;
   }
 //--- Trim and replace
   bool isCurrentlyTrimming = false ;
   while (idx < receiver_length) {
-    const utf32 c = ptr [idx] ;
+    const utf32 c = characterAtIndex (idx) ;
     if ((UNICODE_VALUE (c) == ' ') || (UNICODE_VALUE (c) == '\n')) {
       isCurrentlyTrimming = true ;
     }else{
@@ -1108,9 +1297,8 @@ C_String C_String::uppercaseString (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    s.appendUnicodeCharacter (unicodeToUpper (ptr [i]) COMMA_HERE) ;
+    s.appendUnicodeCharacter (unicodeToUpper (characterAtIndex (i)) COMMA_HERE) ;
   }
   return s ;
 }
@@ -1126,15 +1314,22 @@ C_String C_String::reversedString (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_String::reverseStringInPlace (void) {
-  if (nullptr != mEmbeddedString) {
-    const int32_t receiver_length = length () ;
-    macroUniqueSharedObject (mEmbeddedString) ;
-    insulateEmbeddedString (mEmbeddedString->mCapacity) ;
+  const int32_t receiver_length = length () ;
+  if (isInline ()) {
     for (int32_t i=0 ; i<(receiver_length/2) ; i++) {
-      const utf32 temp = mEmbeddedString->mString [i] ;
-      mEmbeddedString->mString [i] = mEmbeddedString->mString [receiver_length - i - 1] ;
-      mEmbeddedString->mString [receiver_length - i - 1] = temp ;
+      const char temp = mInlineString [i] ;
+      mInlineString [i] = mInlineString [receiver_length - i - 1] ;
+      mInlineString [receiver_length - i - 1] = temp ;
     }
+  }else{
+    insulateEmbeddedString ((uint32_t) (receiver_length + 1), false) ;
+    for (int32_t i=0 ; i<(receiver_length/2) ; i++) {
+      const utf32 temp = mEmbeddedString->characterAtIndex ((uint32_t) i) ;
+      mEmbeddedString->setCharacterAtIndex (mEmbeddedString->characterAtIndex ((uint32_t) (receiver_length - i - 1)),
+                                            (uint32_t) i) ;
+      mEmbeddedString->setCharacterAtIndex (temp, (uint32_t) (receiver_length - i - 1)) ;
+    }
+    mEmbeddedString->mLineStart = kUnknownLineStart ;
   }
 }
 
@@ -1169,13 +1364,16 @@ uint32_t C_String::unsignedIntegerValue (void) const {
 
 uint32_t C_String::currentColumn (void) const {
   uint32_t result = 0 ;
-  bool found = false ;
-  const int32_t receiver_length = length () ;
-  const utf32 * ptr = utf32String (HERE) ;
-  for (int32_t i=receiver_length-1 ; (i>=0) && ! found ; i--) {
-    found = UNICODE_VALUE (ptr [i]) == '\n' ;
-    if (! found) {
-      result ++ ;
+  if (! isInline () && (mEmbeddedString->mLineStart != kUnknownLineStart)) {
+    result = mEmbeddedString->mLength - mEmbeddedString->mLineStart ;
+  }else{
+    bool found = false ;
+    const int32_t receiver_length = length () ;
+    for (int32_t i=receiver_length-1 ; (i>=0) && ! found ; i--) {
+      found = UNICODE_VALUE (characterAtIndex (i)) == '\n' ;
+      if (! found) {
+        result ++ ;
+      }
     }
   }
   return result ;
@@ -1183,9 +1381,29 @@ uint32_t C_String::currentColumn (void) const {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static void appendRepeatedCharacter (C_String & ioString,
+                                     const utf32 inRepeatedCharacter,
+                                     const uint32_t inCount) {
+  const uint32_t kBufferSize = 64 ;
+  utf32 buffer [kBufferSize] ;
+  for (uint32_t i=0 ; i<kBufferSize ; i++) {
+    buffer [i] = inRepeatedCharacter ;
+  }
+  ioString.setCapacity ((uint32_t) ioString.length () + inCount + 1) ;
+  uint32_t remaining = inCount ;
+  while (remaining > 0) {
+    const uint32_t n = (remaining < kBufferSize) ? remaining : kBufferSize ;
+    ioString.genericUnicodeArrayOutput (buffer, (int32_t) n) ;
+    remaining -= n ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 void C_String::appendSpacesUntilColumn (const uint32_t inColumn) {
-  for (uint32_t i=currentColumn () ; i<inColumn ; i++) {
-    appendUnicodeCharacter (TO_UNICODE (' ') COMMA_HERE) ;
+  const uint32_t column = currentColumn () ;
+  if (column < inColumn) {
+    appendRepeatedCharacter (*this, TO_UNICODE (' '), inColumn - column) ;
   }
 }
 
@@ -1194,9 +1412,7 @@ void C_String::appendSpacesUntilColumn (const uint32_t inColumn) {
 C_String C_String::stringWithRepeatedCharacter (const utf32 inRepeatedCharacter,
                                                 const uint32_t inCount) {
   C_String result ;
-  for (uint32_t i=0 ; i<inCount ; i++) {
-    result.appendUnicodeCharacter (inRepeatedCharacter COMMA_HERE) ;
-  }
+  appendRepeatedCharacter (result, inRepeatedCharacter, inCount) ;
   return result ;
 }
 
@@ -1399,9 +1615,8 @@ C_String C_String::identifierRepresentation (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    const utf32 c = ptr [i] ;
+    const utf32 c = characterAtIndex (i) ;
     if (isalpha ((int) UNICODE_VALUE (c))) {
       s.appendUnicodeCharacter (c COMMA_HERE) ;
     }else{
@@ -1419,9 +1634,8 @@ C_String C_String::nameRepresentation (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    const utf32 c = ptr [i] ;
+    const utf32 c = characterAtIndex (i) ;
     if (isalnum ((int) UNICODE_VALUE (c))) {
       s.appendUnicodeCharacter (c COMMA_HERE) ;
     }else{
@@ -1439,9 +1653,8 @@ C_String C_String::fileNameRepresentation (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    const utf32 c = ptr [i] ;
+    const utf32 c = characterAtIndex (i) ;
     const int nc = (int) UNICODE_VALUE (c) ;
     if (isdigit (nc) || islower (nc)) {
       s.appendUnicodeCharacter (c COMMA_HERE) ;
@@ -1460,9 +1673,8 @@ C_String C_String::assemblerRepresentation (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    const utf32 c = ptr [i] ;
+    const utf32 c = characterAtIndex (i) ;
     if (isalnum ((int) UNICODE_VALUE (c)) || (UNICODE_VALUE (c) == '.')  || (UNICODE_VALUE (c) == '-') || (UNICODE_VALUE (c) == '$')) {
       s.appendUnicodeCharacter (c COMMA_HERE) ;
     }else{
@@ -1480,10 +1692,9 @@ C_String C_String::utf8RepresentationEnclosedWithin (const utf32 inCharacter, co
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   s.appendUnicodeCharacter  (inCharacter COMMA_HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    const utf32 c = ptr [i] ;
+    const utf32 c = characterAtIndex (i) ;
     if (UNICODE_VALUE (c) == '\\') {
       s.appendUnicodeCharacter ('\\' COMMA_HERE) ;
       s.appendUnicodeCharacter ('\\' COMMA_HERE) ;
@@ -1534,10 +1745,9 @@ C_String C_String::utf8RepresentationWithUnicodeEscaping (void) const {
   C_String s ;
   const int32_t receiver_length = length () ;
   s.setCapacity ((uint32_t) receiver_length) ;
-  const utf32 * ptr = utf32String (HERE) ;
   s.appendUnicodeCharacter  ('\"' COMMA_HERE) ;
   for (int32_t i=0 ; i<receiver_length ; i++) {
-    const utf32 c = ptr [i] ;
+    const utf32 c = characterAtIndex (i) ;
     if (UNICODE_VALUE (c) == '\\') {
       s.appendUnicodeCharacter ('\\' COMMA_HERE) ;
       s.appendUnicodeCharacter ('\\' COMMA_HERE) ;
@@ -1623,14 +1833,18 @@ C_String C_String::HTMLRepresentation (void) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t C_String::compare (const char * const inCstring) const {
-  int32_t result = 0 ;
-  const utf32 * myStringPtr = utf32String (HERE) ;
-  if (inCstring == nullptr) {
-    result = 1 ;
-  }else if (myStringPtr == nullptr) {
-    result = -1 ;
-  }else{
-    result = ::utf32_char_strcmp (myStringPtr, inCstring) ; // Never call strcmp with nullptr pointer(s) !
+  int32_t result = 1 ;
+  if (inCstring != nullptr) {
+    const int32_t receiverLength = length () ;
+    int32_t c1 ;
+    int32_t c2 ;
+    int32_t idx = 0 ;
+    do{
+      c1 = (idx < receiverLength) ? (int32_t) UNICODE_VALUE (characterAtIndex (idx)) : 0 ;
+      c2 = (int32_t) inCstring [idx] ;
+      idx ++ ;
+    }while ((c1 != 0) && (c1 == c2)) ;
+    result = c1 - c2 ;
   }
   return result ;
 }
@@ -1638,36 +1852,29 @@ int32_t C_String::compare (const char * const inCstring) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t C_String::compare (const C_String & inString) const {
-  int32_t result = 0 ;
-  const utf32 * myStringPtr = utf32String (HERE) ;
-  const utf32 * otherStringPtr = inString.utf32String (HERE) ;
-  if (myStringPtr == nullptr) {
-    result = 1 ;
-  }else if (otherStringPtr == nullptr) {
-    result = -1 ;
-  }else{
-    result = ::utf32_strcmp (myStringPtr, otherStringPtr) ; // Never call strcmp with nullptr pointer(s) !
-  }
-  return result ;
+  const int32_t receiverLength = length () ;
+  const int32_t operandLength = inString.length () ;
+  int32_t c1 ;
+  int32_t c2 ;
+  int32_t idx = 0 ;
+  do{
+    c1 = (idx < receiverLength) ? (int32_t) UNICODE_VALUE (characterAtIndex (idx)) : 0 ;
+    c2 = (idx < operandLength) ? (int32_t) UNICODE_VALUE (inString.characterAtIndex (idx)) : 0 ;
+    idx ++ ;
+  }while ((c1 != 0) && (c1 == c2)) ;
+  return c1 - c2 ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 int32_t C_String::compareStringByLength (const C_String & inString) const {
-  int32_t result ;
-  const utf32 * myStringPtr = utf32String (HERE) ;
-  const utf32 * otherStringPtr = inString.utf32String (HERE) ;
-  if (otherStringPtr == myStringPtr) {
+  int32_t result = length () - inString.length () ;
+  if (result != 0) {
+  //--- Lengths are different
+  }else if (! isInline () && ! inString.isInline () && (mEmbeddedString == inString.mEmbeddedString)) {
     result = 0 ;
-  }else if (otherStringPtr == nullptr) {
-    result = 1 ;
-  }else if (otherStringPtr == nullptr) {
-    result = -1 ;
   }else{
-    result = length () - inString.length () ;
-    if (result == 0) {
-      result = ::utf32_strcmp (myStringPtr, otherStringPtr) ; // Never call strcmp with nullptr pointer(s) !
-    }
+    result = compare (inString) ;
   }
   return result ;
 }
@@ -1711,11 +1918,10 @@ C_String C_String::operator + (const char * inOperand) const {
 //----------------------------------------------------------------------------------------------------------------------
 
 C_String C_String::pathExtension (void) const {
-  const utf32 * source = utf32String (HERE) ;
   C_String result ;
   int32_t receiver_length = length ();
 //--- Suppress training '/'
-  while ((receiver_length > 1) && (UNICODE_VALUE (source [receiver_length - 1]) == '/')) {
+  while ((receiver_length > 1) && (UNICODE_VALUE (characterAtIndex (receiver_length - 1)) == '/')) {
     receiver_length -- ;
   }
 //--- Search last '.'
@@ -1723,11 +1929,11 @@ C_String C_String::pathExtension (void) const {
   int32_t lastOccurrenceIndex = receiver_length ;
   while ((lastOccurrenceIndex > 0) && ! found) {
     lastOccurrenceIndex -- ;
-    found = UNICODE_VALUE (source [lastOccurrenceIndex]) == '.' ;
+    found = UNICODE_VALUE (characterAtIndex (lastOccurrenceIndex)) == '.' ;
   }
   if (found) {
     if (lastOccurrenceIndex < (receiver_length - 1)) {
-      result.genericUnicodeArrayOutput (& source [lastOccurrenceIndex + 1], receiver_length - 1 - lastOccurrenceIndex) ;
+      result.appendSubString (*this, lastOccurrenceIndex + 1, receiver_length - 1 - lastOccurrenceIndex) ;
     }
   }
   return result ;
@@ -1741,11 +1947,10 @@ C_String C_String::pathExtension (void) const {
 
 C_String C_String::
 stringByDeletingPathExtension (void) const {
-  const utf32 * source = utf32String (HERE) ;
   C_String result ;
   int32_t receiver_length = length ();
 //--- Suppress training '/'
-  while ((receiver_length > 1) && (UNICODE_VALUE (source [receiver_length - 1]) == '/')) {
+  while ((receiver_length > 1) && (UNICODE_VALUE (characterAtIndex (receiver_length - 1)) == '/')) {
     receiver_length -- ;
   }
 //--- Search last '.'
@@ -1753,10 +1958,10 @@ stringByDeletingPathExtension (void) const {
   int32_t lastOccurrenceIndex = receiver_length ;
   while ((lastOccurrenceIndex > 0) && ! found) {
     lastOccurrenceIndex -- ;
-    found = UNICODE_VALUE (source [lastOccurrenceIndex]) == '.' ;
+    found = UNICODE_VALUE (characterAtIndex (lastOccurrenceIndex)) == '.' ;
   }
   if (found) {
-    result.genericUnicodeArrayOutput (source, lastOccurrenceIndex) ;
+    result.appendSubString (*this, 0, lastOccurrenceIndex) ;
   }
   return result ;
 }
@@ -1769,11 +1974,10 @@ stringByDeletingPathExtension (void) const {
 
 C_String C_String::
 stringByDeletingLastPathComponent (void) const {
-  const utf32 * source = utf32String (HERE) ;
   C_String result ;
   int32_t receiver_length = length ();
 //--- Suppress training '/'
-  while ((receiver_length > 1) && (UNICODE_VALUE (source [receiver_length - 1]) == '/')) {
+  while ((receiver_length > 1) && (UNICODE_VALUE (characterAtIndex (receiver_length - 1)) == '/')) {
     receiver_length -- ;
   }
 //--- Search last '/'
@@ -1781,10 +1985,10 @@ stringByDeletingLastPathComponent (void) const {
   int32_t lastOccurrenceIndex = receiver_length ;
   while ((lastOccurrenceIndex > 0) && ! found) {
     lastOccurrenceIndex -- ;
-    found = UNICODE_VALUE (source [lastOccurrenceIndex]) == '/' ;
+    found = UNICODE_VALUE (characterAtIndex (lastOccurrenceIndex)) == '/' ;
   }
   if (found) {
-    result.genericUnicodeArrayOutput (source, lastOccurrenceIndex) ;
+    result.appendSubString (*this, 0, lastOccurrenceIndex) ;
   }
   return result ;
 }
@@ -1817,11 +2021,10 @@ stringByAppendingPathComponent (const C_String & inPathComponent) const {
 
 C_String C_String::
 lastPathComponent (void) const {
-  const utf32 * source = utf32String (HERE) ;
   C_String result ;
   int32_t receiver_length = length ();
 //--- Suppress training '/'
-  while ((receiver_length > 1) && (UNICODE_VALUE (source [receiver_length - 1]) == '/')) {
+  while ((receiver_length > 1) && (UNICODE_VALUE (characterAtIndex (receiver_length - 1)) == '/')) {
     receiver_length -- ;
   }
 //--- Search last '/'
@@ -1829,12 +2032,12 @@ lastPathComponent (void) const {
   int32_t lastOccurrenceIndex = receiver_length ;
   while ((lastOccurrenceIndex > 0) && ! found) {
     lastOccurrenceIndex -- ;
-    found = UNICODE_VALUE (source [lastOccurrenceIndex]) == '/' ;
+    found = UNICODE_VALUE (characterAtIndex (lastOccurrenceIndex)) == '/' ;
   }
   if (found) {
-    result.genericUnicodeArrayOutput (& source [lastOccurrenceIndex + 1], receiver_length - lastOccurrenceIndex - 1) ;
+    result.appendSubString (*this, lastOccurrenceIndex + 1, receiver_length - lastOccurrenceIndex - 1) ;
   }else{
-    result.genericUnicodeArrayOutput (source, receiver_length) ;
+    result.appendSubString (*this, 0, receiver_length) ;
   }
   return result ;
 }
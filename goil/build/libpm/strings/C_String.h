@@ -176,8 +176,8 @@ class C_String : public AC_OutputStream {
 //--- Get a string pointer
   public: const char * cString (LOCATION_ARGS) const ;
 
-//--- Get a UTF32 string pointer
-  public: const utf32 * utf32String (LOCATION_ARGS) const ;
+//--- Get the byte count of the string returned by cString
+  public: int32_t utf8Length (void) const ;
 
 //--- Compare with an other string 
   public: int32_t compare (const char * const inCstring) const ;
@@ -321,7 +321,11 @@ class C_String : public AC_OutputStream {
                                                             const int32_t inArrayCount) ;
 
 //--- Private (internal) methods
-  private: void insulateEmbeddedString (const uint32_t inNewCapacity) const ;
+  private: void insulateEmbeddedString (const uint32_t inNewCapacity, const bool inWide) ;
+  private: utf32 characterAtIndex (const int32_t inIndex) const ;
+  private: int32_t indexOfString (const C_String & inSearchedString, const int32_t inStartIndex) const ;
+  private: void appendSubString (const C_String & inSource, const int32_t inStartIndex, const int32_t inLength) ;
+  private: bool isInline (void) const { return mInlineLength != kHeapString ; }
 
   #ifndef DO_NOT_GENERATE_CHECKINGS
     private: void checkString (LOCATION_ARGS) const ;
@@ -332,7 +336,15 @@ class C_String : public AC_OutputStream {
                                   C_String & outString) ;
 
 //---------------- Private attributes -------------
-  private: mutable class cEmbeddedString * mEmbeddedString ;
+//--- A string of at most kInlineCapacity ASCII characters is stored in the object itself. Any other string is stored
+//    in a shared buffer, with one byte per character while all characters are Latin-1 ones.
+  private: static const int32_t kInlineCapacity = 23 ;
+  private: static const uint8_t kHeapString = UINT8_MAX ;
+  private: uint8_t mInlineLength ; // kHeapString if the string is stored in mEmbeddedString
+  private: union {
+    mutable class cEmbeddedString * mEmbeddedString ;
+    char mInlineString [kInlineCapacity + 1] ; // Zero terminated
+  } ;
 } ;
 
 //----------------------------------------------------------------------------------------------------------------------
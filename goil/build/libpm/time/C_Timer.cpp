@@ -21,6 +21,23 @@
 #include "time/C_Timer.h"
 #include "utilities/M_machine.h"
 #include "strings/C_String.h"
+#include "utilities/cpp-allocation.h"
+#include "streams/C_ConsoleOut.h"
+#include "galgas2/C_Compiler.h"
+#include "all-predefined-types.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  #include <sys/resource.h>
+#endif
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -63,6 +80,18 @@ uint32_t C_Timer::msFromStart (void) const {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+uint64_t C_Timer::usFromStart (void) const {
+  clock_t duration ;
+  if (mRunning) {
+    duration = ::clock () - mStart ;
+  }else{
+    duration = mEnd - mStart ;
+  }
+  return (uint64_t (duration) * 1000000) / uint64_t (CLOCKS_PER_SEC) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
 C_String C_Timer::timeString (void) const {
   const uint32_t d = msFromStart () ;
   const uint32_t ms = d % 1000 ;
@@ -107,3 +136,282 @@ AC_OutputStream & operator << (AC_OutputStream & inStream,
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Phase timer
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class cPhaseNode final {
+  public: cPhaseNode (cPhaseNode * inParent, const C_String & inName) :
+  mParent (inParent),
+  mName (inName),
+  mChildren (),
+  mCallCount (0),
+  mNanoseconds (0),
+  mCPUMicroseconds (0),
+  mAllocatedBytes (0),
+  mAllocatedBlocks (0),
+  mPeakResidentKilobytes (0) {
+  }
+
+  public: ~ cPhaseNode (void) {
+    for (size_t i=0 ; i<mChildren.size () ; i++) {
+      delete mChildren [i] ;
+    }
+  }
+
+//--- No copy
+  private: cPhaseNode (const cPhaseNode &) = delete ;
+  private: cPhaseNode & operator = (const cPhaseNode &) = delete ;
+
+//--- Properties
+  public: cPhaseNode * const mParent ;
+  public: const C_String mName ;
+  public: std::vector <cPhaseNode *> mChildren ;
+  public: uint64_t mCallCount ;
+  public: uint64_t mNanoseconds ;
+  public: uint64_t mCPUMicroseconds ;
+  public: uint64_t mAllocatedBytes ;
+  public: uint64_t mAllocatedBlocks ;
+  public: uint64_t mPeakResidentKilobytes ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+//--- Unnamed root of the phase tree, built when phase timing is enabled
+static cPhaseNode * gPhaseRoot = nullptr ;
+
+//--- Innermost phase; nullptr when phase timing is disabled
+static cPhaseNode * gCurrentPhase = nullptr ;
+
+static std::thread::id gPhaseTimingThread ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static uint64_t phaseNanoseconds (void) {
+  return (uint64_t) std::chrono::duration_cast <std::chrono::nanoseconds> (
+    std::chrono::steady_clock::now ().time_since_epoch ()
+  ).count () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  ru_maxrss is in bytes on Mac OS X, in kilobytes on Linux. Not available on Windows.
+//----------------------------------------------------------------------------------------------------------------------
+
+static uint64_t peakResidentKilobytes (void) {
+  uint64_t result = 0 ;
+  #if COMPILE_FOR_WINDOWS == 0
+    struct rusage usage ;
+    if (::getrusage (RUSAGE_SELF, & usage) == 0) {
+      result = (uint64_t) usage.ru_maxrss ;
+      #ifdef __APPLE__
+        result /= 1024 ;
+      #endif
+    }
+  #endif
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PhaseTimer::C_PhaseTimer (const C_String & inName) :
+mNode (nullptr),
+mTimer (),
+mStartNanoseconds (0),
+mStartBytes (0),
+mStartBlocks (0) {
+  if ((nullptr != gCurrentPhase) && (std::this_thread::get_id () == gPhaseTimingThread)) {
+    for (size_t i=0 ; (i<gCurrentPhase->mChildren.size ()) && (nullptr == mNode) ; i++) {
+      if (gCurrentPhase->mChildren [i]->mName == inName) {
+        mNode = gCurrentPhase->mChildren [i] ;
+      }
+    }
+    if (nullptr == mNode) {
+      mNode = new cPhaseNode (gCurrentPhase, inName) ;
+      gCurrentPhase->mChildren.push_back (mNode) ;
+    }
+    gCurrentPhase = mNode ;
+    mStartBytes = allocatedByteCount () ;
+    mStartBlocks = allocatedBlockCount () ;
+    mTimer.startTimer () ;
+    mStartNanoseconds = phaseNanoseconds () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PhaseTimer::~ C_PhaseTimer (void) {
+  if (nullptr != mNode) {
+    mNode->mNanoseconds += phaseNanoseconds () - mStartNanoseconds ;
+    mNode->mCPUMicroseconds += mTimer.usFromStart () ;
+    mNode->mAllocatedBytes += allocatedByteCount () - mStartBytes ;
+    mNode->mAllocatedBlocks += allocatedBlockCount () - mStartBlocks ;
+    mNode->mPeakResidentKilobytes = peakResidentKilobytes () ;
+    mNode->mCallCount += 1 ;
+    gCurrentPhase = mNode->mParent ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void C_PhaseTimer::enablePhaseTiming (void) {
+  if (nullptr == gPhaseRoot) {
+    gPhaseRoot = new cPhaseNode (nullptr, C_String ()) ;
+    gCurrentPhase = gPhaseRoot ;
+    enableAllocationCounting () ;
+    gPhaseTimingThread = std::this_thread::get_id () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+bool C_PhaseTimer::phaseTimingEnabled (void) {
+  return nullptr != gPhaseRoot ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void appendPhaseLines (const cPhaseNode * inNode,
+                              const uint32_t inDepth,
+                              C_String & ioReport) {
+  char line [128] ;
+  snprintf (line, sizeof (line), "%11.3f %11.3f %8llu %15llu %12llu %21llu  ",
+            (double) inNode->mNanoseconds / 1.0e6,
+            (double) inNode->mCPUMicroseconds / 1.0e3,
+            (unsigned long long) inNode->mCallCount,
+            (unsigned long long) inNode->mAllocatedBytes,
+            (unsigned long long) inNode->mAllocatedBlocks,
+            (unsigned long long) inNode->mPeakResidentKilobytes) ;
+  ioReport << line ;
+  for (uint32_t i=0 ; i<inDepth ; i++) {
+    ioReport << "  " ;
+  }
+  ioReport << inNode->mName << "\n" ;
+  for (size_t i=0 ; i<inNode->mChildren.size () ; i++) {
+    appendPhaseLines (inNode->mChildren [i], inDepth + 1, ioReport) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_String C_PhaseTimer::textReport (void) {
+  C_String result ;
+  if (nullptr != gPhaseRoot) {
+    result << "  wall (ms)    cpu (ms)    calls  alloc. (bytes) alloc. blocks  peak RSS so far (kB)  phase\n" ;
+    for (size_t i=0 ; i<gPhaseRoot->mChildren.size () ; i++) {
+      appendPhaseLines (gPhaseRoot->mChildren [i], 0, result) ;
+    }
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void appendPhaseJSONList (const std::vector <cPhaseNode *> & inPhases,
+                                 const C_String & inIndentation,
+                                 C_String & ioReport) {
+  ioReport << "[" ;
+  for (size_t i=0 ; i<inPhases.size () ; i++) {
+    const cPhaseNode * node = inPhases [i] ;
+    C_String name = node->mName.stringByReplacingStringByString ("\\", "\\\\") ;
+    name = name.stringByReplacingStringByString ("\"", "\\\"") ;
+    char values [256] ;
+    snprintf (values, sizeof (values),
+              "\"calls\" : %llu, \"wall_ms\" : %.3f, \"cpu_ms\" : %.3f, "
+              "\"allocated_bytes\" : %llu, \"allocated_blocks\" : %llu, \"peak_rss_so_far_kB\" : %llu",
+              (unsigned long long) node->mCallCount,
+              (double) node->mNanoseconds / 1.0e6,
+              (double) node->mCPUMicroseconds / 1.0e3,
+              (unsigned long long) node->mAllocatedBytes,
+              (unsigned long long) node->mAllocatedBlocks,
+              (unsigned long long) node->mPeakResidentKilobytes) ;
+    ioReport << ((i == 0) ? "\n" : ",\n")
+             << inIndentation << "  { \"name\" : \"" << name << "\", " << values << ",\n"
+             << inIndentation << "    \"phases\" : " ;
+    appendPhaseJSONList (node->mChildren, inIndentation + "    ", ioReport) ;
+    ioReport << "\n" << inIndentation << "  }" ;
+  }
+  if (! inPhases.empty ()) {
+    ioReport << "\n" << inIndentation ;
+  }
+  ioReport << "]" ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_String C_PhaseTimer::jsonReport (void) {
+  C_String result ;
+  if (nullptr != gPhaseRoot) {
+    result << "{ \"phases\" : " ;
+    appendPhaseJSONList (gPhaseRoot->mChildren, C_String (), result) ;
+    result << "\n}\n" ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Routines declared 'extern proc' in goil_routines.galgas, for timing the phases from the GALGAS sources
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_startPhaseTiming (const GALGAS_bool constinArgument0,
+                               const GALGAS_string constinArgument1,
+                               C_Compiler * inCompiler
+                               COMMA_LOCATION_ARGS) {
+  if (constinArgument0.isValid () && constinArgument1.isValid ()) {
+    const C_String format = constinArgument1.stringValue () ;
+    if ((format != "") && (format != "text") && (format != "json")) {
+      inCompiler->onTheFlyRunTimeError (C_String ("invalid '--timings=") + format + "' parameter; it should be text or json" COMMA_THERE) ;
+    }else if (constinArgument0.boolValue () || (format != "")) {
+      C_PhaseTimer::enablePhaseTiming () ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_printPhaseTimingReport (const GALGAS_string constinArgument0,
+                                     C_Compiler * /* inCompiler */
+                                     COMMA_UNUSED_LOCATION_ARGS) {
+  if (C_PhaseTimer::phaseTimingEnabled () && constinArgument0.isValid ()) {
+    if (constinArgument0.stringValue () == "json") {
+      co << C_PhaseTimer::jsonReport () ;
+    }else{
+      co << C_PhaseTimer::textReport () ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  beginPhase and endPhase enclose a phase, as the life of a C_PhaseTimer instance does. The open phases are stacked
+//  per thread, as 'write to' blocks may run in other threads.
+//----------------------------------------------------------------------------------------------------------------------
+
+static thread_local std::vector <C_PhaseTimer *> gOpenPhases ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_beginPhase (const GALGAS_string constinArgument0,
+                         C_Compiler * /* inCompiler */
+                         COMMA_UNUSED_LOCATION_ARGS) {
+  if (C_PhaseTimer::phaseTimingEnabled () && constinArgument0.isValid ()) {
+    gOpenPhases.push_back (new C_PhaseTimer (constinArgument0.stringValue ())) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_endPhase (C_Compiler * /* inCompiler */
+                       COMMA_UNUSED_LOCATION_ARGS) {
+  if (! gOpenPhases.empty ()) {
+    delete gOpenPhases.back () ;
+    gOpenPhases.pop_back () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -47,6 +47,8 @@ class C_Timer final {
 
   public: uint32_t msFromStart (void) const ;
 
+  public: uint64_t usFromStart (void) const ;
+
   public: C_String timeString (void) const ;
   
   public: inline bool isRunning (void) const { return mRunning ; }
@@ -62,3 +64,41 @@ AC_OutputStream & operator << (AC_OutputStream & inStream,
                                const C_Timer & inTimer) ;
 
 //----------------------------------------------------------------------------------------------------------------------
+//
+//  Phase timer
+//
+//  While phase timing is enabled, each instance records a phase of the program, from its construction to its
+//  destruction: the wall time, the CPU time of the process, the number and the size of the blocks allocated by the
+//  current thread, and the peak resident memory of the process since its start, read at the end of the phase. The
+//  phases are nested as the instances are; the executions of the phases that have the same name in the same enclosing
+//  phase are merged. Only the thread that enabled phase timing records phases.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class C_PhaseTimer final {
+  public: C_PhaseTimer (const C_String & inName) ;
+
+  public: ~ C_PhaseTimer (void) ;
+
+  public: static void enablePhaseTiming (void) ;
+
+  public: static bool phaseTimingEnabled (void) ;
+
+//--- Report of the phases recorded since phase timing has been enabled, as an indented table or as JSON
+  public: static C_String textReport (void) ;
+
+  public: static C_String jsonReport (void) ;
+
+//--- No copy
+  private: C_PhaseTimer (const C_PhaseTimer &) = delete ;
+  private: C_PhaseTimer & operator = (const C_PhaseTimer &) = delete ;
+
+//--- Private properties
+  private: class cPhaseNode * mNode ;
+  private: C_Timer mTimer ;
+  private: uint64_t mStartNanoseconds ;
+  private: uint64_t mStartBytes ;
+  private: uint64_t mStartBlocks ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -93,7 +93,7 @@ C_SharedObject::~ C_SharedObject (void) {
 void C_SharedObject::retain (const C_SharedObject * inObject COMMA_LOCATION_ARGS) {
   if (inObject != nullptr) {
     macroValidSharedObjectThere (inObject, C_SharedObject) ;
-    inObject->mRetainCount ++ ;
+    inObject->mRetainCount.fetch_add (1, std::memory_order_relaxed) ;
   }
 }
 
@@ -102,9 +102,9 @@ void C_SharedObject::retain (const C_SharedObject * inObject COMMA_LOCATION_ARGS
 void C_SharedObject::release (const C_SharedObject * inObject COMMA_LOCATION_ARGS) {
   if (inObject != nullptr) {
     macroValidSharedObjectThere (inObject, C_SharedObject) ;
-    MF_AssertThere (inObject->mRetainCount > 0, "mRetainCount should be > 0)", 0, 0) ;
-    inObject->mRetainCount -- ;
-    if (inObject->mRetainCount == 0) {
+    const int32_t previousRetainCount = inObject->mRetainCount.fetch_sub (1, std::memory_order_acq_rel) ;
+    MF_AssertThere (previousRetainCount > 0, "mRetainCount should be > 0)", 0, 0) ;
+    if (previousRetainCount == 1) {
       macroMyDelete (inObject) ;
     }
   }
@@ -142,7 +142,7 @@ void C_SharedObject::retainRelease (const C_SharedObject * inObjectToRetain,
            << "', line "
            << cStringWithSigned (p->mCreationLine)
            << " (retain count: "
-           << cStringWithSigned (p->mRetainCount)
+           << cStringWithSigned (p->mRetainCount.load ())
            << ")\n" ;
         p = p->mPtrToNextObject ;
       }
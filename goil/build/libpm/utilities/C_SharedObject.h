@@ -27,6 +27,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include <atomic>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 class C_SharedObject {
 //--- Attributes for debug
   #ifndef DO_NOT_GENERATE_CHECKINGS
@@ -41,10 +45,12 @@ class C_SharedObject {
   #endif
 
 
-//--- Retain count
-  private: mutable int32_t mRetainCount ;
+//--- Retain count: atomic, as GTL template instructions may be executed by several threads (see 'write to')
+  private: mutable std::atomic <int32_t> mRetainCount ;
 
-  public: inline bool isUniquelyReferenced (void) const { return mRetainCount == 1 ; }
+  public: inline bool isUniquelyReferenced (void) const {
+    return mRetainCount.load (std::memory_order_acquire) == 1 ;
+  }
   
   public: static void retain (const C_SharedObject * inObject COMMA_LOCATION_ARGS) ;
 
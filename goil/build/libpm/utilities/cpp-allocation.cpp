@@ -26,6 +26,8 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -70,6 +72,49 @@
   static uint32_t gAllocatedArrayCount = 0 ;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+//  The counters are only updated while counting is enabled by a profiler, so that the allocations do not touch the
+//  thread local storage when nothing reads it. gAllocationCountingUsers is the number of profilers using them.
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::atomic <int32_t> gAllocationCountingUsers (0) ;
+
+static thread_local uint64_t gAllocatedByteCount = 0 ;
+static thread_local uint64_t gAllocatedBlockCount = 0 ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void enableAllocationCounting (void) {
+  gAllocationCountingUsers.fetch_add (1, std::memory_order_relaxed) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void disableAllocationCounting (void) {
+  gAllocationCountingUsers.fetch_sub (1, std::memory_order_relaxed) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static inline void countAllocation (const size_t inSizeInBytes) {
+  if (gAllocationCountingUsers.load (std::memory_order_relaxed) > 0) {
+    gAllocatedByteCount += inSizeInBytes ;
+    gAllocatedBlockCount += 1 ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint64_t allocatedByteCount (void) {
+  return gAllocatedByteCount ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint64_t allocatedBlockCount (void) {
+  return gAllocatedBlockCount ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 #ifndef DO_NOT_GENERATE_CHECKINGS
@@ -88,6 +133,7 @@
       }
       gAllocProloguePendings -- ;
     #endif
+    countAllocation (inSizeInBytes) ;
     void * result = nullptr ;
     if (inSizeInBytes > 0) {
       result = ::myAllocRoutine (inSizeInBytes) ;
@@ -113,6 +159,7 @@
       }
       gAllocProloguePendings -- ;
     #endif
+    countAllocation (inSizeInBytes) ;
     void * result = nullptr ;
     if (inSizeInBytes > 0) {
       result = ::myAllocRoutine (inSizeInBytes) ;
@@ -180,6 +227,66 @@
   }
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+//  Without checkings, the allocation operators are only redefined for counting the allocated bytes
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  void * operator new (size_t inSizeInBytes) {
+    countAllocation (inSizeInBytes) ;
+    void * result = ::malloc ((inSizeInBytes > 0) ? inSizeInBytes : 1) ;
+    if (nullptr == result) {
+      throw std::bad_alloc () ;
+    }
+    return result ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  void * operator new [] (size_t inSizeInBytes) {
+    countAllocation (inSizeInBytes) ;
+    void * result = ::malloc ((inSizeInBytes > 0) ? inSizeInBytes : 1) ;
+    if (nullptr == result) {
+      throw std::bad_alloc () ;
+    }
+    return result ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  void operator delete (void * inPointer) noexcept {
+    ::free (inPointer) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  void operator delete (void * inPointer, std::size_t) noexcept {
+    ::free (inPointer) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  void operator delete [] (void * inPointer) noexcept {
+    ::free (inPointer) ;
+  }
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef REDEFINE_NEW_DELETE_OPERATORS
+  void operator delete [] (void * inPointer, std::size_t) noexcept {
+    ::free (inPointer) ;
+  }
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void displayAllocationStats (void) {
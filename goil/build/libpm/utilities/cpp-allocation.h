@@ -22,6 +22,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include <stdint.h>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #ifndef DO_NOT_GENERATE_CHECKINGS
   void prologueForNew (void) ;
 #endif
@@ -31,3 +35,17 @@
 void displayAllocationStats (void) ;
 
 //----------------------------------------------------------------------------------------------------------------------
+//  Total size and number of the blocks allocated by the current thread with operator new and operator new [] while
+//  the counting is enabled. Each call of enableAllocationCounting enables it until the matching call of
+//  disableAllocationCounting; it is disabled by default.
+//----------------------------------------------------------------------------------------------------------------------
+
+void enableAllocationCounting (void) ;
+
+void disableAllocationCounting (void) ;
+
+uint64_t allocatedByteCount (void) ;
+
+uint64_t allocatedBlockCount (void) ;
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -14011,12 +14011,62 @@ extern C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ;
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+extern C_StringCommandLineOption gOption_gtl_5F_options_profile ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String List options                                              
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  GTL execution profiler
+//
+//  When the --gtl-profile option is set, a frame is recorded for each execution of a template, of a foreach, for,
+//  loop or repeat statement, and for each call of a function, a getter or a setter. Frames are identified by the
+//  executed entity and the stack of their callers; each one counts its invocations, and the time spent and the
+//  bytes allocated, including or excluding the frames it calls. The profile is only recorded by the main thread.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlProfilerFrame final {
+  public: cGtlProfilerFrame (const void * inEntity,
+                             const char * inKind,
+                             const GALGAS_string & inName,
+                             const GALGAS_location & inLocation) ;
+
+  public: ~ cGtlProfilerFrame (void) ;
+
+//--- No copy
+  private: cGtlProfilerFrame (const cGtlProfilerFrame &) = delete ;
+  private: cGtlProfilerFrame & operator = (const cGtlProfilerFrame &) = delete ;
+
+//--- Private properties
+  private: class cGtlProfileNode * mNode ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Profiling is enabled while an instance is alive. writeProfile writes the profile recorded since the start of the
+//  first session: <file>.folded in collapsed stack format for flame graphs, and <file>.txt, the frames sorted by
+//  exclusive time. It then frees the recorded frames and stops profiling.
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlProfilerSession final {
+  public: cGtlProfilerSession (void) ;
+
+  public: ~ cGtlProfilerSession (void) ;
+
+  public: void writeProfile (C_Compiler * inCompiler) ;
+
+//--- No copy
+  private: cGtlProfilerSession (const cGtlProfilerSession &) = delete ;
+  private: cGtlProfilerSession & operator = (const cGtlProfilerSession &) = delete ;
+
+//--- Private properties
+  private: bool mEnabled ;
+} ;
+
 //----------------------------------------------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -17548,3 +17598,66 @@ class GALGAS_gtlInstructionListContextStack_2D_element : public AC_GALGAS_root {
 
 extern const C_galgas_type_descriptor kTypeDescriptor_GALGAS_gtlInstructionListContextStack_2D_element ;
 
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'startPhaseTiming'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_startPhaseTiming (const class GALGAS_bool constinArgument0,
+                               const class GALGAS_string constinArgument1,
+                               class C_Compiler * inCompiler
+                               COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'beginPhase'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_beginPhase (const class GALGAS_string constinArgument0,
+                         class C_Compiler * inCompiler
+                         COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'endPhase'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_endPhase (class C_Compiler * inCompiler
+                       COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'printPhaseTimingReport'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_printPhaseTimingReport (const class GALGAS_string constinArgument0,
+                                     class C_Compiler * inCompiler
+                                     COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'openBuildManifest'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_openBuildManifest (const class GALGAS_string constinArgument0,
+                                const class GALGAS_string constinArgument1,
+                                const class GALGAS_bool constinArgument2,
+                                const class GALGAS_bool constinArgument3,
+                                class GALGAS_bool & outArgument4,
+                                class C_Compiler * inCompiler
+                                COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'storeBuildManifest'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_storeBuildManifest (class C_Compiler * inCompiler
+                                 COMMA_LOCATION_ARGS) ;
@@ -5,6 +5,12 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include "galgas2/C_BuildManifest.h"
+
+#include <mutex>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #include "all-declarations-10.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -19,6 +25,7 @@ void cPtr_gtlForeachStatementInstruction::method_execute (GALGAS_gtlContext & io
                                                           GALGAS_string & ioArgument_outputString,
                                                           C_Compiler * inCompiler
                                                           COMMA_UNUSED_LOCATION_ARGS) {
+  const cGtlProfilerFrame profilerFrame (this, "foreach", GALGAS_string (), this->mProperty_where) ;
   GALGAS_gtlData var_localMap_20558 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 706)) ;
   GALGAS_gtlData var_iterableData_20603 = callExtensionGetter_eval ((const cPtr_gtlExpression *) this->mProperty_iterable.ptr (), ioArgument_context, var_localMap_20558, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 707)) ;
   if (var_iterableData_20603.isValid ()) {
@@ -53,6 +60,7 @@ void cPtr_gtlForStatementInstruction::method_execute (GALGAS_gtlContext & ioArgu
                                                       GALGAS_string & ioArgument_outputString,
                                                       C_Compiler * inCompiler
                                                       COMMA_UNUSED_LOCATION_ARGS) {
+  const cGtlProfilerFrame profilerFrame (this, "for", GALGAS_string (), this->mProperty_where) ;
   GALGAS_lstring var_indexName_21672 = GALGAS_lstring::constructor_new (GALGAS_string ("INDEX"), this->mProperty_where  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 737)) ;
   GALGAS_gtlData var_localMap_21717 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 738)) ;
   cEnumerator_gtlExpressionList enumerator_21753 (this->mProperty_iterable, kENUMERATION_UP) ;
@@ -90,6 +98,7 @@ void cPtr_gtlLoopStatementInstruction::method_execute (GALGAS_gtlContext & ioArg
                                                        GALGAS_string & ioArgument_outputString,
                                                        C_Compiler * inCompiler
                                                        COMMA_UNUSED_LOCATION_ARGS) {
+  const cGtlProfilerFrame profilerFrame (this, "loop", GALGAS_string (), this->mProperty_where) ;
   GALGAS_gtlData var_localMap_22891 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 775)) ;
   GALGAS_gtlData var_startData_22936 = callExtensionGetter_eval ((const cPtr_gtlExpression *) this->mProperty_start.ptr (), ioArgument_context, var_localMap_22891, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 776)) ;
   GALGAS_gtlData var_stopData_23000 = callExtensionGetter_eval ((const cPtr_gtlExpression *) this->mProperty_stop.ptr (), ioArgument_context, var_localMap_22891, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 777)) ;
@@ -213,6 +222,7 @@ void cPtr_gtlRepeatStatementInstruction::method_execute (GALGAS_gtlContext & ioA
                                                          GALGAS_string & ioArgument_outputString,
                                                          C_Compiler * inCompiler
                                                          COMMA_UNUSED_LOCATION_ARGS) {
+  const cGtlProfilerFrame profilerFrame (this, "repeat", GALGAS_string (), this->mProperty_where) ;
   GALGAS_gtlData var_localMap_24901 = callExtensionGetter_overrideMap ((const cPtr_gtlData *) ioArgument_vars.ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 833)) ;
   GALGAS_bool var_boolCondition_24939 = GALGAS_bool (false) ;
   GALGAS_gtlData var_limitData_24976 = callExtensionGetter_eval ((const cPtr_gtlExpression *) this->mProperty_limit.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 835)) ;
@@ -383,6 +393,7 @@ void cPtr_gtlPrintStatementInstruction::method_execute (GALGAS_gtlContext & ioAr
                                                         GALGAS_string & /* ioArgument_outputString */,
                                                         C_Compiler * inCompiler
                                                         COMMA_UNUSED_LOCATION_ARGS) {
+  preventReuseOfCurrentBuildManifestBlock () ;
   GALGAS_string var_messageToPrintString_28089 = callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) this->mProperty_messageToPrint.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 932)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 932)) ;
   inCompiler->printMessage (var_messageToPrintString_28089  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 933)) ;
   enumGalgasBool test_0 = kBoolTrue ;
@@ -405,6 +416,7 @@ void cPtr_gtlDisplayStatementInstruction::method_execute (GALGAS_gtlContext & io
                                                           GALGAS_string & /* ioArgument_outputString */,
                                                           C_Compiler * inCompiler
                                                           COMMA_UNUSED_LOCATION_ARGS) {
+  preventReuseOfCurrentBuildManifestBlock () ;
   GALGAS_gtlData var_variable_28714 = extensionGetter_get (this->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 950)) ;
   inCompiler->printMessage (extensionGetter_stringPath (this->mProperty_variablePath, ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)).add_operation (GALGAS_string (" from "), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)).add_operation (this->mProperty_where.getter_endLocationString (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952)).add_operation (callExtensionGetter_desc ((const cPtr_gtlData *) var_variable_28714.ptr (), GALGAS_uint (uint32_t (4U)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 953)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 952))  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 951)) ;
 }
@@ -1915,6 +1927,13 @@ C_BoolCommandLineOption gOption_gtl_5F_options_warnDeprecated ("gtl_options",
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+C_StringCommandLineOption gOption_gtl_5F_options_profile ("gtl_options",
+                                         "profile",
+                                         0,
+                                         "gtl-profile",
+                                         "Profile the execution of the GTL templates, writing <file>.folded (collapsed stacks) and <file>.txt (report)",
+                                         "") ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String List options                                              
@@ -2001,17 +2020,16 @@ static GALGAS_string onceFunction_bold (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_bold = false ;
+static std::once_flag gOnceFunctionFlag_bold ;
 static GALGAS_string gOnceFunctionResult_bold ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_bold (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_bold) {
+  std::call_once (gOnceFunctionFlag_bold, [&] () {
     gOnceFunctionResult_bold = onceFunction_bold (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_bold = true ;
-  }
+  }) ;
   return gOnceFunctionResult_bold ;
 }
 
@@ -2071,17 +2089,16 @@ static GALGAS_string onceFunction_underline (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_underline = false ;
+static std::once_flag gOnceFunctionFlag_underline ;
 static GALGAS_string gOnceFunctionResult_underline ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_underline (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_underline) {
+  std::call_once (gOnceFunctionFlag_underline, [&] () {
     gOnceFunctionResult_underline = onceFunction_underline (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_underline = true ;
-  }
+  }) ;
   return gOnceFunctionResult_underline ;
 }
 
@@ -2141,17 +2158,16 @@ static GALGAS_string onceFunction_blink (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_blink = false ;
+static std::once_flag gOnceFunctionFlag_blink ;
 static GALGAS_string gOnceFunctionResult_blink ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_blink (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_blink) {
+  std::call_once (gOnceFunctionFlag_blink, [&] () {
     gOnceFunctionResult_blink = onceFunction_blink (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_blink = true ;
-  }
+  }) ;
   return gOnceFunctionResult_blink ;
 }
 
@@ -2211,17 +2227,16 @@ static GALGAS_string onceFunction_black (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_black = false ;
+static std::once_flag gOnceFunctionFlag_black ;
 static GALGAS_string gOnceFunctionResult_black ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_black (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_black) {
+  std::call_once (gOnceFunctionFlag_black, [&] () {
     gOnceFunctionResult_black = onceFunction_black (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_black = true ;
-  }
+  }) ;
   return gOnceFunctionResult_black ;
 }
 
@@ -2281,17 +2296,16 @@ static GALGAS_string onceFunction_red (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_red = false ;
+static std::once_flag gOnceFunctionFlag_red ;
 static GALGAS_string gOnceFunctionResult_red ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_red (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_red) {
+  std::call_once (gOnceFunctionFlag_red, [&] () {
     gOnceFunctionResult_red = onceFunction_red (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_red = true ;
-  }
+  }) ;
   return gOnceFunctionResult_red ;
 }
 
@@ -2351,17 +2365,16 @@ static GALGAS_string onceFunction_green (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_green = false ;
+static std::once_flag gOnceFunctionFlag_green ;
 static GALGAS_string gOnceFunctionResult_green ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_green (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_green) {
+  std::call_once (gOnceFunctionFlag_green, [&] () {
     gOnceFunctionResult_green = onceFunction_green (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_green = true ;
-  }
+  }) ;
   return gOnceFunctionResult_green ;
 }
 
@@ -2421,17 +2434,16 @@ static GALGAS_string onceFunction_yellow (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_yellow = false ;
+static std::once_flag gOnceFunctionFlag_yellow ;
 static GALGAS_string gOnceFunctionResult_yellow ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_yellow (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_yellow) {
+  std::call_once (gOnceFunctionFlag_yellow, [&] () {
     gOnceFunctionResult_yellow = onceFunction_yellow (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_yellow = true ;
-  }
+  }) ;
   return gOnceFunctionResult_yellow ;
 }
 
@@ -2491,17 +2503,16 @@ static GALGAS_string onceFunction_blue (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_blue = false ;
+static std::once_flag gOnceFunctionFlag_blue ;
 static GALGAS_string gOnceFunctionResult_blue ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_blue (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_blue) {
+  std::call_once (gOnceFunctionFlag_blue, [&] () {
     gOnceFunctionResult_blue = onceFunction_blue (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_blue = true ;
-  }
+  }) ;
   return gOnceFunctionResult_blue ;
 }
 
@@ -2561,17 +2572,16 @@ static GALGAS_string onceFunction_magenta (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_magenta = false ;
+static std::once_flag gOnceFunctionFlag_magenta ;
 static GALGAS_string gOnceFunctionResult_magenta ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_magenta (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_magenta) {
+  std::call_once (gOnceFunctionFlag_magenta, [&] () {
     gOnceFunctionResult_magenta = onceFunction_magenta (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_magenta = true ;
-  }
+  }) ;
   return gOnceFunctionResult_magenta ;
 }
 
@@ -2631,17 +2641,16 @@ static GALGAS_string onceFunction_cyan (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_cyan = false ;
+static std::once_flag gOnceFunctionFlag_cyan ;
 static GALGAS_string gOnceFunctionResult_cyan ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_cyan (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_cyan) {
+  std::call_once (gOnceFunctionFlag_cyan, [&] () {
     gOnceFunctionResult_cyan = onceFunction_cyan (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_cyan = true ;
-  }
+  }) ;
   return gOnceFunctionResult_cyan ;
 }
 
@@ -2701,17 +2710,16 @@ static GALGAS_string onceFunction_darkred (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_darkred = false ;
+static std::once_flag gOnceFunctionFlag_darkred ;
 static GALGAS_string gOnceFunctionResult_darkred ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_darkred (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_darkred) {
+  std::call_once (gOnceFunctionFlag_darkred, [&] () {
     gOnceFunctionResult_darkred = onceFunction_darkred (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_darkred = true ;
-  }
+  }) ;
   return gOnceFunctionResult_darkred ;
 }
 
@@ -2771,17 +2779,16 @@ static GALGAS_string onceFunction_darkgreen (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_darkgreen = false ;
+static std::once_flag gOnceFunctionFlag_darkgreen ;
 static GALGAS_string gOnceFunctionResult_darkgreen ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_darkgreen (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_darkgreen) {
+  std::call_once (gOnceFunctionFlag_darkgreen, [&] () {
     gOnceFunctionResult_darkgreen = onceFunction_darkgreen (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_darkgreen = true ;
-  }
+  }) ;
   return gOnceFunctionResult_darkgreen ;
 }
 
@@ -2841,17 +2848,16 @@ static GALGAS_string onceFunction_darkyellow (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_darkyellow = false ;
+static std::once_flag gOnceFunctionFlag_darkyellow ;
 static GALGAS_string gOnceFunctionResult_darkyellow ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_darkyellow (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_darkyellow) {
+  std::call_once (gOnceFunctionFlag_darkyellow, [&] () {
     gOnceFunctionResult_darkyellow = onceFunction_darkyellow (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_darkyellow = true ;
-  }
+  }) ;
   return gOnceFunctionResult_darkyellow ;
 }
 
@@ -2911,17 +2917,16 @@ static GALGAS_string onceFunction_darkblue (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_darkblue = false ;
+static std::once_flag gOnceFunctionFlag_darkblue ;
 static GALGAS_string gOnceFunctionResult_darkblue ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_darkblue (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_darkblue) {
+  std::call_once (gOnceFunctionFlag_darkblue, [&] () {
     gOnceFunctionResult_darkblue = onceFunction_darkblue (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_darkblue = true ;
-  }
+  }) ;
   return gOnceFunctionResult_darkblue ;
 }
 
@@ -2981,17 +2986,16 @@ static GALGAS_string onceFunction_darkmagenta (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_darkmagenta = false ;
+static std::once_flag gOnceFunctionFlag_darkmagenta ;
 static GALGAS_string gOnceFunctionResult_darkmagenta ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_darkmagenta (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_darkmagenta) {
+  std::call_once (gOnceFunctionFlag_darkmagenta, [&] () {
     gOnceFunctionResult_darkmagenta = onceFunction_darkmagenta (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_darkmagenta = true ;
-  }
+  }) ;
   return gOnceFunctionResult_darkmagenta ;
 }
 
@@ -3051,17 +3055,16 @@ static GALGAS_string onceFunction_darkcyan (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_darkcyan = false ;
+static std::once_flag gOnceFunctionFlag_darkcyan ;
 static GALGAS_string gOnceFunctionResult_darkcyan ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_darkcyan (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_darkcyan) {
+  std::call_once (gOnceFunctionFlag_darkcyan, [&] () {
     gOnceFunctionResult_darkcyan = onceFunction_darkcyan (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_darkcyan = true ;
-  }
+  }) ;
   return gOnceFunctionResult_darkcyan ;
 }
 
@@ -3121,17 +3124,16 @@ static GALGAS_string onceFunction_white (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_white = false ;
+static std::once_flag gOnceFunctionFlag_white ;
 static GALGAS_string gOnceFunctionResult_white ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_white (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_white) {
+  std::call_once (gOnceFunctionFlag_white, [&] () {
     gOnceFunctionResult_white = onceFunction_white (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_white = true ;
-  }
+  }) ;
   return gOnceFunctionResult_white ;
 }
 
@@ -3191,17 +3193,16 @@ static GALGAS_string onceFunction_endc (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_endc = false ;
+static std::once_flag gOnceFunctionFlag_endc ;
 static GALGAS_string gOnceFunctionResult_endc ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_string function_endc (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_endc) {
+  std::call_once (gOnceFunctionFlag_endc, [&] () {
     gOnceFunctionResult_endc = onceFunction_endc (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_endc = true ;
-  }
+  }) ;
   return gOnceFunctionResult_endc ;
 }
 
@@ -5084,6 +5085,18 @@ C_BoolCommandLineOption gOption_goil_5F_options_arxmlDisplayOil ("goil_options",
                                          "arxmlPrintOil",
                                          "Display an Oil version while parsing an arxml file") ;
 
+C_BoolCommandLineOption gOption_goil_5F_options_arxmlLegacyParser ("goil_options",
+                                         "arxmlLegacyParser",
+                                         0,
+                                         "arxmlLegacyParser",
+                                         "Parse arxml files with the lexique based parser instead of the streaming reader") ;
+
+C_BoolCommandLineOption gOption_goil_5F_options_force ("goil_options",
+                                         "force",
+                                         0,
+                                         "force",
+                                         "Render all the templates, even if the build manifest tells that the generated files are up to date") ;
+
 C_BoolCommandLineOption gOption_goil_5F_options_generate_5F_log ("goil_options",
                                          "generate_log",
                                          108,
@@ -5096,6 +5109,12 @@ C_BoolCommandLineOption gOption_goil_5F_options_pierreOption ("goil_options",
                                          "pierre",
                                          "Special option to pass a galgas bug to Pierre") ;
 
+C_BoolCommandLineOption gOption_goil_5F_options_timings ("goil_options",
+                                         "timings",
+                                         0,
+                                         "timings",
+                                         "Print a report of the time and memory used by each phase of goil") ;
+
 C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ("goil_options",
                                          "warnMultiple",
                                          0,
@@ -5108,6 +5127,13 @@ C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ("goil_options",
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+C_UIntCommandLineOption gOption_goil_5F_options_gtlJobs ("goil_options",
+                                         "gtlJobs",
+                                         0,
+                                         "gtl-jobs",
+                                         "Number of threads executing the 'write to' blocks of the GTL templates (0: one per processor, 1: no parallel execution)",
+                                         0) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String options                                                   
@@ -5156,6 +5182,13 @@ C_StringCommandLineOption gOption_goil_5F_options_template_5F_dir ("goil_options
                                          "Specifies template directory (used by goil for code generation)",
                                          "") ;
 
+C_StringCommandLineOption gOption_goil_5F_options_timingsFormat ("goil_options",
+                                         "timingsFormat",
+                                         0,
+                                         "timings",
+                                         "Print the phase timing report in the given format: text or json",
+                                         "") ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String List options                                              
@@ -8180,17 +8213,16 @@ static GALGAS_lstring onceFunction_emptyLString (C_Compiler * inCompiler
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_emptyLString = false ;
+static std::once_flag gOnceFunctionFlag_emptyLString ;
 static GALGAS_lstring gOnceFunctionResult_emptyLString ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_lstring function_emptyLString (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_emptyLString) {
+  std::call_once (gOnceFunctionFlag_emptyLString, [&] () {
     gOnceFunctionResult_emptyLString = onceFunction_emptyLString (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_emptyLString = true ;
-  }
+  }) ;
   return gOnceFunctionResult_emptyLString ;
 }
 
@@ -10562,6 +10594,29 @@ void routine_errorNoFileFound (const GALGAS_stringlist constinArgument_searchedP
 }
 
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'checkBuildManifest'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_checkBuildManifest (const GALGAS_lstring constinArgument_sourceFile,
+                                 GALGAS_bool & outArgument_upToDate,
+                                 C_Compiler * inCompiler
+                                 COMMA_UNUSED_LOCATION_ARGS) {
+  outArgument_upToDate.drop () ; // Release 'out' argument
+  GALGAS_string var_configuration_17530 = GALGAS_string ("GOIL_TEMPLATES=").add_operation (GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("GOIL_TEMPLATES")  COMMA_SOURCE_FILE ("goil_routines.galgas", 600)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 600)).add_operation (GALGAS_string ("\nGOIL_INCLUDE_PATH="), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 601)).add_operation (GALGAS_string::constructor_stringWithEnvironmentVariableOrEmpty (GALGAS_string ("GOIL_INCLUDE_PATH")  COMMA_SOURCE_FILE ("goil_routines.galgas", 601)), inCompiler COMMA_SOURCE_FILE ("goil_routines.galgas", 601)) ;
+  GALGAS_bool test_0 = GALGAS_bool (gOption_gtl_5F_options_debug.readProperty_value ()).operator_not (SOURCE_FILE ("goil_routines.galgas", 602)) ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = GALGAS_bool (kIsEqual, GALGAS_string (gOption_gtl_5F_options_profile.readProperty_value ()).objectCompare (GALGAS_string::makeEmptyString ())) ;
+  }
+  GALGAS_bool var_enabled_17742 = test_0 ;
+  {
+  routine_openBuildManifest (constinArgument_sourceFile.readProperty_string (), var_configuration_17530, var_enabled_17742, GALGAS_bool (gOption_goil_5F_options_force.readProperty_value ()), outArgument_upToDate, inCompiler  COMMA_SOURCE_FILE ("goil_routines.galgas", 603)) ;
+  }
+}
+
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'stringLBool'
@@ -11487,10 +11542,34 @@ void routine_verifyAll (const GALGAS_implementation constinArgument_imp,
                         C_Compiler * inCompiler
                         COMMA_UNUSED_LOCATION_ARGS) {
   {
-  routine_verifyAllAttributes (constinArgument_imp, constinArgument_application.readProperty_objects (), inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 681)) ;
+  routine_beginPhase (GALGAS_string ("verifyAll"), inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 681)) ;
+  }
+  {
+  routine_beginPhase (GALGAS_string ("verifyAllAttributes"), inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 682)) ;
+  }
+  {
+  routine_verifyAllAttributes (constinArgument_imp, constinArgument_application.readProperty_objects (), inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 683)) ;
+  }
+  {
+  routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 684)) ;
+  }
+  {
+  routine_beginPhase (GALGAS_string ("verifyApplication"), inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 685)) ;
+  }
+  callExtensionMethod_verifyApplication ((cPtr_implementation *) constinArgument_imp.ptr (), constinArgument_application, inCompiler COMMA_SOURCE_FILE ("semantic_verification.galgas", 686)) ;
+  {
+  routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 687)) ;
+  }
+  {
+  routine_beginPhase (GALGAS_string ("verifyCrossReferences"), inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 690)) ;
+  }
+  callExtensionMethod_verifyCrossReferences ((cPtr_applicationDefinition *) constinArgument_application.ptr (), constinArgument_imp, inCompiler COMMA_SOURCE_FILE ("semantic_verification.galgas", 691)) ;
+  {
+  routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 692)) ;
+  }
+  {
+  routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("semantic_verification.galgas", 693)) ;
   }
-  callExtensionMethod_verifyApplication ((cPtr_implementation *) constinArgument_imp.ptr (), constinArgument_application, inCompiler COMMA_SOURCE_FILE ("semantic_verification.galgas", 682)) ;
-  callExtensionMethod_verifyCrossReferences ((cPtr_applicationDefinition *) constinArgument_application.ptr (), constinArgument_imp, inCompiler COMMA_SOURCE_FILE ("semantic_verification.galgas", 685)) ;
 }
 
 
@@ -919,6 +919,17 @@ void routine_errorNoFileFound (const class GALGAS_stringlist constinArgument0,
                                class C_Compiler * inCompiler
                                COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'checkBuildManifest'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_checkBuildManifest (const class GALGAS_lstring constinArgument0,
+                                 class GALGAS_bool & outArgument1,
+                                 class C_Compiler * inCompiler
+                                 COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Function 'attributeAllowsAuto'
@@ -105,6 +105,110 @@ void routine_generate_5F_all (GALGAS_gtlData inArgument_cfg,
 }
 
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'arxmlCompileRootNode'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_arxmlCompileRootNode (GALGAS_arxmlNode inArgument_rootNode,
+                                   C_Compiler * inCompiler
+                                   COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_implementation var_imp_3917 = GALGAS_implementation::constructor_new (GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 167))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 167)) ;
+  GALGAS_applicationDefinition var_application_4003 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 168)) ;
+  GALGAS_string var_fileIncludeList_4056 = GALGAS_string::makeEmptyString () ;
+  GALGAS_bool var_debug_4089 = GALGAS_bool (false) ;
+  GALGAS_lstring var_autosarVersion_4227 ;
+  GALGAS_lstring var_autosarDescription_4257 ;
+  {
+  routine_getAutosarVersion (inArgument_rootNode, var_autosarVersion_4227, var_autosarDescription_4257, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 177)) ;
+  }
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = GALGAS_bool (kIsEqual, var_autosarVersion_4227.readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      TC_Array <C_FixItDescription> fixItArray1 ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 180)), GALGAS_string ("[TPS_ECUC_06005][TPS_ECUC_08053] : Missing AUTOSAR version"), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 180)) ;
+    }
+  }
+  GALGAS_stringlist var_autosarVlist_4552 = var_autosarVersion_4227.readProperty_string ().getter_componentsSeparatedByString (GALGAS_string (".") COMMA_SOURCE_FILE ("arxml_parser.galgas", 184)) ;
+  GALGAS_string var_versionFirst_4657 ;
+  {
+  var_autosarVlist_4552.setter_popFirst (var_versionFirst_4657, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 185)) ;
+  }
+  GALGAS_string var_versionSecond_4711 ;
+  {
+  var_autosarVlist_4552.setter_popFirst (var_versionSecond_4711, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 186)) ;
+  }
+  GALGAS_lstring var_autosarShortVersion_4741 = GALGAS_lstring::constructor_new (var_versionFirst_4657.add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)).add_operation (var_versionSecond_4711, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)), var_autosarVersion_4227.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 187)) ;
+  {
+  routine_displayOil (GALGAS_string ("\nOIL_VERSION = \"").add_operation (var_autosarShortVersion_4741.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 189)).add_operation (GALGAS_string ("\";\n\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 189)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 189)) ;
+  }
+  {
+  var_application_4003.setter_setVersion (var_autosarShortVersion_4741 COMMA_SOURCE_FILE ("arxml_parser.galgas", 191)) ;
+  }
+  {
+  var_application_4003.setter_setVersionDescription (var_autosarDescription_4257 COMMA_SOURCE_FILE ("arxml_parser.galgas", 192)) ;
+  }
+  GALGAS_string var_autosarVersionNoDot_5246 = var_autosarVersion_4227.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("."), GALGAS_string ("-"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 201)) ;
+  GALGAS_string var_autosarMetaFile_5405 = GALGAS_string ("AUTOSAR_").add_operation (var_autosarVersionNoDot_5246, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 203)).add_operation (GALGAS_string (".xsd"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 203)) ;
+  GALGAS_string var_filePath_5479 = function_templates_5F_directory (GALGAS_string ("arxmlMeta"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 204)).add_operation (var_autosarMetaFile_5405, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 204)) ;
+  GALGAS_arxmlMetaClassMap var_classMap_5563 ;
+  enumGalgasBool test_2 = kBoolTrue ;
+  if (kBoolTrue == test_2) {
+    test_2 = var_filePath_5479.getter_fileExists (SOURCE_FILE ("arxml_parser.galgas", 207)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 207)).boolEnum () ;
+    if (kBoolTrue == test_2) {
+      TC_Array <C_FixItDescription> fixItArray3 ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 208)), GALGAS_string ("The corresponding metafile ").add_operation (var_filePath_5479, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 208)).add_operation (GALGAS_string (" does not"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 208)).add_operation (GALGAS_string (" exists. The Metamodel can be found here : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 208)).add_operation (GALGAS_string ("http://www.autosar.org/specification -> Methodology and Templates -> "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 209)).add_operation (GALGAS_string ("Templates -> AUTOSAR_MMOD_XMLSchema.zip."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 208)) ;
+    }
+  }
+  var_classMap_5563.drop () ;
+  cGrammar_arxmlmetaparser_5F_grammar::_performSourceFileParsing_ (inCompiler, function_lstringWith (var_filePath_5479, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 214)), var_classMap_5563, var_debug_4089  COMMA_SOURCE_FILE ("arxml_parser.galgas", 214)) ;
+  GALGAS_arxmlElementValue var_rootValue_6136 ;
+  {
+  routine_nodeToClass (inArgument_rootNode, var_classMap_5563, var_rootValue_6136, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 220)) ;
+  }
+  {
+  routine_includeConfigs (var_imp_3917, var_application_4003, var_fileIncludeList_4056, var_autosarShortVersion_4741, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 232)) ;
+  }
+  {
+  routine_convertToOil (var_imp_3917, var_application_4003, var_rootValue_6136, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 239)) ;
+  }
+  callExtensionMethod_checkObjectReferences ((cPtr_implementation *) var_imp_3917.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)) ;
+  enumGalgasBool test_4 = kBoolTrue ;
+  if (kBoolTrue == test_4) {
+    test_4 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 252)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    if (kBoolTrue == test_4) {
+      {
+      routine_setDefaults (var_imp_3917, var_application_4003, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 253)) ;
+      }
+    }
+  }
+  enumGalgasBool test_5 = kBoolTrue ;
+  if (kBoolTrue == test_5) {
+    test_5 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 260)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    if (kBoolTrue == test_5) {
+      {
+      routine_verifyAll (var_imp_3917, var_application_4003, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 261)) ;
+      }
+    }
+  }
+  enumGalgasBool test_6 = kBoolTrue ;
+  if (kBoolTrue == test_6) {
+    test_6 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 263)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    if (kBoolTrue == test_6) {
+      GALGAS_gtlData var_templateData_7452 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_4003.ptr (), var_imp_3917, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 264)) ;
+      {
+      routine_generate_5F_all (var_templateData_7452, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 267)) ;
+      }
+    }
+  }
+  var_fileIncludeList_4056 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 270)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 270)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 270)).add_operation (var_fileIncludeList_4056, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 270)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 270)) ;
+  GALGAS_string var_oilDepFileName_7765 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 271)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 271)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 271)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 272)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 272)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 272)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 272)) ;
+  var_fileIncludeList_4056.method_writeToFile (var_oilDepFileName_7765, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 274)) ;
+}
+
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Routine 'getAutosarVersion'
@@ -118,68 +222,68 @@ void routine_getAutosarVersion (GALGAS_arxmlNode inArgument_rootNode,
                                 COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_iAutosarVersion.drop () ; // Release 'out' argument
   outArgument_iAutosarDescription.drop () ; // Release 'out' argument
-  GALGAS_lstring var_autosarVersion_7851 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 273)) ;
-  GALGAS_lstring var_autosarDescription_7896 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 274)) ;
-  GALGAS_arxmlElementList var_autosarNodes_8021 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 277)) ;
-  callExtensionMethod_getSubElementsFromName ((cPtr_arxmlNode *) inArgument_rootNode.ptr (), GALGAS_string ("AUTOSAR"), var_autosarNodes_8021, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 278)) ;
+  GALGAS_lstring var_autosarVersion_8298 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 286)) ;
+  GALGAS_lstring var_autosarDescription_8343 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 287)) ;
+  GALGAS_arxmlElementList var_autosarNodes_8468 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 290)) ;
+  callExtensionMethod_getSubElementsFromName ((cPtr_arxmlNode *) inArgument_rootNode.ptr (), GALGAS_string ("AUTOSAR"), var_autosarNodes_8468, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 291)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, var_autosarNodes_8021.getter_count (SOURCE_FILE ("arxml_parser.galgas", 279)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, var_autosarNodes_8468.getter_count (SOURCE_FILE ("arxml_parser.galgas", 292)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 280)), GALGAS_string ("[TPS_GST_00077] : Missing root AUTOSAR node."), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 280)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 293)), GALGAS_string ("[TPS_GST_00077] : Missing root AUTOSAR node."), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 293)) ;
     }
   }
-  GALGAS_arxmlElementList var_adminDataNodes_8238 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 283)) ;
-  extensionMethod_getSubElementsFromName (var_autosarNodes_8021, GALGAS_string ("ADMIN-DATA"), var_adminDataNodes_8238, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 284)) ;
+  GALGAS_arxmlElementList var_adminDataNodes_8685 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 296)) ;
+  extensionMethod_getSubElementsFromName (var_autosarNodes_8468, GALGAS_string ("ADMIN-DATA"), var_adminDataNodes_8685, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 297)) ;
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
-    test_2 = GALGAS_bool (kIsEqual, var_adminDataNodes_8238.getter_count (SOURCE_FILE ("arxml_parser.galgas", 285)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    test_2 = GALGAS_bool (kIsEqual, var_adminDataNodes_8685.getter_count (SOURCE_FILE ("arxml_parser.galgas", 298)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
     if (kBoolTrue == test_2) {
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 286)), GALGAS_string ("[TPS_ECUC_06004] : Missing AUTOSAR's ADMIN-DATA node."), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 286)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 299)), GALGAS_string ("[TPS_ECUC_06004] : Missing AUTOSAR's ADMIN-DATA node."), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 299)) ;
     }
   }
-  GALGAS_arxmlElementList var_revisions_8477 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 289)) ;
-  extensionMethod_getElementsFromName (var_adminDataNodes_8238, GALGAS_string ("DOC-REVISION"), var_revisions_8477, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 290)) ;
+  GALGAS_arxmlElementList var_revisions_8924 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 302)) ;
+  extensionMethod_getElementsFromName (var_adminDataNodes_8685, GALGAS_string ("DOC-REVISION"), var_revisions_8924, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 303)) ;
   enumGalgasBool test_4 = kBoolTrue ;
   if (kBoolTrue == test_4) {
-    test_4 = GALGAS_bool (kIsEqual, var_adminDataNodes_8238.getter_count (SOURCE_FILE ("arxml_parser.galgas", 291)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    test_4 = GALGAS_bool (kIsEqual, var_adminDataNodes_8685.getter_count (SOURCE_FILE ("arxml_parser.galgas", 304)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
     if (kBoolTrue == test_4) {
       TC_Array <C_FixItDescription> fixItArray5 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 292)), GALGAS_string ("Missing AUTOSAR'S ADMIN-DATA's DOC-REVISION NODE"), fixItArray5  COMMA_SOURCE_FILE ("arxml_parser.galgas", 292)) ;
-    }
-  }
-  GALGAS_bool var_version_5F_found_8690 = GALGAS_bool (false) ;
-  GALGAS_bool var_issued_5F_by_5F_found_8720 = GALGAS_bool (false) ;
-  GALGAS_lstring var_issued_5F_by_8755 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 297)) ;
-  cEnumerator_arxmlElementList enumerator_8810 (var_revisions_8477, kENUMERATION_UP) ;
-  bool bool_6 = var_version_5F_found_8690.operator_not (SOURCE_FILE ("arxml_parser.galgas", 300)).isValidAndTrue () ;
-  if (enumerator_8810.hasCurrentObject () && bool_6) {
-    while (enumerator_8810.hasCurrentObject () && bool_6) {
-      var_issued_5F_by_5F_found_8720 = GALGAS_bool (false) ;
-      callExtensionMethod_getProperty ((cPtr_arxmlElementNode *) enumerator_8810.current_node (HERE).ptr (), GALGAS_string ("ISSUED-BY"), var_issued_5F_by_8755, var_issued_5F_by_5F_found_8720, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 302)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 305)), GALGAS_string ("Missing AUTOSAR'S ADMIN-DATA's DOC-REVISION NODE"), fixItArray5  COMMA_SOURCE_FILE ("arxml_parser.galgas", 305)) ;
+    }
+  }
+  GALGAS_bool var_version_5F_found_9137 = GALGAS_bool (false) ;
+  GALGAS_bool var_issued_5F_by_5F_found_9167 = GALGAS_bool (false) ;
+  GALGAS_lstring var_issued_5F_by_9202 = function_lstringWith (GALGAS_string::makeEmptyString (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 310)) ;
+  cEnumerator_arxmlElementList enumerator_9257 (var_revisions_8924, kENUMERATION_UP) ;
+  bool bool_6 = var_version_5F_found_9137.operator_not (SOURCE_FILE ("arxml_parser.galgas", 313)).isValidAndTrue () ;
+  if (enumerator_9257.hasCurrentObject () && bool_6) {
+    while (enumerator_9257.hasCurrentObject () && bool_6) {
+      var_issued_5F_by_5F_found_9167 = GALGAS_bool (false) ;
+      callExtensionMethod_getProperty ((cPtr_arxmlElementNode *) enumerator_9257.current_node (HERE).ptr (), GALGAS_string ("ISSUED-BY"), var_issued_5F_by_9202, var_issued_5F_by_5F_found_9167, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 315)) ;
       enumGalgasBool test_7 = kBoolTrue ;
       if (kBoolTrue == test_7) {
-        GALGAS_bool test_8 = var_issued_5F_by_5F_found_8720 ;
+        GALGAS_bool test_8 = var_issued_5F_by_5F_found_9167 ;
         if (kBoolTrue == test_8.boolEnum ()) {
-          test_8 = GALGAS_bool (kIsEqual, var_issued_5F_by_8755.readProperty_string ().objectCompare (GALGAS_string ("AUTOSAR"))) ;
+          test_8 = GALGAS_bool (kIsEqual, var_issued_5F_by_9202.readProperty_string ().objectCompare (GALGAS_string ("AUTOSAR"))) ;
         }
         test_7 = test_8.boolEnum () ;
         if (kBoolTrue == test_7) {
-          GALGAS_bool var_description_5F_found_9033 = GALGAS_bool (false) ;
-          callExtensionMethod_getProperty ((cPtr_arxmlElementNode *) enumerator_8810.current_node (HERE).ptr (), GALGAS_string ("REVISION-LABEL"), var_autosarVersion_7851, var_version_5F_found_8690, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 305)) ;
-          callExtensionMethod_getProperty ((cPtr_arxmlElementNode *) enumerator_8810.current_node (HERE).ptr (), GALGAS_string ("DATE"), var_autosarDescription_7896, var_description_5F_found_9033, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 306)) ;
+          GALGAS_bool var_description_5F_found_9480 = GALGAS_bool (false) ;
+          callExtensionMethod_getProperty ((cPtr_arxmlElementNode *) enumerator_9257.current_node (HERE).ptr (), GALGAS_string ("REVISION-LABEL"), var_autosarVersion_8298, var_version_5F_found_9137, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 318)) ;
+          callExtensionMethod_getProperty ((cPtr_arxmlElementNode *) enumerator_9257.current_node (HERE).ptr (), GALGAS_string ("DATE"), var_autosarDescription_8343, var_description_5F_found_9480, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 319)) ;
         }
       }
-      enumerator_8810.gotoNextObject () ;
-      if (enumerator_8810.hasCurrentObject ()) {
-        bool_6 = var_version_5F_found_8690.operator_not (SOURCE_FILE ("arxml_parser.galgas", 300)).isValidAndTrue () ;
+      enumerator_9257.gotoNextObject () ;
+      if (enumerator_9257.hasCurrentObject ()) {
+        bool_6 = var_version_5F_found_9137.operator_not (SOURCE_FILE ("arxml_parser.galgas", 313)).isValidAndTrue () ;
       }
     }
   }
-  outArgument_iAutosarVersion = var_autosarVersion_7851 ;
-  outArgument_iAutosarDescription = var_autosarDescription_7896 ;
+  outArgument_iAutosarVersion = var_autosarVersion_8298 ;
+  outArgument_iAutosarDescription = var_autosarDescription_8343 ;
 }
 
 
@@ -195,18 +299,18 @@ void routine_includeConfigs (GALGAS_implementation & ioArgument_imp,
                              GALGAS_lstring inArgument_version,
                              C_Compiler * inCompiler
                              COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_string var_config_5F_file_5F_name_9573 = GALGAS_string (gOption_goil_5F_options_config.readProperty_value ()) ;
-  GALGAS_stringlist var_configFiles_9647 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_9573.add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 325)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 324)) ;
-  cEnumerator_stringlist enumerator_9906 (var_configFiles_9647, kENUMERATION_DOWN) ;
-  while (enumerator_9906.hasCurrentObject ()) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_9906.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 330)), ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, GALGAS_bool (false)  COMMA_SOURCE_FILE ("arxml_parser.galgas", 330)) ;
-    enumerator_9906.gotoNextObject () ;
-  }
-  GALGAS_stringlist var_configVersionFiles_10217 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_9573.add_operation (inArgument_version.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 337)).add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 337)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 336)) ;
-  cEnumerator_stringlist enumerator_10369 (var_configVersionFiles_10217, kENUMERATION_DOWN) ;
-  while (enumerator_10369.hasCurrentObject ()) {
-    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_10369.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 340)), ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, GALGAS_bool (false)  COMMA_SOURCE_FILE ("arxml_parser.galgas", 340)) ;
-    enumerator_10369.gotoNextObject () ;
+  GALGAS_string var_config_5F_file_5F_name_10020 = GALGAS_string (gOption_goil_5F_options_config.readProperty_value ()) ;
+  GALGAS_stringlist var_configFiles_10094 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_10020.add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 338)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 337)) ;
+  cEnumerator_stringlist enumerator_10353 (var_configFiles_10094, kENUMERATION_DOWN) ;
+  while (enumerator_10353.hasCurrentObject ()) {
+    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_10353.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 343)), ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, GALGAS_bool (false)  COMMA_SOURCE_FILE ("arxml_parser.galgas", 343)) ;
+    enumerator_10353.gotoNextObject () ;
+  }
+  GALGAS_stringlist var_configVersionFiles_10664 = function_allTemplateFilePaths (GALGAS_string ("config"), var_config_5F_file_5F_name_10020.add_operation (inArgument_version.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 350)).add_operation (GALGAS_string (".oil"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 350)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 349)) ;
+  cEnumerator_stringlist enumerator_10816 (var_configVersionFiles_10664, kENUMERATION_DOWN) ;
+  while (enumerator_10816.hasCurrentObject ()) {
+    cGrammar_goil_5F_file_5F_level_5F_include::_performSourceFileParsing_ (inCompiler, function_lstringWith (enumerator_10816.current_mValue (HERE), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 353)), ioArgument_imp, ioArgument_application, ioArgument_fileIncludeList, GALGAS_bool (false)  COMMA_SOURCE_FILE ("arxml_parser.galgas", 353)) ;
+    enumerator_10816.gotoNextObject () ;
   }
 }
 
@@ -223,28 +327,28 @@ void routine_nodeToClass (GALGAS_arxmlNode inArgument_rootNode,
                           C_Compiler * inCompiler
                           COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_rootValue.drop () ; // Release 'out' argument
-  GALGAS_arxmlElementList var_autosarNodes_10738 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 351)) ;
-  callExtensionMethod_getSubElementsFromName ((cPtr_arxmlNode *) inArgument_rootNode.ptr (), GALGAS_string ("AUTOSAR"), var_autosarNodes_10738, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 352)) ;
+  GALGAS_arxmlElementList var_autosarNodes_11185 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 364)) ;
+  callExtensionMethod_getSubElementsFromName ((cPtr_arxmlNode *) inArgument_rootNode.ptr (), GALGAS_string ("AUTOSAR"), var_autosarNodes_11185, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 365)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, var_autosarNodes_10738.getter_count (SOURCE_FILE ("arxml_parser.galgas", 353)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, var_autosarNodes_11185.getter_count (SOURCE_FILE ("arxml_parser.galgas", 366)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 354)), GALGAS_string ("[TPS_GST_00077] : Missing root AUTOSAR node."), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 354)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 367)), GALGAS_string ("[TPS_GST_00077] : Missing root AUTOSAR node."), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 367)) ;
     }
   }
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
-    test_2 = GALGAS_bool (kIsStrictSup, var_autosarNodes_10738.getter_count (SOURCE_FILE ("arxml_parser.galgas", 356)).objectCompare (GALGAS_uint (uint32_t (1U)))).boolEnum () ;
+    test_2 = GALGAS_bool (kIsStrictSup, var_autosarNodes_11185.getter_count (SOURCE_FILE ("arxml_parser.galgas", 369)).objectCompare (GALGAS_uint (uint32_t (1U)))).boolEnum () ;
     if (kBoolTrue == test_2) {
       TC_Array <C_FixItDescription> fixItArray3 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 357)), GALGAS_string ("[TPS_GST_00077] : Too many AUTOSAR nodes."), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 357)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 370)), GALGAS_string ("[TPS_GST_00077] : Too many AUTOSAR nodes."), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 370)) ;
     }
   }
-  GALGAS_arxmlElementNode var_autosarNode_11098 ;
-  var_autosarNodes_10738.method_first (var_autosarNode_11098, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 362)) ;
+  GALGAS_arxmlElementNode var_autosarNode_11545 ;
+  var_autosarNodes_11185.method_first (var_autosarNode_11545, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 375)) ;
   {
-  routine_nodeToClassRes (var_autosarNode_11098, ioArgument_classMap, outArgument_rootValue, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 363)) ;
+  routine_nodeToClassRes (var_autosarNode_11545, ioArgument_classMap, outArgument_rootValue, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 376)) ;
   }
 }
 
@@ -261,113 +365,113 @@ void routine_nodeToClassRes (GALGAS_arxmlElementNode inArgument_currentElement,
                              C_Compiler * inCompiler
                              COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_elementValue.drop () ; // Release 'out' argument
-  GALGAS_arxmlMetaClass var_currentClass_11372 ;
-  inArgument_classMap.method_searchKey (inArgument_currentElement.readProperty_name (), var_currentClass_11372, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 373)) ;
-  GALGAS_bool var_textFound_11481 = GALGAS_bool (false) ;
-  GALGAS_lstring var_text_11510 = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 377))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 377)) ;
-  callExtensionMethod_getText ((cPtr_arxmlElementNode *) inArgument_currentElement.ptr (), var_text_11510, var_textFound_11481, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 378)) ;
-  GALGAS_lstring var_type_11628 = var_currentClass_11372.readProperty_name () ;
-  outArgument_elementValue = GALGAS_arxmlElementValue::constructor_new (var_type_11628, var_text_11510, GALGAS_arxmlElementValueMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 385)), inArgument_currentElement.readProperty_attributes ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 382)) ;
-  GALGAS_arxmlElementList var_subElements_12034 ;
-  callExtensionMethod_getSubElements ((cPtr_arxmlElementNode *) inArgument_currentElement.ptr (), var_subElements_12034, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 390)) ;
-  cEnumerator_arxmlElementList enumerator_12072 (var_subElements_12034, kENUMERATION_UP) ;
-  while (enumerator_12072.hasCurrentObject ()) {
+  GALGAS_arxmlMetaClass var_currentClass_11819 ;
+  inArgument_classMap.method_searchKey (inArgument_currentElement.readProperty_name (), var_currentClass_11819, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 386)) ;
+  GALGAS_bool var_textFound_11928 = GALGAS_bool (false) ;
+  GALGAS_lstring var_text_11957 = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 390))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 390)) ;
+  callExtensionMethod_getText ((cPtr_arxmlElementNode *) inArgument_currentElement.ptr (), var_text_11957, var_textFound_11928, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 391)) ;
+  GALGAS_lstring var_type_12075 = var_currentClass_11819.readProperty_name () ;
+  outArgument_elementValue = GALGAS_arxmlElementValue::constructor_new (var_type_12075, var_text_11957, GALGAS_arxmlElementValueMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 398)), inArgument_currentElement.readProperty_attributes ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 395)) ;
+  GALGAS_arxmlElementList var_subElements_12481 ;
+  callExtensionMethod_getSubElements ((cPtr_arxmlElementNode *) inArgument_currentElement.ptr (), var_subElements_12481, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 403)) ;
+  cEnumerator_arxmlElementList enumerator_12519 (var_subElements_12481, kENUMERATION_UP) ;
+  while (enumerator_12519.hasCurrentObject ()) {
     enumGalgasBool test_0 = kBoolTrue ;
     if (kBoolTrue == test_0) {
-      test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlMetaClass *) var_currentClass_11372.ptr (), enumerator_12072.current_node (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 392)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 392)).boolEnum () ;
+      test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlMetaClass *) var_currentClass_11819.ptr (), enumerator_12519.current_node (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 405)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 405)).boolEnum () ;
       if (kBoolTrue == test_0) {
         TC_Array <C_FixItDescription> fixItArray1 ;
-        inCompiler->emitSemanticError (enumerator_12072.current_node (HERE).readProperty_name ().readProperty_location (), GALGAS_string ("The element ").add_operation (enumerator_12072.current_node (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 393)).add_operation (GALGAS_string (" does not belong to the "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 393)).add_operation (inArgument_currentElement.readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 394)).add_operation (GALGAS_string (" element.\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 395)).add_operation (GALGAS_string ("Possible elements are :\n "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 395)).add_operation (extensionGetter_string (var_currentClass_11372.readProperty_lElementLegacy (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 396)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 396)), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 393)) ;
+        inCompiler->emitSemanticError (enumerator_12519.current_node (HERE).readProperty_name ().readProperty_location (), GALGAS_string ("The element ").add_operation (enumerator_12519.current_node (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 406)).add_operation (GALGAS_string (" does not belong to the "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 406)).add_operation (inArgument_currentElement.readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 407)).add_operation (GALGAS_string (" element.\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 408)).add_operation (GALGAS_string ("Possible elements are :\n "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 408)).add_operation (extensionGetter_string (var_currentClass_11819.readProperty_lElementLegacy (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 409)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 409)), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 406)) ;
       }
     }
-    enumerator_12072.gotoNextObject () ;
+    enumerator_12519.gotoNextObject () ;
   }
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
     test_2 = GALGAS_bool (kIsNotEqual, inArgument_currentElement.readProperty_name ().readProperty_string ().objectCompare (GALGAS_string ("AUTOSAR"))).boolEnum () ;
     if (kBoolTrue == test_2) {
-      cEnumerator_arxmlAttributeMap enumerator_12603 (inArgument_currentElement.readProperty_attributes (), kENUMERATION_UP) ;
-      while (enumerator_12603.hasCurrentObject ()) {
+      cEnumerator_arxmlAttributeMap enumerator_13050 (inArgument_currentElement.readProperty_attributes (), kENUMERATION_UP) ;
+      while (enumerator_13050.hasCurrentObject ()) {
         enumGalgasBool test_3 = kBoolTrue ;
         if (kBoolTrue == test_3) {
-          test_3 = callExtensionGetter_hasAttribute ((const cPtr_arxmlMetaClass *) var_currentClass_11372.ptr (), enumerator_12603.current_lkey (HERE).readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 404)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 404)).boolEnum () ;
+          test_3 = callExtensionGetter_hasAttribute ((const cPtr_arxmlMetaClass *) var_currentClass_11819.ptr (), enumerator_13050.current_lkey (HERE).readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 417)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 417)).boolEnum () ;
           if (kBoolTrue == test_3) {
             TC_Array <C_FixItDescription> fixItArray4 ;
-            inCompiler->emitSemanticError (enumerator_12603.current_lkey (HERE).readProperty_location (), GALGAS_string ("The attribute ").add_operation (enumerator_12603.current_lkey (HERE).readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 405)).add_operation (GALGAS_string (" does not belong to the "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 405)).add_operation (inArgument_currentElement.readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 405)).add_operation (GALGAS_string (" element.\nPossible "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 406)).add_operation (GALGAS_string ("attributes are :\n "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 406)).add_operation (extensionGetter_string (var_currentClass_11372.readProperty_lAttributeLegacy (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 407)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 407)), fixItArray4  COMMA_SOURCE_FILE ("arxml_parser.galgas", 405)) ;
+            inCompiler->emitSemanticError (enumerator_13050.current_lkey (HERE).readProperty_location (), GALGAS_string ("The attribute ").add_operation (enumerator_13050.current_lkey (HERE).readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 418)).add_operation (GALGAS_string (" does not belong to the "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 418)).add_operation (inArgument_currentElement.readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 418)).add_operation (GALGAS_string (" element.\nPossible "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 419)).add_operation (GALGAS_string ("attributes are :\n "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 419)).add_operation (extensionGetter_string (var_currentClass_11819.readProperty_lAttributeLegacy (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 420)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 420)), fixItArray4  COMMA_SOURCE_FILE ("arxml_parser.galgas", 418)) ;
           }
         }
-        enumerator_12603.gotoNextObject () ;
+        enumerator_13050.gotoNextObject () ;
       }
     }
   }
-  cEnumerator_arxmlMetaElementList enumerator_13044 (var_currentClass_11372.readProperty_lElementLegacy (), kENUMERATION_UP) ;
-  while (enumerator_13044.hasCurrentObject ()) {
-    GALGAS_arxmlElementList var_subElements_13112 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 414)) ;
-    callExtensionMethod_getSubElementsFromName ((cPtr_arxmlElementNode *) inArgument_currentElement.ptr (), enumerator_13044.current_lElement (HERE).readProperty_name ().readProperty_string (), var_subElements_13112, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 416)) ;
-    GALGAS_uint var_minOccurs_13331 = GALGAS_uint (uint32_t (1U)) ;
-    GALGAS_uint var_maxOccurs_13355 = GALGAS_uint (uint32_t (1U)) ;
+  cEnumerator_arxmlMetaElementList enumerator_13491 (var_currentClass_11819.readProperty_lElementLegacy (), kENUMERATION_UP) ;
+  while (enumerator_13491.hasCurrentObject ()) {
+    GALGAS_arxmlElementList var_subElements_13559 = GALGAS_arxmlElementList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 427)) ;
+    callExtensionMethod_getSubElementsFromName ((cPtr_arxmlElementNode *) inArgument_currentElement.ptr (), enumerator_13491.current_lElement (HERE).readProperty_name ().readProperty_string (), var_subElements_13559, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 429)) ;
+    GALGAS_uint var_minOccurs_13778 = GALGAS_uint (uint32_t (1U)) ;
+    GALGAS_uint var_maxOccurs_13802 = GALGAS_uint (uint32_t (1U)) ;
     enumGalgasBool test_5 = kBoolTrue ;
     if (kBoolTrue == test_5) {
-      GALGAS_bool test_6 = GALGAS_bool (kIsNotEqual, enumerator_13044.current_lElement (HERE).readProperty_minOccurs ().readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())) ;
+      GALGAS_bool test_6 = GALGAS_bool (kIsNotEqual, enumerator_13491.current_lElement (HERE).readProperty_minOccurs ().readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())) ;
       if (kBoolTrue == test_6.boolEnum ()) {
-        test_6 = enumerator_13044.current_lElement (HERE).readProperty_minOccurs ().readProperty_string ().getter_isDecimalUnsignedNumber (SOURCE_FILE ("arxml_parser.galgas", 424)) ;
+        test_6 = enumerator_13491.current_lElement (HERE).readProperty_minOccurs ().readProperty_string ().getter_isDecimalUnsignedNumber (SOURCE_FILE ("arxml_parser.galgas", 437)) ;
       }
       test_5 = test_6.boolEnum () ;
       if (kBoolTrue == test_5) {
-        var_minOccurs_13331 = enumerator_13044.current_lElement (HERE).readProperty_minOccurs ().readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 425)) ;
+        var_minOccurs_13778 = enumerator_13491.current_lElement (HERE).readProperty_minOccurs ().readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 438)) ;
       }
     }
     enumGalgasBool test_7 = kBoolTrue ;
     if (kBoolTrue == test_7) {
-      test_7 = GALGAS_bool (kIsStrictInf, var_subElements_13112.getter_count (SOURCE_FILE ("arxml_parser.galgas", 428)).objectCompare (var_minOccurs_13331)).boolEnum () ;
+      test_7 = GALGAS_bool (kIsStrictInf, var_subElements_13559.getter_count (SOURCE_FILE ("arxml_parser.galgas", 441)).objectCompare (var_minOccurs_13778)).boolEnum () ;
       if (kBoolTrue == test_7) {
         TC_Array <C_FixItDescription> fixItArray8 ;
-        inCompiler->emitSemanticError (inArgument_currentElement.readProperty_name ().readProperty_location (), GALGAS_string ("Missing element ").add_operation (enumerator_13044.current_lElement (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 429)).add_operation (GALGAS_string (". Minimum : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 429)).add_operation (var_minOccurs_13331.getter_string (SOURCE_FILE ("arxml_parser.galgas", 430)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 430)).add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 430)).add_operation (GALGAS_string (" Found "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 430)).add_operation (var_subElements_13112.getter_count (SOURCE_FILE ("arxml_parser.galgas", 431)).getter_string (SOURCE_FILE ("arxml_parser.galgas", 431)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 431)), fixItArray8  COMMA_SOURCE_FILE ("arxml_parser.galgas", 429)) ;
+        inCompiler->emitSemanticError (inArgument_currentElement.readProperty_name ().readProperty_location (), GALGAS_string ("Missing element ").add_operation (enumerator_13491.current_lElement (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 442)).add_operation (GALGAS_string (". Minimum : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 442)).add_operation (var_minOccurs_13778.getter_string (SOURCE_FILE ("arxml_parser.galgas", 443)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 443)).add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 443)).add_operation (GALGAS_string (" Found "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 443)).add_operation (var_subElements_13559.getter_count (SOURCE_FILE ("arxml_parser.galgas", 444)).getter_string (SOURCE_FILE ("arxml_parser.galgas", 444)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 444)), fixItArray8  COMMA_SOURCE_FILE ("arxml_parser.galgas", 442)) ;
       }
     }
     enumGalgasBool test_9 = kBoolTrue ;
     if (kBoolTrue == test_9) {
-      GALGAS_bool test_10 = GALGAS_bool (kIsNotEqual, enumerator_13044.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().objectCompare (GALGAS_string ("unbounded"))) ;
+      GALGAS_bool test_10 = GALGAS_bool (kIsNotEqual, enumerator_13491.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().objectCompare (GALGAS_string ("unbounded"))) ;
       if (kBoolTrue == test_10.boolEnum ()) {
-        test_10 = GALGAS_bool (kIsNotEqual, enumerator_13044.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())) ;
+        test_10 = GALGAS_bool (kIsNotEqual, enumerator_13491.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())) ;
       }
       test_9 = test_10.boolEnum () ;
       if (kBoolTrue == test_9) {
         enumGalgasBool test_11 = kBoolTrue ;
         if (kBoolTrue == test_11) {
-          GALGAS_bool test_12 = GALGAS_bool (kIsNotEqual, enumerator_13044.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())) ;
+          GALGAS_bool test_12 = GALGAS_bool (kIsNotEqual, enumerator_13491.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())) ;
           if (kBoolTrue == test_12.boolEnum ()) {
-            test_12 = enumerator_13044.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().getter_isDecimalUnsignedNumber (SOURCE_FILE ("arxml_parser.galgas", 439)) ;
+            test_12 = enumerator_13491.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().getter_isDecimalUnsignedNumber (SOURCE_FILE ("arxml_parser.galgas", 452)) ;
           }
           test_11 = test_12.boolEnum () ;
           if (kBoolTrue == test_11) {
-            var_maxOccurs_13355 = enumerator_13044.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 440)) ;
+            var_maxOccurs_13802 = enumerator_13491.current_lElement (HERE).readProperty_maxOccurs ().readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 453)) ;
           }
         }
         enumGalgasBool test_13 = kBoolTrue ;
         if (kBoolTrue == test_13) {
-          test_13 = GALGAS_bool (kIsStrictSup, var_subElements_13112.getter_count (SOURCE_FILE ("arxml_parser.galgas", 443)).objectCompare (var_maxOccurs_13355)).boolEnum () ;
+          test_13 = GALGAS_bool (kIsStrictSup, var_subElements_13559.getter_count (SOURCE_FILE ("arxml_parser.galgas", 456)).objectCompare (var_maxOccurs_13802)).boolEnum () ;
           if (kBoolTrue == test_13) {
             TC_Array <C_FixItDescription> fixItArray14 ;
-            inCompiler->emitSemanticError (inArgument_currentElement.readProperty_name ().readProperty_location (), GALGAS_string ("Too many node ").add_operation (enumerator_13044.current_lElement (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 444)).add_operation (GALGAS_string (". Minimum : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 444)).add_operation (var_minOccurs_13331.getter_string (SOURCE_FILE ("arxml_parser.galgas", 445)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 445)).add_operation (GALGAS_string (" ; Maximum : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 445)).add_operation (var_maxOccurs_13355.getter_string (SOURCE_FILE ("arxml_parser.galgas", 445)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 445)).add_operation (GALGAS_string (". Found "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 445)).add_operation (var_subElements_13112.getter_count (SOURCE_FILE ("arxml_parser.galgas", 446)).getter_string (SOURCE_FILE ("arxml_parser.galgas", 446)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 446)), fixItArray14  COMMA_SOURCE_FILE ("arxml_parser.galgas", 444)) ;
+            inCompiler->emitSemanticError (inArgument_currentElement.readProperty_name ().readProperty_location (), GALGAS_string ("Too many node ").add_operation (enumerator_13491.current_lElement (HERE).readProperty_name ().readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 457)).add_operation (GALGAS_string (". Minimum : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 457)).add_operation (var_minOccurs_13778.getter_string (SOURCE_FILE ("arxml_parser.galgas", 458)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 458)).add_operation (GALGAS_string (" ; Maximum : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 458)).add_operation (var_maxOccurs_13802.getter_string (SOURCE_FILE ("arxml_parser.galgas", 458)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 458)).add_operation (GALGAS_string (". Found "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 458)).add_operation (var_subElements_13559.getter_count (SOURCE_FILE ("arxml_parser.galgas", 459)).getter_string (SOURCE_FILE ("arxml_parser.galgas", 459)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 459)), fixItArray14  COMMA_SOURCE_FILE ("arxml_parser.galgas", 457)) ;
           }
         }
       }
     }
-    cEnumerator_arxmlElementList enumerator_14632 (var_subElements_13112, kENUMERATION_UP) ;
-    while (enumerator_14632.hasCurrentObject ()) {
-      GALGAS_arxmlElementValue var_subElementValue_14691 ;
+    cEnumerator_arxmlElementList enumerator_15079 (var_subElements_13559, kENUMERATION_UP) ;
+    while (enumerator_15079.hasCurrentObject ()) {
+      GALGAS_arxmlElementValue var_subElementValue_15138 ;
       {
-      routine_nodeToClassRes (enumerator_14632.current_node (HERE), inArgument_classMap, var_subElementValue_14691, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 453)) ;
+      routine_nodeToClassRes (enumerator_15079.current_node (HERE), inArgument_classMap, var_subElementValue_15138, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 466)) ;
       }
       {
       outArgument_elementValue.insulate (HERE) ;
       cPtr_arxmlElementValue * ptr_14777 = (cPtr_arxmlElementValue *) outArgument_elementValue.ptr () ;
-      callExtensionSetter_insertElement ((cPtr_arxmlElementValue *) ptr_14777, enumerator_14632.current_node (HERE).readProperty_name (), var_subElementValue_14691, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 454)) ;
+      callExtensionSetter_insertElement ((cPtr_arxmlElementValue *) ptr_14777, enumerator_15079.current_node (HERE).readProperty_name (), var_subElementValue_15138, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 467)) ;
       }
-      enumerator_14632.gotoNextObject () ;
+      enumerator_15079.gotoNextObject () ;
     }
-    enumerator_13044.gotoNextObject () ;
+    enumerator_13491.gotoNextObject () ;
   }
 }
 
@@ -382,24 +486,24 @@ void routine_addText (GALGAS_arxmlNodeList & ioArgument_nodes,
                       const GALGAS_bool constinArgument_doNotCondenseWhiteSpaces,
                       C_Compiler * inCompiler
                       COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_string var_s_14956 = GALGAS_string::constructor_retrieveAndResetTemplateString (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 463)) ;
-  GALGAS_string var_trimmedString_15006 = var_s_14956.getter_stringByTrimmingWhiteSpaces (SOURCE_FILE ("arxml_parser.galgas", 464)) ;
+  GALGAS_string var_s_15403 = GALGAS_string::constructor_retrieveAndResetTemplateString (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 476)) ;
+  GALGAS_string var_trimmedString_15453 = var_s_15403.getter_stringByTrimmingWhiteSpaces (SOURCE_FILE ("arxml_parser.galgas", 477)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsStrictSup, var_trimmedString_15006.getter_count (SOURCE_FILE ("arxml_parser.galgas", 465)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictSup, var_trimmedString_15453.getter_count (SOURCE_FILE ("arxml_parser.galgas", 478)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_ls_15108 ;
+      GALGAS_lstring var_ls_15555 ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
         test_1 = constinArgument_doNotCondenseWhiteSpaces.boolEnum () ;
         if (kBoolTrue == test_1) {
-          var_ls_15108 = GALGAS_lstring::constructor_new (var_s_14956, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 468))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 468)) ;
+          var_ls_15555 = GALGAS_lstring::constructor_new (var_s_15403, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 481))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 481)) ;
         }
       }
       if (kBoolFalse == test_1) {
-        var_ls_15108 = GALGAS_lstring::constructor_new (var_trimmedString_15006, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 470))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 470)) ;
+        var_ls_15555 = GALGAS_lstring::constructor_new (var_trimmedString_15453, GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 483))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 483)) ;
       }
-      ioArgument_nodes.addAssign_operation (GALGAS_arxmlTextNode::constructor_new (var_ls_15108  COMMA_SOURCE_FILE ("arxml_parser.galgas", 473))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 473)) ;
+      ioArgument_nodes.addAssign_operation (GALGAS_arxmlTextNode::constructor_new (var_ls_15555  COMMA_SOURCE_FILE ("arxml_parser.galgas", 486))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 486)) ;
     }
   }
 }
@@ -416,25 +520,25 @@ void routine_convertToOil (GALGAS_implementation & ioArgument_imp,
                            GALGAS_arxmlElementValue inArgument_rootValue,
                            C_Compiler * inCompiler
                            COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_emptyPath_15418 = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 482))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 482)) ;
-  GALGAS_arxmlElementValueList var_packages_15505 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 485)) ;
-  GALGAS_stringlist var_packagesPath_15533 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 486)) ;
-  var_packagesPath_15533.addAssign_operation (GALGAS_string ("AR-PACKAGES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 487)) ;
-  var_packagesPath_15533.addAssign_operation (GALGAS_string ("AR-PACKAGE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 488)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_rootValue.ptr (), var_packagesPath_15533, var_packages_15505, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 489)) ;
-  cEnumerator_arxmlElementValueList enumerator_15722 (var_packages_15505, kENUMERATION_UP) ;
-  while (enumerator_15722.hasCurrentObject ()) {
+  GALGAS_lstring var_emptyPath_15865 = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 495))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 495)) ;
+  GALGAS_arxmlElementValueList var_packages_15952 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 498)) ;
+  GALGAS_stringlist var_packagesPath_15980 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 499)) ;
+  var_packagesPath_15980.addAssign_operation (GALGAS_string ("AR-PACKAGES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 500)) ;
+  var_packagesPath_15980.addAssign_operation (GALGAS_string ("AR-PACKAGE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 501)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_rootValue.ptr (), var_packagesPath_15980, var_packages_15952, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 502)) ;
+  cEnumerator_arxmlElementValueList enumerator_16169 (var_packages_15952, kENUMERATION_UP) ;
+  while (enumerator_16169.hasCurrentObject ()) {
     {
-    routine_arxmlImplementationPackage (ioArgument_imp, enumerator_15722.current_value (HERE), var_emptyPath_15418, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 493)) ;
+    routine_arxmlImplementationPackage (ioArgument_imp, enumerator_16169.current_value (HERE), var_emptyPath_15865, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 506)) ;
     }
-    enumerator_15722.gotoNextObject () ;
+    enumerator_16169.gotoNextObject () ;
   }
-  cEnumerator_arxmlElementValueList enumerator_15856 (var_packages_15505, kENUMERATION_UP) ;
-  while (enumerator_15856.hasCurrentObject ()) {
+  cEnumerator_arxmlElementValueList enumerator_16303 (var_packages_15952, kENUMERATION_UP) ;
+  while (enumerator_16303.hasCurrentObject ()) {
     {
-    routine_arxmlDefinitionPackage (ioArgument_imp, ioArgument_application, enumerator_15856.current_value (HERE), var_emptyPath_15418, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 498)) ;
+    routine_arxmlDefinitionPackage (ioArgument_imp, ioArgument_application, enumerator_16303.current_value (HERE), var_emptyPath_15865, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 511)) ;
     }
-    enumerator_15856.gotoNextObject () ;
+    enumerator_16303.gotoNextObject () ;
   }
 }
 
@@ -450,31 +554,31 @@ void routine_arxmlImplementationPackage (GALGAS_implementation & ioArgument_imp,
                                          GALGAS_lstring inArgument_parentPath,
                                          C_Compiler * inCompiler
                                          COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_packageName_16229 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 512)) ;
-  GALGAS_lstring var_currentPath_16342 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 515)).add_operation (var_packageName_16229.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 515)), var_packageName_16229.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 515)) ;
-  GALGAS_arxmlElementValueList var_definitions_16572 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 519)) ;
-  GALGAS_stringlist var_definitionPath_16603 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 520)) ;
-  var_definitionPath_16603.addAssign_operation (GALGAS_string ("ELEMENTS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 521)) ;
-  var_definitionPath_16603.addAssign_operation (GALGAS_string ("ECUC-MODULE-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 522)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_definitionPath_16603, var_definitions_16572, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 523)) ;
-  cEnumerator_arxmlElementValueList enumerator_16786 (var_definitions_16572, kENUMERATION_UP) ;
-  while (enumerator_16786.hasCurrentObject ()) {
+  GALGAS_lstring var_packageName_16676 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 525)) ;
+  GALGAS_lstring var_currentPath_16789 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 528)).add_operation (var_packageName_16676.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 528)), var_packageName_16676.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 528)) ;
+  GALGAS_arxmlElementValueList var_definitions_17019 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 532)) ;
+  GALGAS_stringlist var_definitionPath_17050 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 533)) ;
+  var_definitionPath_17050.addAssign_operation (GALGAS_string ("ELEMENTS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 534)) ;
+  var_definitionPath_17050.addAssign_operation (GALGAS_string ("ECUC-MODULE-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 535)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_definitionPath_17050, var_definitions_17019, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 536)) ;
+  cEnumerator_arxmlElementValueList enumerator_17233 (var_definitions_17019, kENUMERATION_UP) ;
+  while (enumerator_17233.hasCurrentObject ()) {
     {
-    routine_arxmlImplementationRoot (ioArgument_imp, enumerator_16786.current_value (HERE), var_currentPath_16342, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 525)) ;
+    routine_arxmlImplementationRoot (ioArgument_imp, enumerator_17233.current_value (HERE), var_currentPath_16789, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 538)) ;
     }
-    enumerator_16786.gotoNextObject () ;
+    enumerator_17233.gotoNextObject () ;
   }
-  GALGAS_arxmlElementValueList var_packages_16962 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 529)) ;
-  GALGAS_stringlist var_packagesPath_16990 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 530)) ;
-  var_packagesPath_16990.addAssign_operation (GALGAS_string ("AR-PACKAGES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 531)) ;
-  var_packagesPath_16990.addAssign_operation (GALGAS_string ("AR-PACKAGE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 532)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_packagesPath_16990, var_packages_16962, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 533)) ;
-  cEnumerator_arxmlElementValueList enumerator_17160 (var_packages_16962, kENUMERATION_UP) ;
-  while (enumerator_17160.hasCurrentObject ()) {
+  GALGAS_arxmlElementValueList var_packages_17409 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 542)) ;
+  GALGAS_stringlist var_packagesPath_17437 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 543)) ;
+  var_packagesPath_17437.addAssign_operation (GALGAS_string ("AR-PACKAGES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 544)) ;
+  var_packagesPath_17437.addAssign_operation (GALGAS_string ("AR-PACKAGE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 545)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_packagesPath_17437, var_packages_17409, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 546)) ;
+  cEnumerator_arxmlElementValueList enumerator_17607 (var_packages_17409, kENUMERATION_UP) ;
+  while (enumerator_17607.hasCurrentObject ()) {
     {
-    routine_arxmlImplementationPackage (ioArgument_imp, enumerator_17160.current_value (HERE), var_currentPath_16342, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 535)) ;
+    routine_arxmlImplementationPackage (ioArgument_imp, enumerator_17607.current_value (HERE), var_currentPath_16789, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 548)) ;
     }
-    enumerator_17160.gotoNextObject () ;
+    enumerator_17607.gotoNextObject () ;
   }
 }
 
@@ -490,32 +594,32 @@ void routine_arxmlImplementationRoot (GALGAS_implementation & ioArgument_impleme
                                       GALGAS_lstring inArgument_parentPath,
                                       C_Compiler * inCompiler
                                       COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_objectName_17422 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 545)) ;
+  GALGAS_lstring var_objectName_17869 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 558)) ;
   {
-  routine_displayOil (GALGAS_string ("\nIMPLEMENTATION ").add_operation (var_objectName_17422.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 546)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 546)) ;
+  routine_displayOil (GALGAS_string ("\nIMPLEMENTATION ").add_operation (var_objectName_17869.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 559)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 559)) ;
   }
-  GALGAS_lstring var_currentPath_17581 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 549)).add_operation (var_objectName_17422.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 549)), inArgument_parentPath.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 549)) ;
-  GALGAS_lstring var_oil_5F_desc_17787 ;
+  GALGAS_lstring var_currentPath_18028 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 562)).add_operation (var_objectName_17869.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 562)), inArgument_parentPath.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 562)) ;
+  GALGAS_lstring var_oil_5F_desc_18234 ;
   {
-  routine_arxmlGetDescription (inArgument_packageElement, var_oil_5F_desc_17787, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 553)) ;
+  routine_arxmlGetDescription (inArgument_packageElement, var_oil_5F_desc_18234, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 566)) ;
   }
-  GALGAS_arxmlElementValueList var_subDefs_17850 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 556)) ;
-  GALGAS_stringlist var_subDefsPath_17877 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 557)) ;
-  var_subDefsPath_17877.addAssign_operation (GALGAS_string ("CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 558)) ;
-  var_subDefsPath_17877.addAssign_operation (GALGAS_string ("ECUC-PARAM-CONF-CONTAINER-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 559)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_subDefsPath_17877, var_subDefs_17850, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 560)) ;
+  GALGAS_arxmlElementValueList var_subDefs_18297 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 569)) ;
+  GALGAS_stringlist var_subDefsPath_18324 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 570)) ;
+  var_subDefsPath_18324.addAssign_operation (GALGAS_string ("CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 571)) ;
+  var_subDefsPath_18324.addAssign_operation (GALGAS_string ("ECUC-PARAM-CONF-CONTAINER-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 572)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_subDefsPath_18324, var_subDefs_18297, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 573)) ;
   {
-  routine_displayOil (GALGAS_string ("\n{\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 562)) ;
+  routine_displayOil (GALGAS_string ("\n{\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 575)) ;
   }
-  cEnumerator_arxmlElementValueList enumerator_18121 (var_subDefs_17850, kENUMERATION_UP) ;
-  while (enumerator_18121.hasCurrentObject ()) {
+  cEnumerator_arxmlElementValueList enumerator_18568 (var_subDefs_18297, kENUMERATION_UP) ;
+  while (enumerator_18568.hasCurrentObject ()) {
     {
-    routine_arxmlImplementationObject (ioArgument_implementation, enumerator_18121.current_value (HERE), var_currentPath_17581, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 566)) ;
+    routine_arxmlImplementationObject (ioArgument_implementation, enumerator_18568.current_value (HERE), var_currentPath_18028, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 579)) ;
     }
-    enumerator_18121.gotoNextObject () ;
+    enumerator_18568.gotoNextObject () ;
   }
   {
-  routine_displayOil (GALGAS_string ("}; /* END IMPLEMENTATION ").add_operation (var_objectName_17422.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 569)).add_operation (GALGAS_string (" : \""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 569)).add_operation (var_oil_5F_desc_17787.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 570)).add_operation (GALGAS_string ("\" */\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 570)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 569)) ;
+  routine_displayOil (GALGAS_string ("}; /* END IMPLEMENTATION ").add_operation (var_objectName_17869.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 582)).add_operation (GALGAS_string (" : \""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 582)).add_operation (var_oil_5F_desc_18234.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 583)).add_operation (GALGAS_string ("\" */\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 583)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 582)) ;
   }
 }
 
@@ -531,52 +635,52 @@ void routine_arxmlImplementationObject (GALGAS_implementation & ioArgument_imple
                                         GALGAS_lstring inArgument_parentPath,
                                         C_Compiler * inCompiler
                                         COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_implementationMap var_imp_18497 = ioArgument_implementation.readProperty_imp () ;
-  GALGAS_implementationObjectMap var_objectAttributes_18551 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 579)) ;
-  GALGAS_lstring var_objectName_18713 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 583)) ;
-  GALGAS_lstring var_currentPath_18824 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 586)).add_operation (var_objectName_18713.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 586)), inArgument_parentPath.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 586)) ;
-  GALGAS_lstring var_objectKind_19073 = var_objectName_18713 ;
-  var_objectKind_19073.setter_setString (var_objectName_18713.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 591)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 591)) ;
+  GALGAS_implementationMap var_imp_18944 = ioArgument_implementation.readProperty_imp () ;
+  GALGAS_implementationObjectMap var_objectAttributes_18998 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 592)) ;
+  GALGAS_lstring var_objectName_19160 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 596)) ;
+  GALGAS_lstring var_currentPath_19271 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 599)).add_operation (var_objectName_19160.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 599)), inArgument_parentPath.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 599)) ;
+  GALGAS_lstring var_objectKind_19520 = var_objectName_19160 ;
+  var_objectKind_19520.setter_setString (var_objectName_19160.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 604)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 604)) ;
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (var_objectKind_19073.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 593)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 593)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (var_objectKind_19520.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 606)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 606)) ;
   }
-  GALGAS_lbool var_multiple_19297 ;
+  GALGAS_lbool var_multiple_19744 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_packageElement, var_objectName_18713, var_multiple_19297, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 596)) ;
+  routine_arxmlGetMultiplicity (inArgument_packageElement, var_objectName_19160, var_multiple_19744, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 609)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("\n  {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 597)) ;
+  routine_displayOil (GALGAS_string ("\n  {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 610)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_19416 ;
+  GALGAS_lstring var_oil_5F_desc_19863 ;
   {
-  routine_arxmlGetDescription (inArgument_packageElement, var_oil_5F_desc_19416, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 600)) ;
+  routine_arxmlGetDescription (inArgument_packageElement, var_oil_5F_desc_19863, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 613)) ;
   }
   {
-  routine_arxmlImplementationContainer (var_objectAttributes_18551, inArgument_packageElement, var_currentPath_18824, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 603)) ;
+  routine_arxmlImplementationContainer (var_objectAttributes_18998, inArgument_packageElement, var_currentPath_19271, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 616)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  }; /* \"").add_operation (var_oil_5F_desc_19416.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 607)).add_operation (GALGAS_string ("\"*/\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 607)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 607)) ;
+  routine_displayOil (GALGAS_string ("  }; /* \"").add_operation (var_oil_5F_desc_19863.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 620)).add_operation (GALGAS_string ("\"*/\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 620)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 620)) ;
   }
-  GALGAS_implementationObject var_newObject_19721 = GALGAS_implementationObject::constructor_new (var_multiple_19297, var_objectAttributes_18551  COMMA_SOURCE_FILE ("arxml_parser.galgas", 611)) ;
-  GALGAS_implementationObject var_object_19894 ;
+  GALGAS_implementationObject var_newObject_20168 = GALGAS_implementationObject::constructor_new (var_multiple_19744, var_objectAttributes_18998  COMMA_SOURCE_FILE ("arxml_parser.galgas", 624)) ;
+  GALGAS_implementationObject var_object_20341 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasKey ((const cPtr_implementation *) ioArgument_implementation.ptr (), var_objectName_18713.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 616)).boolEnum () ;
+    test_0 = callExtensionGetter_hasKey ((const cPtr_implementation *) ioArgument_implementation.ptr (), var_objectName_19160.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 629)).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      var_imp_18497.setter_del (var_objectName_18713, var_object_19894, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 617)) ;
+      var_imp_18944.setter_del (var_objectName_19160, var_object_20341, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 630)) ;
       }
-      var_object_19894 = callExtensionGetter_mergeImplementationObjectWith ((const cPtr_implementationObject *) var_object_19894.ptr (), var_newObject_19721, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 618)) ;
+      var_object_20341 = callExtensionGetter_mergeImplementationObjectWith ((const cPtr_implementationObject *) var_object_20341.ptr (), var_newObject_20168, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 631)) ;
     }
   }
   if (kBoolFalse == test_0) {
-    var_object_19894 = var_newObject_19721 ;
+    var_object_20341 = var_newObject_20168 ;
   }
   {
-  var_imp_18497.setter_put (var_objectName_18713, var_object_19894, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 624)) ;
+  var_imp_18944.setter_put (var_objectName_19160, var_object_20341, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 637)) ;
   }
   {
-  ioArgument_implementation.setter_setImp (var_imp_18497 COMMA_SOURCE_FILE ("arxml_parser.galgas", 625)) ;
+  ioArgument_implementation.setter_setImp (var_imp_18944 COMMA_SOURCE_FILE ("arxml_parser.galgas", 638)) ;
   }
 }
 
@@ -592,141 +696,141 @@ void routine_arxmlImplementationContainer (GALGAS_implementationObjectMap & ioAr
                                            GALGAS_lstring inArgument_parentPath,
                                            C_Compiler * inCompiler
                                            COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_arxmlElementValueList var_intParameters_20546 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 636)) ;
-  GALGAS_stringlist var_intParametersPath_20579 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 637)) ;
-  var_intParametersPath_20579.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 638)) ;
-  var_intParametersPath_20579.addAssign_operation (GALGAS_string ("ECUC-INTEGER-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 639)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_intParametersPath_20579, var_intParameters_20546, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 640)) ;
-  cEnumerator_arxmlElementValueList enumerator_20786 (var_intParameters_20546, kENUMERATION_UP) ;
-  while (enumerator_20786.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_20834 ;
-    GALGAS_impType var_type_20865 ;
+  GALGAS_arxmlElementValueList var_intParameters_20993 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 649)) ;
+  GALGAS_stringlist var_intParametersPath_21026 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 650)) ;
+  var_intParametersPath_21026.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 651)) ;
+  var_intParametersPath_21026.addAssign_operation (GALGAS_string ("ECUC-INTEGER-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 652)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_intParametersPath_21026, var_intParameters_20993, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 653)) ;
+  cEnumerator_arxmlElementValueList enumerator_21233 (var_intParameters_20993, kENUMERATION_UP) ;
+  while (enumerator_21233.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_21281 ;
+    GALGAS_impType var_type_21312 ;
     {
-    routine_arxmlImplementationContainerNumber (var_attributeName_20834, var_type_20865, GALGAS_dataType::constructor_uint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 647)), enumerator_20786.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 645)) ;
+    routine_arxmlImplementationContainerNumber (var_attributeName_21281, var_type_21312, GALGAS_dataType::constructor_uint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 660)), enumerator_21233.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 658)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_20834, var_type_20865, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 650)) ;
-    }
-    enumerator_20786.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_floatParameters_21418 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 656)) ;
-  GALGAS_stringlist var_floatParametersPath_21453 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 657)) ;
-  var_floatParametersPath_21453.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 658)) ;
-  var_floatParametersPath_21453.addAssign_operation (GALGAS_string ("ECUC-FLOAT-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 659)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_floatParametersPath_21453, var_floatParameters_21418, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 660)) ;
-  cEnumerator_arxmlElementValueList enumerator_21668 (var_floatParameters_21418, kENUMERATION_UP) ;
-  while (enumerator_21668.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_21718 ;
-    GALGAS_impType var_type_21749 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_21281, var_type_21312, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 663)) ;
+    }
+    enumerator_21233.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_floatParameters_21865 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 669)) ;
+  GALGAS_stringlist var_floatParametersPath_21900 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 670)) ;
+  var_floatParametersPath_21900.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 671)) ;
+  var_floatParametersPath_21900.addAssign_operation (GALGAS_string ("ECUC-FLOAT-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 672)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_floatParametersPath_21900, var_floatParameters_21865, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 673)) ;
+  cEnumerator_arxmlElementValueList enumerator_22115 (var_floatParameters_21865, kENUMERATION_UP) ;
+  while (enumerator_22115.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_22165 ;
+    GALGAS_impType var_type_22196 ;
     {
-    routine_arxmlImplementationContainerNumber (var_attributeName_21718, var_type_21749, GALGAS_dataType::constructor_floatNumber (SOURCE_FILE ("arxml_parser.galgas", 667)), enumerator_21668.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 665)) ;
+    routine_arxmlImplementationContainerNumber (var_attributeName_22165, var_type_22196, GALGAS_dataType::constructor_floatNumber (SOURCE_FILE ("arxml_parser.galgas", 680)), enumerator_22115.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 678)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_21718, var_type_21749, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 670)) ;
-    }
-    enumerator_21668.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_stringParameters_22289 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 676)) ;
-  GALGAS_stringlist var_stringParametersPath_22325 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 677)) ;
-  var_stringParametersPath_22325.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 678)) ;
-  var_stringParametersPath_22325.addAssign_operation (GALGAS_string ("ECUC-STRING-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 679)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_stringParametersPath_22325, var_stringParameters_22289, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 680)) ;
-  cEnumerator_arxmlElementValueList enumerator_22546 (var_stringParameters_22289, kENUMERATION_UP) ;
-  while (enumerator_22546.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_22597 ;
-    GALGAS_impType var_type_22628 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_22165, var_type_22196, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 683)) ;
+    }
+    enumerator_22115.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_stringParameters_22736 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 689)) ;
+  GALGAS_stringlist var_stringParametersPath_22772 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 690)) ;
+  var_stringParametersPath_22772.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 691)) ;
+  var_stringParametersPath_22772.addAssign_operation (GALGAS_string ("ECUC-STRING-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 692)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_stringParametersPath_22772, var_stringParameters_22736, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 693)) ;
+  cEnumerator_arxmlElementValueList enumerator_22993 (var_stringParameters_22736, kENUMERATION_UP) ;
+  while (enumerator_22993.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_23044 ;
+    GALGAS_impType var_type_23075 ;
     {
-    routine_arxmlImplementationContainerString (var_attributeName_22597, var_type_22628, GALGAS_dataType::constructor_string (SOURCE_FILE ("arxml_parser.galgas", 687)), enumerator_22546.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 685)) ;
+    routine_arxmlImplementationContainerString (var_attributeName_23044, var_type_23075, GALGAS_dataType::constructor_string (SOURCE_FILE ("arxml_parser.galgas", 700)), enumerator_22993.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 698)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_22597, var_type_22628, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 690)) ;
-    }
-    enumerator_22546.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_booleanParameters_23164 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 696)) ;
-  GALGAS_stringlist var_booleanParametersPath_23201 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 697)) ;
-  var_booleanParametersPath_23201.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 698)) ;
-  var_booleanParametersPath_23201.addAssign_operation (GALGAS_string ("ECUC-BOOLEAN-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 699)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_booleanParametersPath_23201, var_booleanParameters_23164, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 700)) ;
-  cEnumerator_arxmlElementValueList enumerator_23428 (var_booleanParameters_23164, kENUMERATION_UP) ;
-  while (enumerator_23428.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_23480 ;
-    GALGAS_impType var_type_23511 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_23044, var_type_23075, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 703)) ;
+    }
+    enumerator_22993.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_booleanParameters_23611 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 709)) ;
+  GALGAS_stringlist var_booleanParametersPath_23648 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 710)) ;
+  var_booleanParametersPath_23648.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 711)) ;
+  var_booleanParametersPath_23648.addAssign_operation (GALGAS_string ("ECUC-BOOLEAN-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 712)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_booleanParametersPath_23648, var_booleanParameters_23611, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 713)) ;
+  cEnumerator_arxmlElementValueList enumerator_23875 (var_booleanParameters_23611, kENUMERATION_UP) ;
+  while (enumerator_23875.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_23927 ;
+    GALGAS_impType var_type_23958 ;
     {
-    routine_arxmlImplementationContainerBoolean (var_attributeName_23480, var_type_23511, GALGAS_dataType::constructor_boolean (SOURCE_FILE ("arxml_parser.galgas", 707)), enumerator_23428.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 705)) ;
+    routine_arxmlImplementationContainerBoolean (var_attributeName_23927, var_type_23958, GALGAS_dataType::constructor_boolean (SOURCE_FILE ("arxml_parser.galgas", 720)), enumerator_23875.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 718)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_23480, var_type_23511, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 710)) ;
-    }
-    enumerator_23428.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_enumParameters_24050 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 716)) ;
-  GALGAS_stringlist var_enumParametersPath_24084 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 717)) ;
-  var_enumParametersPath_24084.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 718)) ;
-  var_enumParametersPath_24084.addAssign_operation (GALGAS_string ("ECUC-ENUMERATION-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 719)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_enumParametersPath_24084, var_enumParameters_24050, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 720)) ;
-  cEnumerator_arxmlElementValueList enumerator_24300 (var_enumParameters_24050, kENUMERATION_UP) ;
-  while (enumerator_24300.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_24349 ;
-    GALGAS_impType var_type_24380 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_23927, var_type_23958, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 723)) ;
+    }
+    enumerator_23875.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_enumParameters_24497 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 729)) ;
+  GALGAS_stringlist var_enumParametersPath_24531 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 730)) ;
+  var_enumParametersPath_24531.addAssign_operation (GALGAS_string ("PARAMETERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 731)) ;
+  var_enumParametersPath_24531.addAssign_operation (GALGAS_string ("ECUC-ENUMERATION-PARAM-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 732)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_enumParametersPath_24531, var_enumParameters_24497, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 733)) ;
+  cEnumerator_arxmlElementValueList enumerator_24747 (var_enumParameters_24497, kENUMERATION_UP) ;
+  while (enumerator_24747.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_24796 ;
+    GALGAS_impType var_type_24827 ;
     {
-    routine_arxmlImplementationContainerEnumeration (var_attributeName_24349, var_type_24380, GALGAS_dataType::constructor_enumeration (SOURCE_FILE ("arxml_parser.galgas", 727)), enumerator_24300.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 725)) ;
+    routine_arxmlImplementationContainerEnumeration (var_attributeName_24796, var_type_24827, GALGAS_dataType::constructor_enumeration (SOURCE_FILE ("arxml_parser.galgas", 740)), enumerator_24747.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 738)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_24349, var_type_24380, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 730)) ;
-    }
-    enumerator_24300.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_structParameters_24945 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 736)) ;
-  GALGAS_stringlist var_structParametersPath_24981 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 737)) ;
-  var_structParametersPath_24981.addAssign_operation (GALGAS_string ("SUB-CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 738)) ;
-  var_structParametersPath_24981.addAssign_operation (GALGAS_string ("ECUC-PARAM-CONF-CONTAINER-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 739)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_structParametersPath_24981, var_structParameters_24945, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 740)) ;
-  cEnumerator_arxmlElementValueList enumerator_25214 (var_structParameters_24945, kENUMERATION_UP) ;
-  while (enumerator_25214.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_25265 ;
-    GALGAS_impType var_type_25296 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_24796, var_type_24827, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 743)) ;
+    }
+    enumerator_24747.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_structParameters_25392 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 749)) ;
+  GALGAS_stringlist var_structParametersPath_25428 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 750)) ;
+  var_structParametersPath_25428.addAssign_operation (GALGAS_string ("SUB-CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 751)) ;
+  var_structParametersPath_25428.addAssign_operation (GALGAS_string ("ECUC-PARAM-CONF-CONTAINER-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 752)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_structParametersPath_25428, var_structParameters_25392, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 753)) ;
+  cEnumerator_arxmlElementValueList enumerator_25661 (var_structParameters_25392, kENUMERATION_UP) ;
+  while (enumerator_25661.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_25712 ;
+    GALGAS_impType var_type_25743 ;
     {
-    routine_arxmlImplementationContainerStructure (var_attributeName_25265, var_type_25296, GALGAS_dataType::constructor_structType (SOURCE_FILE ("arxml_parser.galgas", 747)), enumerator_25214.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 745)) ;
+    routine_arxmlImplementationContainerStructure (var_attributeName_25712, var_type_25743, GALGAS_dataType::constructor_structType (SOURCE_FILE ("arxml_parser.galgas", 760)), enumerator_25661.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 758)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_25265, var_type_25296, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 750)) ;
-    }
-    enumerator_25214.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_identParameters_25854 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 756)) ;
-  GALGAS_stringlist var_identParametersPath_25889 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 757)) ;
-  var_identParametersPath_25889.addAssign_operation (GALGAS_string ("REFERENCES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 758)) ;
-  var_identParametersPath_25889.addAssign_operation (GALGAS_string ("TPL-IDENTIFIER-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 759)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_identParametersPath_25889, var_identParameters_25854, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 760)) ;
-  cEnumerator_arxmlElementValueList enumerator_26102 (var_identParameters_25854, kENUMERATION_UP) ;
-  while (enumerator_26102.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_26152 ;
-    GALGAS_impType var_type_26183 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_25712, var_type_25743, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 763)) ;
+    }
+    enumerator_25661.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_identParameters_26301 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 769)) ;
+  GALGAS_stringlist var_identParametersPath_26336 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 770)) ;
+  var_identParametersPath_26336.addAssign_operation (GALGAS_string ("REFERENCES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 771)) ;
+  var_identParametersPath_26336.addAssign_operation (GALGAS_string ("TPL-IDENTIFIER-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 772)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_identParametersPath_26336, var_identParameters_26301, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 773)) ;
+  cEnumerator_arxmlElementValueList enumerator_26549 (var_identParameters_26301, kENUMERATION_UP) ;
+  while (enumerator_26549.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_26599 ;
+    GALGAS_impType var_type_26630 ;
     {
-    routine_arxmlImplementationContainerIdentifier (var_attributeName_26152, var_type_26183, GALGAS_dataType::constructor_identifier (SOURCE_FILE ("arxml_parser.galgas", 767)), enumerator_26102.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 765)) ;
+    routine_arxmlImplementationContainerIdentifier (var_attributeName_26599, var_type_26630, GALGAS_dataType::constructor_identifier (SOURCE_FILE ("arxml_parser.galgas", 780)), enumerator_26549.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 778)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_26152, var_type_26183, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 770)) ;
-    }
-    enumerator_26102.gotoNextObject () ;
-  }
-  GALGAS_arxmlElementValueList var_refParameters_26745 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 776)) ;
-  GALGAS_stringlist var_refParametersPath_26778 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 777)) ;
-  var_refParametersPath_26778.addAssign_operation (GALGAS_string ("REFERENCES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 778)) ;
-  var_refParametersPath_26778.addAssign_operation (GALGAS_string ("ECUC-REFERENCE-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 779)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_refParametersPath_26778, var_refParameters_26745, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 780)) ;
-  cEnumerator_arxmlElementValueList enumerator_26981 (var_refParameters_26745, kENUMERATION_UP) ;
-  while (enumerator_26981.hasCurrentObject ()) {
-    GALGAS_lstring var_attributeName_27029 ;
-    GALGAS_impType var_type_27060 ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_26599, var_type_26630, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 783)) ;
+    }
+    enumerator_26549.gotoNextObject () ;
+  }
+  GALGAS_arxmlElementValueList var_refParameters_27192 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 789)) ;
+  GALGAS_stringlist var_refParametersPath_27225 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 790)) ;
+  var_refParametersPath_27225.addAssign_operation (GALGAS_string ("REFERENCES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 791)) ;
+  var_refParametersPath_27225.addAssign_operation (GALGAS_string ("ECUC-REFERENCE-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 792)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_refParametersPath_27225, var_refParameters_27192, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 793)) ;
+  cEnumerator_arxmlElementValueList enumerator_27428 (var_refParameters_27192, kENUMERATION_UP) ;
+  while (enumerator_27428.hasCurrentObject ()) {
+    GALGAS_lstring var_attributeName_27476 ;
+    GALGAS_impType var_type_27507 ;
     {
-    routine_arxmlImplementationContainerReference (var_attributeName_27029, var_type_27060, GALGAS_dataType::constructor_objectType (SOURCE_FILE ("arxml_parser.galgas", 787)), enumerator_26981.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 785)) ;
+    routine_arxmlImplementationContainerReference (var_attributeName_27476, var_type_27507, GALGAS_dataType::constructor_objectType (SOURCE_FILE ("arxml_parser.galgas", 800)), enumerator_27428.current_value (HERE), inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 798)) ;
     }
     {
-    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_27029, var_type_27060, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 790)) ;
+    routine_arxmlInsertObjectAttribute (ioArgument_objectAttributes, var_attributeName_27476, var_type_27507, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 803)) ;
     }
-    enumerator_26981.gotoNextObject () ;
+    enumerator_27428.gotoNextObject () ;
   }
 }
 
@@ -746,165 +850,165 @@ void routine_arxmlImplementationContainerNumber (GALGAS_lstring & outArgument_ob
                                                  COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
-  GALGAS_dataType var_type_27685 = constinArgument_iType ;
+  GALGAS_dataType var_type_28132 = constinArgument_iType ;
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 806)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 819)) ;
   }
-  GALGAS_lbool var_multiple_27839 ;
+  GALGAS_lbool var_multiple_28286 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_27839, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 809)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_28286, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 822)) ;
   }
-  GALGAS_bool var_withAuto_27905 ;
+  GALGAS_bool var_withAuto_28352 ;
   {
-  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_27905, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 812)) ;
+  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_28352, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 825)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_27994 ;
+  GALGAS_lstring var_oil_5F_desc_28441 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_27994, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 815)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_28441, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 828)) ;
   }
-  GALGAS_attributeRange var_range_28151 ;
+  GALGAS_attributeRange var_range_28598 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    GALGAS_bool test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MIN"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 821)) ;
+    GALGAS_bool test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MIN"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 834)) ;
     if (kBoolTrue == test_1.boolEnum ()) {
-      test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MAX"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 821)) ;
+      test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MAX"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 834)) ;
     }
     test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_min_28243 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MIN"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 822)) ;
-      GALGAS_lstring var_max_28300 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MAX"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 823)) ;
-      GALGAS_string var_minSignString_28356 = GALGAS_string::makeEmptyString () ;
-      GALGAS_string var_maxSignString_28387 = GALGAS_string::makeEmptyString () ;
+      GALGAS_lstring var_min_28690 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MIN"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 835)) ;
+      GALGAS_lstring var_max_28747 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("MAX"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 836)) ;
+      GALGAS_string var_minSignString_28803 = GALGAS_string::makeEmptyString () ;
+      GALGAS_string var_maxSignString_28834 = GALGAS_string::makeEmptyString () ;
       enumGalgasBool test_2 = kBoolTrue ;
       if (kBoolTrue == test_2) {
-        test_2 = GALGAS_bool (kIsEqual, var_max_28300.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 827)).objectCompare (GALGAS_string ("INF"))).boolEnum () ;
+        test_2 = GALGAS_bool (kIsEqual, var_max_28747.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 840)).objectCompare (GALGAS_string ("INF"))).boolEnum () ;
         if (kBoolTrue == test_2) {
-          var_max_28300.setter_setString (GALGAS_sint_36__34_::constructor_max (SOURCE_FILE ("arxml_parser.galgas", 828)).getter_string (SOURCE_FILE ("arxml_parser.galgas", 828)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 828)) ;
+          var_max_28747.setter_setString (GALGAS_sint_36__34_::constructor_max (SOURCE_FILE ("arxml_parser.galgas", 841)).getter_string (SOURCE_FILE ("arxml_parser.galgas", 841)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 841)) ;
         }
       }
-      GALGAS_bool var_minSign_28542 ;
+      GALGAS_bool var_minSign_28989 ;
       {
-      routine_arxmlPopSign (var_min_28243, var_minSign_28542, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 831)) ;
+      routine_arxmlPopSign (var_min_28690, var_minSign_28989, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 844)) ;
       }
-      GALGAS_bool var_maxSign_28585 ;
+      GALGAS_bool var_maxSign_29032 ;
       {
-      routine_arxmlPopSign (var_max_28300, var_maxSign_28585, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 832)) ;
+      routine_arxmlPopSign (var_max_28747, var_maxSign_29032, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 845)) ;
       }
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = var_minSign_28542.boolEnum () ;
+        test_3 = var_minSign_28989.boolEnum () ;
         if (kBoolTrue == test_3) {
-          var_minSignString_28356 = GALGAS_string ("-") ;
-          var_type_27685 = GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 837)) ;
+          var_minSignString_28803 = GALGAS_string ("-") ;
+          var_type_28132 = GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 850)) ;
         }
       }
       enumGalgasBool test_4 = kBoolTrue ;
       if (kBoolTrue == test_4) {
-        test_4 = var_maxSign_28585.boolEnum () ;
+        test_4 = var_maxSign_29032.boolEnum () ;
         if (kBoolTrue == test_4) {
-          var_maxSignString_28387 = GALGAS_string ("-") ;
-          var_type_27685 = GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 841)) ;
+          var_maxSignString_28834 = GALGAS_string ("-") ;
+          var_type_28132 = GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 854)) ;
         }
       }
       {
-      routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (var_type_27685, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 843)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 843)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 843)) ;
+      routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (var_type_28132, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 856)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 856)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 856)) ;
       }
       {
-      routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 844)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 844)) ;
+      routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 857)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 857)) ;
       }
-      GALGAS_object_5F_t var_start_28934 ;
-      GALGAS_object_5F_t var_stop_28958 ;
+      GALGAS_object_5F_t var_start_29381 ;
+      GALGAS_object_5F_t var_stop_29405 ;
       enumGalgasBool test_5 = kBoolTrue ;
       if (kBoolTrue == test_5) {
-        GALGAS_bool test_6 = GALGAS_bool (kIsEqual, var_type_27685.objectCompare (GALGAS_dataType::constructor_uint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 849)))) ;
+        GALGAS_bool test_6 = GALGAS_bool (kIsEqual, var_type_28132.objectCompare (GALGAS_dataType::constructor_uint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 862)))) ;
         if (kBoolTrue != test_6.boolEnum ()) {
-          test_6 = GALGAS_bool (kIsEqual, var_type_27685.objectCompare (GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 849)))) ;
+          test_6 = GALGAS_bool (kIsEqual, var_type_28132.objectCompare (GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 862)))) ;
         }
         test_5 = test_6.boolEnum () ;
         if (kBoolTrue == test_5) {
-          GALGAS_luint_36__34_ var_minVal_29060 = GALGAS_luint_36__34_::constructor_new (var_min_28243.readProperty_string ().getter_decimalUnsigned_36__34_Number (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 851)), var_min_28243.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 850)) ;
-          GALGAS_luint_36__34_ var_maxVal_29242 = GALGAS_luint_36__34_::constructor_new (var_max_28300.readProperty_string ().getter_decimalUnsigned_36__34_Number (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 855)), var_max_28300.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 854)) ;
+          GALGAS_luint_36__34_ var_minVal_29507 = GALGAS_luint_36__34_::constructor_new (var_min_28690.readProperty_string ().getter_decimalUnsigned_36__34_Number (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 864)), var_min_28690.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 863)) ;
+          GALGAS_luint_36__34_ var_maxVal_29689 = GALGAS_luint_36__34_::constructor_new (var_max_28747.readProperty_string ().getter_decimalUnsigned_36__34_Number (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 868)), var_max_28747.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 867)) ;
           {
-          routine_displayOil (GALGAS_string ("[").add_operation (var_minSignString_28356, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 858)).add_operation (var_minVal_29060.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 858)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 858)).add_operation (GALGAS_string (" .. "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 858)).add_operation (var_maxSignString_28387, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 859)).add_operation (var_maxVal_29242.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 859)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 859)).add_operation (GALGAS_string ("]"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 859)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 858)) ;
+          routine_displayOil (GALGAS_string ("[").add_operation (var_minSignString_28803, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)).add_operation (var_minVal_29507.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 871)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)).add_operation (GALGAS_string (" .. "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)).add_operation (var_maxSignString_28834, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 872)).add_operation (var_maxVal_29689.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 872)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 872)).add_operation (GALGAS_string ("]"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 872)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)) ;
           }
-          var_start_28934 = function_checkAndGetIntegerNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 860)), var_type_27685, var_minVal_29060, var_minSign_28542, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 860)) ;
-          var_stop_28958 = function_checkAndGetIntegerNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 861)), var_type_27685, var_maxVal_29242, var_maxSign_28585, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 861)) ;
+          var_start_29381 = function_checkAndGetIntegerNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 873)), var_type_28132, var_minVal_29507, var_minSign_28989, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 873)) ;
+          var_stop_29405 = function_checkAndGetIntegerNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 874)), var_type_28132, var_maxVal_29689, var_maxSign_29032, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 874)) ;
         }
       }
       if (kBoolFalse == test_5) {
         enumGalgasBool test_7 = kBoolTrue ;
         if (kBoolTrue == test_7) {
-          test_7 = GALGAS_bool (kIsEqual, var_type_27685.objectCompare (GALGAS_dataType::constructor_floatNumber (SOURCE_FILE ("arxml_parser.galgas", 862)))).boolEnum () ;
+          test_7 = GALGAS_bool (kIsEqual, var_type_28132.objectCompare (GALGAS_dataType::constructor_floatNumber (SOURCE_FILE ("arxml_parser.galgas", 875)))).boolEnum () ;
           if (kBoolTrue == test_7) {
-            GALGAS_ldouble var_minVal_29748 = GALGAS_ldouble::constructor_new (var_min_28243.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 864)), var_min_28243.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 863)) ;
-            GALGAS_ldouble var_maxVal_29919 = GALGAS_ldouble::constructor_new (var_max_28300.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 868)), var_max_28300.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 867)) ;
+            GALGAS_ldouble var_minVal_30195 = GALGAS_ldouble::constructor_new (var_min_28690.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 877)), var_min_28690.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 876)) ;
+            GALGAS_ldouble var_maxVal_30366 = GALGAS_ldouble::constructor_new (var_max_28747.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 881)), var_max_28747.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 880)) ;
             {
-            routine_displayOil (GALGAS_string ("[").add_operation (var_minVal_29748.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 871)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)).add_operation (GALGAS_string (" .. "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)).add_operation (var_maxVal_29919.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 871)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)).add_operation (GALGAS_string ("]"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 871)) ;
+            routine_displayOil (GALGAS_string ("[").add_operation (var_minVal_30195.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 884)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 884)).add_operation (GALGAS_string (" .. "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 884)).add_operation (var_maxVal_30366.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 884)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 884)).add_operation (GALGAS_string ("]"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 884)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 884)) ;
             }
-            var_start_28934 = function_checkAndGetFloatNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 872)), var_type_27685, var_minVal_29748, var_minSign_28542, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 872)) ;
-            var_stop_28958 = function_checkAndGetFloatNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 873)), var_type_27685, var_maxVal_29919, var_maxSign_28585, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 873)) ;
+            var_start_29381 = function_checkAndGetFloatNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 885)), var_type_28132, var_minVal_30195, var_minSign_28989, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 885)) ;
+            var_stop_29405 = function_checkAndGetFloatNumber (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 886)), var_type_28132, var_maxVal_30366, var_maxSign_29032, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 886)) ;
           }
         }
         if (kBoolFalse == test_7) {
           TC_Array <C_FixItDescription> fixItArray8 ;
-          inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 875)), GALGAS_string ("Internal error"), fixItArray8  COMMA_SOURCE_FILE ("arxml_parser.galgas", 875)) ;
-          var_start_28934.drop () ; // Release error dropped variable
-          var_stop_28958.drop () ; // Release error dropped variable
+          inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 888)), GALGAS_string ("Internal error"), fixItArray8  COMMA_SOURCE_FILE ("arxml_parser.galgas", 888)) ;
+          var_start_29381.drop () ; // Release error dropped variable
+          var_stop_29405.drop () ; // Release error dropped variable
         }
       }
-      var_range_28151 = function_buildRange (var_type_27685, var_start_28934, var_stop_28958, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 877)) ;
+      var_range_28598 = function_buildRange (var_type_28132, var_start_29381, var_stop_29405, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 890)) ;
     }
   }
   if (kBoolFalse == test_0) {
     {
-    routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (var_type_27685, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 879)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 879)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 879)) ;
+    routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (var_type_28132, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 892)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 892)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 892)) ;
     }
     {
-    routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 880)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 880)) ;
+    routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 893)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 893)) ;
     }
-    var_range_28151 = GALGAS_noRange::constructor_new (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 881)) ;
+    var_range_28598 = GALGAS_noRange::constructor_new (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 894)) ;
   }
-  GALGAS_object_5F_t var_defaultValue_30590 ;
+  GALGAS_object_5F_t var_defaultValue_31037 ;
   enumGalgasBool test_9 = kBoolTrue ;
   if (kBoolTrue == test_9) {
-    test_9 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 886)).boolEnum () ;
+    test_9 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 899)).boolEnum () ;
     if (kBoolTrue == test_9) {
-      GALGAS_lstring var_value_30666 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 887)) ;
-      GALGAS_bool var_sign_30788 ;
+      GALGAS_lstring var_value_31113 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 900)) ;
+      GALGAS_bool var_sign_31235 ;
       {
-      routine_arxmlPopSign (var_value_30666, var_sign_30788, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 890)) ;
+      routine_arxmlPopSign (var_value_31113, var_sign_31235, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 903)) ;
       }
       enumGalgasBool test_10 = kBoolTrue ;
       if (kBoolTrue == test_10) {
-        GALGAS_bool test_11 = GALGAS_bool (kIsEqual, var_type_27685.objectCompare (GALGAS_dataType::constructor_uint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 893)))) ;
+        GALGAS_bool test_11 = GALGAS_bool (kIsEqual, var_type_28132.objectCompare (GALGAS_dataType::constructor_uint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 906)))) ;
         if (kBoolTrue != test_11.boolEnum ()) {
-          test_11 = GALGAS_bool (kIsEqual, var_type_27685.objectCompare (GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 893)))) ;
+          test_11 = GALGAS_bool (kIsEqual, var_type_28132.objectCompare (GALGAS_dataType::constructor_sint_36__34_Number (SOURCE_FILE ("arxml_parser.galgas", 906)))) ;
         }
         test_10 = test_11.boolEnum () ;
         if (kBoolTrue == test_10) {
-          GALGAS_luint_36__34_ var_integerValue_30962 = GALGAS_luint_36__34_::constructor_new (var_value_30666.readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 895)).getter_uint_36__34_ (SOURCE_FILE ("arxml_parser.galgas", 895)), var_value_30666.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 894)) ;
+          GALGAS_luint_36__34_ var_integerValue_31409 = GALGAS_luint_36__34_::constructor_new (var_value_31113.readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 908)).getter_uint_36__34_ (SOURCE_FILE ("arxml_parser.galgas", 908)), var_value_31113.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 907)) ;
           {
-          routine_displayOil (GALGAS_string (" = ").add_operation (var_integerValue_30962.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 897)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 897)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 897)) ;
+          routine_displayOil (GALGAS_string (" = ").add_operation (var_integerValue_31409.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 910)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 910)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 910)) ;
           }
-          var_defaultValue_30590 = function_checkAndGetIntegerNumber (var_oil_5F_desc_27994, var_type_27685, var_integerValue_30962, var_sign_30788, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 898)) ;
+          var_defaultValue_31037 = function_checkAndGetIntegerNumber (var_oil_5F_desc_28441, var_type_28132, var_integerValue_31409, var_sign_31235, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 911)) ;
         }
       }
       if (kBoolFalse == test_10) {
         enumGalgasBool test_12 = kBoolTrue ;
         if (kBoolTrue == test_12) {
-          test_12 = GALGAS_bool (kIsEqual, var_type_27685.objectCompare (GALGAS_dataType::constructor_floatNumber (SOURCE_FILE ("arxml_parser.galgas", 902)))).boolEnum () ;
+          test_12 = GALGAS_bool (kIsEqual, var_type_28132.objectCompare (GALGAS_dataType::constructor_floatNumber (SOURCE_FILE ("arxml_parser.galgas", 915)))).boolEnum () ;
           if (kBoolTrue == test_12) {
-            GALGAS_ldouble var_floatValue_31443 = GALGAS_ldouble::constructor_new (var_value_30666.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 904)), var_value_30666.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 903)) ;
+            GALGAS_ldouble var_floatValue_31890 = GALGAS_ldouble::constructor_new (var_value_31113.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 917)), var_value_31113.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 916)) ;
             {
-            routine_displayOil (GALGAS_string (" = ").add_operation (var_floatValue_31443.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 906)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 906)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 906)) ;
+            routine_displayOil (GALGAS_string (" = ").add_operation (var_floatValue_31890.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 919)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 919)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 919)) ;
             }
-            var_defaultValue_30590 = function_checkAndGetFloatNumber (var_oil_5F_desc_27994, var_type_27685, var_floatValue_31443, var_sign_30788, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 907)) ;
+            var_defaultValue_31037 = function_checkAndGetFloatNumber (var_oil_5F_desc_28441, var_type_28132, var_floatValue_31890, var_sign_31235, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 920)) ;
           }
         }
         if (kBoolFalse == test_12) {
           TC_Array <C_FixItDescription> fixItArray13 ;
-          inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 912)), GALGAS_string ("Internal error"), fixItArray13  COMMA_SOURCE_FILE ("arxml_parser.galgas", 912)) ;
-          var_defaultValue_30590.drop () ; // Release error dropped variable
+          inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 925)), GALGAS_string ("Internal error"), fixItArray13  COMMA_SOURCE_FILE ("arxml_parser.galgas", 925)) ;
+          var_defaultValue_31037.drop () ; // Release error dropped variable
         }
       }
     }
@@ -912,23 +1016,23 @@ void routine_arxmlImplementationContainerNumber (GALGAS_lstring & outArgument_ob
   if (kBoolFalse == test_9) {
     enumGalgasBool test_14 = kBoolTrue ;
     if (kBoolTrue == test_14) {
-      test_14 = var_withAuto_27905.boolEnum () ;
+      test_14 = var_withAuto_28352.boolEnum () ;
       if (kBoolTrue == test_14) {
-        var_defaultValue_30590 = GALGAS_auto::constructor_new (var_oil_5F_desc_27994, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 915)) ;
+        var_defaultValue_31037 = GALGAS_auto::constructor_new (var_oil_5F_desc_28441, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 928)) ;
       }
     }
     if (kBoolFalse == test_14) {
-      var_defaultValue_30590 = GALGAS_void::constructor_new (var_oil_5F_desc_27994, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 917)) ;
+      var_defaultValue_31037 = GALGAS_void::constructor_new (var_oil_5F_desc_28441, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 930)) ;
     }
   }
   {
-  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_27994.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 919)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 919)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 919)) ;
+  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_28441.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 932)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 932)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 932)) ;
   }
-  GALGAS_locationList temp_15 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 922)) ;
-  temp_15.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 922)) ;
-  GALGAS_lstringlist temp_16 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 926)) ;
-  temp_16.addAssign_operation (var_oil_5F_desc_27994  COMMA_SOURCE_FILE ("arxml_parser.galgas", 926)) ;
-  outArgument_options = GALGAS_impRangedType::constructor_new (temp_15, var_type_27685, outArgument_objectName, var_multiple_27839.readProperty_bool (), temp_16, var_withAuto_27905, var_defaultValue_30590, var_range_28151  COMMA_SOURCE_FILE ("arxml_parser.galgas", 922)) ;
+  GALGAS_locationList temp_15 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 935)) ;
+  temp_15.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 935)) ;
+  GALGAS_lstringlist temp_16 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 939)) ;
+  temp_16.addAssign_operation (var_oil_5F_desc_28441  COMMA_SOURCE_FILE ("arxml_parser.galgas", 939)) ;
+  outArgument_options = GALGAS_impRangedType::constructor_new (temp_15, var_type_28132, outArgument_objectName, var_multiple_28286.readProperty_bool (), temp_16, var_withAuto_28352, var_defaultValue_31037, var_range_28598  COMMA_SOURCE_FILE ("arxml_parser.galgas", 935)) ;
 }
 
 
@@ -948,58 +1052,58 @@ void routine_arxmlImplementationContainerString (GALGAS_lstring & outArgument_ob
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 939)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 939)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 939)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 952)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 952)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 952)) ;
   }
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 942)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 955)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 943)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 943)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 956)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 956)) ;
   }
-  GALGAS_lbool var_multiple_32874 ;
+  GALGAS_lbool var_multiple_33321 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_32874, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 946)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_33321, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 959)) ;
   }
-  GALGAS_bool var_withAuto_32940 ;
+  GALGAS_bool var_withAuto_33387 ;
   {
-  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_32940, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 949)) ;
+  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_33387, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 962)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_33029 ;
+  GALGAS_lstring var_oil_5F_desc_33476 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_33029, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 952)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_33476, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 965)) ;
   }
-  GALGAS_object_5F_t var_defaultValue_33075 ;
+  GALGAS_object_5F_t var_defaultValue_33522 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 957)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 970)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_value_33155 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 958)) ;
+      GALGAS_lstring var_value_33602 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 971)) ;
       {
-      routine_displayOil (GALGAS_string (" = \"").add_operation (var_value_33155.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 959)).add_operation (GALGAS_string ("\""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 959)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 959)) ;
+      routine_displayOil (GALGAS_string (" = \"").add_operation (var_value_33602.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 972)).add_operation (GALGAS_string ("\""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 972)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 972)) ;
       }
-      var_defaultValue_33075 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_33029, var_value_33155.readProperty_location (), var_value_33155.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 960)) ;
+      var_defaultValue_33522 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_33476, var_value_33602.readProperty_location (), var_value_33602.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 973)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = var_withAuto_32940.boolEnum () ;
+      test_1 = var_withAuto_33387.boolEnum () ;
       if (kBoolTrue == test_1) {
-        var_defaultValue_33075 = GALGAS_auto::constructor_new (var_oil_5F_desc_33029, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 966)) ;
+        var_defaultValue_33522 = GALGAS_auto::constructor_new (var_oil_5F_desc_33476, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 979)) ;
       }
     }
     if (kBoolFalse == test_1) {
-      var_defaultValue_33075 = GALGAS_void::constructor_new (var_oil_5F_desc_33029, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 968)) ;
+      var_defaultValue_33522 = GALGAS_void::constructor_new (var_oil_5F_desc_33476, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 981)) ;
     }
   }
   {
-  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_33029.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 970)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 970)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 970)) ;
+  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_33476.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 983)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 983)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 983)) ;
   }
-  GALGAS_locationList temp_2 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 974)) ;
-  temp_2.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 974)) ;
-  GALGAS_lstringlist temp_3 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 978)) ;
-  temp_3.addAssign_operation (var_oil_5F_desc_33029  COMMA_SOURCE_FILE ("arxml_parser.galgas", 978)) ;
-  outArgument_options = GALGAS_impAutoDefaultType::constructor_new (temp_2, constinArgument_type, outArgument_objectName, var_multiple_32874.readProperty_bool (), temp_3, var_withAuto_32940, var_defaultValue_33075  COMMA_SOURCE_FILE ("arxml_parser.galgas", 973)) ;
+  GALGAS_locationList temp_2 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 987)) ;
+  temp_2.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 987)) ;
+  GALGAS_lstringlist temp_3 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 991)) ;
+  temp_3.addAssign_operation (var_oil_5F_desc_33476  COMMA_SOURCE_FILE ("arxml_parser.galgas", 991)) ;
+  outArgument_options = GALGAS_impAutoDefaultType::constructor_new (temp_2, constinArgument_type, outArgument_objectName, var_multiple_33321.readProperty_bool (), temp_3, var_withAuto_33387, var_defaultValue_33522  COMMA_SOURCE_FILE ("arxml_parser.galgas", 986)) ;
 }
 
 
@@ -1019,106 +1123,106 @@ void routine_arxmlImplementationContainerBoolean (GALGAS_lstring & outArgument_o
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 991)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 991)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 991)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1004)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1004)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1004)) ;
   }
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 994)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1007)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 995)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 995)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1008)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1008)) ;
   }
-  GALGAS_bool var_withAuto_34510 ;
+  GALGAS_bool var_withAuto_34957 ;
   {
-  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_34510, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 998)) ;
+  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_34957, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1011)) ;
   }
-  GALGAS_lbool var_multiple_34604 ;
+  GALGAS_lbool var_multiple_35051 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_34604, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1001)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_35051, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1014)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_34693 ;
+  GALGAS_lstring var_oil_5F_desc_35140 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_34693, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1004)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_35140, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1017)) ;
   }
-  GALGAS_object_5F_t var_defaultValue_34738 ;
+  GALGAS_object_5F_t var_defaultValue_35185 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1008)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1021)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_value_34818 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1009)) ;
-      GALGAS_bool var_booleanValue_34888 ;
+      GALGAS_lstring var_value_35265 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1022)) ;
+      GALGAS_bool var_booleanValue_35335 ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        GALGAS_bool test_2 = GALGAS_bool (kIsEqual, var_value_34818.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1011)).objectCompare (GALGAS_string ("TRUE"))) ;
+        GALGAS_bool test_2 = GALGAS_bool (kIsEqual, var_value_35265.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1024)).objectCompare (GALGAS_string ("TRUE"))) ;
         if (kBoolTrue != test_2.boolEnum ()) {
-          test_2 = GALGAS_bool (kIsEqual, var_value_34818.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
+          test_2 = GALGAS_bool (kIsEqual, var_value_35265.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
         }
         test_1 = test_2.boolEnum () ;
         if (kBoolTrue == test_1) {
-          var_booleanValue_34888 = GALGAS_bool (true) ;
+          var_booleanValue_35335 = GALGAS_bool (true) ;
         }
       }
       if (kBoolFalse == test_1) {
         enumGalgasBool test_3 = kBoolTrue ;
         if (kBoolTrue == test_3) {
-          GALGAS_bool test_4 = GALGAS_bool (kIsEqual, var_value_34818.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1014)).objectCompare (GALGAS_string ("FALSE"))) ;
+          GALGAS_bool test_4 = GALGAS_bool (kIsEqual, var_value_35265.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1027)).objectCompare (GALGAS_string ("FALSE"))) ;
           if (kBoolTrue != test_4.boolEnum ()) {
-            test_4 = GALGAS_bool (kIsEqual, var_value_34818.readProperty_string ().objectCompare (GALGAS_string ("0"))) ;
+            test_4 = GALGAS_bool (kIsEqual, var_value_35265.readProperty_string ().objectCompare (GALGAS_string ("0"))) ;
           }
           test_3 = test_4.boolEnum () ;
           if (kBoolTrue == test_3) {
-            var_booleanValue_34888 = GALGAS_bool (false) ;
+            var_booleanValue_35335 = GALGAS_bool (false) ;
           }
         }
         if (kBoolFalse == test_3) {
-          var_booleanValue_34888 = GALGAS_bool (false) ;
+          var_booleanValue_35335 = GALGAS_bool (false) ;
           TC_Array <C_FixItDescription> fixItArray5 ;
-          inCompiler->emitSemanticError (var_value_34818.readProperty_location (), GALGAS_string ("A Boolean must be 'true', 'false', '0' or '1'"), fixItArray5  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1019)) ;
+          inCompiler->emitSemanticError (var_value_35265.readProperty_location (), GALGAS_string ("A Boolean must be 'true', 'false', '0' or '1'"), fixItArray5  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1032)) ;
         }
       }
       {
-      routine_displayOil (GALGAS_string (" = ").add_operation (var_booleanValue_34888.getter_cString (SOURCE_FILE ("arxml_parser.galgas", 1021)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1021)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1021)) ;
+      routine_displayOil (GALGAS_string (" = ").add_operation (var_booleanValue_35335.getter_cString (SOURCE_FILE ("arxml_parser.galgas", 1034)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1034)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1034)) ;
       }
-      var_defaultValue_34738 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_34693, var_value_34818.readProperty_location (), var_booleanValue_34888, GALGAS_objectAttributes::constructor_new (GALGAS_identifierMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1028))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1026))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1022)) ;
+      var_defaultValue_35185 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_35140, var_value_35265.readProperty_location (), var_booleanValue_35335, GALGAS_objectAttributes::constructor_new (GALGAS_identifierMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1041))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1039))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1035)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_6 = kBoolTrue ;
     if (kBoolTrue == test_6) {
-      test_6 = var_withAuto_34510.boolEnum () ;
+      test_6 = var_withAuto_34957.boolEnum () ;
       if (kBoolTrue == test_6) {
-        var_defaultValue_34738 = GALGAS_auto::constructor_new (var_oil_5F_desc_34693, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1032)) ;
+        var_defaultValue_35185 = GALGAS_auto::constructor_new (var_oil_5F_desc_35140, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1045)) ;
       }
     }
     if (kBoolFalse == test_6) {
-      var_defaultValue_34738 = GALGAS_void::constructor_new (var_oil_5F_desc_34693, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1034)) ;
+      var_defaultValue_35185 = GALGAS_void::constructor_new (var_oil_5F_desc_35140, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1047)) ;
     }
   }
-  GALGAS_implementationObjectMap var_structAttributes_36004 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1040)) ;
+  GALGAS_implementationObjectMap var_structAttributes_36451 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1053)) ;
   enumGalgasBool test_7 = kBoolTrue ;
   if (kBoolTrue == test_7) {
-    test_7 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("SUB-CONTAINERS"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1041)).boolEnum () ;
+    test_7 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("SUB-CONTAINERS"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1054)).boolEnum () ;
     if (kBoolTrue == test_7) {
       {
-      routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1042)) ;
+      routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1055)) ;
       }
       {
-      routine_arxmlImplementationContainer (var_structAttributes_36004, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1043)) ;
+      routine_arxmlImplementationContainer (var_structAttributes_36451, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1056)) ;
       }
       {
-      routine_displayOil (GALGAS_string ("\n    } : \"").add_operation (var_oil_5F_desc_34693.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1044)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1044)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1044)) ;
+      routine_displayOil (GALGAS_string ("\n    } : \"").add_operation (var_oil_5F_desc_35140.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1057)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1057)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1057)) ;
       }
     }
   }
   if (kBoolFalse == test_7) {
     {
-    routine_displayOil (GALGAS_string (" : \"").add_operation (var_oil_5F_desc_34693.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1046)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1046)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1046)) ;
+    routine_displayOil (GALGAS_string (" : \"").add_operation (var_oil_5F_desc_35140.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1059)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1059)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1059)) ;
     }
   }
-  GALGAS_locationList temp_8 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1051)) ;
-  temp_8.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1051)) ;
-  GALGAS_lstringlist temp_9 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1055)) ;
-  temp_9.addAssign_operation (var_oil_5F_desc_34693  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1055)) ;
-  outArgument_options = GALGAS_impBoolType::constructor_new (temp_8, constinArgument_type, outArgument_objectName, var_multiple_34604.readProperty_bool (), temp_9, var_withAuto_34510, var_defaultValue_34738, var_structAttributes_36004, var_structAttributes_36004  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1050)) ;
+  GALGAS_locationList temp_8 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1064)) ;
+  temp_8.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1064)) ;
+  GALGAS_lstringlist temp_9 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1068)) ;
+  temp_9.addAssign_operation (var_oil_5F_desc_35140  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1068)) ;
+  outArgument_options = GALGAS_impBoolType::constructor_new (temp_8, constinArgument_type, outArgument_objectName, var_multiple_35051.readProperty_bool (), temp_9, var_withAuto_34957, var_defaultValue_35185, var_structAttributes_36451, var_structAttributes_36451  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1063)) ;
 }
 
 
@@ -1138,83 +1242,83 @@ void routine_arxmlImplementationContainerEnumeration (GALGAS_lstring & outArgume
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1070)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1070)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1070)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1083)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1083)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1083)) ;
   }
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1073)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1086)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1074)).add_operation (GALGAS_string ("["), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1074)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1074)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1087)).add_operation (GALGAS_string ("["), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1087)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1087)) ;
   }
-  GALGAS_bool var_withAuto_37173 ;
+  GALGAS_bool var_withAuto_37620 ;
   {
-  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_37173, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1077)) ;
+  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_37620, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1090)) ;
   }
-  GALGAS_lbool var_multiple_37267 ;
+  GALGAS_lbool var_multiple_37714 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_37267, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1080)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_37714, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1093)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_37356 ;
+  GALGAS_lstring var_oil_5F_desc_37803 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_37356, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1083)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_37803, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1096)) ;
   }
-  GALGAS_enumValues var_enumValues_37446 = GALGAS_enumValues::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1087)) ;
-  GALGAS_arxmlElementValueList var_enumElementValues_37507 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1088)) ;
-  GALGAS_stringlist var_enumElementValuesPath_37544 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1089)) ;
-  var_enumElementValuesPath_37544.addAssign_operation (GALGAS_string ("LITERALS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1090)) ;
-  var_enumElementValuesPath_37544.addAssign_operation (GALGAS_string ("ECUC-ENUMERATION-LITERAL-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1091)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_parameter.ptr (), var_enumElementValuesPath_37544, var_enumElementValues_37507, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1092)) ;
-  cEnumerator_arxmlElementValueList enumerator_37770 (var_enumElementValues_37507, kENUMERATION_UP) ;
-  while (enumerator_37770.hasCurrentObject ()) {
-    GALGAS_lstring var_enumValueName_37822 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) enumerator_37770.current_value (HERE).ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1094)) ;
+  GALGAS_enumValues var_enumValues_37893 = GALGAS_enumValues::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1100)) ;
+  GALGAS_arxmlElementValueList var_enumElementValues_37954 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1101)) ;
+  GALGAS_stringlist var_enumElementValuesPath_37991 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1102)) ;
+  var_enumElementValuesPath_37991.addAssign_operation (GALGAS_string ("LITERALS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1103)) ;
+  var_enumElementValuesPath_37991.addAssign_operation (GALGAS_string ("ECUC-ENUMERATION-LITERAL-DEF")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1104)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_parameter.ptr (), var_enumElementValuesPath_37991, var_enumElementValues_37954, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1105)) ;
+  cEnumerator_arxmlElementValueList enumerator_38217 (var_enumElementValues_37954, kENUMERATION_UP) ;
+  while (enumerator_38217.hasCurrentObject ()) {
+    GALGAS_lstring var_enumValueName_38269 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) enumerator_38217.current_value (HERE).ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1107)) ;
     {
-    var_enumValues_37446.setter_put (var_enumValueName_37822, GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1095)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1095)) ;
+    var_enumValues_37893.setter_put (var_enumValueName_38269, GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1108)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1108)) ;
     }
     {
-    routine_displayOil (var_enumValueName_37822.readProperty_string (), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1096)) ;
+    routine_displayOil (var_enumValueName_38269.readProperty_string (), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1109)) ;
     }
-    if (enumerator_37770.hasNextObject ()) {
+    if (enumerator_38217.hasNextObject ()) {
       {
-      routine_displayOil (GALGAS_string (", "), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1098)) ;
+      routine_displayOil (GALGAS_string (", "), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1111)) ;
       }
     }
-    enumerator_37770.gotoNextObject () ;
+    enumerator_38217.gotoNextObject () ;
   }
   {
-  routine_displayOil (GALGAS_string ("]"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1100)) ;
+  routine_displayOil (GALGAS_string ("]"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1113)) ;
   }
-  GALGAS_object_5F_t var_defaultValue_38090 ;
+  GALGAS_object_5F_t var_defaultValue_38537 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1104)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1117)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_value_38170 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1105)) ;
+      GALGAS_lstring var_value_38617 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1118)) ;
       {
-      routine_displayOil (GALGAS_string (" = ").add_operation (var_value_38170.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1106)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1106)) ;
+      routine_displayOil (GALGAS_string (" = ").add_operation (var_value_38617.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1119)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1119)) ;
       }
-      var_defaultValue_38090 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_37356, var_value_38170.readProperty_location (), var_value_38170.readProperty_string (), GALGAS_objectAttributes::constructor_new (GALGAS_identifierMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1113))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1111))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1107)) ;
+      var_defaultValue_38537 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_37803, var_value_38617.readProperty_location (), var_value_38617.readProperty_string (), GALGAS_objectAttributes::constructor_new (GALGAS_identifierMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1126))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1124))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1120)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = var_withAuto_37173.boolEnum () ;
+      test_1 = var_withAuto_37620.boolEnum () ;
       if (kBoolTrue == test_1) {
-        var_defaultValue_38090 = GALGAS_auto::constructor_new (var_oil_5F_desc_37356, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1117)) ;
+        var_defaultValue_38537 = GALGAS_auto::constructor_new (var_oil_5F_desc_37803, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1130)) ;
       }
     }
     if (kBoolFalse == test_1) {
-      var_defaultValue_38090 = GALGAS_void::constructor_new (var_oil_5F_desc_37356, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1119)) ;
+      var_defaultValue_38537 = GALGAS_void::constructor_new (var_oil_5F_desc_37803, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1132)) ;
     }
   }
   {
-  routine_displayOil (GALGAS_string ("\n : \"").add_operation (var_oil_5F_desc_37356.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1122)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1122)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1122)) ;
+  routine_displayOil (GALGAS_string ("\n : \"").add_operation (var_oil_5F_desc_37803.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1135)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1135)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1135)) ;
   }
-  GALGAS_locationList temp_2 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1126)) ;
-  temp_2.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1126)) ;
-  GALGAS_lstringlist temp_3 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1130)) ;
-  temp_3.addAssign_operation (var_oil_5F_desc_37356  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1130)) ;
-  outArgument_options = GALGAS_impEnumType::constructor_new (temp_2, constinArgument_type, outArgument_objectName, var_multiple_37267.readProperty_bool (), temp_3, var_withAuto_37173, var_defaultValue_38090, var_enumValues_37446  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1125)) ;
+  GALGAS_locationList temp_2 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1139)) ;
+  temp_2.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1139)) ;
+  GALGAS_lstringlist temp_3 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1143)) ;
+  temp_3.addAssign_operation (var_oil_5F_desc_37803  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1143)) ;
+  outArgument_options = GALGAS_impEnumType::constructor_new (temp_2, constinArgument_type, outArgument_objectName, var_multiple_37714.readProperty_bool (), temp_3, var_withAuto_37620, var_defaultValue_38537, var_enumValues_37893  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1138)) ;
 }
 
 
@@ -1234,37 +1338,37 @@ void routine_arxmlImplementationContainerStructure (GALGAS_lstring & outArgument
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1145)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1145)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1145)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1158)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1158)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1158)) ;
   }
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1148)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1161)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1149)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1149)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1162)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1162)) ;
   }
-  GALGAS_lbool var_multiple_39724 ;
+  GALGAS_lbool var_multiple_40171 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_39724, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1152)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_40171, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1165)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_39813 ;
+  GALGAS_lstring var_oil_5F_desc_40260 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_39813, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1155)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_40260, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1168)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1157)) ;
+  routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1170)) ;
   }
-  GALGAS_implementationObjectMap var_structAttributes_39880 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1160)) ;
+  GALGAS_implementationObjectMap var_structAttributes_40327 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1173)) ;
   {
-  routine_arxmlImplementationContainer (var_structAttributes_39880, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1161)) ;
+  routine_arxmlImplementationContainer (var_structAttributes_40327, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1174)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("\n    } : \"").add_operation (var_oil_5F_desc_39813.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1163)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1163)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1163)) ;
+  routine_displayOil (GALGAS_string ("\n    } : \"").add_operation (var_oil_5F_desc_40260.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1176)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1176)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1176)) ;
   }
-  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1167)) ;
-  temp_0.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1167)) ;
-  GALGAS_lstringlist temp_1 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1171)) ;
-  temp_1.addAssign_operation (var_oil_5F_desc_39813  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1171)) ;
-  outArgument_options = GALGAS_impStructType::constructor_new (temp_0, constinArgument_type, outArgument_objectName, var_multiple_39724.readProperty_bool (), temp_1, var_structAttributes_39880  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1166)) ;
+  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1180)) ;
+  temp_0.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1180)) ;
+  GALGAS_lstringlist temp_1 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1184)) ;
+  temp_1.addAssign_operation (var_oil_5F_desc_40260  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1184)) ;
+  outArgument_options = GALGAS_impStructType::constructor_new (temp_0, constinArgument_type, outArgument_objectName, var_multiple_40171.readProperty_bool (), temp_1, var_structAttributes_40327  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1179)) ;
 }
 
 
@@ -1284,58 +1388,58 @@ void routine_arxmlImplementationContainerIdentifier (GALGAS_lstring & outArgumen
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1183)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1183)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1183)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (extensionGetter_oilType (constinArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1196)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1196)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1196)) ;
   }
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1186)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1199)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1187)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1187)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1200)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1200)) ;
   }
-  GALGAS_lbool var_multiple_40815 ;
+  GALGAS_lbool var_multiple_41262 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_40815, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1190)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_41262, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1203)) ;
   }
-  GALGAS_bool var_withAuto_40881 ;
+  GALGAS_bool var_withAuto_41328 ;
   {
-  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_40881, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1193)) ;
+  routine_arxmlGetWithAuto (inArgument_parameter, var_withAuto_41328, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1206)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_40970 ;
+  GALGAS_lstring var_oil_5F_desc_41417 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_40970, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1196)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_41417, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1209)) ;
   }
-  GALGAS_object_5F_t var_defaultValue_41015 ;
+  GALGAS_object_5F_t var_defaultValue_41462 ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1200)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1213)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_value_41095 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1201)) ;
+      GALGAS_lstring var_value_41542 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFAULT-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1214)) ;
       {
-      routine_displayOil (GALGAS_string (" = ").add_operation (var_value_41095.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1202)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1202)) ;
+      routine_displayOil (GALGAS_string (" = ").add_operation (var_value_41542.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1215)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1215)) ;
       }
-      var_defaultValue_41015 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_40970, var_value_41095.readProperty_location (), var_value_41095.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1203)) ;
+      var_defaultValue_41462 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_41417, var_value_41542.readProperty_location (), var_value_41542.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1216)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = var_withAuto_40881.boolEnum () ;
+      test_1 = var_withAuto_41328.boolEnum () ;
       if (kBoolTrue == test_1) {
-        var_defaultValue_41015 = GALGAS_auto::constructor_new (var_oil_5F_desc_40970, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1209)) ;
+        var_defaultValue_41462 = GALGAS_auto::constructor_new (var_oil_5F_desc_41417, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1222)) ;
       }
     }
     if (kBoolFalse == test_1) {
-      var_defaultValue_41015 = GALGAS_void::constructor_new (var_oil_5F_desc_40970, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1211)) ;
+      var_defaultValue_41462 = GALGAS_void::constructor_new (var_oil_5F_desc_41417, outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1224)) ;
     }
   }
   {
-  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_40970.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1213)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1213)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1213)) ;
+  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_41417.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1226)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1226)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1226)) ;
   }
-  GALGAS_locationList temp_2 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1217)) ;
-  temp_2.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1217)) ;
-  GALGAS_lstringlist temp_3 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1221)) ;
-  temp_3.addAssign_operation (var_oil_5F_desc_40970  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1221)) ;
-  outArgument_options = GALGAS_impAutoDefaultType::constructor_new (temp_2, constinArgument_type, outArgument_objectName, var_multiple_40815.readProperty_bool (), temp_3, var_withAuto_40881, var_defaultValue_41015  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1216)) ;
+  GALGAS_locationList temp_2 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1230)) ;
+  temp_2.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1230)) ;
+  GALGAS_lstringlist temp_3 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1234)) ;
+  temp_3.addAssign_operation (var_oil_5F_desc_41417  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1234)) ;
+  outArgument_options = GALGAS_impAutoDefaultType::constructor_new (temp_2, constinArgument_type, outArgument_objectName, var_multiple_41262.readProperty_bool (), temp_3, var_withAuto_41328, var_defaultValue_41462  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1229)) ;
 }
 
 
@@ -1354,33 +1458,33 @@ void routine_arxmlImplementationContainerReference (GALGAS_lstring & outArgument
                                                     COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_objectName.drop () ; // Release 'out' argument
   outArgument_options.drop () ; // Release 'out' argument
-  GALGAS_lstring var_objectType_42284 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DESTINATION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1235)) ;
-  var_objectType_42284.setter_setString (var_objectType_42284.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1237)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1237)) ;
+  GALGAS_lstring var_objectType_42731 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DESTINATION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1248)) ;
+  var_objectType_42731.setter_setString (var_objectType_42731.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1250)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1250)) ;
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (var_objectType_42284.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1238)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1238)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (var_objectType_42731.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1251)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1251)) ;
   }
   {
-  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1241)) ;
+  routine_arxmlGetName (inArgument_parameter, outArgument_objectName, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1254)) ;
   }
   {
-  routine_displayOil (GALGAS_string (" ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1242)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1242)) ;
+  routine_displayOil (GALGAS_string (" ").add_operation (outArgument_objectName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1255)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1255)) ;
   }
-  GALGAS_lbool var_multiple_42708 ;
+  GALGAS_lbool var_multiple_43155 ;
   {
-  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_42708, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1245)) ;
+  routine_arxmlGetMultiplicity (inArgument_parameter, outArgument_objectName, var_multiple_43155, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1258)) ;
   }
-  GALGAS_lstring var_oil_5F_desc_42797 ;
+  GALGAS_lstring var_oil_5F_desc_43244 ;
   {
-  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_42797, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1248)) ;
+  routine_arxmlGetDescription (inArgument_parameter, var_oil_5F_desc_43244, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1261)) ;
   }
   {
-  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_42797.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1250)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1250)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1250)) ;
+  routine_displayOil (GALGAS_string (": \"").add_operation (var_oil_5F_desc_43244.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1263)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1263)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1263)) ;
   }
-  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1254)) ;
-  temp_0.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1254)) ;
-  GALGAS_lstringlist temp_1 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1258)) ;
-  temp_1.addAssign_operation (var_oil_5F_desc_42797  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1258)) ;
-  outArgument_options = GALGAS_refType::constructor_new (temp_0, constinArgument_type, outArgument_objectName, var_multiple_42708.readProperty_bool (), temp_1, var_objectType_42284  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1253)) ;
+  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1267)) ;
+  temp_0.addAssign_operation (outArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1267)) ;
+  GALGAS_lstringlist temp_1 = GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1271)) ;
+  temp_1.addAssign_operation (var_oil_5F_desc_43244  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1271)) ;
+  outArgument_options = GALGAS_refType::constructor_new (temp_0, constinArgument_type, outArgument_objectName, var_multiple_43155.readProperty_bool (), temp_1, var_objectType_42731  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1266)) ;
 }
 
 
@@ -1396,31 +1500,31 @@ void routine_arxmlDefinitionPackage (GALGAS_implementation & ioArgument_imp,
                                      GALGAS_lstring inArgument_parentPath,
                                      C_Compiler * inCompiler
                                      COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_packageName_43450 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1274)) ;
-  GALGAS_lstring var_currentPath_43563 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1277)).add_operation (var_packageName_43450.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1277)), var_packageName_43450.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1277)) ;
-  GALGAS_arxmlElementValueList var_definitions_43790 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1281)) ;
-  GALGAS_stringlist var_definitionPath_43821 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1282)) ;
-  var_definitionPath_43821.addAssign_operation (GALGAS_string ("ELEMENTS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1283)) ;
-  var_definitionPath_43821.addAssign_operation (GALGAS_string ("ECUC-MODULE-CONFIGURATION-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1284)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_definitionPath_43821, var_definitions_43790, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1285)) ;
-  cEnumerator_arxmlElementValueList enumerator_44021 (var_definitions_43790, kENUMERATION_UP) ;
-  while (enumerator_44021.hasCurrentObject ()) {
+  GALGAS_lstring var_packageName_43897 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1287)) ;
+  GALGAS_lstring var_currentPath_44010 = GALGAS_lstring::constructor_new (inArgument_parentPath.readProperty_string ().add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1290)).add_operation (var_packageName_43897.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1290)), var_packageName_43897.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1290)) ;
+  GALGAS_arxmlElementValueList var_definitions_44237 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1294)) ;
+  GALGAS_stringlist var_definitionPath_44268 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1295)) ;
+  var_definitionPath_44268.addAssign_operation (GALGAS_string ("ELEMENTS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1296)) ;
+  var_definitionPath_44268.addAssign_operation (GALGAS_string ("ECUC-MODULE-CONFIGURATION-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1297)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_definitionPath_44268, var_definitions_44237, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1298)) ;
+  cEnumerator_arxmlElementValueList enumerator_44468 (var_definitions_44237, kENUMERATION_UP) ;
+  while (enumerator_44468.hasCurrentObject ()) {
     {
-    routine_arxmlDefinitionRoot (ioArgument_imp, ioArgument_application, enumerator_44021.current_value (HERE), var_currentPath_43563, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1287)) ;
+    routine_arxmlDefinitionRoot (ioArgument_imp, ioArgument_application, enumerator_44468.current_value (HERE), var_currentPath_44010, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1300)) ;
     }
-    enumerator_44021.gotoNextObject () ;
+    enumerator_44468.gotoNextObject () ;
   }
-  GALGAS_arxmlElementValueList var_packages_44207 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1291)) ;
-  GALGAS_stringlist var_packagesPath_44235 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1292)) ;
-  var_packagesPath_44235.addAssign_operation (GALGAS_string ("AR-PACKAGES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1293)) ;
-  var_packagesPath_44235.addAssign_operation (GALGAS_string ("AR-PACKAGE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1294)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_packagesPath_44235, var_packages_44207, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1295)) ;
-  cEnumerator_arxmlElementValueList enumerator_44405 (var_packages_44207, kENUMERATION_UP) ;
-  while (enumerator_44405.hasCurrentObject ()) {
+  GALGAS_arxmlElementValueList var_packages_44654 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1304)) ;
+  GALGAS_stringlist var_packagesPath_44682 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1305)) ;
+  var_packagesPath_44682.addAssign_operation (GALGAS_string ("AR-PACKAGES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1306)) ;
+  var_packagesPath_44682.addAssign_operation (GALGAS_string ("AR-PACKAGE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1307)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_packagesPath_44682, var_packages_44654, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1308)) ;
+  cEnumerator_arxmlElementValueList enumerator_44852 (var_packages_44654, kENUMERATION_UP) ;
+  while (enumerator_44852.hasCurrentObject ()) {
     {
-    routine_arxmlDefinitionPackage (ioArgument_imp, ioArgument_application, enumerator_44405.current_value (HERE), var_currentPath_43563, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1297)) ;
+    routine_arxmlDefinitionPackage (ioArgument_imp, ioArgument_application, enumerator_44852.current_value (HERE), var_currentPath_44010, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1310)) ;
     }
-    enumerator_44405.gotoNextObject () ;
+    enumerator_44852.gotoNextObject () ;
   }
 }
 
@@ -1437,36 +1541,36 @@ void routine_arxmlDefinitionRoot (GALGAS_implementation & ioArgument_imp,
                                   GALGAS_lstring /* inArgument_parentPath */,
                                   C_Compiler * inCompiler
                                   COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_cpuName_44697 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1308)) ;
-  GALGAS_lstring var_currentPath_44807 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("DEFINITION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1311)) ;
-  GALGAS_objectsMap var_objects_44926 = ioArgument_application.readProperty_objects () ;
-  GALGAS_lstring var_oil_5F_desc_45042 ;
+  GALGAS_lstring var_cpuName_45144 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1321)) ;
+  GALGAS_lstring var_currentPath_45254 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("DEFINITION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1324)) ;
+  GALGAS_objectsMap var_objects_45373 = ioArgument_application.readProperty_objects () ;
+  GALGAS_lstring var_oil_5F_desc_45489 ;
   {
-  routine_arxmlGetDescription (inArgument_packageElement, var_oil_5F_desc_45042, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1317)) ;
+  routine_arxmlGetDescription (inArgument_packageElement, var_oil_5F_desc_45489, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1330)) ;
   }
-  GALGAS_arxmlElementValueList var_subDefs_45105 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1320)) ;
-  GALGAS_stringlist var_subDefsPath_45132 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1321)) ;
-  var_subDefsPath_45132.addAssign_operation (GALGAS_string ("CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1322)) ;
-  var_subDefsPath_45132.addAssign_operation (GALGAS_string ("ECUC-CONTAINER-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1323)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_subDefsPath_45132, var_subDefs_45105, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1324)) ;
+  GALGAS_arxmlElementValueList var_subDefs_45552 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1333)) ;
+  GALGAS_stringlist var_subDefsPath_45579 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1334)) ;
+  var_subDefsPath_45579.addAssign_operation (GALGAS_string ("CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1335)) ;
+  var_subDefsPath_45579.addAssign_operation (GALGAS_string ("ECUC-CONTAINER-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1336)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), var_subDefsPath_45579, var_subDefs_45552, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1337)) ;
   {
-  routine_displayOil (GALGAS_string ("\nCPU ").add_operation (var_cpuName_44697.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1326)).add_operation (GALGAS_string ("\n{\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1326)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1326)) ;
+  routine_displayOil (GALGAS_string ("\nCPU ").add_operation (var_cpuName_45144.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1339)).add_operation (GALGAS_string ("\n{\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1339)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1339)) ;
   }
-  cEnumerator_arxmlElementValueList enumerator_45352 (var_subDefs_45105, kENUMERATION_UP) ;
-  while (enumerator_45352.hasCurrentObject ()) {
+  cEnumerator_arxmlElementValueList enumerator_45799 (var_subDefs_45552, kENUMERATION_UP) ;
+  while (enumerator_45799.hasCurrentObject ()) {
     {
-    routine_arxmlDefinitionObject (ioArgument_imp, var_objects_44926, enumerator_45352.current_value (HERE), var_currentPath_44807, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1329)) ;
+    routine_arxmlDefinitionObject (ioArgument_imp, var_objects_45373, enumerator_45799.current_value (HERE), var_currentPath_45254, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1342)) ;
     }
-    enumerator_45352.gotoNextObject () ;
+    enumerator_45799.gotoNextObject () ;
   }
   {
-  ioArgument_application.setter_setName (var_cpuName_44697 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1333)) ;
+  ioArgument_application.setter_setName (var_cpuName_45144 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1346)) ;
   }
   {
-  ioArgument_application.setter_setObjects (var_objects_44926 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1334)) ;
+  ioArgument_application.setter_setObjects (var_objects_45373 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1347)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("}; /* END CPU ").add_operation (var_cpuName_44697.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1336)).add_operation (GALGAS_string (" : \""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1336)).add_operation (var_oil_5F_desc_45042.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1337)).add_operation (GALGAS_string ("\" */\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1337)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1336)) ;
+  routine_displayOil (GALGAS_string ("}; /* END CPU ").add_operation (var_cpuName_45144.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1349)).add_operation (GALGAS_string (" : \""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1349)).add_operation (var_oil_5F_desc_45489.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1350)).add_operation (GALGAS_string ("\" */\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1350)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1349)) ;
   }
 }
 
@@ -1483,75 +1587,75 @@ void routine_arxmlDefinitionObject (GALGAS_implementation & ioArgument_imp,
                                     GALGAS_lstring inArgument_parentPath,
                                     C_Compiler * inCompiler
                                     COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_lstring var_currentPath_45842 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), GALGAS_string ("DEFINITION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1347)) ;
-  GALGAS_lstring var_objectKind_45969 ;
+  GALGAS_lstring var_currentPath_46289 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), GALGAS_string ("DEFINITION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1360)) ;
+  GALGAS_lstring var_objectKind_46416 ;
   {
-  routine_oilEquivalentName (inArgument_parentPath, var_currentPath_45842, var_objectKind_45969, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1348)) ;
+  routine_oilEquivalentName (inArgument_parentPath, var_currentPath_46289, var_objectKind_46416, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1361)) ;
   }
-  GALGAS_implementationObject var_impObjOfKind_46032 = callExtensionGetter_impObject ((const cPtr_implementation *) ioArgument_imp.ptr (), var_objectKind_45969.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1351)) ;
-  GALGAS_objectKind var_objectsForKind_46098 = GALGAS_objectKind::constructor_new (GALGAS_objectKindMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1352))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1352)) ;
+  GALGAS_implementationObject var_impObjOfKind_46479 = callExtensionGetter_impObject ((const cPtr_implementation *) ioArgument_imp.ptr (), var_objectKind_46416.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1364)) ;
+  GALGAS_objectKind var_objectsForKind_46545 = GALGAS_objectKind::constructor_new (GALGAS_objectKindMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1365))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1365)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = ioArgument_objects.getter_hasKey (var_objectKind_45969.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1353)).boolEnum () ;
+    test_0 = ioArgument_objects.getter_hasKey (var_objectKind_46416.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1366)).boolEnum () ;
     if (kBoolTrue == test_0) {
       {
-      ioArgument_objects.setter_del (var_objectKind_45969, var_objectsForKind_46098, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1354)) ;
+      ioArgument_objects.setter_del (var_objectKind_46416, var_objectsForKind_46545, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1367)) ;
       }
     }
   }
-  GALGAS_lstring var_objectName_46295 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1358)) ;
-  GALGAS_objectAttributes var_object_46411 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1361)) ;
-  GALGAS_objectKindMap var_objectsKind_46451 = var_objectsForKind_46098.readProperty_objects () ;
+  GALGAS_lstring var_objectName_46742 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1371)) ;
+  GALGAS_objectAttributes var_object_46858 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1374)) ;
+  GALGAS_objectKindMap var_objectsKind_46898 = var_objectsForKind_46545.readProperty_objects () ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = GALGAS_bool (kIsEqual, var_impObjOfKind_46032.readProperty_multiple ().readProperty_bool ().objectCompare (GALGAS_bool (false))).boolEnum () ;
+    test_1 = GALGAS_bool (kIsEqual, var_impObjOfKind_46479.readProperty_multiple ().readProperty_bool ().objectCompare (GALGAS_bool (false))).boolEnum () ;
     if (kBoolTrue == test_1) {
-      var_objectName_46295 = var_objectKind_45969 ;
+      var_objectName_46742 = var_objectKind_46416 ;
     }
   }
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
-    test_2 = var_objectsKind_46451.getter_hasKey (var_objectName_46295.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1371)).boolEnum () ;
+    test_2 = var_objectsKind_46898.getter_hasKey (var_objectName_46742.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1384)).boolEnum () ;
     if (kBoolTrue == test_2) {
       {
-      var_objectsKind_46451.setter_del (var_objectName_46295, var_object_46411, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1372)) ;
+      var_objectsKind_46898.setter_del (var_objectName_46742, var_object_46858, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1385)) ;
       }
     }
   }
-  GALGAS_lstring var_oil_5F_desc_47020 ;
+  GALGAS_lstring var_oil_5F_desc_47467 ;
   {
-  routine_arxmlGetDescription (inArgument_currentElement, var_oil_5F_desc_47020, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1376)) ;
+  routine_arxmlGetDescription (inArgument_currentElement, var_oil_5F_desc_47467, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1389)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  ").add_operation (var_objectKind_45969.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1378)).add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1378)).add_operation (var_objectName_46295.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1378)).add_operation (GALGAS_string ("\n  {\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1378)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1378)) ;
+  routine_displayOil (GALGAS_string ("  ").add_operation (var_objectKind_46416.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)).add_operation (GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)).add_operation (var_objectName_46742.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)).add_operation (GALGAS_string ("\n  {\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)) ;
   }
   {
-  routine_arxmlDefinitionContainer (var_impObjOfKind_46032.readProperty_attributes (), var_object_46411, inArgument_currentElement, var_currentPath_45842, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1381)) ;
+  routine_arxmlDefinitionContainer (var_impObjOfKind_46479.readProperty_attributes (), var_object_46858, inArgument_currentElement, var_currentPath_46289, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1394)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("  } : \"").add_operation (var_oil_5F_desc_47020.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1386)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1386)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1386)) ;
+  routine_displayOil (GALGAS_string ("  } : \"").add_operation (var_oil_5F_desc_47467.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1399)).add_operation (GALGAS_string ("\";\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1399)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1399)) ;
   }
-  GALGAS_identifierMap var_attributes_47413 = var_object_46411.readProperty_objectParams () ;
+  GALGAS_identifierMap var_attributes_47860 = var_object_46858.readProperty_objectParams () ;
   enumGalgasBool test_3 = kBoolTrue ;
   if (kBoolTrue == test_3) {
-    test_3 = var_attributes_47413.getter_hasKey (GALGAS_string ("NAME") COMMA_SOURCE_FILE ("arxml_parser.galgas", 1390)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 1390)).boolEnum () ;
+    test_3 = var_attributes_47860.getter_hasKey (GALGAS_string ("NAME") COMMA_SOURCE_FILE ("arxml_parser.galgas", 1403)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 1403)).boolEnum () ;
     if (kBoolTrue == test_3) {
       {
-      var_attributes_47413.setter_put (GALGAS_lstring::constructor_new (GALGAS_string ("NAME"), var_objectName_46295.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)), GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_47020, var_objectName_46295.readProperty_location (), var_objectName_46295.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1392)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1391)) ;
+      var_attributes_47860.setter_put (GALGAS_lstring::constructor_new (GALGAS_string ("NAME"), var_objectName_46742.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1404)), GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_47467, var_objectName_46742.readProperty_location (), var_objectName_46742.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1405)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1404)) ;
       }
       {
-      var_object_46411.setter_setObjectParams (var_attributes_47413 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1395)) ;
+      var_object_46858.setter_setObjectParams (var_attributes_47860 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1408)) ;
       }
     }
   }
   {
-  var_objectsKind_46451.setter_put (var_objectName_46295, var_object_46411, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1397)) ;
+  var_objectsKind_46898.setter_put (var_objectName_46742, var_object_46858, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1410)) ;
   }
   {
-  var_objectsForKind_46098.setter_setObjects (var_objectsKind_46451 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1398)) ;
+  var_objectsForKind_46545.setter_setObjects (var_objectsKind_46898 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1411)) ;
   }
   {
-  ioArgument_objects.setter_put (var_objectKind_45969, var_objectsForKind_46098, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1399)) ;
+  ioArgument_objects.setter_put (var_objectKind_46416, var_objectsForKind_46545, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1412)) ;
   }
 }
 
@@ -1568,33 +1672,33 @@ void routine_arxmlDefinitionContainer (const GALGAS_implementationObjectMap cons
                                        GALGAS_lstring inArgument_currentPath,
                                        C_Compiler * inCompiler
                                        COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_arxmlElementValueList var_textParameters_48205 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1409)) ;
-  GALGAS_stringlist var_textParametersPath_48239 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1410)) ;
-  var_textParametersPath_48239.addAssign_operation (GALGAS_string ("PARAMETER-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1411)) ;
-  var_textParametersPath_48239.addAssign_operation (GALGAS_string ("ECUC-TEXTUAL-PARAM-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1412)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_textParametersPath_48239, var_textParameters_48205, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1413)) ;
-  GALGAS_arxmlElementValueList var_numParameters_48524 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1416)) ;
-  GALGAS_stringlist var_numParametersPath_48557 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1417)) ;
-  var_numParametersPath_48557.addAssign_operation (GALGAS_string ("PARAMETER-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1418)) ;
-  var_numParametersPath_48557.addAssign_operation (GALGAS_string ("ECUC-NUMERICAL-PARAM-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1419)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_numParametersPath_48557, var_numParameters_48524, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1420)) ;
-  GALGAS_arxmlElementValueList var_refParameters_48810 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1423)) ;
-  GALGAS_stringlist var_refParametersPath_48843 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1424)) ;
-  var_refParametersPath_48843.addAssign_operation (GALGAS_string ("REFERENCE-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1425)) ;
-  var_refParametersPath_48843.addAssign_operation (GALGAS_string ("ECUC-REFERENCE-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1426)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_refParametersPath_48843, var_refParameters_48810, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1427)) ;
-  GALGAS_arxmlElementValueList var_structParameters_49090 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1430)) ;
-  GALGAS_stringlist var_structParametersPath_49126 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1431)) ;
-  var_structParametersPath_49126.addAssign_operation (GALGAS_string ("SUB-CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1432)) ;
-  var_structParametersPath_49126.addAssign_operation (GALGAS_string ("ECUC-CONTAINER-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1433)) ;
-  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_structParametersPath_49126, var_structParameters_49090, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1434)) ;
-  GALGAS_arxmlElementValueList var_allParameters_49380 = var_numParameters_48524.add_operation (var_textParameters_48205, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1437)).add_operation (var_refParameters_48810, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1438)).add_operation (var_structParameters_49090, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1439)) ;
-  cEnumerator_arxmlElementValueList enumerator_49644 (var_allParameters_49380, kENUMERATION_UP) ;
-  while (enumerator_49644.hasCurrentObject ()) {
+  GALGAS_arxmlElementValueList var_textParameters_48652 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1422)) ;
+  GALGAS_stringlist var_textParametersPath_48686 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1423)) ;
+  var_textParametersPath_48686.addAssign_operation (GALGAS_string ("PARAMETER-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1424)) ;
+  var_textParametersPath_48686.addAssign_operation (GALGAS_string ("ECUC-TEXTUAL-PARAM-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1425)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_textParametersPath_48686, var_textParameters_48652, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1426)) ;
+  GALGAS_arxmlElementValueList var_numParameters_48971 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1429)) ;
+  GALGAS_stringlist var_numParametersPath_49004 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1430)) ;
+  var_numParametersPath_49004.addAssign_operation (GALGAS_string ("PARAMETER-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1431)) ;
+  var_numParametersPath_49004.addAssign_operation (GALGAS_string ("ECUC-NUMERICAL-PARAM-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1432)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_numParametersPath_49004, var_numParameters_48971, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1433)) ;
+  GALGAS_arxmlElementValueList var_refParameters_49257 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1436)) ;
+  GALGAS_stringlist var_refParametersPath_49290 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1437)) ;
+  var_refParametersPath_49290.addAssign_operation (GALGAS_string ("REFERENCE-VALUES")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1438)) ;
+  var_refParametersPath_49290.addAssign_operation (GALGAS_string ("ECUC-REFERENCE-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1439)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_refParametersPath_49290, var_refParameters_49257, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1440)) ;
+  GALGAS_arxmlElementValueList var_structParameters_49537 = GALGAS_arxmlElementValueList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1443)) ;
+  GALGAS_stringlist var_structParametersPath_49573 = GALGAS_stringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1444)) ;
+  var_structParametersPath_49573.addAssign_operation (GALGAS_string ("SUB-CONTAINERS")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1445)) ;
+  var_structParametersPath_49573.addAssign_operation (GALGAS_string ("ECUC-CONTAINER-VALUE")  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1446)) ;
+  callExtensionMethod_getElementsByPath ((cPtr_arxmlElementValue *) inArgument_currentElement.ptr (), var_structParametersPath_49573, var_structParameters_49537, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1447)) ;
+  GALGAS_arxmlElementValueList var_allParameters_49827 = var_numParameters_48971.add_operation (var_textParameters_48652, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1450)).add_operation (var_refParameters_49257, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1451)).add_operation (var_structParameters_49537, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1452)) ;
+  cEnumerator_arxmlElementValueList enumerator_50091 (var_allParameters_49827, kENUMERATION_UP) ;
+  while (enumerator_50091.hasCurrentObject ()) {
     {
-    routine_arxmlDefinitionParameter (constinArgument_types, ioArgument_identifiers, enumerator_49644.current_value (HERE), inArgument_currentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1444)) ;
+    routine_arxmlDefinitionParameter (constinArgument_types, ioArgument_identifiers, enumerator_50091.current_value (HERE), inArgument_currentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1457)) ;
     }
-    enumerator_49644.gotoNextObject () ;
+    enumerator_50091.gotoNextObject () ;
   }
 }
 
@@ -1611,52 +1715,52 @@ void routine_arxmlDefinitionParameter (const GALGAS_implementationObjectMap cons
                                        GALGAS_lstring inArgument_parentPath,
                                        C_Compiler * inCompiler
                                        COMMA_UNUSED_LOCATION_ARGS) {
-  GALGAS_object_5F_t var_val_49953 ;
-  GALGAS_lstring var_parameterPath_49972 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFINITION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1456)) ;
-  GALGAS_lstring var_parameterType_50094 ;
-  {
-  routine_oilEquivalentName (inArgument_parentPath, var_parameterPath_49972, var_parameterType_50094, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1457)) ;
-  }
-  GALGAS_bool var_typeOk_50142 = GALGAS_bool (false) ;
-  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1461)) ;
-  temp_0.addAssign_operation (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1461))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1461)) ;
-  GALGAS_impType var_type_50168 = GALGAS_impVoid::constructor_new (temp_0, GALGAS_dataType::constructor_void (SOURCE_FILE ("arxml_parser.galgas", 1463)), function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1463)), GALGAS_bool (false), GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1465))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1461)) ;
-  GALGAS_lstring var_valueType_50439 = callExtensionGetter_getAttributeValueFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFINITION-REF"), GALGAS_string ("DEST"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1467)) ;
-  GALGAS_lstring var_oil_5F_desc_50633 = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1472))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1472)) ;
-  GALGAS_bool var_isAuto_50791 = GALGAS_bool (false) ;
-  GALGAS_lstring var_parameterValue_50817 ;
+  GALGAS_object_5F_t var_val_50400 ;
+  GALGAS_lstring var_parameterPath_50419 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFINITION-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1469)) ;
+  GALGAS_lstring var_parameterType_50541 ;
+  {
+  routine_oilEquivalentName (inArgument_parentPath, var_parameterPath_50419, var_parameterType_50541, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1470)) ;
+  }
+  GALGAS_bool var_typeOk_50589 = GALGAS_bool (false) ;
+  GALGAS_locationList temp_0 = GALGAS_locationList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1474)) ;
+  temp_0.addAssign_operation (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1474))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1474)) ;
+  GALGAS_impType var_type_50615 = GALGAS_impVoid::constructor_new (temp_0, GALGAS_dataType::constructor_void (SOURCE_FILE ("arxml_parser.galgas", 1476)), function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1476)), GALGAS_bool (false), GALGAS_lstringlist::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1478))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1474)) ;
+  GALGAS_lstring var_valueType_50886 = callExtensionGetter_getAttributeValueFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("DEFINITION-REF"), GALGAS_string ("DEST"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1480)) ;
+  GALGAS_lstring var_oil_5F_desc_51080 = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1485))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1485)) ;
+  GALGAS_bool var_isAuto_51238 = GALGAS_bool (false) ;
+  GALGAS_lstring var_parameterValue_51264 ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1479)).boolEnum () ;
+    test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1492)).boolEnum () ;
     if (kBoolTrue == test_1) {
-      var_parameterValue_50817 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1483)) ;
+      var_parameterValue_51264 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1496)) ;
     }
   }
   if (kBoolFalse == test_1) {
     enumGalgasBool test_2 = kBoolTrue ;
     if (kBoolTrue == test_2) {
-      test_2 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1484)).boolEnum () ;
+      test_2 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1497)).boolEnum () ;
       if (kBoolTrue == test_2) {
-        var_parameterValue_50817 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1488)) ;
-        var_parameterValue_50817.setter_setString (var_parameterValue_50817.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1490)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1490)) ;
+        var_parameterValue_51264 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("VALUE-REF"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1501)) ;
+        var_parameterValue_51264.setter_setString (var_parameterValue_51264.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1503)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1503)) ;
         enumGalgasBool test_3 = kBoolTrue ;
         if (kBoolTrue == test_3) {
-          test_3 = GALGAS_bool (kIsEqual, var_parameterType_50094.readProperty_string ().getter_rightSubString (GALGAS_uint (uint32_t (3U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1492)).objectCompare (GALGAS_string ("REF"))).boolEnum () ;
+          test_3 = GALGAS_bool (kIsEqual, var_parameterType_50541.readProperty_string ().getter_rightSubString (GALGAS_uint (uint32_t (3U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1505)).objectCompare (GALGAS_string ("REF"))).boolEnum () ;
           if (kBoolTrue == test_3) {
-            var_parameterType_50094.setter_setString (var_parameterType_50094.readProperty_string ().getter_leftSubString (var_parameterType_50094.readProperty_string ().getter_count (SOURCE_FILE ("arxml_parser.galgas", 1494)).substract_operation (GALGAS_uint (uint32_t (3U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1494)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1493)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1493)) ;
+            var_parameterType_50541.setter_setString (var_parameterType_50541.readProperty_string ().getter_leftSubString (var_parameterType_50541.readProperty_string ().getter_count (SOURCE_FILE ("arxml_parser.galgas", 1507)).substract_operation (GALGAS_uint (uint32_t (3U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1507)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1506)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1506)) ;
           }
         }
         if (kBoolFalse == test_3) {
           enumGalgasBool test_4 = kBoolTrue ;
           if (kBoolTrue == test_4) {
-            test_4 = GALGAS_bool (kIsEqual, var_parameterType_50094.readProperty_string ().getter_rightSubString (GALGAS_uint (uint32_t (4U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1495)).objectCompare (GALGAS_string ("REFS"))).boolEnum () ;
+            test_4 = GALGAS_bool (kIsEqual, var_parameterType_50541.readProperty_string ().getter_rightSubString (GALGAS_uint (uint32_t (4U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1508)).objectCompare (GALGAS_string ("REFS"))).boolEnum () ;
             if (kBoolTrue == test_4) {
-              var_parameterType_50094.setter_setString (var_parameterType_50094.readProperty_string ().getter_leftSubString (var_parameterType_50094.readProperty_string ().getter_count (SOURCE_FILE ("arxml_parser.galgas", 1497)).substract_operation (GALGAS_uint (uint32_t (4U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1497)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1496)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1496)) ;
+              var_parameterType_50541.setter_setString (var_parameterType_50541.readProperty_string ().getter_leftSubString (var_parameterType_50541.readProperty_string ().getter_count (SOURCE_FILE ("arxml_parser.galgas", 1510)).substract_operation (GALGAS_uint (uint32_t (4U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1510)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1509)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1509)) ;
             }
           }
           if (kBoolFalse == test_4) {
             TC_Array <C_FixItDescription> fixItArray5 ;
-            inCompiler->emitSemanticError (var_parameterType_50094.readProperty_location (), GALGAS_string ("An object reference must end with REF or REFS"), fixItArray5  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1499)) ;
+            inCompiler->emitSemanticError (var_parameterType_50541.readProperty_location (), GALGAS_string ("An object reference must end with REF or REFS"), fixItArray5  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1512)) ;
           }
         }
       }
@@ -1664,299 +1768,299 @@ void routine_arxmlDefinitionParameter (const GALGAS_implementationObjectMap cons
     if (kBoolFalse == test_2) {
       enumGalgasBool test_6 = kBoolTrue ;
       if (kBoolTrue == test_6) {
-        GALGAS_bool test_7 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("PARAMETER-VALUES"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1501)) ;
+        GALGAS_bool test_7 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("PARAMETER-VALUES"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1514)) ;
         if (kBoolTrue != test_7.boolEnum ()) {
-          test_7 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("REFERENCE-VALUES"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1502)) ;
+          test_7 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("REFERENCE-VALUES"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1515)) ;
         }
         test_6 = test_7.boolEnum () ;
         if (kBoolTrue == test_6) {
-          var_parameterValue_50817 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1506)) ;
+          var_parameterValue_51264 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1519)) ;
         }
       }
       if (kBoolFalse == test_6) {
         enumGalgasBool test_8 = kBoolTrue ;
         if (kBoolTrue == test_8) {
-          test_8 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("IS-AUTO-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1507)).boolEnum () ;
+          test_8 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("IS-AUTO-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1520)).boolEnum () ;
           if (kBoolTrue == test_8) {
-            var_parameterValue_50817 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("IS-AUTO-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1511)) ;
+            var_parameterValue_51264 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("IS-AUTO-VALUE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1524)) ;
             enumGalgasBool test_9 = kBoolTrue ;
             if (kBoolTrue == test_9) {
-              GALGAS_bool test_10 = GALGAS_bool (kIsEqual, var_parameterValue_50817.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1512)).objectCompare (GALGAS_string ("TRUE"))) ;
+              GALGAS_bool test_10 = GALGAS_bool (kIsEqual, var_parameterValue_51264.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1525)).objectCompare (GALGAS_string ("TRUE"))) ;
               if (kBoolTrue != test_10.boolEnum ()) {
-                test_10 = GALGAS_bool (kIsEqual, var_parameterValue_50817.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
+                test_10 = GALGAS_bool (kIsEqual, var_parameterValue_51264.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
               }
               test_9 = test_10.boolEnum () ;
               if (kBoolTrue == test_9) {
-                var_isAuto_50791 = GALGAS_bool (true) ;
+                var_isAuto_51238 = GALGAS_bool (true) ;
               }
             }
           }
         }
         if (kBoolFalse == test_8) {
           TC_Array <C_FixItDescription> fixItArray11 ;
-          inCompiler->emitSemanticError (var_parameterType_50094.readProperty_location (), GALGAS_string ("No value has been found."), fixItArray11  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1517)) ;
-          var_parameterValue_50817.drop () ; // Release error dropped variable
+          inCompiler->emitSemanticError (var_parameterType_50541.readProperty_location (), GALGAS_string ("No value has been found."), fixItArray11  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1530)) ;
+          var_parameterValue_51264.drop () ; // Release error dropped variable
         }
       }
     }
   }
   enumGalgasBool test_12 = kBoolTrue ;
   if (kBoolTrue == test_12) {
-    test_12 = constinArgument_types.getter_hasKey (var_parameterType_50094.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1521)).boolEnum () ;
+    test_12 = constinArgument_types.getter_hasKey (var_parameterType_50541.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1534)).boolEnum () ;
     if (kBoolTrue == test_12) {
-      constinArgument_types.method_get (var_parameterType_50094, var_type_50168, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1522)) ;
-      var_typeOk_50142 = GALGAS_bool (true) ;
+      constinArgument_types.method_get (var_parameterType_50541, var_type_50615, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1535)) ;
+      var_typeOk_50589 = GALGAS_bool (true) ;
       {
-      routine_testTypeError (var_type_50168.readProperty_type (), var_valueType_50439, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1525)) ;
+      routine_testTypeError (var_type_50615.readProperty_type (), var_valueType_50886, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1538)) ;
       }
     }
   }
   if (kBoolFalse == test_12) {
     TC_Array <C_FixItDescription> fixItArray13 ;
-    inCompiler->emitSemanticError (var_parameterType_50094.readProperty_location (), var_parameterType_50094.readProperty_string ().add_operation (GALGAS_string (" is not declared in the "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1527)).add_operation (GALGAS_string ("IMPLEMENTATION."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1527)), fixItArray13  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1527)) ;
+    inCompiler->emitSemanticError (var_parameterType_50541.readProperty_location (), var_parameterType_50541.readProperty_string ().add_operation (GALGAS_string (" is not declared in the "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1540)).add_operation (GALGAS_string ("IMPLEMENTATION."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1540)), fixItArray13  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1540)) ;
   }
   {
-  routine_displayOil (GALGAS_string ("    ").add_operation (var_parameterType_50094.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1531)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1531)) ;
+  routine_displayOil (GALGAS_string ("    ").add_operation (var_parameterType_50541.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1544)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1544)) ;
   }
-  GALGAS_implementationObjectMap var_subTypes_53409 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1533)) ;
-  GALGAS_objectAttributes var_subAttributes_53477 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1534)) ;
+  GALGAS_implementationObjectMap var_subTypes_53856 = GALGAS_implementationObjectMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 1546)) ;
+  GALGAS_objectAttributes var_subAttributes_53924 = function_emptyObject (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1547)) ;
   enumGalgasBool test_14 = kBoolTrue ;
   if (kBoolTrue == test_14) {
-    test_14 = var_isAuto_50791.boolEnum () ;
+    test_14 = var_isAuto_51238.boolEnum () ;
     if (kBoolTrue == test_14) {
       {
-      routine_displayOil (GALGAS_string (" = AUTO;"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1543)) ;
+      routine_displayOil (GALGAS_string (" = AUTO;"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1556)) ;
       }
       enumGalgasBool test_15 = kBoolTrue ;
       if (kBoolTrue == test_15) {
-        test_15 = callExtensionGetter_autoAllowed ((const cPtr_impType *) var_type_50168.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1544)).boolEnum () ;
+        test_15 = callExtensionGetter_autoAllowed ((const cPtr_impType *) var_type_50615.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1557)).boolEnum () ;
         if (kBoolTrue == test_15) {
-          var_val_49953 = GALGAS_auto::constructor_new (var_oil_5F_desc_50633, var_parameterValue_50817.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1545)) ;
+          var_val_50400 = GALGAS_auto::constructor_new (var_oil_5F_desc_51080, var_parameterValue_51264.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1558)) ;
         }
       }
       if (kBoolFalse == test_15) {
         TC_Array <C_FixItDescription> fixItArray16 ;
-        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1547)), GALGAS_string ("AUTO is not allowed"), fixItArray16  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1547)) ;
-        var_val_49953.drop () ; // Release error dropped variable
+        inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1560)), GALGAS_string ("AUTO is not allowed"), fixItArray16  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1560)) ;
+        var_val_50400.drop () ; // Release error dropped variable
       }
     }
   }
   if (kBoolFalse == test_14) {
     enumGalgasBool test_17 = kBoolTrue ;
     if (kBoolTrue == test_17) {
-      test_17 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-ENUMERATION-PARAM-DEF"))).boolEnum () ;
+      test_17 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-ENUMERATION-PARAM-DEF"))).boolEnum () ;
       if (kBoolTrue == test_17) {
         GALGAS_impEnumType temp_18 ;
-        if (var_type_50168.isValid ()) {
-          if (nullptr != dynamic_cast <const cPtr_impEnumType *> (var_type_50168.ptr ())) {
-            temp_18 = (cPtr_impEnumType *) var_type_50168.ptr () ;
+        if (var_type_50615.isValid ()) {
+          if (nullptr != dynamic_cast <const cPtr_impEnumType *> (var_type_50615.ptr ())) {
+            temp_18 = (cPtr_impEnumType *) var_type_50615.ptr () ;
           }else{
-            inCompiler->castError ("impEnumType", var_type_50168.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1554)) ;
+            inCompiler->castError ("impEnumType", var_type_50615.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1567)) ;
           }
         }
-        GALGAS_impEnumType var_enumType_54289 = temp_18 ;
+        GALGAS_impEnumType var_enumType_54736 = temp_18 ;
         enumGalgasBool test_19 = kBoolTrue ;
         if (kBoolTrue == test_19) {
-          test_19 = var_enumType_54289.readProperty_valuesMap ().getter_hasKey (var_parameterValue_50817.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1555)).boolEnum () ;
+          test_19 = var_enumType_54736.readProperty_valuesMap ().getter_hasKey (var_parameterValue_51264.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1568)).boolEnum () ;
           if (kBoolTrue == test_19) {
-            var_enumType_54289.readProperty_valuesMap ().method_get (var_parameterValue_50817, var_subTypes_53409, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1556)) ;
+            var_enumType_54736.readProperty_valuesMap ().method_get (var_parameterValue_51264, var_subTypes_53856, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1569)) ;
           }
         }
         if (kBoolFalse == test_19) {
           TC_Array <C_FixItDescription> fixItArray20 ;
-          inCompiler->emitSemanticError (var_parameterValue_50817.readProperty_location (), var_parameterValue_50817.readProperty_string ().add_operation (GALGAS_string (" ENUM value "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1558)).add_operation (GALGAS_string ("for "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1558)).add_operation (var_parameterType_50094.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1559)).add_operation (GALGAS_string (" undeclared.\nOne of the following"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1559)).add_operation (GALGAS_string ("values are expected :\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1559)).add_operation (function_valueList (var_enumType_54289.readProperty_valuesMap (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1560)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1560)), fixItArray20  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1558)) ;
+          inCompiler->emitSemanticError (var_parameterValue_51264.readProperty_location (), var_parameterValue_51264.readProperty_string ().add_operation (GALGAS_string (" ENUM value "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1571)).add_operation (GALGAS_string ("for "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1571)).add_operation (var_parameterType_50541.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1572)).add_operation (GALGAS_string (" undeclared.\nOne of the following"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1572)).add_operation (GALGAS_string ("values are expected :\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1572)).add_operation (function_valueList (var_enumType_54736.readProperty_valuesMap (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1573)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1573)), fixItArray20  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1571)) ;
         }
         {
-        routine_displayOil (GALGAS_string (" = ").add_operation (var_parameterValue_50817.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1563)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1563)) ;
+        routine_displayOil (GALGAS_string (" = ").add_operation (var_parameterValue_51264.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1576)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1576)) ;
         }
         enumGalgasBool test_21 = kBoolTrue ;
         if (kBoolTrue == test_21) {
-          test_21 = GALGAS_bool (kIsNotEqual, var_subTypes_53409.getter_count (SOURCE_FILE ("arxml_parser.galgas", 1564)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+          test_21 = GALGAS_bool (kIsNotEqual, var_subTypes_53856.getter_count (SOURCE_FILE ("arxml_parser.galgas", 1577)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
           if (kBoolTrue == test_21) {
             {
-            routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1565)) ;
+            routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1578)) ;
             }
             {
-            routine_arxmlDefinitionContainer (var_subTypes_53409, var_subAttributes_53477, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1566)) ;
+            routine_arxmlDefinitionContainer (var_subTypes_53856, var_subAttributes_53924, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1579)) ;
             }
             {
-            routine_displayOil (GALGAS_string ("    }"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1568)) ;
+            routine_displayOil (GALGAS_string ("    }"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1581)) ;
             }
           }
         }
         {
-        routine_displayOil (GALGAS_string (";"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1570)) ;
+        routine_displayOil (GALGAS_string (";"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1583)) ;
         }
-        var_val_49953 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_50633, var_parameterValue_50817.readProperty_location (), var_parameterValue_50817.readProperty_string (), var_subAttributes_53477  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1572)) ;
+        var_val_50400 = GALGAS_enumAttribute::constructor_new (var_oil_5F_desc_51080, var_parameterValue_51264.readProperty_location (), var_parameterValue_51264.readProperty_string (), var_subAttributes_53924  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1585)) ;
       }
     }
     if (kBoolFalse == test_17) {
       enumGalgasBool test_22 = kBoolTrue ;
       if (kBoolTrue == test_22) {
-        test_22 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-BOOLEAN-PARAM-DEF"))).boolEnum () ;
+        test_22 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-BOOLEAN-PARAM-DEF"))).boolEnum () ;
         if (kBoolTrue == test_22) {
           GALGAS_impBoolType temp_23 ;
-          if (var_type_50168.isValid ()) {
-            if (nullptr != dynamic_cast <const cPtr_impBoolType *> (var_type_50168.ptr ())) {
-              temp_23 = (cPtr_impBoolType *) var_type_50168.ptr () ;
+          if (var_type_50615.isValid ()) {
+            if (nullptr != dynamic_cast <const cPtr_impBoolType *> (var_type_50615.ptr ())) {
+              temp_23 = (cPtr_impBoolType *) var_type_50615.ptr () ;
             }else{
-              inCompiler->castError ("impBoolType", var_type_50168.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1581)) ;
+              inCompiler->castError ("impBoolType", var_type_50615.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1594)) ;
             }
           }
-          GALGAS_impBoolType var_boolType_55423 = temp_23 ;
-          GALGAS_bool var_booleanValue_55469 ;
+          GALGAS_impBoolType var_boolType_55870 = temp_23 ;
+          GALGAS_bool var_booleanValue_55916 ;
           enumGalgasBool test_24 = kBoolTrue ;
           if (kBoolTrue == test_24) {
-            GALGAS_bool test_25 = GALGAS_bool (kIsEqual, var_parameterValue_50817.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1583)).objectCompare (GALGAS_string ("TRUE"))) ;
+            GALGAS_bool test_25 = GALGAS_bool (kIsEqual, var_parameterValue_51264.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1596)).objectCompare (GALGAS_string ("TRUE"))) ;
             if (kBoolTrue != test_25.boolEnum ()) {
-              test_25 = GALGAS_bool (kIsEqual, var_parameterValue_50817.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
+              test_25 = GALGAS_bool (kIsEqual, var_parameterValue_51264.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
             }
             test_24 = test_25.boolEnum () ;
             if (kBoolTrue == test_24) {
-              var_subTypes_53409 = var_boolType_55423.readProperty_trueSubAttributes () ;
-              var_booleanValue_55469 = GALGAS_bool (true) ;
+              var_subTypes_53856 = var_boolType_55870.readProperty_trueSubAttributes () ;
+              var_booleanValue_55916 = GALGAS_bool (true) ;
             }
           }
           if (kBoolFalse == test_24) {
             enumGalgasBool test_26 = kBoolTrue ;
             if (kBoolTrue == test_26) {
-              GALGAS_bool test_27 = GALGAS_bool (kIsEqual, var_parameterValue_50817.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1587)).objectCompare (GALGAS_string ("FALSE"))) ;
+              GALGAS_bool test_27 = GALGAS_bool (kIsEqual, var_parameterValue_51264.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1600)).objectCompare (GALGAS_string ("FALSE"))) ;
               if (kBoolTrue != test_27.boolEnum ()) {
-                test_27 = GALGAS_bool (kIsEqual, var_parameterValue_50817.readProperty_string ().objectCompare (GALGAS_string ("0"))) ;
+                test_27 = GALGAS_bool (kIsEqual, var_parameterValue_51264.readProperty_string ().objectCompare (GALGAS_string ("0"))) ;
               }
               test_26 = test_27.boolEnum () ;
               if (kBoolTrue == test_26) {
-                var_subTypes_53409 = var_boolType_55423.readProperty_falseSubAttributes () ;
-                var_booleanValue_55469 = GALGAS_bool (false) ;
+                var_subTypes_53856 = var_boolType_55870.readProperty_falseSubAttributes () ;
+                var_booleanValue_55916 = GALGAS_bool (false) ;
               }
             }
             if (kBoolFalse == test_26) {
-              var_booleanValue_55469 = GALGAS_bool (false) ;
+              var_booleanValue_55916 = GALGAS_bool (false) ;
               TC_Array <C_FixItDescription> fixItArray28 ;
-              inCompiler->emitSemanticError (var_parameterValue_50817.readProperty_location (), GALGAS_string ("A Boolean must be 'true', 'false', '0' or '1'"), fixItArray28  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1593)) ;
+              inCompiler->emitSemanticError (var_parameterValue_51264.readProperty_location (), GALGAS_string ("A Boolean must be 'true', 'false', '0' or '1'"), fixItArray28  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1606)) ;
             }
           }
           {
-          routine_displayOil (GALGAS_string (" = ").add_operation (var_booleanValue_55469.getter_cString (SOURCE_FILE ("arxml_parser.galgas", 1596)).getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1596)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1596)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1596)) ;
+          routine_displayOil (GALGAS_string (" = ").add_operation (var_booleanValue_55916.getter_cString (SOURCE_FILE ("arxml_parser.galgas", 1609)).getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1609)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1609)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1609)) ;
           }
           enumGalgasBool test_29 = kBoolTrue ;
           if (kBoolTrue == test_29) {
-            test_29 = GALGAS_bool (kIsNotEqual, var_subTypes_53409.getter_count (SOURCE_FILE ("arxml_parser.galgas", 1597)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+            test_29 = GALGAS_bool (kIsNotEqual, var_subTypes_53856.getter_count (SOURCE_FILE ("arxml_parser.galgas", 1610)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
             if (kBoolTrue == test_29) {
               {
-              routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1598)) ;
+              routine_displayOil (GALGAS_string ("\n    {\n"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1611)) ;
               }
               {
-              routine_arxmlDefinitionContainer (var_subTypes_53409, var_subAttributes_53477, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1599)) ;
+              routine_arxmlDefinitionContainer (var_subTypes_53856, var_subAttributes_53924, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1612)) ;
               }
               {
-              routine_displayOil (GALGAS_string ("    }"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1601)) ;
+              routine_displayOil (GALGAS_string ("    }"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1614)) ;
               }
             }
           }
           {
-          routine_displayOil (GALGAS_string (";"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1603)) ;
+          routine_displayOil (GALGAS_string (";"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1616)) ;
           }
-          var_val_49953 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_50633, var_parameterType_50094.readProperty_location (), var_booleanValue_55469, var_subAttributes_53477  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1605)) ;
+          var_val_50400 = GALGAS_boolAttribute::constructor_new (var_oil_5F_desc_51080, var_parameterType_50541.readProperty_location (), var_booleanValue_55916, var_subAttributes_53924  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1618)) ;
         }
       }
       if (kBoolFalse == test_22) {
         enumGalgasBool test_30 = kBoolTrue ;
         if (kBoolTrue == test_30) {
-          test_30 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-INTEGER-PARAM-DEF"))).boolEnum () ;
+          test_30 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-INTEGER-PARAM-DEF"))).boolEnum () ;
           if (kBoolTrue == test_30) {
-            GALGAS_bool var_sign_56716 ;
+            GALGAS_bool var_sign_57163 ;
             {
-            routine_arxmlPopSign (var_parameterValue_50817, var_sign_56716, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1614)) ;
+            routine_arxmlPopSign (var_parameterValue_51264, var_sign_57163, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1627)) ;
             }
-            GALGAS_luint_36__34_ var_integerValue_56740 = GALGAS_luint_36__34_::constructor_new (var_parameterValue_50817.readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1617)).getter_uint_36__34_ (SOURCE_FILE ("arxml_parser.galgas", 1617)), var_parameterValue_50817.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1616)) ;
+            GALGAS_luint_36__34_ var_integerValue_57187 = GALGAS_luint_36__34_::constructor_new (var_parameterValue_51264.readProperty_string ().getter_decimalUnsignedNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1630)).getter_uint_36__34_ (SOURCE_FILE ("arxml_parser.galgas", 1630)), var_parameterValue_51264.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1629)) ;
             {
-            routine_displayOil (GALGAS_string (" = ").add_operation (var_integerValue_56740.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 1620)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1620)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1620)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1620)) ;
+            routine_displayOil (GALGAS_string (" = ").add_operation (var_integerValue_57187.readProperty_uint_36__34_ ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 1633)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1633)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1633)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1633)) ;
             }
-            var_val_49953 = function_checkAndGetIntegerNumber (var_oil_5F_desc_50633, var_type_50168.readProperty_type (), var_integerValue_56740, var_sign_56716, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1622)) ;
+            var_val_50400 = function_checkAndGetIntegerNumber (var_oil_5F_desc_51080, var_type_50615.readProperty_type (), var_integerValue_57187, var_sign_57163, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1635)) ;
           }
         }
         if (kBoolFalse == test_30) {
           enumGalgasBool test_31 = kBoolTrue ;
           if (kBoolTrue == test_31) {
-            test_31 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-FLOAT-PARAM-DEF"))).boolEnum () ;
+            test_31 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-FLOAT-PARAM-DEF"))).boolEnum () ;
             if (kBoolTrue == test_31) {
-              GALGAS_bool var_sign_57319 ;
+              GALGAS_bool var_sign_57766 ;
               {
-              routine_arxmlPopSign (var_parameterValue_50817, var_sign_57319, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1628)) ;
+              routine_arxmlPopSign (var_parameterValue_51264, var_sign_57766, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1641)) ;
               }
-              GALGAS_ldouble var_floatValue_57343 = GALGAS_ldouble::constructor_new (var_parameterValue_50817.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1631)), var_parameterValue_50817.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1630)) ;
+              GALGAS_ldouble var_floatValue_57790 = GALGAS_ldouble::constructor_new (var_parameterValue_51264.readProperty_string ().getter_doubleNumber (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1644)), var_parameterValue_51264.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1643)) ;
               {
-              routine_displayOil (GALGAS_string (" = ").add_operation (var_floatValue_57343.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 1634)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1634)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1634)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1634)) ;
+              routine_displayOil (GALGAS_string (" = ").add_operation (var_floatValue_57790.readProperty_double ().getter_string (SOURCE_FILE ("arxml_parser.galgas", 1647)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1647)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1647)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1647)) ;
               }
-              var_val_49953 = function_checkAndGetFloatNumber (var_oil_5F_desc_50633, var_type_50168.readProperty_type (), var_floatValue_57343, var_sign_57319, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1636)) ;
+              var_val_50400 = function_checkAndGetFloatNumber (var_oil_5F_desc_51080, var_type_50615.readProperty_type (), var_floatValue_57790, var_sign_57766, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1649)) ;
             }
           }
           if (kBoolFalse == test_31) {
             enumGalgasBool test_32 = kBoolTrue ;
             if (kBoolTrue == test_32) {
-              test_32 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-STRING-PARAM-DEF"))).boolEnum () ;
+              test_32 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-STRING-PARAM-DEF"))).boolEnum () ;
               if (kBoolTrue == test_32) {
                 {
-                routine_displayOil (GALGAS_string (" = \"").add_operation (var_parameterValue_50817.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1642)).add_operation (GALGAS_string ("\";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1642)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1642)) ;
+                routine_displayOil (GALGAS_string (" = \"").add_operation (var_parameterValue_51264.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1655)).add_operation (GALGAS_string ("\";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1655)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1655)) ;
                 }
-                var_val_49953 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_50633, var_parameterValue_50817.readProperty_location (), var_parameterValue_50817.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1644)) ;
+                var_val_50400 = GALGAS_stringAttribute::constructor_new (var_oil_5F_desc_51080, var_parameterValue_51264.readProperty_location (), var_parameterValue_51264.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1657)) ;
               }
             }
             if (kBoolFalse == test_32) {
               enumGalgasBool test_33 = kBoolTrue ;
               if (kBoolTrue == test_33) {
-                test_33 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-REFERENCE-DEF"))).boolEnum () ;
+                test_33 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-REFERENCE-DEF"))).boolEnum () ;
                 if (kBoolTrue == test_33) {
                   {
-                  routine_displayOil (GALGAS_string (" = ").add_operation (var_parameterValue_50817.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1652)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1652)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1652)) ;
+                  routine_displayOil (GALGAS_string (" = ").add_operation (var_parameterValue_51264.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1665)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1665)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1665)) ;
                   }
-                  var_val_49953 = GALGAS_objectRefAttribute::constructor_new (var_oil_5F_desc_50633, var_parameterValue_50817.readProperty_location (), var_parameterValue_50817  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1654)) ;
+                  var_val_50400 = GALGAS_objectRefAttribute::constructor_new (var_oil_5F_desc_51080, var_parameterValue_51264.readProperty_location (), var_parameterValue_51264  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1667)) ;
                 }
               }
               if (kBoolFalse == test_33) {
                 enumGalgasBool test_34 = kBoolTrue ;
                 if (kBoolTrue == test_34) {
-                  test_34 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("TPL-IDENTIFIER-DEF"))).boolEnum () ;
+                  test_34 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("TPL-IDENTIFIER-DEF"))).boolEnum () ;
                   if (kBoolTrue == test_34) {
                     {
-                    routine_displayOil (GALGAS_string (" = ").add_operation (var_parameterValue_50817.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1662)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1662)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1662)) ;
+                    routine_displayOil (GALGAS_string (" = ").add_operation (var_parameterValue_51264.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1675)).add_operation (GALGAS_string (";"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1675)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1675)) ;
                     }
-                    var_val_49953 = GALGAS_string_5F_class::constructor_new (var_oil_5F_desc_50633, var_parameterValue_50817.readProperty_location (), var_parameterValue_50817.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1664)) ;
+                    var_val_50400 = GALGAS_string_5F_class::constructor_new (var_oil_5F_desc_51080, var_parameterValue_51264.readProperty_location (), var_parameterValue_51264.readProperty_string ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1677)) ;
                   }
                 }
                 if (kBoolFalse == test_34) {
                   enumGalgasBool test_35 = kBoolTrue ;
                   if (kBoolTrue == test_35) {
-                    test_35 = GALGAS_bool (kIsEqual, var_valueType_50439.readProperty_string ().objectCompare (GALGAS_string ("ECUC-PARAM-CONF-CONTAINER-DEF"))).boolEnum () ;
+                    test_35 = GALGAS_bool (kIsEqual, var_valueType_50886.readProperty_string ().objectCompare (GALGAS_string ("ECUC-PARAM-CONF-CONTAINER-DEF"))).boolEnum () ;
                     if (kBoolTrue == test_35) {
                       GALGAS_impStructType temp_36 ;
-                      if (var_type_50168.isValid ()) {
-                        if (nullptr != dynamic_cast <const cPtr_impStructType *> (var_type_50168.ptr ())) {
-                          temp_36 = (cPtr_impStructType *) var_type_50168.ptr () ;
+                      if (var_type_50615.isValid ()) {
+                        if (nullptr != dynamic_cast <const cPtr_impStructType *> (var_type_50615.ptr ())) {
+                          temp_36 = (cPtr_impStructType *) var_type_50615.ptr () ;
                         }else{
-                          inCompiler->castError ("impStructType", var_type_50168.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1672)) ;
+                          inCompiler->castError ("impStructType", var_type_50615.ptr ()->classDescriptor () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1685)) ;
                         }
                       }
-                      GALGAS_impStructType var_structType_59236 = temp_36 ;
-                      var_subTypes_53409 = var_structType_59236.readProperty_structAttributes () ;
+                      GALGAS_impStructType var_structType_59683 = temp_36 ;
+                      var_subTypes_53856 = var_structType_59683.readProperty_structAttributes () ;
                       {
-                      routine_displayOil (GALGAS_string (" ").add_operation (var_parameterValue_50817.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1675)).add_operation (GALGAS_string ("\n    {\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1675)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1675)) ;
+                      routine_displayOil (GALGAS_string (" ").add_operation (var_parameterValue_51264.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1688)).add_operation (GALGAS_string ("\n    {\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1688)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1688)) ;
                       }
                       {
-                      routine_arxmlDefinitionContainer (var_subTypes_53409, var_subAttributes_53477, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1676)) ;
+                      routine_arxmlDefinitionContainer (var_subTypes_53856, var_subAttributes_53924, inArgument_parameter, inArgument_parentPath, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1689)) ;
                       }
                       {
-                      routine_displayOil (GALGAS_string ("    };"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1678)) ;
+                      routine_displayOil (GALGAS_string ("    };"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1691)) ;
                       }
-                      var_val_49953 = GALGAS_structAttribute::constructor_new (var_oil_5F_desc_50633, var_parameterValue_50817.readProperty_location (), var_parameterValue_50817, var_subAttributes_53477  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1680)) ;
+                      var_val_50400 = GALGAS_structAttribute::constructor_new (var_oil_5F_desc_51080, var_parameterValue_51264.readProperty_location (), var_parameterValue_51264, var_subAttributes_53924  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1693)) ;
                     }
                   }
                   if (kBoolFalse == test_35) {
                     TC_Array <C_FixItDescription> fixItArray37 ;
-                    inCompiler->emitSemanticError (var_valueType_50439.readProperty_location (), GALGAS_string ("Undefined valueType ").add_operation (var_valueType_50439.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1688)), fixItArray37  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1688)) ;
-                    var_val_49953.drop () ; // Release error dropped variable
-                    var_typeOk_50142 = GALGAS_bool (false) ;
+                    inCompiler->emitSemanticError (var_valueType_50886.readProperty_location (), GALGAS_string ("Undefined valueType ").add_operation (var_valueType_50886.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1701)), fixItArray37  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1701)) ;
+                    var_val_50400.drop () ; // Release error dropped variable
+                    var_typeOk_50589 = GALGAS_bool (false) ;
                   }
                 }
               }
@@ -1967,55 +2071,55 @@ void routine_arxmlDefinitionParameter (const GALGAS_implementationObjectMap cons
     }
   }
   {
-  routine_displayOil (GALGAS_string ("      /* ARXML Type :").add_operation (var_valueType_50439.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1692)).add_operation (GALGAS_string (" */\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1692)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1692)) ;
+  routine_displayOil (GALGAS_string ("      /* ARXML Type :").add_operation (var_valueType_50886.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1705)).add_operation (GALGAS_string (" */\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1705)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1705)) ;
   }
-  GALGAS_identifierMap var_idfs_60177 = ioArgument_identifiers.readProperty_objectParams () ;
+  GALGAS_identifierMap var_idfs_60624 = ioArgument_identifiers.readProperty_objectParams () ;
   enumGalgasBool test_38 = kBoolTrue ;
   if (kBoolTrue == test_38) {
-    test_38 = var_type_50168.readProperty_multiple ().boolEnum () ;
+    test_38 = var_type_50615.readProperty_multiple ().boolEnum () ;
     if (kBoolTrue == test_38) {
       enumGalgasBool test_39 = kBoolTrue ;
       if (kBoolTrue == test_39) {
-        test_39 = var_idfs_60177.getter_hasKey (var_parameterType_50094.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1699)).boolEnum () ;
+        test_39 = var_idfs_60624.getter_hasKey (var_parameterType_50541.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1712)).boolEnum () ;
         if (kBoolTrue == test_39) {
-          GALGAS_object_5F_t var_attributeList_60306 ;
+          GALGAS_object_5F_t var_attributeList_60753 ;
           {
-          var_idfs_60177.setter_del (var_parameterType_50094, var_attributeList_60306, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1703)) ;
+          var_idfs_60624.setter_del (var_parameterType_50541, var_attributeList_60753, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1716)) ;
           }
-          if (var_attributeList_60306.isValid ()) {
-            if (var_attributeList_60306.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
-              GALGAS_multipleAttribute cast_60509_multiAttribute ((cPtr_multipleAttribute *) var_attributeList_60306.ptr ()) ;
-              GALGAS_identifierList var_aList_60550 = cast_60509_multiAttribute.readProperty_items () ;
-              var_aList_60550.addAssign_operation (var_val_49953  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1707)) ;
-              var_val_49953 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1708)), cast_60509_multiAttribute.readProperty_location (), var_aList_60550  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1708)) ;
+          if (var_attributeList_60753.isValid ()) {
+            if (var_attributeList_60753.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
+              GALGAS_multipleAttribute cast_60509_multiAttribute ((cPtr_multipleAttribute *) var_attributeList_60753.ptr ()) ;
+              GALGAS_identifierList var_aList_60997 = cast_60509_multiAttribute.readProperty_items () ;
+              var_aList_60997.addAssign_operation (var_val_50400  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1720)) ;
+              var_val_50400 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1721)), cast_60509_multiAttribute.readProperty_location (), var_aList_60997  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1721)) ;
             }
           }
         }
       }
       if (kBoolFalse == test_39) {
-        GALGAS_identifierList var_aList_60820 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1713)) ;
-        GALGAS_object_5F_t var_defaultValue_60896 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_type_50168.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1715)) ;
-        if (var_defaultValue_60896.isValid ()) {
-          if (var_defaultValue_60896.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
-            GALGAS_multipleAttribute cast_61023_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_60896.ptr ()) ;
-            var_aList_60820 = cast_61023_multiAttribute.readProperty_items () ;
+        GALGAS_identifierList var_aList_61267 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1726)) ;
+        GALGAS_object_5F_t var_defaultValue_61343 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_type_50615.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1728)) ;
+        if (var_defaultValue_61343.isValid ()) {
+          if (var_defaultValue_61343.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
+            GALGAS_multipleAttribute cast_61023_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_61343.ptr ()) ;
+            var_aList_61267 = cast_61023_multiAttribute.readProperty_items () ;
           }
         }
-        var_aList_60820.addAssign_operation (var_val_49953  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1725)) ;
-        var_val_49953 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1727)), var_val_49953.readProperty_location (), var_aList_60820  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1727)) ;
+        var_aList_61267.addAssign_operation (var_val_50400  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1738)) ;
+        var_val_50400 = GALGAS_multipleAttribute::constructor_new (function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1740)), var_val_50400.readProperty_location (), var_aList_61267  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1740)) ;
       }
       enumGalgasBool test_40 = kBoolTrue ;
       if (kBoolTrue == test_40) {
-        test_40 = var_idfs_60177.getter_hasKey (var_parameterType_50094.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1729)).boolEnum () ;
+        test_40 = var_idfs_60624.getter_hasKey (var_parameterType_50541.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1742)).boolEnum () ;
         if (kBoolTrue == test_40) {
-          GALGAS_object_5F_t var_existingObject_61514 ;
+          GALGAS_object_5F_t var_existingObject_61961 ;
           {
-          var_idfs_60177.setter_del (var_parameterType_50094, var_existingObject_61514, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1733)) ;
+          var_idfs_60624.setter_del (var_parameterType_50541, var_existingObject_61961, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1746)) ;
           }
           {
-          var_val_49953.insulate (HERE) ;
-          cPtr_object_5F_t * ptr_61592 = (cPtr_object_5F_t *) var_val_49953.ptr () ;
-          callExtensionSetter_mergeSubAttributes ((cPtr_object_5F_t *) ptr_61592, var_existingObject_61514, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1734)) ;
+          var_val_50400.insulate (HERE) ;
+          cPtr_object_5F_t * ptr_61592 = (cPtr_object_5F_t *) var_val_50400.ptr () ;
+          callExtensionSetter_mergeSubAttributes ((cPtr_object_5F_t *) ptr_61592, var_existingObject_61961, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1747)) ;
           }
         }
       }
@@ -2023,15 +2127,15 @@ void routine_arxmlDefinitionParameter (const GALGAS_implementationObjectMap cons
   }
   enumGalgasBool test_41 = kBoolTrue ;
   if (kBoolTrue == test_41) {
-    test_41 = var_typeOk_50142.boolEnum () ;
+    test_41 = var_typeOk_50589.boolEnum () ;
     if (kBoolTrue == test_41) {
       {
-      var_idfs_60177.setter_put (var_parameterType_50094, var_val_49953, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1740)) ;
+      var_idfs_60624.setter_put (var_parameterType_50541, var_val_50400, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1753)) ;
       }
     }
   }
   {
-  ioArgument_identifiers.setter_setObjectParams (var_idfs_60177 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1742)) ;
+  ioArgument_identifiers.setter_setObjectParams (var_idfs_60624 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1755)) ;
   }
 }
 
@@ -2048,10 +2152,10 @@ void routine_testTypeError (GALGAS_dataType inArgument_type,
                             COMMA_UNUSED_LOCATION_ARGS) {
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsNotEqual, extensionGetter_arxmlType (inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1753)).objectCompare (inArgument_valueType.readProperty_string ())).boolEnum () ;
+    test_0 = GALGAS_bool (kIsNotEqual, extensionGetter_arxmlType (inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1766)).objectCompare (inArgument_valueType.readProperty_string ())).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (inArgument_valueType.readProperty_location (), GALGAS_string ("Expected oil type ").add_operation (extensionGetter_oilType (inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1754)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1754)).add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1754)).add_operation (GALGAS_string (" Found "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1754)).add_operation (inArgument_valueType.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1755)).add_operation (GALGAS_string (".\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1755)).add_operation (GALGAS_string (" Fix : Replace it with "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1755)).add_operation (extensionGetter_arxmlType (inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1756)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1756)), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1754)) ;
+      inCompiler->emitSemanticError (inArgument_valueType.readProperty_location (), GALGAS_string ("Expected oil type ").add_operation (extensionGetter_oilType (inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1767)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1767)).add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1767)).add_operation (GALGAS_string (" Found "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1767)).add_operation (inArgument_valueType.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1768)).add_operation (GALGAS_string (".\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1768)).add_operation (GALGAS_string (" Fix : Replace it with "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1768)).add_operation (extensionGetter_arxmlType (inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1769)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1769)), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1767)) ;
     }
   }
 }
@@ -2073,31 +2177,31 @@ void routine_oilEquivalentName (GALGAS_lstring inArgument_parentPath,
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (kIsEqual, inArgument_parentPath.readProperty_string ().objectCompare (inArgument_currentPath.readProperty_string ())).boolEnum () ;
     if (kBoolTrue == test_0) {
-      inArgument_parentPath.setter_setString (inArgument_parentPath.readProperty_string ().getter_stringByDeletingLastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1766)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1766)) ;
+      inArgument_parentPath.setter_setString (inArgument_parentPath.readProperty_string ().getter_stringByDeletingLastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1779)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1779)) ;
     }
   }
-  GALGAS_lstring var_objectKind_62451 = GALGAS_lstring::constructor_new (inArgument_currentPath.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1769)), inArgument_currentPath.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1769)) ;
-  GALGAS_string var_lastParent_62744 = inArgument_parentPath.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1774)).getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1774)) ;
+  GALGAS_lstring var_objectKind_62898 = GALGAS_lstring::constructor_new (inArgument_currentPath.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1782)), inArgument_currentPath.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1782)) ;
+  GALGAS_string var_lastParent_63191 = inArgument_parentPath.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 1787)).getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1787)) ;
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = GALGAS_bool (kIsEqual, var_lastParent_62744.objectCompare (GALGAS_string ("OSOS"))).boolEnum () ;
+    test_1 = GALGAS_bool (kIsEqual, var_lastParent_63191.objectCompare (GALGAS_string ("OSOS"))).boolEnum () ;
     if (kBoolTrue == test_1) {
-      var_lastParent_62744 = GALGAS_string ("OS") ;
+      var_lastParent_63191 = GALGAS_string ("OS") ;
     }
   }
-  GALGAS_uint var_lastParentLength_62986 = var_lastParent_62744.getter_count (SOURCE_FILE ("arxml_parser.galgas", 1782)) ;
+  GALGAS_uint var_lastParentLength_63433 = var_lastParent_63191.getter_count (SOURCE_FILE ("arxml_parser.galgas", 1795)) ;
   enumGalgasBool test_2 = kBoolTrue ;
   if (kBoolTrue == test_2) {
-    test_2 = GALGAS_bool (kIsEqual, var_objectKind_62451.readProperty_string ().getter_leftSubString (var_lastParentLength_62986 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1783)).getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1783)).objectCompare (var_lastParent_62744)).boolEnum () ;
+    test_2 = GALGAS_bool (kIsEqual, var_objectKind_62898.readProperty_string ().getter_leftSubString (var_lastParentLength_63433 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1796)).getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1796)).objectCompare (var_lastParent_63191)).boolEnum () ;
     if (kBoolTrue == test_2) {
-      var_objectKind_62451.setter_setString (var_objectKind_62451.readProperty_string ().getter_subStringFromIndex (var_lastParentLength_62986 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1785)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1785)) ;
-      var_objectKind_62451.setter_setString (var_objectKind_62451.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1786)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1786)) ;
-      outArgument_outName = var_objectKind_62451 ;
+      var_objectKind_62898.setter_setString (var_objectKind_62898.readProperty_string ().getter_subStringFromIndex (var_lastParentLength_63433 COMMA_SOURCE_FILE ("arxml_parser.galgas", 1798)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1798)) ;
+      var_objectKind_62898.setter_setString (var_objectKind_62898.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1799)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1799)) ;
+      outArgument_outName = var_objectKind_62898 ;
     }
   }
   if (kBoolFalse == test_2) {
     TC_Array <C_FixItDescription> fixItArray3 ;
-    inCompiler->emitSemanticError (var_objectKind_62451.readProperty_location (), GALGAS_string ("An object must be named by its Parent.\n ").add_operation (GALGAS_string ("Ex : If Task object has Os parent, then the DEFINITION-REF must be "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1789)).add_operation (GALGAS_string ("(...)/Os/OsTask.\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1790)).add_operation (GALGAS_string ("Fix : Add \""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1791)).add_operation (var_lastParent_62744, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1792)).add_operation (GALGAS_string ("\" to the name of your property."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1792)), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1789)) ;
+    inCompiler->emitSemanticError (var_objectKind_62898.readProperty_location (), GALGAS_string ("An object must be named by its Parent.\n ").add_operation (GALGAS_string ("Ex : If Task object has Os parent, then the DEFINITION-REF must be "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1802)).add_operation (GALGAS_string ("(...)/Os/OsTask.\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1803)).add_operation (GALGAS_string ("Fix : Add \""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1804)).add_operation (var_lastParent_63191, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1805)).add_operation (GALGAS_string ("\" to the name of your property."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1805)), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1802)) ;
     outArgument_outName.drop () ; // Release error dropped variable
   }
 }
@@ -2114,29 +2218,29 @@ void routine_arxmlGetDescription (GALGAS_arxmlElementValue inArgument_packageEle
                                   C_Compiler * inCompiler
                                   COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_description.drop () ; // Release 'out' argument
-  outArgument_description = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1801))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1801)) ;
+  outArgument_description = GALGAS_lstring::constructor_new (GALGAS_string::makeEmptyString (), GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1814))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1814)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("DESC"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1804)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("DESC"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1817)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_arxmlElementValue var_desc_63871 ;
-      callExtensionMethod_getElement ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("DESC"), var_desc_63871, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1805)) ;
-      callExtensionMethod_getAllTextsInSelf ((cPtr_arxmlElementValue *) var_desc_63871.ptr (), GALGAS_string (" "), outArgument_description, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1806)) ;
+      GALGAS_arxmlElementValue var_desc_64318 ;
+      callExtensionMethod_getElement ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("DESC"), var_desc_64318, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1818)) ;
+      callExtensionMethod_getAllTextsInSelf ((cPtr_arxmlElementValue *) var_desc_64318.ptr (), GALGAS_string (" "), outArgument_description, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1819)) ;
     }
   }
   enumGalgasBool test_1 = kBoolTrue ;
   if (kBoolTrue == test_1) {
-    test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("INTRODUCTION"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1808)).boolEnum () ;
+    test_1 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("INTRODUCTION"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1821)).boolEnum () ;
     if (kBoolTrue == test_1) {
-      GALGAS_arxmlElementValue var_desc_64056 ;
-      callExtensionMethod_getElement ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("INTRODUCTION"), var_desc_64056, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1809)) ;
-      callExtensionMethod_getAllTextsInSelf ((cPtr_arxmlElementValue *) var_desc_64056.ptr (), GALGAS_string (" "), outArgument_description, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1810)) ;
+      GALGAS_arxmlElementValue var_desc_64503 ;
+      callExtensionMethod_getElement ((cPtr_arxmlElementValue *) inArgument_packageElement.ptr (), GALGAS_string ("INTRODUCTION"), var_desc_64503, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1822)) ;
+      callExtensionMethod_getAllTextsInSelf ((cPtr_arxmlElementValue *) var_desc_64503.ptr (), GALGAS_string (" "), outArgument_description, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1823)) ;
     }
   }
-  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\n"), GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1814)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1814)) ;
-  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\r"), GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1817)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1817)) ;
-  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\\"), GALGAS_string ("\\\\"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1820)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1820)) ;
-  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\""), GALGAS_string ("\\\""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1823)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1823)) ;
+  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\n"), GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1827)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1827)) ;
+  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\r"), GALGAS_string (" "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1830)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1830)) ;
+  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\\"), GALGAS_string ("\\\\"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1833)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1833)) ;
+  outArgument_description.setter_setString (outArgument_description.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("\""), GALGAS_string ("\\\""), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1836)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1836)) ;
 }
 
 
@@ -2153,7 +2257,7 @@ void routine_displayOil (GALGAS_string inArgument_string,
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (gOption_goil_5F_options_arxmlDisplayOil.readProperty_value ()).boolEnum () ;
     if (kBoolTrue == test_0) {
-      inCompiler->printMessage (inArgument_string  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1832)) ;
+      inCompiler->printMessage (inArgument_string  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1845)) ;
     }
   }
 }
@@ -2173,30 +2277,30 @@ void routine_arxmlGetMultiplicity (GALGAS_arxmlElementValue inArgument_element,
   outArgument_multiple.drop () ; // Release 'out' argument
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_element.ptr (), GALGAS_string ("UPPER-MULTIPLICITY-INFINITE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1841)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_element.ptr (), GALGAS_string ("UPPER-MULTIPLICITY-INFINITE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1854)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_smultiple_65098 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_element.ptr (), GALGAS_string ("UPPER-MULTIPLICITY-INFINITE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1842)) ;
+      GALGAS_lstring var_smultiple_65545 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_element.ptr (), GALGAS_string ("UPPER-MULTIPLICITY-INFINITE"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1855)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        GALGAS_bool test_2 = GALGAS_bool (kIsEqual, var_smultiple_65098.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1844)).objectCompare (GALGAS_string ("TRUE"))) ;
+        GALGAS_bool test_2 = GALGAS_bool (kIsEqual, var_smultiple_65545.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1857)).objectCompare (GALGAS_string ("TRUE"))) ;
         if (kBoolTrue != test_2.boolEnum ()) {
-          test_2 = GALGAS_bool (kIsEqual, var_smultiple_65098.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
+          test_2 = GALGAS_bool (kIsEqual, var_smultiple_65545.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
         }
         test_1 = test_2.boolEnum () ;
         if (kBoolTrue == test_1) {
-          outArgument_multiple = GALGAS_lbool::constructor_new (GALGAS_bool (true), var_smultiple_65098.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1846)) ;
+          outArgument_multiple = GALGAS_lbool::constructor_new (GALGAS_bool (true), var_smultiple_65545.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1859)) ;
           {
-          routine_displayOil (GALGAS_string ("[]"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1847)) ;
+          routine_displayOil (GALGAS_string ("[]"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1860)) ;
           }
         }
       }
       if (kBoolFalse == test_1) {
-        outArgument_multiple = GALGAS_lbool::constructor_new (GALGAS_bool (false), var_smultiple_65098.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1849)) ;
+        outArgument_multiple = GALGAS_lbool::constructor_new (GALGAS_bool (false), var_smultiple_65545.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1862)) ;
       }
     }
   }
   if (kBoolFalse == test_0) {
-    outArgument_multiple = GALGAS_lbool::constructor_new (GALGAS_bool (false), inArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1852)) ;
+    outArgument_multiple = GALGAS_lbool::constructor_new (GALGAS_bool (false), inArgument_objectName.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1865)) ;
   }
 }
 
@@ -2214,19 +2318,19 @@ void routine_arxmlPopSign (GALGAS_lstring & ioArgument_value,
   outArgument_sign.drop () ; // Release 'out' argument
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsEqual, ioArgument_value.readProperty_string ().getter_characterAtIndex (GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1861)).objectCompare (GALGAS_char (TO_UNICODE (45)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsEqual, ioArgument_value.readProperty_string ().getter_characterAtIndex (GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1874)).objectCompare (GALGAS_char (TO_UNICODE (45)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       outArgument_sign = GALGAS_bool (true) ;
-      ioArgument_value.setter_setString (ioArgument_value.readProperty_string ().getter_subStringFromIndex (GALGAS_uint (uint32_t (1U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1863)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1863)) ;
+      ioArgument_value.setter_setString (ioArgument_value.readProperty_string ().getter_subStringFromIndex (GALGAS_uint (uint32_t (1U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1876)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1876)) ;
     }
   }
   if (kBoolFalse == test_0) {
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsEqual, ioArgument_value.readProperty_string ().getter_characterAtIndex (GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1864)).objectCompare (GALGAS_char (TO_UNICODE (43)))).boolEnum () ;
+      test_1 = GALGAS_bool (kIsEqual, ioArgument_value.readProperty_string ().getter_characterAtIndex (GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1877)).objectCompare (GALGAS_char (TO_UNICODE (43)))).boolEnum () ;
       if (kBoolTrue == test_1) {
         outArgument_sign = GALGAS_bool (false) ;
-        ioArgument_value.setter_setString (ioArgument_value.readProperty_string ().getter_subStringFromIndex (GALGAS_uint (uint32_t (1U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1866)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1866)) ;
+        ioArgument_value.setter_setString (ioArgument_value.readProperty_string ().getter_subStringFromIndex (GALGAS_uint (uint32_t (1U)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1879)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1879)) ;
       }
     }
     if (kBoolFalse == test_1) {
@@ -2250,20 +2354,20 @@ void routine_arxmlGetWithAuto (GALGAS_arxmlElementValue inArgument_parameter,
   outArgument_withAuto = GALGAS_bool (false) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("WITH-AUTO"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1877)).boolEnum () ;
+    test_0 = callExtensionGetter_hasElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("WITH-AUTO"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1890)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_lstring var_autoString_66006 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("WITH-AUTO"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1878)) ;
+      GALGAS_lstring var_autoString_66453 = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("WITH-AUTO"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1891)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        GALGAS_bool test_2 = GALGAS_bool (kIsEqual, var_autoString_66006.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1879)).objectCompare (GALGAS_string ("TRUE"))) ;
+        GALGAS_bool test_2 = GALGAS_bool (kIsEqual, var_autoString_66453.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1892)).objectCompare (GALGAS_string ("TRUE"))) ;
         if (kBoolTrue != test_2.boolEnum ()) {
-          test_2 = GALGAS_bool (kIsEqual, var_autoString_66006.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
+          test_2 = GALGAS_bool (kIsEqual, var_autoString_66453.readProperty_string ().objectCompare (GALGAS_string ("1"))) ;
         }
         test_1 = test_2.boolEnum () ;
         if (kBoolTrue == test_1) {
           outArgument_withAuto = GALGAS_bool (true) ;
           {
-          routine_displayOil (GALGAS_string (" WITH_AUTO"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1882)) ;
+          routine_displayOil (GALGAS_string (" WITH_AUTO"), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1895)) ;
           }
         }
       }
@@ -2283,8 +2387,8 @@ void routine_arxmlGetName (GALGAS_arxmlElementValue inArgument_parameter,
                            C_Compiler * inCompiler
                            COMMA_UNUSED_LOCATION_ARGS) {
   outArgument_objectName.drop () ; // Release 'out' argument
-  outArgument_objectName = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1892)) ;
-  outArgument_objectName.setter_setString (outArgument_objectName.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1893)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1893)) ;
+  outArgument_objectName = callExtensionGetter_getTextFromElement ((const cPtr_arxmlElementValue *) inArgument_parameter.ptr (), GALGAS_string ("SHORT-NAME"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1905)) ;
+  outArgument_objectName.setter_setString (outArgument_objectName.readProperty_string ().getter_uppercaseString (SOURCE_FILE ("arxml_parser.galgas", 1906)) COMMA_SOURCE_FILE ("arxml_parser.galgas", 1906)) ;
 }
 
 
@@ -2301,80 +2405,80 @@ void routine_arxmlInsertObjectAttribute (GALGAS_implementationObjectMap & ioArgu
                                          COMMA_UNUSED_LOCATION_ARGS) {
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = ioArgument_objectAttributes.getter_hasKey (inArgument_attributeName.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1901)).boolEnum () ;
+    test_0 = ioArgument_objectAttributes.getter_hasKey (inArgument_attributeName.readProperty_string () COMMA_SOURCE_FILE ("arxml_parser.galgas", 1914)).boolEnum () ;
     if (kBoolTrue == test_0) {
-      GALGAS_impType var_previousType_66643 ;
-      ioArgument_objectAttributes.method_get (inArgument_attributeName, var_previousType_66643, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1903)) ;
+      GALGAS_impType var_previousType_67090 ;
+      ioArgument_objectAttributes.method_get (inArgument_attributeName, var_previousType_67090, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1916)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
-        test_1 = var_previousType_66643.readProperty_multiple ().boolEnum () ;
+        test_1 = var_previousType_67090.readProperty_multiple ().boolEnum () ;
         if (kBoolTrue == test_1) {
-          GALGAS_object_5F_t var_previousDefaultValue_66977 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_previousType_66643.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1909)) ;
-          GALGAS_object_5F_t var_defaultValue_67051 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) inArgument_type.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1910)) ;
-          GALGAS_bool var_oneIsMultiple_67101 = GALGAS_bool (false) ;
+          GALGAS_object_5F_t var_previousDefaultValue_67424 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) var_previousType_67090.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1922)) ;
+          GALGAS_object_5F_t var_defaultValue_67498 = callExtensionGetter_getDefaultValue ((const cPtr_impType *) inArgument_type.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1923)) ;
+          GALGAS_bool var_oneIsMultiple_67548 = GALGAS_bool (false) ;
           enumGalgasBool test_2 = kBoolTrue ;
           if (kBoolTrue == test_2) {
-            test_2 = GALGAS_bool (var_previousDefaultValue_66977.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute).boolEnum () ;
+            test_2 = GALGAS_bool (var_previousDefaultValue_67424.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute).boolEnum () ;
             if (kBoolTrue == test_2) {
-              var_oneIsMultiple_67101 = GALGAS_bool (true) ;
+              var_oneIsMultiple_67548 = GALGAS_bool (true) ;
             }
           }
           if (kBoolFalse == test_2) {
             enumGalgasBool test_3 = kBoolTrue ;
             if (kBoolTrue == test_3) {
-              test_3 = GALGAS_bool (var_defaultValue_67051.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute).boolEnum () ;
+              test_3 = GALGAS_bool (var_defaultValue_67498.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute).boolEnum () ;
               if (kBoolTrue == test_3) {
-                var_oneIsMultiple_67101 = GALGAS_bool (true) ;
+                var_oneIsMultiple_67548 = GALGAS_bool (true) ;
               }
             }
           }
           enumGalgasBool test_4 = kBoolTrue ;
           if (kBoolTrue == test_4) {
-            test_4 = var_oneIsMultiple_67101.boolEnum () ;
+            test_4 = var_oneIsMultiple_67548.boolEnum () ;
             if (kBoolTrue == test_4) {
-              GALGAS_identifierList var_aList_67512 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1921)) ;
-              GALGAS_lstring var_desc_67548 = function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1922)) ;
-              GALGAS_location var_location_67588 = GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1923)) ;
-              if (var_previousDefaultValue_66977.isValid ()) {
-                if (var_previousDefaultValue_66977.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
-                  GALGAS_multipleAttribute cast_67708_multiAttribute ((cPtr_multipleAttribute *) var_previousDefaultValue_66977.ptr ()) ;
-                  var_aList_67512 = cast_67708_multiAttribute.readProperty_items () ;
-                  var_desc_67548 = cast_67708_multiAttribute.readProperty_oil_5F_desc () ;
-                  var_location_67588 = cast_67708_multiAttribute.readProperty_location () ;
+              GALGAS_identifierList var_aList_67959 = GALGAS_identifierList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 1934)) ;
+              GALGAS_lstring var_desc_67995 = function_emptyLString (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1935)) ;
+              GALGAS_location var_location_68035 = GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1936)) ;
+              if (var_previousDefaultValue_67424.isValid ()) {
+                if (var_previousDefaultValue_67424.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
+                  GALGAS_multipleAttribute cast_67708_multiAttribute ((cPtr_multipleAttribute *) var_previousDefaultValue_67424.ptr ()) ;
+                  var_aList_67959 = cast_67708_multiAttribute.readProperty_items () ;
+                  var_desc_67995 = cast_67708_multiAttribute.readProperty_oil_5F_desc () ;
+                  var_location_68035 = cast_67708_multiAttribute.readProperty_location () ;
                 }
               }
-              if (var_defaultValue_67051.isValid ()) {
-                if (var_defaultValue_67051.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
-                  GALGAS_multipleAttribute cast_67968_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_67051.ptr ()) ;
-                  var_aList_67512.plusAssign_operation(cast_67968_multiAttribute.readProperty_items (), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1936)) ;
+              if (var_defaultValue_67498.isValid ()) {
+                if (var_defaultValue_67498.dynamicTypeDescriptor () == & kTypeDescriptor_GALGAS_multipleAttribute) {
+                  GALGAS_multipleAttribute cast_67968_multiAttribute ((cPtr_multipleAttribute *) var_defaultValue_67498.ptr ()) ;
+                  var_aList_67959.plusAssign_operation(cast_67968_multiAttribute.readProperty_items (), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1949)) ;
                   enumGalgasBool test_5 = kBoolTrue ;
                   if (kBoolTrue == test_5) {
-                    test_5 = GALGAS_bool (kIsEqual, var_desc_67548.readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+                    test_5 = GALGAS_bool (kIsEqual, var_desc_67995.readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
                     if (kBoolTrue == test_5) {
-                      var_desc_67548 = cast_67968_multiAttribute.readProperty_oil_5F_desc () ;
+                      var_desc_67995 = cast_67968_multiAttribute.readProperty_oil_5F_desc () ;
                     }
                   }
                   enumGalgasBool test_6 = kBoolTrue ;
                   if (kBoolTrue == test_6) {
-                    test_6 = GALGAS_bool (kIsEqual, var_location_67588.objectCompare (GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1940)))).boolEnum () ;
+                    test_6 = GALGAS_bool (kIsEqual, var_location_68035.objectCompare (GALGAS_location::constructor_nowhere (SOURCE_FILE ("arxml_parser.galgas", 1953)))).boolEnum () ;
                     if (kBoolTrue == test_6) {
-                      var_location_67588 = cast_67968_multiAttribute.readProperty_location () ;
+                      var_location_68035 = cast_67968_multiAttribute.readProperty_location () ;
                     }
                   }
                 }
               }
-              GALGAS_object_5F_t var_newDefault_68305 = GALGAS_multipleAttribute::constructor_new (var_desc_67548, var_location_67588, var_aList_67512  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1946)) ;
+              GALGAS_object_5F_t var_newDefault_68752 = GALGAS_multipleAttribute::constructor_new (var_desc_67995, var_location_68035, var_aList_67959  COMMA_SOURCE_FILE ("arxml_parser.galgas", 1959)) ;
               {
               inArgument_type.insulate (HERE) ;
               cPtr_impType * ptr_68413 = (cPtr_impType *) inArgument_type.ptr () ;
-              callExtensionSetter_setDefValue ((cPtr_impType *) ptr_68413, var_newDefault_68305, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1949)) ;
+              callExtensionSetter_setDefValue ((cPtr_impType *) ptr_68413, var_newDefault_68752, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1962)) ;
               }
               {
               GALGAS_impType joker_68491 ; // Joker input parameter
-              ioArgument_objectAttributes.setter_del (inArgument_attributeName, joker_68491, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1951)) ;
+              ioArgument_objectAttributes.setter_del (inArgument_attributeName, joker_68491, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1964)) ;
               }
               {
-              ioArgument_objectAttributes.setter_put (inArgument_attributeName, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1952)) ;
+              ioArgument_objectAttributes.setter_put (inArgument_attributeName, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1965)) ;
               }
             }
           }
@@ -2382,14 +2486,14 @@ void routine_arxmlInsertObjectAttribute (GALGAS_implementationObjectMap & ioArgu
       }
       enumGalgasBool test_7 = kBoolTrue ;
       if (kBoolTrue == test_7) {
-        test_7 = function_checkNewTypeWithinPreviousType (inArgument_attributeName, var_previousType_66643, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1956)).boolEnum () ;
+        test_7 = function_checkNewTypeWithinPreviousType (inArgument_attributeName, var_previousType_67090, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1969)).boolEnum () ;
         if (kBoolTrue == test_7) {
           {
           GALGAS_impType joker_68775 ; // Joker input parameter
-          ioArgument_objectAttributes.setter_del (inArgument_attributeName, joker_68775, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1959)) ;
+          ioArgument_objectAttributes.setter_del (inArgument_attributeName, joker_68775, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1972)) ;
           }
           {
-          ioArgument_objectAttributes.setter_put (inArgument_attributeName, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1960)) ;
+          ioArgument_objectAttributes.setter_put (inArgument_attributeName, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1973)) ;
           }
         }
       }
@@ -2397,7 +2501,7 @@ void routine_arxmlInsertObjectAttribute (GALGAS_implementationObjectMap & ioArgu
   }
   if (kBoolFalse == test_0) {
     {
-    ioArgument_objectAttributes.setter_put (inArgument_attributeName, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1963)) ;
+    ioArgument_objectAttributes.setter_put (inArgument_attributeName, inArgument_type, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 1976)) ;
     }
   }
 }
@@ -2708,9 +2812,12 @@ const char * projectVersionString (void) {
 //
 //----------------------------------------------------------------------------------------------------------------------
 
-static void routine_before (C_Compiler * /* inCompiler */
+static void routine_before (C_Compiler * inCompiler
                             COMMA_UNUSED_LOCATION_ARGS) {
   {
+    {
+    routine_startPhaseTiming (GALGAS_bool (gOption_goil_5F_options_timings.readProperty_value ()), GALGAS_string (gOption_goil_5F_options_timingsFormat.readProperty_value ()), inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 29)) ;
+    }
   }
 }
 
@@ -2721,9 +2828,12 @@ static void routine_before (C_Compiler * /* inCompiler */
 //
 //----------------------------------------------------------------------------------------------------------------------
 
-static void routine_after (C_Compiler * /* inCompiler */
+static void routine_after (C_Compiler * inCompiler
                            COMMA_UNUSED_LOCATION_ARGS) {
   {
+    {
+    routine_printPhaseTimingReport (GALGAS_string (gOption_goil_5F_options_timingsFormat.readProperty_value ()), inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 87)) ;
+    }
   }
 }
 
@@ -2737,10 +2847,29 @@ static void routine_after (C_Compiler * /* inCompiler */
 static void routine_programRule_5F__30_ (const GALGAS_lstring constinArgument_inSourceFile,
                                          C_Compiler * inCompiler
                                          COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool var_upToDate_975 ;
   {
-  routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 33)) ;
+  routine_checkBuildManifest (constinArgument_inSourceFile, var_upToDate_975, inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 34)) ;
+  }
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = var_upToDate_975.operator_not (SOURCE_FILE ("goil_program.galgas", 35)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      {
+      routine_beginPhase (constinArgument_inSourceFile.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("goil_program.galgas", 36)), inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 36)) ;
+      }
+      {
+      routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 37)) ;
+      }
+      cGrammar_goil_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile  COMMA_SOURCE_FILE ("goil_program.galgas", 38)) ;
+      {
+      routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 39)) ;
+      }
+      {
+      routine_storeBuildManifest (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 40)) ;
+      }
+    }
   }
-  cGrammar_goil_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile  COMMA_SOURCE_FILE ("goil_program.galgas", 34)) ;
 }
 
 
@@ -2753,10 +2882,29 @@ static void routine_programRule_5F__30_ (const GALGAS_lstring constinArgument_in
 static void routine_programRule_5F__31_ (const GALGAS_lstring constinArgument_inSourceFile,
                                          C_Compiler * inCompiler
                                          COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool var_upToDate_1337 ;
   {
-  routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 38)) ;
+  routine_checkBuildManifest (constinArgument_inSourceFile, var_upToDate_1337, inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 45)) ;
+  }
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = var_upToDate_1337.operator_not (SOURCE_FILE ("goil_program.galgas", 46)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      {
+      routine_beginPhase (constinArgument_inSourceFile.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("goil_program.galgas", 47)), inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 47)) ;
+      }
+      {
+      routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 48)) ;
+      }
+      cGrammar_goil_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile  COMMA_SOURCE_FILE ("goil_program.galgas", 49)) ;
+      {
+      routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 50)) ;
+      }
+      {
+      routine_storeBuildManifest (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 51)) ;
+      }
+    }
   }
-  cGrammar_goil_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile  COMMA_SOURCE_FILE ("goil_program.galgas", 39)) ;
 }
 
 
@@ -2781,13 +2929,59 @@ static void routine_programRule_5F__32_ (const GALGAS_lstring /* constinArgument
 static void routine_programRule_5F__33_ (const GALGAS_lstring constinArgument_inSourceFile,
                                          C_Compiler * inCompiler
                                          COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool var_upToDate_1828 ;
   {
-  routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 48)) ;
+  routine_checkBuildManifest (constinArgument_inSourceFile, var_upToDate_1828, inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 61)) ;
+  }
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = var_upToDate_1828.operator_not (SOURCE_FILE ("goil_program.galgas", 62)).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      {
+      routine_beginPhase (constinArgument_inSourceFile.readProperty_string ().getter_lastPathComponent (SOURCE_FILE ("goil_program.galgas", 63)), inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 63)) ;
+      }
+      {
+      routine_checkTemplatesPath (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 64)) ;
+      }
+      GALGAS_arxmlNode var_root_1969 ;
+      enumGalgasBool test_1 = kBoolTrue ;
+      if (kBoolTrue == test_1) {
+        test_1 = GALGAS_bool (gOption_goil_5F_options_arxmlLegacyParser.readProperty_value ()).boolEnum () ;
+        if (kBoolTrue == test_1) {
+          var_root_1969.drop () ;
+          cGrammar_arxml_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile, var_root_1969, GALGAS_bool (true), GALGAS_bool (true)  COMMA_SOURCE_FILE ("goil_program.galgas", 67)) ;
+        }
+      }
+      if (kBoolFalse == test_1) {
+        {
+        routine_beginPhase (GALGAS_string ("parsing"), inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 72)) ;
+        }
+        GALGAS_bool var_ok_2237 ;
+        {
+        routine_readArxmlFile (constinArgument_inSourceFile, GALGAS_bool (true), GALGAS_bool (true), var_root_1969, var_ok_2237, inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 73)) ;
+        }
+        {
+        routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 74)) ;
+        }
+        enumGalgasBool test_2 = kBoolTrue ;
+        if (kBoolTrue == test_2) {
+          test_2 = var_ok_2237.boolEnum () ;
+          if (kBoolTrue == test_2) {
+            {
+            routine_arxmlCompileRootNode (var_root_1969, inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 76)) ;
+            }
+          }
+        }
+      }
+      callExtensionMethod_print ((cPtr_arxmlNode *) var_root_1969.ptr (), GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("goil_program.galgas", 79)) ;
+      {
+      routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 80)) ;
+      }
+      {
+      routine_storeBuildManifest (inCompiler  COMMA_SOURCE_FILE ("goil_program.galgas", 81)) ;
+      }
+    }
   }
-  GALGAS_arxmlNode var_root_1354 ;
-  var_root_1354.drop () ;
-  cGrammar_arxml_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile, var_root_1354, GALGAS_bool (true), GALGAS_bool (true)  COMMA_SOURCE_FILE ("goil_program.galgas", 49)) ;
-  callExtensionMethod_print ((cPtr_arxmlNode *) var_root_1354.ptr (), GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("goil_program.galgas", 53)) ;
 }
 
 
@@ -8579,10 +8579,16 @@ class cGrammar_goil_5F_object_5F_level_5F_include : public cParser_goil_5F_synta
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_arxmlDisplayOil ;
 
+extern C_BoolCommandLineOption gOption_goil_5F_options_arxmlLegacyParser ;
+
+extern C_BoolCommandLineOption gOption_goil_5F_options_force ;
+
 extern C_BoolCommandLineOption gOption_goil_5F_options_generate_5F_log ;
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_pierreOption ;
 
+extern C_BoolCommandLineOption gOption_goil_5F_options_timings ;
+
 extern C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ;
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -8591,6 +8597,8 @@ extern C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ;
 //
 //----------------------------------------------------------------------------------------------------------------------
 
+extern C_UIntCommandLineOption gOption_goil_5F_options_gtlJobs ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String options                                                   
@@ -8609,6 +8617,8 @@ extern C_StringCommandLineOption gOption_goil_5F_options_target_5F_platform ;
 
 extern C_StringCommandLineOption gOption_goil_5F_options_template_5F_dir ;
 
+extern C_StringCommandLineOption gOption_goil_5F_options_timingsFormat ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //                              String List options                                              
@@ -5,6 +5,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include "galgas2/C_BuildManifest.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #include "all-declarations-3.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -5118,6 +5122,8 @@ void cPtr_gtlTemplate::method_execute (GALGAS_gtlContext & ioArgument_context,
                                        GALGAS_string & ioArgument_outputString,
                                        C_Compiler * inCompiler
                                        COMMA_UNUSED_LOCATION_ARGS) {
+  const cGtlProfilerFrame profilerFrame (this, "template", this->mProperty_path, GALGAS_location ()) ;
+  noteBuildManifestInput (this->mProperty_path) ;
   extensionMethod_execute (this->mProperty_program, ioArgument_context, ioArgument_vars, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 269)) ;
 }
 
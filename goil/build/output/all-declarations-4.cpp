@@ -5,6 +5,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include "galgas2/C_BuildManifest.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #include "all-declarations-4.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -504,6 +508,8 @@ GALGAS_gtlData cPtr_gtlFunction::getter_call (const GALGAS_location constinArgum
                                               const GALGAS_gtlDataList constinArgument_actualArguments,
                                               C_Compiler * inCompiler
                                               COMMA_UNUSED_LOCATION_ARGS) const {
+  const cGtlProfilerFrame profilerFrame (this, "function", this->mProperty_name.mProperty_string, this->mProperty_where) ;
+  noteBuildManifestInput (this->mProperty_where) ;
   GALGAS_gtlData result_result ; // Returned variable
   GALGAS_gtlData var_funcVariableMap_2844 ;
   GALGAS_bool var_ok_2871 ;
@@ -766,6 +772,8 @@ GALGAS_gtlData cPtr_gtlGetter::getter_callGetter (const GALGAS_location constinA
                                                   const GALGAS_gtlDataList constinArgument_actualArguments,
                                                   C_Compiler * inCompiler
                                                   COMMA_UNUSED_LOCATION_ARGS) const {
+  const cGtlProfilerFrame profilerFrame (this, "getter", this->mProperty_name.mProperty_string, this->mProperty_where) ;
+  noteBuildManifestInput (this->mProperty_where) ;
   GALGAS_gtlData result_result ; // Returned variable
   GALGAS_gtlData var_getterVariableMap_3674 ;
   GALGAS_bool var_ok_3703 ;
@@ -1055,6 +1063,8 @@ void cPtr_gtlSetter::method_callSetter (const GALGAS_location constinArgument_fr
                                         const GALGAS_gtlDataList constinArgument_actualArguments,
                                         C_Compiler * inCompiler
                                         COMMA_UNUSED_LOCATION_ARGS) {
+  const cGtlProfilerFrame profilerFrame (this, "setter", this->mProperty_name.mProperty_string, this->mProperty_where) ;
+  noteBuildManifestInput (this->mProperty_where) ;
   GALGAS_gtlData var_setterVariableMap_4705 ;
   GALGAS_bool var_ok_4734 ;
   const GALGAS_gtlSetter temp_0 = this ;
@@ -488,6 +488,31 @@ class cPtr_gtlWriteToInstruction : public cPtr_gtlInstruction {
 
 } ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Parallel execution of the 'write to' blocks of a root template. While an instance is alive, the 'write to' blocks
+//  executed with the root library may be handed over to worker threads; replayPendingBlocks performs, in program
+//  order, the output and the file writes of the blocks that have not been replayed yet. The destructor waits for
+//  the worker threads and drops what has not been replayed (an exception is propagating).
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlWriteToScope final {
+  public: cGtlWriteToScope (GALGAS_library & ioRootLibrary,
+                            C_Compiler * inCompiler) ;
+
+  public: ~ cGtlWriteToScope (void) ;
+
+  public: void replayPendingBlocks (void) ;
+
+//--- No copy
+  private: cGtlWriteToScope (const cGtlWriteToScope &) = delete ;
+  private: cGtlWriteToScope & operator = (const cGtlWriteToScope &) = delete ;
+
+//--- Private properties
+  private: class C_OrderedJobScheduler * mScheduler ;
+} ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 // Phase 1: @gtlTemplateInstruction  value class
@@ -3339,148 +3339,59 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_
                                                                                  const GALGAS_bool constinArgument_doNotCondenseWhiteSpaces,
                                                                                  C_Lexique_arxml_5F_scanner * inCompiler) {
   outArgument_rootNode.drop () ; // Release 'out' argument
-  GALGAS_implementation var_imp_928 = GALGAS_implementation::constructor_new (GALGAS_implementationMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 36))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 36)) ;
-  GALGAS_applicationDefinition var_application_1014 = function_emptyApplicationDefinition (inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 37)) ;
-  GALGAS_string var_fileIncludeList_1067 = GALGAS_string::makeEmptyString () ;
-  GALGAS_bool var_debug_1100 = GALGAS_bool (false) ;
-  GALGAS_string var_s_1234 = GALGAS_string::constructor_retrieveAndResetTemplateString (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 44)) ;
+  GALGAS_string var_s_1029 = GALGAS_string::constructor_retrieveAndResetTemplateString (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 39)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = GALGAS_bool (kIsStrictSup, var_s_1234.getter_count (SOURCE_FILE ("arxml_parser.galgas", 45)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
+    test_0 = GALGAS_bool (kIsStrictSup, var_s_1029.getter_count (SOURCE_FILE ("arxml_parser.galgas", 40)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
     if (kBoolTrue == test_0) {
       TC_Array <C_FixItDescription> fixItArray1 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 46)), GALGAS_string ("No character is allowed before XML header"), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 46)) ;
+      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 41)), GALGAS_string ("No character is allowed before XML header"), fixItArray1  COMMA_SOURCE_FILE ("arxml_parser.galgas", 41)) ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)) ;
-  GALGAS_lstring var_name_1409 = inCompiler->synthetizedAttribute_tokenString () ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
-  GALGAS_arxmlAttributeMap var_attributes_1436 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 52)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 44)) ;
+  GALGAS_lstring var_name_1204 = inCompiler->synthetizedAttribute_tokenString () ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 45)) ;
+  GALGAS_arxmlAttributeMap var_attributes_1231 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 47)) ;
   bool repeatFlag_2 = true ;
   while (repeatFlag_2) {
     if (select_arxml_5F_parser_0 (inCompiler) == 2) {
-      GALGAS_lstring var_attributeName_1501 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 56)) ;
-      GALGAS_lstring var_attributeValue_1549 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 57)) ;
+      GALGAS_lstring var_attributeName_1296 = inCompiler->synthetizedAttribute_tokenString () ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 51)) ;
+      GALGAS_lstring var_attributeValue_1344 = inCompiler->synthetizedAttribute_tokenString () ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 52)) ;
       {
-      var_attributes_1436.setter_insertKey (var_attributeName_1501, var_attributeValue_1549, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 58)) ;
+      var_attributes_1231.setter_insertKey (var_attributeName_1296, var_attributeValue_1344, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 53)) ;
       }
     }else{
       repeatFlag_2 = false ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
-  GALGAS_arxmlNodeList var_nodes_1672 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 62)) ;
-  nt_element_5F_list_ (var_nodes_1672, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
-  outArgument_rootNode = GALGAS_arxmlElementNode::constructor_new (var_name_1409, var_attributes_1436, var_nodes_1672  COMMA_SOURCE_FILE ("arxml_parser.galgas", 68)) ;
-  GALGAS_lstring var_autosarVersion_1991 ;
-  GALGAS_lstring var_autosarDescription_2021 ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
+  GALGAS_arxmlNodeList var_nodes_1467 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 57)) ;
+  nt_element_5F_list_ (var_nodes_1467, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
+  outArgument_rootNode = GALGAS_arxmlElementNode::constructor_new (var_name_1204, var_attributes_1231, var_nodes_1467  COMMA_SOURCE_FILE ("arxml_parser.galgas", 63)) ;
   {
-  routine_getAutosarVersion (outArgument_rootNode, var_autosarVersion_1991, var_autosarDescription_2021, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 81)) ;
+  routine_arxmlCompileRootNode (outArgument_rootNode, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 74)) ;
   }
-  enumGalgasBool test_3 = kBoolTrue ;
-  if (kBoolTrue == test_3) {
-    test_3 = GALGAS_bool (kIsEqual, var_autosarVersion_1991.readProperty_string ().objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
-    if (kBoolTrue == test_3) {
-      TC_Array <C_FixItDescription> fixItArray4 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 84)), GALGAS_string ("[TPS_ECUC_06005][TPS_ECUC_08053] : Missing AUTOSAR version"), fixItArray4  COMMA_SOURCE_FILE ("arxml_parser.galgas", 84)) ;
-    }
-  }
-  GALGAS_stringlist var_autosarVlist_2316 = var_autosarVersion_1991.readProperty_string ().getter_componentsSeparatedByString (GALGAS_string (".") COMMA_SOURCE_FILE ("arxml_parser.galgas", 88)) ;
-  GALGAS_string var_versionFirst_2421 ;
-  {
-  var_autosarVlist_2316.setter_popFirst (var_versionFirst_2421, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 89)) ;
-  }
-  GALGAS_string var_versionSecond_2475 ;
-  {
-  var_autosarVlist_2316.setter_popFirst (var_versionSecond_2475, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 90)) ;
-  }
-  GALGAS_lstring var_autosarShortVersion_2505 = GALGAS_lstring::constructor_new (var_versionFirst_2421.add_operation (GALGAS_string ("."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 91)).add_operation (var_versionSecond_2475, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 91)), var_autosarVersion_1991.readProperty_location ()  COMMA_SOURCE_FILE ("arxml_parser.galgas", 91)) ;
-  {
-  routine_displayOil (GALGAS_string ("\nOIL_VERSION = \"").add_operation (var_autosarShortVersion_2505.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)).add_operation (GALGAS_string ("\";\n\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)), inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 93)) ;
-  }
-  {
-  var_application_1014.setter_setVersion (var_autosarShortVersion_2505 COMMA_SOURCE_FILE ("arxml_parser.galgas", 95)) ;
-  }
-  {
-  var_application_1014.setter_setVersionDescription (var_autosarDescription_2021 COMMA_SOURCE_FILE ("arxml_parser.galgas", 96)) ;
-  }
-  GALGAS_string var_autosarVersionNoDot_3010 = var_autosarVersion_1991.readProperty_string ().getter_stringByReplacingStringByString (GALGAS_string ("."), GALGAS_string ("-"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 105)) ;
-  GALGAS_string var_autosarMetaFile_3169 = GALGAS_string ("AUTOSAR_").add_operation (var_autosarVersionNoDot_3010, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 107)).add_operation (GALGAS_string (".xsd"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 107)) ;
-  GALGAS_string var_filePath_3243 = function_templates_5F_directory (GALGAS_string ("arxmlMeta"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 108)).add_operation (var_autosarMetaFile_3169, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 108)) ;
-  GALGAS_arxmlMetaClassMap var_classMap_3327 ;
-  enumGalgasBool test_5 = kBoolTrue ;
-  if (kBoolTrue == test_5) {
-    test_5 = var_filePath_3243.getter_fileExists (SOURCE_FILE ("arxml_parser.galgas", 111)).operator_not (SOURCE_FILE ("arxml_parser.galgas", 111)).boolEnum () ;
-    if (kBoolTrue == test_5) {
-      TC_Array <C_FixItDescription> fixItArray6 ;
-      inCompiler->emitSemanticError (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)), GALGAS_string ("The corresponding metafile ").add_operation (var_filePath_3243, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string (" does not"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string (" exists. The Metamodel can be found here : "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)).add_operation (GALGAS_string ("http://www.autosar.org/specification -> Methodology and Templates -> "), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 113)).add_operation (GALGAS_string ("Templates -> AUTOSAR_MMOD_XMLSchema.zip."), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 114)), fixItArray6  COMMA_SOURCE_FILE ("arxml_parser.galgas", 112)) ;
-    }
-  }
-  var_classMap_3327.drop () ;
-  cGrammar_arxmlmetaparser_5F_grammar::_performSourceFileParsing_ (inCompiler, function_lstringWith (var_filePath_3243, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)), var_classMap_3327, var_debug_1100  COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)) ;
-  GALGAS_arxmlElementValue var_rootValue_3900 ;
-  {
-  routine_nodeToClass (outArgument_rootNode, var_classMap_3327, var_rootValue_3900, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 124)) ;
-  }
-  {
-  routine_includeConfigs (var_imp_928, var_application_1014, var_fileIncludeList_1067, var_autosarShortVersion_2505, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 136)) ;
-  }
-  {
-  routine_convertToOil (var_imp_928, var_application_1014, var_rootValue_3900, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 143)) ;
-  }
-  callExtensionMethod_checkObjectReferences ((cPtr_implementation *) var_imp_928.ptr (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 154)) ;
-  enumGalgasBool test_7 = kBoolTrue ;
-  if (kBoolTrue == test_7) {
-    test_7 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 156)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
-    if (kBoolTrue == test_7) {
-      {
-      routine_setDefaults (var_imp_928, var_application_1014, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 157)) ;
-      }
-    }
-  }
-  enumGalgasBool test_8 = kBoolTrue ;
-  if (kBoolTrue == test_8) {
-    test_8 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 164)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
-    if (kBoolTrue == test_8) {
-      {
-      routine_verifyAll (var_imp_928, var_application_1014, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 165)) ;
-      }
-    }
-  }
-  enumGalgasBool test_9 = kBoolTrue ;
-  if (kBoolTrue == test_9) {
-    test_9 = GALGAS_bool (kIsEqual, GALGAS_uint::constructor_errorCount (SOURCE_FILE ("arxml_parser.galgas", 167)).objectCompare (GALGAS_uint (uint32_t (0U)))).boolEnum () ;
-    if (kBoolTrue == test_9) {
-      GALGAS_gtlData var_templateData_5216 = callExtensionGetter_templateData ((const cPtr_applicationDefinition *) var_application_1014.ptr (), var_imp_928, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 168)) ;
-      {
-      routine_generate_5F_all (var_templateData_5216, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 171)) ;
-      }
-    }
-  }
-  var_fileIncludeList_1067 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 174)).add_operation (GALGAS_string (":"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)).add_operation (var_fileIncludeList_1067, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)).add_operation (GALGAS_string ("\n"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 174)) ;
-  GALGAS_string var_oilDepFileName_5529 = GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 175)).getter_stringByDeletingLastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 175)).add_operation (GALGAS_string ("/build/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 175)).add_operation (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 176)).getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 176)), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 176)).add_operation (GALGAS_string (".dep"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 176)) ;
-  var_fileIncludeList_1067.method_writeToFile (var_oilDepFileName_5529, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 178)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_parse (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)) ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 44)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 45)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     if (select_arxml_5F_parser_0 (inCompiler) == 2) {
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 56)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 57)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 51)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 52)) ;
     }else{
       repeatFlag_0 = false ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
   nt_element_5F_list_parse (inCompiler) ;
   inCompiler->resetTemplateString () ;
 }
@@ -3488,19 +3399,19 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_p
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_indexing (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 49)) ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__3F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 44)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 45)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     if (select_arxml_5F_parser_0 (inCompiler) == 2) {
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 56)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 57)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 50)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 51)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 52)) ;
     }else{
       repeatFlag_0 = false ;
     }
   }
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 55)) ;
   nt_element_5F_list_indexing (inCompiler) ;
 }
 
@@ -3514,7 +3425,7 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_5F_list_i1_ (GALGAS_a
   while (repeatFlag_0) {
     if (select_arxml_5F_parser_1 (inCompiler) == 2) {
       {
-      routine_addText (ioArgument_nodes, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 193)) ;
+      routine_addText (ioArgument_nodes, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 87)) ;
       }
       nt_element_ (ioArgument_nodes, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
     }else{
@@ -3556,13 +3467,13 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_ (GALGAS_arxmlNode
                                                                 const GALGAS_bool constinArgument_includeComments,
                                                                 const GALGAS_bool /* constinArgument_doNotCondenseWhiteSpaces */,
                                                                 C_Lexique_arxml_5F_scanner * inCompiler) {
-  GALGAS_lstring var_commentString_6445 = inCompiler->synthetizedAttribute_tokenString () ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)) ;
+  GALGAS_lstring var_commentString_2418 = inCompiler->synthetizedAttribute_tokenString () ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 104)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = constinArgument_includeComments.boolEnum () ;
     if (kBoolTrue == test_0) {
-      ioArgument_nodes.addAssign_operation (GALGAS_arxmlCommentNode::constructor_new (var_commentString_6445  COMMA_SOURCE_FILE ("arxml_parser.galgas", 212))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 212)) ;
+      ioArgument_nodes.addAssign_operation (GALGAS_arxmlCommentNode::constructor_new (var_commentString_2418  COMMA_SOURCE_FILE ("arxml_parser.galgas", 106))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 106)) ;
     }
   }
 }
@@ -3570,14 +3481,14 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_ (GALGAS_arxmlNode
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_parse (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 104)) ;
   inCompiler->resetTemplateString () ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_indexing (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 104)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -3586,80 +3497,80 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNode
                                                                 const GALGAS_bool constinArgument_includeComments,
                                                                 const GALGAS_bool constinArgument_doNotCondenseWhiteSpaces,
                                                                 C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
-  GALGAS_lstring var_name_6779 = inCompiler->synthetizedAttribute_tokenString () ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 224)) ;
-  GALGAS_arxmlAttributeMap var_attributeMap_6805 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 225)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)) ;
+  GALGAS_lstring var_name_2752 = inCompiler->synthetizedAttribute_tokenString () ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)) ;
+  GALGAS_arxmlAttributeMap var_attributeMap_2778 = GALGAS_arxmlAttributeMap::constructor_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 119)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     if (select_arxml_5F_parser_2 (inCompiler) == 2) {
-      GALGAS_lstring var_attributeName_6872 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 228)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 229)) ;
-      GALGAS_lstring var_attributeValue_6920 = inCompiler->synthetizedAttribute_tokenString () ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 230)) ;
+      GALGAS_lstring var_attributeName_2845 = inCompiler->synthetizedAttribute_tokenString () ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 122)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 123)) ;
+      GALGAS_lstring var_attributeValue_2893 = inCompiler->synthetizedAttribute_tokenString () ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 124)) ;
       {
-      var_attributeMap_6805.setter_insertKey (var_attributeName_6872, var_attributeValue_6920, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 231)) ;
+      var_attributeMap_2778.setter_insertKey (var_attributeName_2845, var_attributeValue_2893, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 125)) ;
       }
     }else{
       repeatFlag_0 = false ;
     }
   }
-  GALGAS_arxmlNodeList var_nodeList_7021 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 234)) ;
+  GALGAS_arxmlNodeList var_nodeList_2994 = GALGAS_arxmlNodeList::constructor_emptyList (SOURCE_FILE ("arxml_parser.galgas", 128)) ;
   switch (select_arxml_5F_parser_3 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 130)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 238)) ;
-    nt_element_5F_list_ (var_nodeList_7021, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 132)) ;
+    nt_element_5F_list_ (var_nodeList_2994, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
     {
-    routine_addText (var_nodeList_7021, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 244)) ;
+    routine_addText (var_nodeList_2994, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 138)) ;
     }
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 246)) ;
-    GALGAS_lstring var_closingName_7257 = inCompiler->synthetizedAttribute_tokenString () ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 247)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 140)) ;
+    GALGAS_lstring var_closingName_3230 = inCompiler->synthetizedAttribute_tokenString () ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 141)) ;
     enumGalgasBool test_1 = kBoolTrue ;
     if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsNotEqual, var_closingName_7257.readProperty_string ().objectCompare (var_name_6779.readProperty_string ())).boolEnum () ;
+      test_1 = GALGAS_bool (kIsNotEqual, var_closingName_3230.readProperty_string ().objectCompare (var_name_2752.readProperty_string ())).boolEnum () ;
       if (kBoolTrue == test_1) {
         TC_Array <C_FixItDescription> fixItArray2 ;
-        inCompiler->emitSemanticError (var_closingName_7257.readProperty_location (), GALGAS_string ("incorrect closing tag </").add_operation (var_closingName_7257.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)).add_operation (GALGAS_string ("> instead of </"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (var_name_6779.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (GALGAS_string (">"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)), fixItArray2  COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)) ;
+        inCompiler->emitSemanticError (var_closingName_3230.readProperty_location (), GALGAS_string ("incorrect closing tag </").add_operation (var_closingName_3230.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 143)).add_operation (GALGAS_string ("> instead of </"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 144)).add_operation (var_name_2752.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 144)).add_operation (GALGAS_string (">"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 144)), fixItArray2  COMMA_SOURCE_FILE ("arxml_parser.galgas", 143)) ;
       }
     }
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 252)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 146)) ;
   } break ;
   default:
     break ;
   }
-  ioArgument_nodes.addAssign_operation (GALGAS_arxmlElementNode::constructor_new (var_name_6779, var_attributeMap_6805, var_nodeList_7021  COMMA_SOURCE_FILE ("arxml_parser.galgas", 255))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 255)) ;
+  ioArgument_nodes.addAssign_operation (GALGAS_arxmlElementNode::constructor_new (var_name_2752, var_attributeMap_2778, var_nodeList_2994  COMMA_SOURCE_FILE ("arxml_parser.galgas", 149))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 149)) ;
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_parse (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 224)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     if (select_arxml_5F_parser_2 (inCompiler) == 2) {
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 228)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 229)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 230)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 122)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 123)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 124)) ;
     }else{
       repeatFlag_0 = false ;
     }
   }
   switch (select_arxml_5F_parser_3 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 130)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 238)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 132)) ;
     nt_element_5F_list_parse (inCompiler) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 246)) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 247)) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 252)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 140)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 141)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 146)) ;
   } break ;
   default:
     break ;
@@ -3670,28 +3581,28 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_parse (C_Lexique_a
 //---------------------------------------------------------------------------------------------------------------------*
 
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_indexing (C_Lexique_arxml_5F_scanner * inCompiler) {
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
-  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 224)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 117)) ;
+  inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 118)) ;
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
     if (select_arxml_5F_parser_2 (inCompiler) == 2) {
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 228)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 229)) ;
-      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 230)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 122)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3D_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 123)) ;
+      inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_value COMMA_SOURCE_FILE ("arxml_parser.galgas", 124)) ;
     }else{
       repeatFlag_0 = false ;
     }
   }
   switch (select_arxml_5F_parser_3 (inCompiler)) {
   case 1: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 236)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__2F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 130)) ;
   } break ;
   case 2: {
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 238)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 132)) ;
     nt_element_5F_list_indexing (inCompiler) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 246)) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 247)) ;
-    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 252)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 140)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 141)) ;
+    inCompiler->acceptTerminal (C_Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 146)) ;
   } break ;
   default:
     break ;
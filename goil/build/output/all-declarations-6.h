@@ -1292,6 +1292,30 @@ void routine_addText (class GALGAS_arxmlNodeList & ioArgument0,
                       class C_Compiler * inCompiler
                       COMMA_LOCATION_ARGS) ;
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'arxmlCompileRootNode'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_arxmlCompileRootNode (class GALGAS_arxmlNode inArgument0,
+                                   class C_Compiler * inCompiler
+                                   COMMA_LOCATION_ARGS) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//Routine 'readArxmlFile'
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+void routine_readArxmlFile (const class GALGAS_lstring constinArgument0,
+                            const class GALGAS_bool constinArgument1,
+                            const class GALGAS_bool constinArgument2,
+                            class GALGAS_arxmlNode & outArgument3,
+                            class GALGAS_bool & outArgument4,
+                            class C_Compiler * inCompiler
+                            COMMA_LOCATION_ARGS) ;
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Routine 'convertToOil'
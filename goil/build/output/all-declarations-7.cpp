@@ -5,6 +5,16 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include "files/C_FileManager.h"
+#include "galgas2/C_BuildManifest.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #include "all-declarations-7.h"
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3199,6 +3209,114 @@ GALGAS_lstring callExtensionGetter_fullPrefix (const cPtr_gtlContext * inObject,
   return result ;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Template file name resolution cache
+//
+//  A template instruction looks for its file in each directory of the target path, from the most specific one. The
+//  template directories do not change while goil runs: each directory is listed once, the existence of a candidate
+//  file is looked up in its listing, and the resolved file name is memoized for the prefix, the simple name, the
+//  target path and the template directories. Both caches may be used by the threads executing 'write to' blocks.
+//
+//  The lookup in a listing is case sensitive, but the file systems of macOS and Windows are usually not: a name that
+//  only matches a file of the listing with another case is checked with the file system.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::mutex gTemplateFileCacheMutex ;
+
+//--- Names of the regular files of a directory, as listed and lowercased
+class cTemplateDirectoryListing {
+  public: std::unordered_set <std::string> mFileNames ;
+  public: std::unordered_set <std::string> mLowercaseFileNames ;
+} ;
+
+//--- Directory path -> listing
+static std::unordered_map <std::string, cTemplateDirectoryListing> gTemplateDirectoryListings ;
+
+//--- Resolution key -> resolved template file name
+static std::unordered_map <std::string, std::string> gResolvedTemplateFileNames ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static GALGAS_bool templateFileExists (const GALGAS_string & inFilePath) {
+  GALGAS_bool result ;
+  if (inFilePath.isValid ()) {
+    const C_String filePath = inFilePath.stringValue () ;
+    const std::string directory (filePath.stringByDeletingLastPathComponent ().cString (HERE)) ;
+    const std::string fileName (filePath.lastPathComponent ().cString (HERE)) ;
+    bool exists = false ;
+    bool otherCase = false ;
+    { std::lock_guard <std::mutex> lock (gTemplateFileCacheMutex) ;
+      std::unordered_map <std::string, cTemplateDirectoryListing>::iterator it = gTemplateDirectoryListings.find (directory) ;
+      if (it == gTemplateDirectoryListings.end ()) {
+        TC_UniqueArray <C_String> fileNames ;
+        C_FileManager::findRegularFileNamesInDirectory ((directory.length () == 0) ? C_String (".") : C_String (directory.c_str ()), fileNames) ;
+        cTemplateDirectoryListing listing ;
+        for (int32_t i=0 ; i<fileNames.count () ; i++) {
+          listing.mFileNames.insert (fileNames (i COMMA_HERE).cString (HERE)) ;
+          listing.mLowercaseFileNames.insert (fileNames (i COMMA_HERE).lowercaseString ().cString (HERE)) ;
+        }
+        it = gTemplateDirectoryListings.insert (std::make_pair (directory, listing)).first ;
+      }
+      exists = it->second.mFileNames.count (fileName) > 0 ;
+      otherCase = !exists && (it->second.mLowercaseFileNames.count (filePath.lastPathComponent ().lowercaseString ().cString (HERE)) > 0) ;
+    }
+  //--- The file system tells if the case matters
+    if (otherCase) {
+      exists = C_FileManager::fileExistsAtPath (filePath) ;
+    }
+    result = GALGAS_bool (exists) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  The listed directories are inputs of the build manifest: adding or removing a template in one of them may change
+//  the resolution of a template instruction.
+//----------------------------------------------------------------------------------------------------------------------
+
+static void enumerateListedTemplateDirectories (TC_UniqueArray <C_String> & outDirectories) {
+  std::lock_guard <std::mutex> lock (gTemplateFileCacheMutex) ;
+  for (std::unordered_map <std::string, cTemplateDirectoryListing>::const_iterator it = gTemplateDirectoryListings.begin () ;
+       it != gTemplateDirectoryListings.end () ; ++it) {
+    outDirectories.appendObject ((it->first.length () == 0) ? C_String (".") : C_String (it->first.c_str ())) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void registerListedTemplateDirectories (void) {
+  setBuildManifestDirectoryEnumerator (enumerateListedTemplateDirectories) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_PrologueEpilogue gListedTemplateDirectoriesRegistration (registerListedTemplateDirectories, nullptr) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::string templateResolutionKey (const GALGAS_string & inUserTemplateDirectory,
+                                          const GALGAS_string & inTemplateDirectory,
+                                          const GALGAS_string & inPrefix,
+                                          const GALGAS_string & inPath,
+                                          const GALGAS_string & inSimpleName,
+                                          const GALGAS_string & inExtension) {
+  std::string result ;
+  if (inUserTemplateDirectory.isValid () && inTemplateDirectory.isValid () && inPrefix.isValid ()
+   && inPath.isValid () && inSimpleName.isValid () && inExtension.isValid ()) {
+    C_String key ;
+    key << inUserTemplateDirectory.stringValue () << "\n"
+        << inTemplateDirectory.stringValue () << "\n"
+        << inPrefix.stringValue () << "\n"
+        << inPath.stringValue () << "\n"
+        << inSimpleName.stringValue () << "\n"
+        << inExtension.stringValue () ;
+    result = key.cString (HERE) ;
+  }
+  return result ;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Extension getter '@gtlContext fullTemplateFileName'
@@ -3213,6 +3331,14 @@ GALGAS_lstring cPtr_gtlContext::getter_fullTemplateFileName (GALGAS_gtlContext i
   GALGAS_lstring result_fullName ; // Returned variable
   const GALGAS_gtlContext temp_0 = this ;
   GALGAS_lstring var_fullPref_2482 = callExtensionGetter_fullPrefix ((const cPtr_gtlContext *) temp_0.ptr (), inArgument_vars, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 110)) ;
+  const std::string resolutionKey = templateResolutionKey (this->mProperty_userTemplateDirectory, this->mProperty_templateDirectory, var_fullPref_2482.readProperty_string (), this->mProperty_path, inArgument_simpleName.readProperty_string (), inArgument_context.readProperty_templateExtension ()) ;
+  if (resolutionKey.length () > 0) {
+    std::lock_guard <std::mutex> lock (gTemplateFileCacheMutex) ;
+    const std::unordered_map <std::string, std::string>::const_iterator it = gResolvedTemplateFileNames.find (resolutionKey) ;
+    if (it != gResolvedTemplateFileNames.end ()) {
+      return GALGAS_lstring::constructor_new (GALGAS_string (C_String (it->second.c_str ())), inArgument_simpleName.readProperty_location ()  COMMA_HERE) ;
+    }
+  }
   GALGAS_bool var_found_2528 = GALGAS_bool (false) ;
   GALGAS_string var_prefixedTemplatePath_2552 ;
   GALGAS_string var_hierarchicalPath_2583 ;
@@ -3227,7 +3353,7 @@ GALGAS_lstring cPtr_gtlContext::getter_fullTemplateFileName (GALGAS_gtlContext i
         GALGAS_string var_fullPath_2962 = function_pathWithExtension (inArgument_context, extensionGetter_stringByAppendingPath (extensionGetter_stringByAppendingPath (var_prefixedTemplatePath_2552, var_hierarchicalPath_2583, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 131)), inArgument_simpleName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 131)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 129)) ;
         enumGalgasBool test_1 = kBoolTrue ;
         if (kBoolTrue == test_1) {
-          test_1 = var_fullPath_2962.getter_fileExists (SOURCE_FILE ("gtl_types.galgas", 136)).boolEnum () ;
+          test_1 = templateFileExists (var_fullPath_2962).boolEnum () ;
           if (kBoolTrue == test_1) {
             var_rootPath_2610 = var_fullPath_2962 ;
             var_found_2528 = GALGAS_bool (true) ;
@@ -3265,7 +3391,7 @@ GALGAS_lstring cPtr_gtlContext::getter_fullTemplateFileName (GALGAS_gtlContext i
             GALGAS_string var_fullPath_3849 = function_pathWithExtension (inArgument_context, extensionGetter_stringByAppendingPath (extensionGetter_stringByAppendingPath (var_prefixedTemplatePath_2552, var_hierarchicalPath_2583, inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 163)), inArgument_simpleName.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 163)), inCompiler COMMA_SOURCE_FILE ("gtl_types.galgas", 161)) ;
             enumGalgasBool test_4 = kBoolTrue ;
             if (kBoolTrue == test_4) {
-              test_4 = var_fullPath_3849.getter_fileExists (SOURCE_FILE ("gtl_types.galgas", 168)).boolEnum () ;
+              test_4 = templateFileExists (var_fullPath_3849).boolEnum () ;
               if (kBoolTrue == test_4) {
                 var_rootPath_2610 = var_fullPath_3849 ;
                 var_found_2528 = GALGAS_bool (true) ;
@@ -3292,6 +3418,10 @@ GALGAS_lstring cPtr_gtlContext::getter_fullTemplateFileName (GALGAS_gtlContext i
     }
   }
   result_fullName = GALGAS_lstring::constructor_new (var_rootPath_2610, inArgument_simpleName.readProperty_location ()  COMMA_SOURCE_FILE ("gtl_types.galgas", 180)) ;
+  if ((resolutionKey.length () > 0) && var_rootPath_2610.isValid ()) {
+    std::lock_guard <std::mutex> lock (gTemplateFileCacheMutex) ;
+    gResolvedTemplateFileNames [resolutionKey] = var_rootPath_2610.stringValue ().cString (HERE) ;
+  }
 //---
   return result_fullName ;
 }
@@ -8124,148 +8254,154 @@ GALGAS_gtlData cPtr_applicationDefinition::getter_templateData (const GALGAS_imp
                                                                 C_Compiler * inCompiler
                                                                 COMMA_UNUSED_LOCATION_ARGS) const {
   GALGAS_gtlData result_cfg ; // Returned variable
-  result_cfg = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 190)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 190)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 190))  COMMA_SOURCE_FILE ("systemConfig.galgas", 190)) ;
+  {
+  routine_beginPhase (GALGAS_string ("GTL data export"), inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 190)) ;
+  }
+  result_cfg = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 191)), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 191)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 191))  COMMA_SOURCE_FILE ("systemConfig.galgas", 191)) ;
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_5816 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_5816, GALGAS_lstring::constructor_new (GALGAS_string ("OILFILENAME"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 196))  COMMA_SOURCE_FILE ("systemConfig.galgas", 196)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 198)), function_lstring (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 199)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 199)), GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 200)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 200))  COMMA_SOURCE_FILE ("systemConfig.galgas", 197)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 195)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_5816, GALGAS_lstring::constructor_new (GALGAS_string ("OILFILENAME"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 197))  COMMA_SOURCE_FILE ("systemConfig.galgas", 197)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 199)), function_lstring (GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 200)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 200)), GALGAS_string::constructor_stringWithSourceFilePath (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 201)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 201))  COMMA_SOURCE_FILE ("systemConfig.galgas", 198)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 196)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6041 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6041, GALGAS_lstring::constructor_new (GALGAS_string ("CPUNAME"), this->mProperty_name.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 205)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), function_lstring (GALGAS_string ("name of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), this->mProperty_name.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 204)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6041, GALGAS_lstring::constructor_new (GALGAS_string ("CPUNAME"), this->mProperty_name.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 206)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 207)), function_lstring (GALGAS_string ("name of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 207)), this->mProperty_name.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 207)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 205)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6195 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6195, GALGAS_lstring::constructor_new (GALGAS_string ("CPUDESCRIPTION"), this->mProperty_cpuDescription.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 210)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), function_lstring (GALGAS_string ("description of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), this->mProperty_cpuDescription.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 209)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6195, GALGAS_lstring::constructor_new (GALGAS_string ("CPUDESCRIPTION"), this->mProperty_cpuDescription.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 211)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 212)), function_lstring (GALGAS_string ("description of the CPU object"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 212)), this->mProperty_cpuDescription.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 212)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 210)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6383 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6383, GALGAS_lstring::constructor_new (GALGAS_string ("OILVERSION"), this->mProperty_version.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 215)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 216)), this->mProperty_versionDescription, this->mProperty_version.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 216)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 214)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6383, GALGAS_lstring::constructor_new (GALGAS_string ("OILVERSION"), this->mProperty_version.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 216)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 217)), this->mProperty_versionDescription, this->mProperty_version.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 217)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 215)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6530 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6530, GALGAS_lstring::constructor_new (GALGAS_string ("OILDESCRIPTION"), this->mProperty_versionDescription.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 220)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 221)), this->mProperty_versionDescription, this->mProperty_versionDescription.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 221)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 219)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6530, GALGAS_lstring::constructor_new (GALGAS_string ("OILDESCRIPTION"), this->mProperty_versionDescription.readProperty_location ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 221)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 222)), this->mProperty_versionDescription, this->mProperty_versionDescription.readProperty_string ()  COMMA_SOURCE_FILE ("systemConfig.galgas", 222)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 220)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6703 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6703, GALGAS_lstring::constructor_new (GALGAS_string ("TIMESTAMP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 225))  COMMA_SOURCE_FILE ("systemConfig.galgas", 225)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 227)), function_lstring (GALGAS_string ("timestamp of OIL compiling"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 228)), GALGAS_string::constructor_stringWithCurrentDateTime (SOURCE_FILE ("systemConfig.galgas", 229))  COMMA_SOURCE_FILE ("systemConfig.galgas", 226)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 224)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6703, GALGAS_lstring::constructor_new (GALGAS_string ("TIMESTAMP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 226))  COMMA_SOURCE_FILE ("systemConfig.galgas", 226)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 228)), function_lstring (GALGAS_string ("timestamp of OIL compiling"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 229)), GALGAS_string::constructor_stringWithCurrentDateTime (SOURCE_FILE ("systemConfig.galgas", 230))  COMMA_SOURCE_FILE ("systemConfig.galgas", 227)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 225)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_6909 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6909, GALGAS_lstring::constructor_new (GALGAS_string ("PROJECT"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 234))  COMMA_SOURCE_FILE ("systemConfig.galgas", 234)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 236)), function_lstring (GALGAS_string ("project name"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 237)), function_projectName (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 238)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 238))  COMMA_SOURCE_FILE ("systemConfig.galgas", 235)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 233)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_6909, GALGAS_lstring::constructor_new (GALGAS_string ("PROJECT"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 235))  COMMA_SOURCE_FILE ("systemConfig.galgas", 235)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 237)), function_lstring (GALGAS_string ("project name"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 238)), function_projectName (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 239)).getter_lastPathComponent (SOURCE_FILE ("systemConfig.galgas", 239))  COMMA_SOURCE_FILE ("systemConfig.galgas", 236)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 234)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7100 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7100, GALGAS_lstring::constructor_new (GALGAS_string ("TARGET"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 243))  COMMA_SOURCE_FILE ("systemConfig.galgas", 243)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 245)), function_lstring (GALGAS_string ("target architecture/chip/board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 246)), GALGAS_string (gOption_goil_5F_options_target_5F_platform.readProperty_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 244)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 242)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7100, GALGAS_lstring::constructor_new (GALGAS_string ("TARGET"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 244))  COMMA_SOURCE_FILE ("systemConfig.galgas", 244)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 246)), function_lstring (GALGAS_string ("target architecture/chip/board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 247)), GALGAS_string (gOption_goil_5F_options_target_5F_platform.readProperty_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 245)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 243)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7315 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7315, GALGAS_lstring::constructor_new (GALGAS_string ("TEMPLATEPATH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 252))  COMMA_SOURCE_FILE ("systemConfig.galgas", 252)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 254)), function_lstring (GALGAS_string ("path of the templates used"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 255)), GALGAS_string (gOption_goil_5F_options_template_5F_dir.readProperty_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 253)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 251)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7315, GALGAS_lstring::constructor_new (GALGAS_string ("TEMPLATEPATH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 253))  COMMA_SOURCE_FILE ("systemConfig.galgas", 253)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 255)), function_lstring (GALGAS_string ("path of the templates used"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 256)), GALGAS_string (gOption_goil_5F_options_template_5F_dir.readProperty_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 254)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 252)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7531 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7531, GALGAS_lstring::constructor_new (GALGAS_string ("ARCH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 261))  COMMA_SOURCE_FILE ("systemConfig.galgas", 261)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), function_lstring (GALGAS_string ("target architecture"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), function_arch (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 262))  COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 260)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7531, GALGAS_lstring::constructor_new (GALGAS_string ("ARCH"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 262))  COMMA_SOURCE_FILE ("systemConfig.galgas", 262)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 263)), function_lstring (GALGAS_string ("target architecture"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 263)), function_arch (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 263))  COMMA_SOURCE_FILE ("systemConfig.galgas", 263)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 261)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7673 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7673, GALGAS_lstring::constructor_new (GALGAS_string ("CHIP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 266))  COMMA_SOURCE_FILE ("systemConfig.galgas", 266)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), function_lstring (GALGAS_string ("target chip"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), function_chip (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 267))  COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 265)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7673, GALGAS_lstring::constructor_new (GALGAS_string ("CHIP"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 267))  COMMA_SOURCE_FILE ("systemConfig.galgas", 267)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 268)), function_lstring (GALGAS_string ("target chip"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 268)), function_chip (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 268))  COMMA_SOURCE_FILE ("systemConfig.galgas", 268)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 266)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7806 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7806, GALGAS_lstring::constructor_new (GALGAS_string ("BOARD"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 271))  COMMA_SOURCE_FILE ("systemConfig.galgas", 271)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), function_lstring (GALGAS_string ("target board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), function_board (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 272))  COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 270)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7806, GALGAS_lstring::constructor_new (GALGAS_string ("BOARD"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 272))  COMMA_SOURCE_FILE ("systemConfig.galgas", 272)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 273)), function_lstring (GALGAS_string ("target board"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 273)), function_board (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 273))  COMMA_SOURCE_FILE ("systemConfig.galgas", 273)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 271)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_7942 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7942, GALGAS_lstring::constructor_new (GALGAS_string ("TARGETPATHLIST"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 276))  COMMA_SOURCE_FILE ("systemConfig.galgas", 276)), GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), function_lstring (GALGAS_string ("target path list"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), function_targetPathList (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 277))  COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 275)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_7942, GALGAS_lstring::constructor_new (GALGAS_string ("TARGETPATHLIST"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 277))  COMMA_SOURCE_FILE ("systemConfig.galgas", 277)), GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 278)), function_lstring (GALGAS_string ("target path list"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 278)), function_targetPathList (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 278))  COMMA_SOURCE_FILE ("systemConfig.galgas", 278)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 276)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_8099 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8099, GALGAS_lstring::constructor_new (GALGAS_string ("LOGFILE"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 281))  COMMA_SOURCE_FILE ("systemConfig.galgas", 281)), GALGAS_gtlBool::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 283)), function_lstring (GALGAS_string ("Generated a logfile"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 284)), GALGAS_bool (gOption_goil_5F_options_generate_5F_log.readProperty_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 282)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 280)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8099, GALGAS_lstring::constructor_new (GALGAS_string ("LOGFILE"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 282))  COMMA_SOURCE_FILE ("systemConfig.galgas", 282)), GALGAS_gtlBool::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 284)), function_lstring (GALGAS_string ("Generated a logfile"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 285)), GALGAS_bool (gOption_goil_5F_options_generate_5F_log.readProperty_value ())  COMMA_SOURCE_FILE ("systemConfig.galgas", 283)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 281)) ;
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_8301 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8301, GALGAS_lstring::constructor_new (GALGAS_string ("EOF"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 290))  COMMA_SOURCE_FILE ("systemConfig.galgas", 290)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 292)), function_lstring (GALGAS_string ("End of file location"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 293)), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 294)).getter_endLocationString (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 294))  COMMA_SOURCE_FILE ("systemConfig.galgas", 291)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 289)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8301, GALGAS_lstring::constructor_new (GALGAS_string ("EOF"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 291))  COMMA_SOURCE_FILE ("systemConfig.galgas", 291)), GALGAS_gtlString::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 293)), function_lstring (GALGAS_string ("End of file location"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 294)), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 295)).getter_endLocationString (inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 295))  COMMA_SOURCE_FILE ("systemConfig.galgas", 292)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 290)) ;
   }
-  GALGAS_gtlData var_opts_8518 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 300)), function_lstring (GALGAS_string ("Passed options"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 301)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 302))  COMMA_SOURCE_FILE ("systemConfig.galgas", 299)) ;
-  GALGAS_string var_optionString_8619 = extensionGetter_trimRight (extensionGetter_trimLeft (GALGAS_string (gOption_goil_5F_options_passOption.readProperty_value ()), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 304)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 304)) ;
+  GALGAS_gtlData var_opts_8518 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 301)), function_lstring (GALGAS_string ("Passed options"), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 302)), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 303))  COMMA_SOURCE_FILE ("systemConfig.galgas", 300)) ;
+  GALGAS_string var_optionString_8619 = extensionGetter_trimRight (extensionGetter_trimLeft (GALGAS_string (gOption_goil_5F_options_passOption.readProperty_value ()), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 305)), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 305)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    GALGAS_bool test_1 = GALGAS_bool (kIsStrictSup, var_optionString_8619.getter_count (SOURCE_FILE ("systemConfig.galgas", 305)).objectCompare (GALGAS_uint (uint32_t (0U)))) ;
+    GALGAS_bool test_1 = GALGAS_bool (kIsStrictSup, var_optionString_8619.getter_count (SOURCE_FILE ("systemConfig.galgas", 306)).objectCompare (GALGAS_uint (uint32_t (0U)))) ;
     if (kBoolTrue != test_1.boolEnum ()) {
       test_1 = GALGAS_bool (gOption_goil_5F_options_pierreOption.readProperty_value ()) ;
     }
     test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
       var_opts_8518.drop () ;
-      cGrammar_options_5F_grammar::_performSourceStringParsing_ (inCompiler, GALGAS_string (gOption_goil_5F_options_passOption.readProperty_value ()), GALGAS_string ("Passed options"), var_opts_8518  COMMA_SOURCE_FILE ("systemConfig.galgas", 306)) ;
+      cGrammar_options_5F_grammar::_performSourceStringParsing_ (inCompiler, GALGAS_string (gOption_goil_5F_options_passOption.readProperty_value ()), GALGAS_string ("Passed options"), var_opts_8518  COMMA_SOURCE_FILE ("systemConfig.galgas", 307)) ;
     }
   }
   {
   result_cfg.insulate (HERE) ;
   cPtr_gtlData * ptr_8885 = (cPtr_gtlData *) result_cfg.ptr () ;
-  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8885, GALGAS_lstring::constructor_new (GALGAS_string ("PASSEDOPTIONS"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 310))  COMMA_SOURCE_FILE ("systemConfig.galgas", 310)), var_opts_8518, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 309)) ;
+  callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_8885, GALGAS_lstring::constructor_new (GALGAS_string ("PASSEDOPTIONS"), GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 311))  COMMA_SOURCE_FILE ("systemConfig.galgas", 311)), var_opts_8518, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 310)) ;
   }
   cEnumerator_objectsMap enumerator_8971 (this->mProperty_objects, kENUMERATION_UP) ;
   while (enumerator_8971.hasCurrentObject ()) {
     GALGAS_implementationObject var_implementationObject_9209 ;
-    constinArgument_imp.readProperty_imp ().method_get (enumerator_8971.current_lkey (HERE), var_implementationObject_9209, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 318)) ;
+    constinArgument_imp.readProperty_imp ().method_get (enumerator_8971.current_lkey (HERE), var_implementationObject_9209, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 319)) ;
     enumGalgasBool test_2 = kBoolTrue ;
     if (kBoolTrue == test_2) {
       test_2 = var_implementationObject_9209.readProperty_multiple ().readProperty_bool ().boolEnum () ;
       if (kBoolTrue == test_2) {
-        GALGAS_gtlList var_objs_9297 = GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 320)), enumerator_8971.current_lkey (HERE), GALGAS_list::constructor_emptyList (SOURCE_FILE ("systemConfig.galgas", 320))  COMMA_SOURCE_FILE ("systemConfig.galgas", 320)) ;
+        GALGAS_gtlList var_objs_9297 = GALGAS_gtlList::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 321)), enumerator_8971.current_lkey (HERE), GALGAS_list::constructor_emptyList (SOURCE_FILE ("systemConfig.galgas", 321))  COMMA_SOURCE_FILE ("systemConfig.galgas", 321)) ;
         cEnumerator_objectKindMap enumerator_9348 (enumerator_8971.current_objectsOfKind (HERE).readProperty_objects (), kENUMERATION_UP) ;
         while (enumerator_9348.hasCurrentObject ()) {
-          GALGAS_gtlData var_attrs_9403 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9348.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 322)) ;
+          GALGAS_gtlData var_attrs_9403 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9348.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 323)) ;
           {
           var_objs_9297.insulate (HERE) ;
           cPtr_gtlList * ptr_9453 = (cPtr_gtlList *) var_objs_9297.ptr () ;
-          callExtensionSetter_appendItem ((cPtr_gtlList *) ptr_9453, var_attrs_9403, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 324)) ;
+          callExtensionSetter_appendItem ((cPtr_gtlList *) ptr_9453, var_attrs_9403, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 325)) ;
           }
           enumerator_9348.gotoNextObject () ;
         }
         {
         result_cfg.insulate (HERE) ;
         cPtr_gtlData * ptr_9496 = (cPtr_gtlData *) result_cfg.ptr () ;
-        callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9496, enumerator_8971.current_lkey (HERE), var_objs_9297, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 326)) ;
+        callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9496, enumerator_8971.current_lkey (HERE), var_objs_9297, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 327)) ;
         }
       }
     }
     if (kBoolFalse == test_2) {
       enumGalgasBool test_3 = kBoolTrue ;
       if (kBoolTrue == test_3) {
-        test_3 = GALGAS_bool (kIsEqual, enumerator_8971.current_objectsOfKind (HERE).readProperty_objects ().getter_count (SOURCE_FILE ("systemConfig.galgas", 332)).objectCompare (GALGAS_uint (uint32_t (1U)))).boolEnum () ;
+        test_3 = GALGAS_bool (kIsEqual, enumerator_8971.current_objectsOfKind (HERE).readProperty_objects ().getter_count (SOURCE_FILE ("systemConfig.galgas", 333)).objectCompare (GALGAS_uint (uint32_t (1U)))).boolEnum () ;
         if (kBoolTrue == test_3) {
-          GALGAS_gtlData var_attrs_9659 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 333)), enumerator_8971.current_lkey (HERE), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 333))  COMMA_SOURCE_FILE ("systemConfig.galgas", 333)) ;
+          GALGAS_gtlData var_attrs_9659 = GALGAS_gtlStruct::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 334)), enumerator_8971.current_lkey (HERE), GALGAS_gtlVarMap::constructor_emptyMap (SOURCE_FILE ("systemConfig.galgas", 334))  COMMA_SOURCE_FILE ("systemConfig.galgas", 334)) ;
           cEnumerator_objectKindMap enumerator_9722 (enumerator_8971.current_objectsOfKind (HERE).readProperty_objects (), kENUMERATION_UP) ;
           while (enumerator_9722.hasCurrentObject ()) {
-            var_attrs_9659 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9722.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 335)) ;
+            var_attrs_9659 = callExtensionGetter_fieldMap ((const cPtr_objectAttributes *) enumerator_9722.current_attributes (HERE).ptr (), inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 336)) ;
             enumerator_9722.gotoNextObject () ;
           }
           {
           result_cfg.insulate (HERE) ;
           cPtr_gtlData * ptr_9819 = (cPtr_gtlData *) result_cfg.ptr () ;
-          callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9819, enumerator_8971.current_lkey (HERE), var_attrs_9659, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 337)) ;
+          callExtensionSetter_setStructField ((cPtr_gtlData *) ptr_9819, enumerator_8971.current_lkey (HERE), var_attrs_9659, inCompiler COMMA_SOURCE_FILE ("systemConfig.galgas", 338)) ;
           }
         }
       }
     }
     enumerator_8971.gotoNextObject () ;
   }
+  {
+  routine_endPhase (inCompiler  COMMA_SOURCE_FILE ("systemConfig.galgas", 346)) ;
+  }
 //---
   return result_cfg ;
 }
@@ -5,6 +5,10 @@
 
 //----------------------------------------------------------------------------------------------------------------------
 
+#include <mutex>
+
+//----------------------------------------------------------------------------------------------------------------------
+
 #include "all-declarations-8.h"
 
 //---------------------------------------------------------------------------------------------------------------------*
@@ -6507,6 +6511,9 @@ GALGAS_string function_invokeGTL (GALGAS_gtlString inArgument_rootTemplateFileNa
                                   C_Compiler * inCompiler
                                   COMMA_UNUSED_LOCATION_ARGS) {
   GALGAS_string result_result ; // Returned variable
+  {
+  routine_beginPhase (GALGAS_string ("template execution"), inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 35)) ;
+  }
   result_result = GALGAS_string::makeEmptyString () ;
   GALGAS_library var_lib_1096 = function_emptyLib (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 36)) ;
   enumGalgasBool test_0 = kBoolTrue ;
@@ -6518,7 +6525,14 @@ GALGAS_string function_invokeGTL (GALGAS_gtlString inArgument_rootTemplateFileNa
     }
   }
   GALGAS_gtlTemplateInstruction var_rootTemplateInstruction_1349 = GALGAS_gtlTemplateInstruction::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 45)), GALGAS_string::makeEmptyString (), function_emptylstring (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 47)), GALGAS_gtlTerminal::constructor_new (GALGAS_location::constructor_here (inCompiler  COMMA_SOURCE_FILE ("gtl_interface.galgas", 49)), inArgument_rootTemplateFileName  COMMA_SOURCE_FILE ("gtl_interface.galgas", 48)), GALGAS_bool (false), GALGAS_bool (true), GALGAS_gtlExpressionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 54)), GALGAS_gtlInstructionList::constructor_emptyList (SOURCE_FILE ("gtl_interface.galgas", 55))  COMMA_SOURCE_FILE ("gtl_interface.galgas", 44)) ;
+  cGtlProfilerSession profilerSession ;
+  cGtlWriteToScope writeToScope (var_lib_1096, inCompiler) ;
   callExtensionMethod_execute ((cPtr_gtlTemplateInstruction *) var_rootTemplateInstruction_1349.ptr (), inArgument_context, inArgument_vars, var_lib_1096, result_result, inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 59)) ;
+  writeToScope.replayPendingBlocks () ;
+  profilerSession.writeProfile (inCompiler) ;
+  {
+  routine_endPhase (inCompiler COMMA_SOURCE_FILE ("gtl_interface.galgas", 60)) ;
+  }
 //---
   return result_result ;
 }
@@ -8888,17 +8902,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_noArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_noArgument = false ;
+static std::once_flag gOnceFunctionFlag_noArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_noArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_noArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_noArgument) {
+  std::call_once (gOnceFunctionFlag_noArgument, [&] () {
     gOnceFunctionResult_noArgument = onceFunction_noArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_noArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_noArgument ;
 }
 
@@ -8958,17 +8971,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_intArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_intArgument = false ;
+static std::once_flag gOnceFunctionFlag_intArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_intArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_intArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_intArgument) {
+  std::call_once (gOnceFunctionFlag_intArgument, [&] () {
     gOnceFunctionResult_intArgument = onceFunction_intArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_intArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_intArgument ;
 }
 
@@ -9028,17 +9040,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_charArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_charArgument = false ;
+static std::once_flag gOnceFunctionFlag_charArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_charArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_charArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_charArgument) {
+  std::call_once (gOnceFunctionFlag_charArgument, [&] () {
     gOnceFunctionResult_charArgument = onceFunction_charArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_charArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_charArgument ;
 }
 
@@ -9099,17 +9110,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_charCharArguments (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_charCharArguments = false ;
+static std::once_flag gOnceFunctionFlag_charCharArguments ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_charCharArguments ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_charCharArguments (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_charCharArguments) {
+  std::call_once (gOnceFunctionFlag_charCharArguments, [&] () {
     gOnceFunctionResult_charCharArguments = onceFunction_charCharArguments (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_charCharArguments = true ;
-  }
+  }) ;
   return gOnceFunctionResult_charCharArguments ;
 }
 
@@ -9170,17 +9180,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_charIntArguments (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_charIntArguments = false ;
+static std::once_flag gOnceFunctionFlag_charIntArguments ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_charIntArguments ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_charIntArguments (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_charIntArguments) {
+  std::call_once (gOnceFunctionFlag_charIntArguments, [&] () {
     gOnceFunctionResult_charIntArguments = onceFunction_charIntArguments (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_charIntArguments = true ;
-  }
+  }) ;
   return gOnceFunctionResult_charIntArguments ;
 }
 
@@ -9240,17 +9249,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_floatArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_floatArgument = false ;
+static std::once_flag gOnceFunctionFlag_floatArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_floatArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_floatArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_floatArgument) {
+  std::call_once (gOnceFunctionFlag_floatArgument, [&] () {
     gOnceFunctionResult_floatArgument = onceFunction_floatArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_floatArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_floatArgument ;
 }
 
@@ -9310,17 +9318,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_stringArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_stringArgument = false ;
+static std::once_flag gOnceFunctionFlag_stringArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_stringArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_stringArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_stringArgument) {
+  std::call_once (gOnceFunctionFlag_stringArgument, [&] () {
     gOnceFunctionResult_stringArgument = onceFunction_stringArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_stringArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_stringArgument ;
 }
 
@@ -9381,17 +9388,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_stringStringArgument (C_Compiler
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_stringStringArgument = false ;
+static std::once_flag gOnceFunctionFlag_stringStringArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_stringStringArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_stringStringArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_stringStringArgument) {
+  std::call_once (gOnceFunctionFlag_stringStringArgument, [&] () {
     gOnceFunctionResult_stringStringArgument = onceFunction_stringStringArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_stringStringArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_stringStringArgument ;
 }
 
@@ -9452,17 +9458,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_boolIntArguments (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_boolIntArguments = false ;
+static std::once_flag gOnceFunctionFlag_boolIntArguments ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_boolIntArguments ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_boolIntArguments (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_boolIntArguments) {
+  std::call_once (gOnceFunctionFlag_boolIntArguments, [&] () {
     gOnceFunctionResult_boolIntArguments = onceFunction_boolIntArguments (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_boolIntArguments = true ;
-  }
+  }) ;
   return gOnceFunctionResult_boolIntArguments ;
 }
 
@@ -9523,17 +9528,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_intIntArguments (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_intIntArguments = false ;
+static std::once_flag gOnceFunctionFlag_intIntArguments ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_intIntArguments ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_intIntArguments (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_intIntArguments) {
+  std::call_once (gOnceFunctionFlag_intIntArguments, [&] () {
     gOnceFunctionResult_intIntArguments = onceFunction_intIntArguments (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_intIntArguments = true ;
-  }
+  }) ;
   return gOnceFunctionResult_intIntArguments ;
 }
 
@@ -9594,17 +9598,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_intAnyArguments (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_intAnyArguments = false ;
+static std::once_flag gOnceFunctionFlag_intAnyArguments ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_intAnyArguments ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_intAnyArguments (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_intAnyArguments) {
+  std::call_once (gOnceFunctionFlag_intAnyArguments, [&] () {
     gOnceFunctionResult_intAnyArguments = onceFunction_intAnyArguments (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_intAnyArguments = true ;
-  }
+  }) ;
   return gOnceFunctionResult_intAnyArguments ;
 }
 
@@ -9664,17 +9667,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_anyArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_anyArgument = false ;
+static std::once_flag gOnceFunctionFlag_anyArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_anyArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_anyArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_anyArgument) {
+  std::call_once (gOnceFunctionFlag_anyArgument, [&] () {
     gOnceFunctionResult_anyArgument = onceFunction_anyArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_anyArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_anyArgument ;
 }
 
@@ -9734,17 +9736,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_structArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_structArgument = false ;
+static std::once_flag gOnceFunctionFlag_structArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_structArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_structArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_structArgument) {
+  std::call_once (gOnceFunctionFlag_structArgument, [&] () {
     gOnceFunctionResult_structArgument = onceFunction_structArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_structArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_structArgument ;
 }
 
@@ -9804,17 +9805,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_expressionArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_expressionArgument = false ;
+static std::once_flag gOnceFunctionFlag_expressionArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_expressionArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_expressionArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_expressionArgument) {
+  std::call_once (gOnceFunctionFlag_expressionArgument, [&] () {
     gOnceFunctionResult_expressionArgument = onceFunction_expressionArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_expressionArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_expressionArgument ;
 }
 
@@ -9874,17 +9874,16 @@ static GALGAS_gtlTypedArgumentList onceFunction_setArgument (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_setArgument = false ;
+static std::once_flag gOnceFunctionFlag_setArgument ;
 static GALGAS_gtlTypedArgumentList gOnceFunctionResult_setArgument ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_gtlTypedArgumentList function_setArgument (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_setArgument) {
+  std::call_once (gOnceFunctionFlag_setArgument, [&] () {
     gOnceFunctionResult_setArgument = onceFunction_setArgument (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_setArgument = true ;
-  }
+  }) ;
   return gOnceFunctionResult_setArgument ;
 }
 
@@ -9986,17 +9985,16 @@ static GALGAS_lstring onceFunction_emptylstring (C_Compiler *
 //  Function implementation                                                                      
 //----------------------------------------------------------------------------------------------------------------------
 
-static bool gOnceFunctionResultAvailable_emptylstring = false ;
+static std::once_flag gOnceFunctionFlag_emptylstring ;
 static GALGAS_lstring gOnceFunctionResult_emptylstring ;
 
 //----------------------------------------------------------------------------------------------------------------------
 
 GALGAS_lstring function_emptylstring (class C_Compiler * inCompiler
               COMMA_LOCATION_ARGS) {
-  if (! gOnceFunctionResultAvailable_emptylstring) {
+  std::call_once (gOnceFunctionFlag_emptylstring, [&] () {
     gOnceFunctionResult_emptylstring = onceFunction_emptylstring (inCompiler COMMA_THERE) ;
-    gOnceFunctionResultAvailable_emptylstring = true ;
-  }
+  }) ;
   return gOnceFunctionResult_emptylstring ;
 }
 
@@ -2,6 +2,15 @@
 #include "galgas2/C_galgas_io.h"
 #include "galgas2/C_galgas_CLI_Options.h"
 #include "utilities/C_PrologueEpilogue.h"
+#include "galgas2/C_BuildManifest.h"
+
+//----------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -11520,6 +11529,588 @@ void cPtr_gtlEmitInstruction::method_execute (GALGAS_gtlContext & ioArgument_con
                                               COMMA_UNUSED_LOCATION_ARGS) {
   ioArgument_outputString.plusAssign_operation(callExtensionGetter_string ((const cPtr_gtlData *) callExtensionGetter_eval ((const cPtr_gtlExpression *) this->mProperty_rValue.ptr (), ioArgument_context, ioArgument_vars, ioArgument_lib, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 399)).ptr (), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 399)), inCompiler  COMMA_SOURCE_FILE ("gtl_instructions.galgas", 399)) ;
 }
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  GTL execution profiler
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlProfileNode final {
+  public: cGtlProfileNode (cGtlProfileNode * inParent, const std::string & inName) :
+  mParent (inParent),
+  mName (inName),
+  mChildren (),
+  mCallCount (0),
+  mInclusiveNanoseconds (0),
+  mChildrenNanoseconds (0),
+  mInclusiveBytes (0),
+  mChildrenBytes (0),
+  mStartNanoseconds (0),
+  mStartBytes (0) {
+  }
+
+  public: ~ cGtlProfileNode (void) {
+    for (std::unordered_map <const void *, cGtlProfileNode *>::iterator it = mChildren.begin () ; it != mChildren.end () ; ++it) {
+      delete it->second ;
+    }
+  }
+
+//--- No copy
+  private: cGtlProfileNode (const cGtlProfileNode &) = delete ;
+  private: cGtlProfileNode & operator = (const cGtlProfileNode &) = delete ;
+
+//--- Properties
+  public: cGtlProfileNode * const mParent ;
+  public: const std::string mName ;
+  public: std::unordered_map <const void *, cGtlProfileNode *> mChildren ;
+  public: uint64_t mCallCount ;
+  public: uint64_t mInclusiveNanoseconds ;
+  public: uint64_t mChildrenNanoseconds ;
+  public: uint64_t mInclusiveBytes ;
+  public: uint64_t mChildrenBytes ;
+  public: uint64_t mStartNanoseconds ;
+  public: uint64_t mStartBytes ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+//--- Root of the frame tree, built by the first session and freed when the profile is written
+static cGtlProfileNode * gProfileRoot = nullptr ;
+
+//--- Innermost frame; nullptr when profiling is disabled
+static cGtlProfileNode * gProfileCurrentNode = nullptr ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static uint64_t profilerNanoseconds (void) {
+  return (uint64_t) std::chrono::duration_cast <std::chrono::nanoseconds> (
+    std::chrono::steady_clock::now ().time_since_epoch ()
+  ).count () ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  The frame name is only built the first time the entity is executed from a given stack
+//----------------------------------------------------------------------------------------------------------------------
+
+static std::string profileFrameName (const char * inKind,
+                                     const GALGAS_string & inName,
+                                     const GALGAS_location & inLocation) {
+  C_String name (inKind) ;
+  if (inName.isValid () && (inName.stringValue ().length () > 0)) {
+    name << " " << inName.stringValue () ;
+  }
+  if (inLocation.isValid () && (inLocation.sourceText ().sourceFilePath ().length () > 0)) {
+    name << " " << inLocation.sourceText ().sourceFilePath () << ":" << cStringWithSigned (inLocation.startLocation ().lineNumber ()) ;
+  }
+//--- ';' separates the frames of a collapsed stack
+  std::string result (name.cString (HERE)) ;
+  std::replace (result.begin (), result.end (), ';', ',') ;
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cGtlProfilerFrame::cGtlProfilerFrame (const void * inEntity,
+                                      const char * inKind,
+                                      const GALGAS_string & inName,
+                                      const GALGAS_location & inLocation) :
+mNode (nullptr) {
+  if ((nullptr != gProfileCurrentNode) && (nullptr == outputJournalForCurrentThread ())) {
+    cGtlProfileNode * & node = gProfileCurrentNode->mChildren [inEntity] ;
+    if (nullptr == node) {
+      node = new cGtlProfileNode (gProfileCurrentNode, profileFrameName (inKind, inName, inLocation)) ;
+    }
+    mNode = node ;
+    gProfileCurrentNode = node ;
+    node->mCallCount += 1 ;
+    node->mStartBytes = allocatedByteCount () ;
+    node->mStartNanoseconds = profilerNanoseconds () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cGtlProfilerFrame::~ cGtlProfilerFrame (void) {
+  if (nullptr != mNode) {
+    const uint64_t duration = profilerNanoseconds () - mNode->mStartNanoseconds ;
+    const uint64_t bytes = allocatedByteCount () - mNode->mStartBytes ;
+    mNode->mInclusiveNanoseconds += duration ;
+    mNode->mInclusiveBytes += bytes ;
+    mNode->mParent->mChildrenNanoseconds += duration ;
+    mNode->mParent->mChildrenBytes += bytes ;
+    gProfileCurrentNode = mNode->mParent ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cGtlProfilerSession::cGtlProfilerSession (void) :
+mEnabled ((nullptr == gProfileCurrentNode) && (gOption_gtl_5F_options_profile.readProperty_value ().length () > 0)) {
+  if (mEnabled) {
+    if (nullptr == gProfileRoot) {
+      gProfileRoot = new cGtlProfileNode (nullptr, "goil") ;
+    }
+    gProfileCurrentNode = gProfileRoot ;
+    enableAllocationCounting () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cGtlProfilerSession::~ cGtlProfilerSession (void) {
+  if (mEnabled) {
+    disableAllocationCounting () ;
+    gProfileCurrentNode = nullptr ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlProfileEntry final {
+  public: std::string mName ;
+  public: uint64_t mCallCount ;
+  public: uint64_t mInclusiveNanoseconds ;
+  public: uint64_t mExclusiveNanoseconds ;
+  public: uint64_t mInclusiveBytes ;
+  public: uint64_t mExclusiveBytes ;
+
+  public: cGtlProfileEntry (void) :
+  mName (),
+  mCallCount (0),
+  mInclusiveNanoseconds (0),
+  mExclusiveNanoseconds (0),
+  mInclusiveBytes (0),
+  mExclusiveBytes (0) {
+  }
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//  ioActiveNames counts the frames of the current stack by name: the inclusive costs of a recursive entity are only
+//  accounted for its outermost frame.
+//----------------------------------------------------------------------------------------------------------------------
+
+static void collectProfile (const cGtlProfileNode * inNode,
+                            const std::string & inStack,
+                            C_String & ioCollapsedStacks,
+                            std::unordered_map <std::string, cGtlProfileEntry> & ioEntries,
+                            std::unordered_map <std::string, uint32_t> & ioActiveNames) {
+  const std::string stack = (inStack.length () == 0) ? inNode->mName : (inStack + ";" + inNode->mName) ;
+  const uint64_t exclusiveNanoseconds = inNode->mInclusiveNanoseconds - inNode->mChildrenNanoseconds ;
+  const uint64_t exclusiveMicroseconds = exclusiveNanoseconds / 1000 ;
+  if (exclusiveMicroseconds > 0) {
+    ioCollapsedStacks << stack.c_str () << " " << cStringWithUnsigned (exclusiveMicroseconds) << "\n" ;
+  }
+  cGtlProfileEntry & entry = ioEntries [inNode->mName] ;
+  entry.mName = inNode->mName ;
+  entry.mCallCount += inNode->mCallCount ;
+  entry.mExclusiveNanoseconds += exclusiveNanoseconds ;
+  entry.mExclusiveBytes += inNode->mInclusiveBytes - inNode->mChildrenBytes ;
+  uint32_t & activeCount = ioActiveNames [inNode->mName] ;
+  if (activeCount == 0) {
+    entry.mInclusiveNanoseconds += inNode->mInclusiveNanoseconds ;
+    entry.mInclusiveBytes += inNode->mInclusiveBytes ;
+  }
+  activeCount += 1 ;
+  for (std::unordered_map <const void *, cGtlProfileNode *>::const_iterator it = inNode->mChildren.begin () ; it != inNode->mChildren.end () ; ++it) {
+    collectProfile (it->second, stack, ioCollapsedStacks, ioEntries, ioActiveNames) ;
+  }
+  ioActiveNames [inNode->mName] -= 1 ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Decreasing exclusive time, then name
+//----------------------------------------------------------------------------------------------------------------------
+
+static int32_t compareProfileEntries (const cGtlProfileEntry * const & inEntry1,
+                                      const cGtlProfileEntry * const & inEntry2) {
+  int32_t result = 0 ;
+  if (inEntry1->mExclusiveNanoseconds > inEntry2->mExclusiveNanoseconds) {
+    result = -1 ;
+  }else if (inEntry1->mExclusiveNanoseconds < inEntry2->mExclusiveNanoseconds) {
+    result = 1 ;
+  }else{
+    result = inEntry1->mName.compare (inEntry2->mName) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cGtlProfilerSession::writeProfile (C_Compiler * inCompiler) {
+  if (mEnabled) {
+  //--- The root frame accounts the time spent out of the sessions as well: only its children are reported
+    C_String collapsedStacks ;
+    std::unordered_map <std::string, cGtlProfileEntry> entries ;
+    std::unordered_map <std::string, uint32_t> activeNames ;
+    for (std::unordered_map <const void *, cGtlProfileNode *>::const_iterator it = gProfileRoot->mChildren.begin () ; it != gProfileRoot->mChildren.end () ; ++it) {
+      collectProfile (it->second, "", collapsedStacks, entries, activeNames) ;
+    }
+  //--- Report
+    TC_UniqueArray <const cGtlProfileEntry *> sortedEntries ;
+    for (std::unordered_map <std::string, cGtlProfileEntry>::const_iterator it = entries.begin () ; it != entries.end () ; ++it) {
+      sortedEntries.appendObject (& it->second) ;
+    }
+    sortedEntries.sortArrayUsingFunction (compareProfileEntries) ;
+    C_String report ;
+    report << "  self (ms)  total (ms)      calls    self (bytes)   total (bytes)  frame\n" ;
+    for (int32_t i=0 ; i<sortedEntries.count () ; i++) {
+      const cGtlProfileEntry & entry = * sortedEntries (i COMMA_HERE) ;
+      char line [128] ;
+      snprintf (line, sizeof (line), "%11.3f %11.3f %10llu %15llu %15llu  ",
+                (double) entry.mExclusiveNanoseconds / 1.0e6,
+                (double) entry.mInclusiveNanoseconds / 1.0e6,
+                (unsigned long long) entry.mCallCount,
+                (unsigned long long) entry.mExclusiveBytes,
+                (unsigned long long) entry.mInclusiveBytes) ;
+      report << line << entry.mName.c_str () << "\n" ;
+    }
+    const C_String filePath = gOption_gtl_5F_options_profile.readProperty_value () ;
+    GALGAS_string (collapsedStacks).method_writeToFile (GALGAS_string (filePath + ".folded"), inCompiler COMMA_HERE) ;
+    GALGAS_string (report).method_writeToFile (GALGAS_string (filePath + ".txt"), inCompiler COMMA_HERE) ;
+  //--- The frame tree is not needed anymore
+    disableAllocationCounting () ;
+    gProfileCurrentNode = nullptr ;
+    delete gProfileRoot ;
+    gProfileRoot = nullptr ;
+    mEnabled = false ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Build manifest of the 'write to' blocks (galgas2/C_BuildManifest.h)
+//
+//  Besides the conditions of the manifest, a block is reusable if it loads no function, getter or setter in the
+//  library.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool instructionListIsIsolated (const GALGAS_gtlInstructionList & inInstructionList) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static uint32_t libraryDefinitionCount (const GALGAS_library & inLibrary) {
+  uint32_t result = 0 ;
+  if (inLibrary.isValid ()) {
+    const cPtr_library * library = (const cPtr_library *) inLibrary.ptr () ;
+    result = library->mProperty_funcMap.count ()
+           + library->mProperty_getterMap.count ()
+           + library->mProperty_setterMap.count ()
+           + library->mProperty_doneImports.getter_count (HERE).uintValue () ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Records the rendering of a 'write to' block by the current thread.
+//----------------------------------------------------------------------------------------------------------------------
+
+class cManifestBlockRecorder final {
+  public: cManifestBlockRecorder (const cPtr_gtlWriteToInstruction * inInstruction,
+                                  const GALGAS_string & inFileName,
+                                  const GALGAS_library & inLibrary) :
+  mRecorder (inFileName, buildManifestIsRecorded () && instructionListIsIsolated (inInstruction->mProperty_instructions)),
+  mLibrary (inLibrary),
+  mLibraryDefinitionCount (mRecorder.isActive () ? libraryDefinitionCount (inLibrary) : 0) {
+  }
+
+  public: ~ cManifestBlockRecorder (void) {
+    if (mRecorder.isActive () && (mLibraryDefinitionCount != libraryDefinitionCount (mLibrary))) {
+      mRecorder.preventReuse () ;
+    }
+  }
+
+  public: inline void noteFileWritten (void) { mRecorder.noteFileWritten () ; }
+
+//--- No copy
+  private: cManifestBlockRecorder (const cManifestBlockRecorder &) = delete ;
+  private: cManifestBlockRecorder & operator = (const cManifestBlockRecorder &) = delete ;
+
+//--- Private properties
+  private: C_BuildManifestBlockRecorder mRecorder ;
+  private: const GALGAS_library & mLibrary ;
+  private: const uint32_t mLibraryDefinitionCount ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+//  Parallel execution of 'write to' blocks
+//
+//  The main thread hands a 'write to' block over to a worker thread when the block is executed with the root library
+//  and cannot change the context of the template it belongs to: no error or input statement, except in the
+//  templates it invokes as they get their own context. The worker renders the block with copies of the context, of
+//  the variables and of the library, in an output journal that also defers the file write. The main thread goes on
+//  and replays the journals in program order, before any output of its own and at the end of the root template;
+//  the functions, getters, setters and templates loaded by a worker are merged into the root library when its
+//  journal is replayed.
+//
+//----------------------------------------------------------------------------------------------------------------------
+
+class cGtlWriteToJob final : public C_OrderedJob {
+  public: cGtlWriteToJob (const cPtr_gtlWriteToInstruction * inInstruction,
+                          const GALGAS_gtlContext & inContext,
+                          const GALGAS_gtlData & inVars,
+                          const GALGAS_library & inLibrary,
+                          GALGAS_library & ioRootLibrary,
+                          const GALGAS_string & inFullFileName,
+                          C_Compiler * inCompiler) :
+  C_OrderedJob (),
+  mInstruction (inInstruction),
+  mContext (inContext),
+  mVars (inVars),
+  mLibrary (inLibrary),
+  mRootLibrary (& ioRootLibrary),
+  mFullFileName (inFullFileName),
+  mCompiler (inCompiler) {
+  }
+
+  protected: virtual void execute (void) override ;
+
+  protected: virtual void willReplay (void) override ;
+
+//--- Properties
+  private: const GALGAS_gtlWriteToInstruction mInstruction ;
+  private: GALGAS_gtlContext mContext ;
+  private: GALGAS_gtlData mVars ;
+  private: GALGAS_library mLibrary ;
+  private: GALGAS_library * const mRootLibrary ;
+  private: const GALGAS_string mFullFileName ;
+  private: C_Compiler * mCompiler ;
+} ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static C_OrderedJobScheduler * gWriteToScheduler = nullptr ;
+
+static GALGAS_library * gWriteToRootLibrary = nullptr ;
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void writeRenderedFile (const GALGAS_string & inContents,
+                               const GALGAS_string & inFullFileName,
+                               const GALGAS_bool & inIsExecutable,
+                               C_Compiler * inCompiler) {
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = inIsExecutable.boolEnum () ;
+    if (kBoolTrue == test_0) {
+      GALGAS_string var_directory_13111 = inFullFileName.getter_stringByDeletingLastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 449)) ;
+      enumGalgasBool test_1 = kBoolTrue ;
+      if (kBoolTrue == test_1) {
+        test_1 = GALGAS_bool (kIsNotEqual, var_directory_13111.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
+        if (kBoolTrue == test_1) {
+          var_directory_13111.method_makeDirectory (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 450)) ;
+        }
+      }
+      inContents.method_writeToExecutableFile (inFullFileName, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 451)) ;
+    }
+  }
+  if (kBoolFalse == test_0) {
+    inContents.method_makeDirectoryAndWriteToFile (inFullFileName, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 453)) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  The file is written after the output of the blocks that precede it: when a journal is attached to the current
+//  thread, the write is recorded in it, otherwise the pending blocks are replayed first.
+//----------------------------------------------------------------------------------------------------------------------
+
+static void writeRenderedFileInOrder (const GALGAS_string & inContents,
+                                      const GALGAS_string & inFullFileName,
+                                      const GALGAS_bool & inIsExecutable,
+                                      C_Compiler * inCompiler) {
+  if (! recordInOutputJournal (0, 0, [=] () { writeRenderedFile (inContents, inFullFileName, inIsExecutable, inCompiler) ; })) {
+    writeRenderedFile (inContents, inFullFileName, inIsExecutable, inCompiler) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cGtlWriteToJob::execute (void) {
+  C_Compiler * inCompiler = mCompiler ;
+  const cPtr_gtlWriteToInstruction * instruction = (const cPtr_gtlWriteToInstruction *) mInstruction.ptr () ;
+  GALGAS_uint var_currentErrorCount_12226 = GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 418)) ;
+  GALGAS_string var_result_12578 = GALGAS_string::makeEmptyString () ;
+  cManifestBlockRecorder manifestRecorder (instruction, mFullFileName, mLibrary) ;
+  extensionMethod_execute (instruction->mProperty_instructions, mContext, mVars, mLibrary, var_result_12578, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 446)) ;
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    test_0 = GALGAS_bool (kIsEqual, var_currentErrorCount_12226.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 447)))).boolEnum () ;
+    if (kBoolTrue == test_0) {
+      writeRenderedFileInOrder (var_result_12578, mFullFileName, instruction->mProperty_isExecutable, inCompiler) ;
+      manifestRecorder.noteFileWritten () ;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template <typename MAP, typename ENUMERATOR, typename VALUE>
+static void mergeMap (const MAP & inSourceMap,
+                      MAP & ioTargetMap,
+                      VALUE (ENUMERATOR::* inCurrentValue) (LOCATION_ARGS) const,
+                      C_Compiler * inCompiler) {
+  ENUMERATOR enumerator (inSourceMap, kENUMERATION_UP) ;
+  while (enumerator.hasCurrentObject ()) {
+    const GALGAS_lstring key = enumerator.current_lkey (HERE) ;
+    if (! ioTargetMap.getter_hasKey (key.readProperty_string () COMMA_HERE).boolValue ()) {
+      ioTargetMap.addAssign_operation (key, (enumerator.*inCurrentValue) (HERE), inCompiler COMMA_HERE) ;
+    }
+    enumerator.gotoNextObject () ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static void mergeLibrary (const GALGAS_library & inLibrary,
+                          GALGAS_library & ioRootLibrary,
+                          C_Compiler * inCompiler) {
+  if (inLibrary.isValid () && ioRootLibrary.isValid () && (inLibrary.ptr () != ioRootLibrary.ptr ())) {
+    const cPtr_library * source = (const cPtr_library *) inLibrary.ptr () ;
+    ioRootLibrary.insulate (HERE) ;
+    cPtr_library * target = (cPtr_library *) ioRootLibrary.ptr () ;
+    mergeMap (source->mProperty_funcMap, target->mProperty_funcMap, & cEnumerator_gtlFuncMap::current_function, inCompiler) ;
+    mergeMap (source->mProperty_getterMap, target->mProperty_getterMap, & cEnumerator_gtlGetterMap::current_theGetter, inCompiler) ;
+    mergeMap (source->mProperty_setterMap, target->mProperty_setterMap, & cEnumerator_gtlSetterMap::current_theSetter, inCompiler) ;
+    mergeMap (source->mProperty_templateMap, target->mProperty_templateMap, & cEnumerator_gtlTemplateMap::current_aTemplate, inCompiler) ;
+    target->mProperty_doneImports.plusAssign_operation (source->mProperty_doneImports, inCompiler COMMA_HERE) ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cGtlWriteToJob::willReplay (void) {
+  mergeLibrary (mLibrary, * mRootLibrary, mCompiler) ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool instructionListIsIsolated (const GALGAS_gtlInstructionList & inInstructionList) ;
+
+//----------------------------------------------------------------------------------------------------------------------
+//  An instruction is isolated when it cannot change the context it is executed in. The variables are not
+//  considered: a 'write to' block executes with a copy of them.
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool instructionIsIsolated (const cPtr_gtlInstruction * inInstruction) {
+  bool result = true ;
+  if ((nullptr != dynamic_cast <const cPtr_gtlErrorStatementInstruction *> (inInstruction))
+   || (nullptr != dynamic_cast <const cPtr_gtlInputStatementInstruction *> (inInstruction))) {
+    result = false ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlIfStatementInstruction *> (inInstruction)) {
+    const cPtr_gtlIfStatementInstruction * p = (const cPtr_gtlIfStatementInstruction *) inInstruction ;
+    cEnumerator_gtlThenElsifStatementList enumerator (p->mProperty_thenElsifList, kENUMERATION_UP) ;
+    while (result && enumerator.hasCurrentObject ()) {
+      result = instructionListIsIsolated (enumerator.current_instructionList (HERE)) ;
+      enumerator.gotoNextObject () ;
+    }
+    result = result && instructionListIsIsolated (p->mProperty_elseList) ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlForeachStatementInstruction *> (inInstruction)) {
+    const cPtr_gtlForeachStatementInstruction * p = (const cPtr_gtlForeachStatementInstruction *) inInstruction ;
+    result = instructionListIsIsolated (p->mProperty_beforeList)
+          && instructionListIsIsolated (p->mProperty_betweenList)
+          && instructionListIsIsolated (p->mProperty_afterList)
+          && instructionListIsIsolated (p->mProperty_doList) ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlForStatementInstruction *> (inInstruction)) {
+    const cPtr_gtlForStatementInstruction * p = (const cPtr_gtlForStatementInstruction *) inInstruction ;
+    result = instructionListIsIsolated (p->mProperty_betweenList)
+          && instructionListIsIsolated (p->mProperty_doList) ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlLoopStatementInstruction *> (inInstruction)) {
+    const cPtr_gtlLoopStatementInstruction * p = (const cPtr_gtlLoopStatementInstruction *) inInstruction ;
+    result = instructionListIsIsolated (p->mProperty_beforeList)
+          && instructionListIsIsolated (p->mProperty_betweenList)
+          && instructionListIsIsolated (p->mProperty_afterList)
+          && instructionListIsIsolated (p->mProperty_doList) ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlRepeatStatementInstruction *> (inInstruction)) {
+    const cPtr_gtlRepeatStatementInstruction * p = (const cPtr_gtlRepeatStatementInstruction *) inInstruction ;
+    result = instructionListIsIsolated (p->mProperty_continueList)
+          && instructionListIsIsolated (p->mProperty_doList) ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlTemplateInstruction *> (inInstruction)) {
+    const cPtr_gtlTemplateInstruction * p = (const cPtr_gtlTemplateInstruction *) inInstruction ;
+    result = instructionListIsIsolated (p->mProperty_instructionsIfNotFound) ;
+  }else if (nullptr != dynamic_cast <const cPtr_gtlWriteToInstruction *> (inInstruction)) {
+    const cPtr_gtlWriteToInstruction * p = (const cPtr_gtlWriteToInstruction *) inInstruction ;
+    result = instructionListIsIsolated (p->mProperty_instructions) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool instructionListIsIsolated (const GALGAS_gtlInstructionList & inInstructionList) {
+  bool result = true ;
+  cEnumerator_gtlInstructionList enumerator (inInstructionList, kENUMERATION_UP) ;
+  while (result && enumerator.hasCurrentObject ()) {
+    result = instructionIsIsolated ((const cPtr_gtlInstruction *) enumerator.current_instruction (HERE).ptr ()) ;
+    enumerator.gotoNextObject () ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+static bool startWriteToJob (const cPtr_gtlWriteToInstruction * inInstruction,
+                             const GALGAS_gtlContext & inContext,
+                             const GALGAS_gtlData & inVars,
+                             GALGAS_library & ioLibrary,
+                             const GALGAS_string & inFullFileName,
+                             C_Compiler * inCompiler) {
+  const bool start = (nullptr != gWriteToScheduler)
+    && (nullptr == outputJournalForCurrentThread ())
+    && (& ioLibrary == gWriteToRootLibrary)
+    && instructionListIsIsolated (inInstruction->mProperty_instructions) ;
+  if (start) {
+  //--- The job is recorded apart from the enclosing block in the build manifest
+    preventReuseOfCurrentBuildManifestBlock () ;
+    gWriteToScheduler->start (new cGtlWriteToJob (inInstruction, inContext, inVars, ioLibrary, ioLibrary, inFullFileName, inCompiler)) ;
+  }
+  return start ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//  Parallel execution is also disabled in debug mode and when profiling.
+//----------------------------------------------------------------------------------------------------------------------
+
+static uint32_t writeToThreadCount (void) {
+  uint32_t result = 1 ;
+  if (! gOption_gtl_5F_options_debug.readProperty_value ()
+   && (gOption_gtl_5F_options_profile.readProperty_value ().length () == 0)) {
+    result = C_OrderedJobScheduler::threadCountForJobs (gOption_goil_5F_options_gtlJobs.readProperty_value ()) ;
+  }
+  return result ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cGtlWriteToScope::cGtlWriteToScope (GALGAS_library & ioRootLibrary,
+                                    C_Compiler * /* inCompiler */) :
+mScheduler (nullptr) {
+  const uint32_t threadCount = writeToThreadCount () ;
+  if ((nullptr == gWriteToScheduler) && (nullptr == outputJournalForCurrentThread ()) && (threadCount > 1)) {
+    mScheduler = new C_OrderedJobScheduler (threadCount) ;
+    gWriteToScheduler = mScheduler ;
+    gWriteToRootLibrary = & ioRootLibrary ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+cGtlWriteToScope::~ cGtlWriteToScope (void) {
+  if (nullptr != mScheduler) {
+    gWriteToScheduler = nullptr ;
+    gWriteToRootLibrary = nullptr ;
+    delete mScheduler ;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void cGtlWriteToScope::replayPendingBlocks (void) {
+  if (nullptr != mScheduler) {
+    mScheduler->replay (0) ;
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 //Overriding extension method '@gtlWriteToInstruction execute'
@@ -11551,32 +12142,30 @@ void cPtr_gtlWriteToInstruction::method_execute (GALGAS_gtlContext & ioArgument_
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
     test_0 = GALGAS_bool (kIsEqual, var_currentErrorCount_12226.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 445)))).boolEnum () ;
-    if (kBoolTrue == test_0) {
+    if ((kBoolTrue == test_0) && ! reuseBuildManifestBlock (var_fullFileName_12277)
+     && ! startWriteToJob (this, ioArgument_context, var_varsCopy_12601, ioArgument_lib, var_fullFileName_12277, inCompiler)) {
+      {
+      routine_beginPhase (GALGAS_string ("write to ").add_operation (var_fullFileName_12277, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 446)), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 446)) ;
+      }
+      cManifestBlockRecorder manifestRecorder (this, var_fullFileName_12277, ioArgument_lib) ;
       extensionMethod_execute (this->mProperty_instructions, ioArgument_context, var_varsCopy_12601, ioArgument_lib, var_result_12578, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 446)) ;
       enumGalgasBool test_1 = kBoolTrue ;
       if (kBoolTrue == test_1) {
         test_1 = GALGAS_bool (kIsEqual, var_currentErrorCount_12226.objectCompare (GALGAS_uint::constructor_errorCount (SOURCE_FILE ("gtl_instructions.galgas", 447)))).boolEnum () ;
         if (kBoolTrue == test_1) {
-          enumGalgasBool test_2 = kBoolTrue ;
-          if (kBoolTrue == test_2) {
-            test_2 = this->mProperty_isExecutable.boolEnum () ;
-            if (kBoolTrue == test_2) {
-              GALGAS_string var_directory_13111 = var_fullFileName_12277.getter_stringByDeletingLastPathComponent (SOURCE_FILE ("gtl_instructions.galgas", 449)) ;
-              enumGalgasBool test_3 = kBoolTrue ;
-              if (kBoolTrue == test_3) {
-                test_3 = GALGAS_bool (kIsNotEqual, var_directory_13111.objectCompare (GALGAS_string::makeEmptyString ())).boolEnum () ;
-                if (kBoolTrue == test_3) {
-                  var_directory_13111.method_makeDirectory (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 450)) ;
-                }
-              }
-              var_result_12578.method_writeToExecutableFile (var_fullFileName_12277, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 451)) ;
-            }
+          {
+          routine_beginPhase (GALGAS_string ("file writing"), inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 448)) ;
           }
-          if (kBoolFalse == test_2) {
-            var_result_12578.method_makeDirectoryAndWriteToFile (var_fullFileName_12277, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 453)) ;
+          writeRenderedFileInOrder (var_result_12578, var_fullFileName_12277, this->mProperty_isExecutable, inCompiler) ;
+          manifestRecorder.noteFileWritten () ;
+          {
+          routine_endPhase (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 450)) ;
           }
         }
       }
+      {
+      routine_endPhase (inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 452)) ;
+      }
     }
   }
 }
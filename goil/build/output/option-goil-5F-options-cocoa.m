@@ -23,6 +23,24 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"arxmlLegacyParser"
+    commandChar:0
+    commandString:@"arxmlLegacyParser"
+    comment:@"Parse arxml files with the lexique based parser instead of the streaming reader"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"force"
+    commandChar:0
+    commandString:@"force"
+    comment:@"Render all the templates, even if the build manifest tells that the generated files are up to date"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"generate_log"
@@ -41,6 +59,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"timings"
+    commandChar:0
+    commandString:@"timings"
+    comment:@"Print a report of the time and memory used by each phase of goil"
+    defaultValue:@""
+  ] ;
+  [ioBoolOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"warnMultiple"
@@ -50,6 +77,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"gtlJobs"
+    commandChar:0
+    commandString:@"gtl-jobs"
+    comment:@"Number of threads executing the 'write to' blocks of the GTL templates (0: one per processor, 1: no parallel execution)"
+    defaultValue:@"0"
+  ] ;
+  [ioUIntOptionArray addObject:option] ;
   option = [[OC_GGS_CommandLineOption alloc]
     initWithDomainName:@"goil_options"
     identifier:@"config"
@@ -104,6 +140,15 @@ void enterOptionsFor_goil_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioStringOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"goil_options"
+    identifier:@"timingsFormat"
+    commandChar:0
+    commandString:@"timings"
+    comment:@"Print the phase timing report in the given format: text or json"
+    defaultValue:@""
+  ] ;
+  [ioStringOptionArray addObject:option] ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -17,6 +17,22 @@ func enterOptions (_ ioBoolOptionArray : inout [SWIFT_CommandLineOption],
     comment: "Display an Oil version while parsing an arxml file",
     defaultValue: ""
   ))
+  ioBoolOptionArray.append (SWIFT_CommandLineOption (
+    domainName: "goil_options",
+    identifier: "arxmlLegacyParser",
+    commandChar: "",
+    commandString: "arxmlLegacyParser",
+    comment: "Parse arxml files with the lexique based parser instead of the streaming reader",
+    defaultValue: ""
+  ))
+  ioBoolOptionArray.append (SWIFT_CommandLineOption (
+    domainName: "goil_options",
+    identifier: "force",
+    commandChar: "",
+    commandString: "force",
+    comment: "Render all the templates, even if the build manifest tells that the generated files are up to date",
+    defaultValue: ""
+  ))
   ioBoolOptionArray.append (SWIFT_CommandLineOption (
     domainName: "goil_options",
     identifier: "generate_log",
@@ -33,6 +49,14 @@ func enterOptions (_ ioBoolOptionArray : inout [SWIFT_CommandLineOption],
     comment: "Special option to pass a galgas bug to Pierre",
     defaultValue: ""
   ))
+  ioBoolOptionArray.append (SWIFT_CommandLineOption (
+    domainName: "goil_options",
+    identifier: "timings",
+    commandChar: "",
+    commandString: "timings",
+    comment: "Print a report of the time and memory used by each phase of goil",
+    defaultValue: ""
+  ))
   ioBoolOptionArray.append (SWIFT_CommandLineOption (
     domainName: "goil_options",
     identifier: "warnMultiple",
@@ -41,6 +65,14 @@ func enterOptions (_ ioBoolOptionArray : inout [SWIFT_CommandLineOption],
     comment: "Emit a warning if an object not defined for the first time in the implementation does not have the same multiple attribute as in the first definition",
     defaultValue: ""
   ))
+  ioUIntOptionArray.append (SWIFT_CommandLineOption (
+    domainName: "goil_options",
+    identifier: "gtlJobs",
+    commandChar: "",
+    commandString: "gtl-jobs",
+    comment: "Number of threads executing the 'write to' blocks of the GTL templates (0: one per processor, 1: no parallel execution)",
+    defaultValue: "0"
+  ))
   ioStringOptionArray.append (SWIFT_CommandLineOption (
     domainName: "goil_options",
     identifier: "config",
@@ -89,6 +121,14 @@ func enterOptions (_ ioBoolOptionArray : inout [SWIFT_CommandLineOption],
     comment: "Specifies template directory (used by goil for code generation)",
     defaultValue: ""
   ))
+  ioStringOptionArray.append (SWIFT_CommandLineOption (
+    domainName: "goil_options",
+    identifier: "timingsFormat",
+    commandChar: "",
+    commandString: "timings",
+    comment: "Print the phase timing report in the given format: text or json",
+    defaultValue: ""
+  ))
   ioBoolOptionArray.append (SWIFT_CommandLineOption (
     domainName: "galgas_cli_options",
     identifier: "quiet_output",
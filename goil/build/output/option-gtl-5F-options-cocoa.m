@@ -32,6 +32,15 @@ void enterOptionsFor_gtl_5F_options (NSMutableArray * ioBoolOptionArray,
     defaultValue:@""
   ] ;
   [ioBoolOptionArray addObject:option] ;
+  option = [[OC_GGS_CommandLineOption alloc]
+    initWithDomainName:@"gtl_options"
+    identifier:@"profile"
+    commandChar:0
+    commandString:@"gtl-profile"
+    comment:@"Profile the execution of the GTL templates, writing <file>.folded (collapsed stacks) and <file>.txt (report)"
+    defaultValue:@""
+  ] ;
+  [ioStringOptionArray addObject:option] ;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
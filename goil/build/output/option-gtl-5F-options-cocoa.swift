@@ -25,6 +25,14 @@ func enterOptions (_ ioBoolOptionArray : inout [SWIFT_CommandLineOption],
     comment: "Warns about deprecated constructs in the GTL template language",
     defaultValue: ""
   ))
+  ioStringOptionArray.append (SWIFT_CommandLineOption (
+    domainName: "gtl_options",
+    identifier: "profile",
+    commandChar: "",
+    commandString: "gtl-profile",
+    comment: "Profile the execution of the GTL templates, writing <file>.folded (collapsed stacks) and <file>.txt (report)",
+    defaultValue: ""
+  ))
   ioBoolOptionArray.append (SWIFT_CommandLineOption (
     domainName: "galgas_cli_options",
     identifier: "quiet_output",
@@ -110,6 +110,57 @@ struct TPL_IOC_QUEUED_MO
 typedef struct TPL_IOC_QUEUED_MO tpl_ioc_queued_mo;
 
 
+#ifndef TPL_CACHE_LINE_SIZE
+/*
+ * The ports with a single core do not define the size of a cache line,
+ * the indexes of the sender and of the receiver are only kept apart.
+ */
+#define TPL_CACHE_LINE_SIZE 16U
+#endif
+
+/**
+ * @typedef tpl_ioc_spsc_queue_dyn
+ *
+ * type for dynamic part of a single producer single consumer queue
+ * descriptor. head and lost_seen are written by the receiver core only,
+ * tail and lost by the sender core only. The padding puts them in
+ * different cache lines (TPL_CACHE_LINE_SIZE in tpl_machine.h), so that
+ * the receiver and the sender do not invalidate the line of each other
+ * at each message. head and tail range from 0 to twice the length of the
+ * queue so that a full queue is told apart from an empty one without a
+ * shared size.
+ */
+struct TPL_IOC_SPSC_QUEUE_DYN
+{
+  VAR(uint32, TYPEDEF)  head;
+  VAR(uint32, TYPEDEF)  lost_seen;
+  VAR(uint32, TYPEDEF)  padding[(TPL_CACHE_LINE_SIZE / sizeof(uint32)) - 2U];
+  VAR(uint32, TYPEDEF)  tail;
+  VAR(uint32, TYPEDEF)  lost;
+};
+
+typedef struct TPL_IOC_SPSC_QUEUE_DYN tpl_ioc_spsc_queue_dyn;
+
+
+/**
+ * @typedef tpl_ioc_spsc_mo
+ *
+ * type single producer single consumer queued ioc message object
+ * descriptor. All the messages of a group share the same indexes.
+ */
+struct TPL_IOC_SPSC_MO
+{
+  P2VAR(tpl_ioc_spsc_queue_dyn, TYPEDEF, OS_VAR)    dyn_desc;
+  P2CONST(tpl_ioc_buffer, TYPEDEF, OS_CONST)        buffer;
+  P2CONST(tpl_ioc_message_size, TYPEDEF, OS_CONST)  element_size;
+  VAR(uint32, TYPEDEF)                              length;
+  VAR(tpl_ioc_id, TYPEDEF)                          id;
+  VAR(tpl_ioc_size, TYPEDEF)                        nb_mo;
+};
+
+typedef struct TPL_IOC_SPSC_MO tpl_ioc_spsc_mo;
+
+
 /**
  * @typedef tpl_ioc_message
  *
@@ -16,6 +16,10 @@
 
 #include "tpl_ioc_queued_kernel.h"
 
+#if WITH_MEMORY_PROTECTION == YES
+#include "tpl_os_mem_prot.h"
+#endif
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 extern void tpl_get_task_lock(void);
@@ -67,7 +71,7 @@ FUNC(tpl_status, OS_CODE) tpl_ioc_send_queued_service(
 #if IOC_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-    ioc_stat = tpl_ioc_queued_table[ioc_id];
+    ioc_stat = tpl_ioc_queued_table[ioc_id-IOC_SPSC_COUNT];
 
     /* trace */
     TRACE_IOC_SEND(ioc_id)
@@ -162,7 +166,7 @@ FUNC(tpl_status, OS_CODE) tpl_ioc_receive_queued_service(
 #if IOC_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-    ioc_stat = tpl_ioc_queued_table[ioc_id];
+    ioc_stat = tpl_ioc_queued_table[ioc_id-IOC_SPSC_COUNT];
 
     /* trace */
     TRACE_IOC_RECEIVE(ioc_id)
@@ -225,6 +229,257 @@ FUNC(tpl_status, OS_CODE) tpl_ioc_receive_queued_service(
 }
 
 
+/**
+ * service for sending several IOC queued messages in one call. The
+ * messages are taken from arrays: ioc_data[i].data points to the first
+ * of count elements of the i-th data of the group.
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data structs to send
+ * @param count in: number of messages to send,
+ *              out: number of messages sent
+ *
+ * @retval IOC_E_OK no error
+ * @retval IOC_E_LIMIT queue is full, only the first messages were sent
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_send_n_queued_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+)
+{
+  P2CONST(tpl_ioc_queued_mo, AUTOMATIC, OS_CONST) ioc_stat;
+  P2CONST(tpl_ioc_queue, AUTOMATIC, OS_CONST)     queue_stat;
+  VAR(tpl_ioc_buffer, AUTOMATIC)                  data_ptr;
+  P2VAR(uint8, AUTOMATIC, AUTOMATIC)              ioc_data_ptr;
+  VAR(tpl_status, AUTOMATIC)                      result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                      ioc_result=IOC_E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                    message;
+  VAR(uint32, AUTOMATIC)                          free_count;
+  VAR(uint32, AUTOMATIC)                          sent = 0;
+  VAR(uint32, AUTOMATIC)                          element;
+  VAR(uint32, AUTOMATIC)                          size;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the task system  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_Send)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_WRITE_IOC_ID(core_id, ioc_id, result)
+
+  /* check count is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, count, result);
+
+#if IOC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_queued_table[ioc_id-IOC_SPSC_COUNT];
+
+    /* trace */
+    TRACE_IOC_SEND(ioc_id)
+
+    /* the number of messages sent is limited by the fullest queue
+       of the group, so that the queues stay in step */
+    sent = *count;
+    for(message=0; message<ioc_stat->nb_mo; message++)
+    {
+      queue_stat = &(ioc_stat->queue[message]);
+      free_count = (queue_stat->max_size - queue_stat->dyn_desc->size) /
+                   queue_stat->element_size;
+      if(free_count < sent)
+      {
+        sent = free_count;
+      }
+    }
+
+    /* loop on all message to send, which means all parameters
+       which can be passed to API call */
+    for(message=0; message<ioc_stat->nb_mo; message++)
+    {
+      /* static decriptor of the current queue for the current message */
+      queue_stat = &(ioc_stat->queue[message]);
+      ioc_data_ptr = ioc_data[message].data;
+      for(element=0; element<sent; element++)
+      {
+        /* the room was checked above, data_ptr is not NULL */
+        data_ptr=tpl_ioc_queue_element_for_write(queue_stat);
+        size = queue_stat->element_size;
+        while (size > 0U) {
+          *data_ptr = *ioc_data_ptr;
+          data_ptr++;
+          ioc_data_ptr++;
+          size--;
+        }
+      }
+
+      if(sent < *count)
+      {
+        /* the queue is full, the messages that are left are lost */
+        ioc_result = IOC_E_LIMIT;
+        queue_stat->dyn_desc->overflow=TRUE;
+      }
+    }
+
+    *count = sent;
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the task structures  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if((ioc_result==IOC_E_OK) && (result!=E_OK))
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+
+/**
+ * service for receiving several IOC queued messages in one call. The
+ * messages are stored in arrays: ioc_data[i].data points to the first
+ * of count elements of the i-th data of the group.
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data structs to receive
+ * @param count in: maximum number of messages to receive,
+ *              out: number of messages received
+ *
+ * @retval IOC_E_OK no error
+ * @retval IOC_E_NO_DATA no data to receive
+ * @retval IOC_E_LOST_DATA previous send caused a queue overflow
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_receive_n_queued_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+)
+{
+  P2CONST(tpl_ioc_queued_mo, AUTOMATIC, OS_CONST) ioc_stat;
+  P2CONST(tpl_ioc_queue, AUTOMATIC, OS_CONST)     queue_stat;
+  VAR(tpl_ioc_buffer, AUTOMATIC)                  data_ptr;
+  P2VAR(uint8, AUTOMATIC, AUTOMATIC)              ioc_data_ptr;
+  VAR(tpl_status, AUTOMATIC)                      result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                      ioc_result=IOC_E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                    message;
+  VAR(uint32, AUTOMATIC)                          available;
+  VAR(uint32, AUTOMATIC)                          received = 0;
+  VAR(uint32, AUTOMATIC)                          element;
+  VAR(uint32, AUTOMATIC)                          size;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the task system  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_Receive)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_READ_IOC_ID(core_id, ioc_id, result)
+
+  /* check count is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, count, result);
+
+#if IOC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_queued_table[ioc_id-IOC_SPSC_COUNT];
+
+    /* trace */
+    TRACE_IOC_RECEIVE(ioc_id)
+
+    /* the number of messages received is limited by the emptiest
+       queue of the group */
+    received = *count;
+    for(message=0; message<ioc_stat->nb_mo; message++)
+    {
+      queue_stat = &(ioc_stat->queue[message]);
+      available = queue_stat->dyn_desc->size / queue_stat->element_size;
+      if(available < received)
+      {
+        received = available;
+      }
+    }
+
+    if(received == 0U)
+    {
+      /* the queue is empty, there is nothing to receive */
+      ioc_result = IOC_E_NO_DATA;
+    }
+
+    /* loop on all message to receive, which means all parameters
+       which can be passed to API call */
+    for(message=0; message<ioc_stat->nb_mo; message++)
+    {
+      /* static decriptor of the current queue for the current message */
+      queue_stat = &(ioc_stat->queue[message]);
+      ioc_data_ptr = ioc_data[message].data;
+      for(element=0; element<received; element++)
+      {
+        /* the content was checked above, data_ptr is not NULL */
+        data_ptr=tpl_ioc_queue_element_for_read(queue_stat);
+        size = queue_stat->element_size;
+        while (size > 0U) {
+          *ioc_data_ptr = *data_ptr;
+          ioc_data_ptr++;
+          data_ptr++;
+          size--;
+        }
+      }
+
+      /* if an overflow has beed detected during send,
+         it is notified here to the receiver */
+      if(queue_stat->dyn_desc->overflow==TRUE)
+      {
+        ioc_result = IOC_E_LOST_DATA;
+        queue_stat->dyn_desc->overflow=FALSE;
+      }
+    }
+
+    *count = received;
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the task structures  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if((ioc_result==IOC_E_OK) && (result!=E_OK))
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+
 /**
  * service for emptying an IOC queue
  *
@@ -264,7 +519,7 @@ FUNC(StatusType, OS_CODE) tpl_ioc_empty_queue_service(
 #if IOC_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-    ioc_stat = tpl_ioc_queued_table[ioc_id];
+    ioc_stat = tpl_ioc_queued_table[ioc_id-IOC_SPSC_COUNT];
 
     /* loop on all message to clear */
     for(message=0; message<ioc_stat->nb_mo; message++)
@@ -49,6 +49,18 @@ extern FUNC(tpl_status, OS_CODE) tpl_ioc_receive_queued_service(
   P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
 );
 
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_send_n_queued_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+);
+
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_receive_n_queued_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+);
+
 extern FUNC(StatusType, OS_CODE) tpl_ioc_empty_queue_service(
   VAR(tpl_ioc_id, AUTOMATIC) ioc_id
 );
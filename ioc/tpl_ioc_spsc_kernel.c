@@ -0,0 +1,663 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline AUTOSAR IOC single producer single consumer services
+ * implementation
+ *
+ * These services are used by the queued IocCommunications that have one
+ * sender and one receiver. They do not take the kernel lock (LOCK_KERNEL
+ * is FALSE in api_ioc.oil): the sender core only writes the tail of the
+ * queue and the receiver core only writes its head. LOCK_KERNEL() only
+ * serializes the tasks and ISRs of the calling core, as the services are
+ * not reentrant on a core.
+ *
+ * $Date$ - $Rev$
+ * $Author$
+ * $URL$
+ */
+/* MISRA RULE 3.1 VIOLATION: special character is used in comments for svn integration, the code can survive to this ! */
+
+#include "tpl_ioc_spsc_kernel.h"
+
+#if WITH_MEMORY_PROTECTION == YES
+#include "tpl_os_mem_prot.h"
+#endif
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+extern void tpl_get_task_lock(void);
+extern void tpl_release_task_lock(void);
+#if APP_COUNT > 0
+extern CONSTP2CONST(tpl_app_access, AUTOMATIC, OS_APPL_CONST)
+tpl_app_table[APP_COUNT];
+#endif
+
+/**
+ * Copies a message. Words are copied when both buffers are aligned on a
+ * word boundary, the remaining bytes are copied one by one.
+ *
+ * @param to    the destination buffer
+ * @param from  the source buffer
+ * @param size  the size of the message in bytes
+ */
+STATIC FUNC(void, OS_CODE) tpl_ioc_copy(
+  P2VAR(tpl_ioc_data, AUTOMATIC, OS_VAR)    to,
+  P2CONST(tpl_ioc_data, AUTOMATIC, OS_VAR)  from,
+  VAR(tpl_ioc_message_size, AUTOMATIC)      size)
+{
+  P2VAR(uint32, AUTOMATIC, OS_VAR)    to_word;
+  P2CONST(uint32, AUTOMATIC, OS_VAR)  from_word;
+
+  /* MISRA RULE 11.3 VIOLATION: the addresses are converted to an integer
+     only to check their alignment */
+  if (((((unsigned long)to) | ((unsigned long)from)) &
+       (sizeof(uint32) - 1U)) == 0U)
+  {
+    to_word = (P2VAR(uint32, AUTOMATIC, OS_VAR))to;
+    from_word = (P2CONST(uint32, AUTOMATIC, OS_VAR))from;
+    while (size >= sizeof(uint32))
+    {
+      *to_word = *from_word;
+      to_word++;
+      from_word++;
+      size -= (tpl_ioc_message_size)sizeof(uint32);
+    }
+    to = (P2VAR(tpl_ioc_data, AUTOMATIC, OS_VAR))to_word;
+    from = (P2CONST(tpl_ioc_data, AUTOMATIC, OS_VAR))from_word;
+  }
+
+  while (size > 0U)
+  {
+    *to = *from;
+    to++;
+    from++;
+    size--;
+  }
+}
+
+/**
+ * service for sending an IOC queued message on a single producer
+ * single consumer queue. The messages of a group are all sent or
+ * none is sent.
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data struct to send
+ *
+ * @retval IOC_E_OK no error
+ * @retval IOC_E_LIMIT queue is full
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_send_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+)
+{
+  P2CONST(tpl_ioc_spsc_mo, AUTOMATIC, OS_CONST)     ioc_stat;
+  P2VAR(tpl_ioc_spsc_queue_dyn, AUTOMATIC, OS_VAR)  dq;
+  VAR(uint32, AUTOMATIC)                            head;
+  VAR(uint32, AUTOMATIC)                            tail;
+  VAR(uint32, AUTOMATIC)                            slot;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                        ioc_result=IOC_E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                      message;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the tasks of the core  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_Send)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_WRITE_IOC_ID(core_id, ioc_id, result)
+
+#if IOC_SPSC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_spsc_table[ioc_id];
+    dq = ioc_stat->dyn_desc;
+
+    /* trace */
+    TRACE_IOC_SEND(ioc_id)
+
+    /* the tail is only written by this core, the head is written by
+       the receiver core */
+    tail = dq->tail;
+    head = TPL_IOC_LOAD_ACQUIRE(dq->head);
+
+    /* check the queue is not full */
+    if ((tail - head) != ioc_stat->length &&
+        (head - tail) != ioc_stat->length)
+    {
+      slot = (tail < ioc_stat->length) ? tail : (tail - ioc_stat->length);
+
+      /* copy all the messages of the group in their slot */
+      for (message=0; message<ioc_stat->nb_mo; message++)
+      {
+        /* MISRA RULE 17.4 VIOLATION: performing pointer aritmetic here,
+           this is the fastest and most readable way to manage the buffer.
+           Furthermore the slot value is checked to be in bounds, this is
+           safe. */
+        tpl_ioc_copy(
+          ioc_stat->buffer[message] + (slot * ioc_stat->element_size[message]),
+          ioc_data[message].data,
+          ioc_stat->element_size[message]);
+      }
+
+      /* publish the messages to the receiver core */
+      tail++;
+      if (tail == (2U * ioc_stat->length))
+      {
+        tail = 0;
+      }
+      TPL_IOC_STORE_RELEASE(dq->tail, tail);
+    }
+    else
+    {
+      /* the queue is full, the overflow is notified to the receiver */
+      ioc_result = IOC_E_LIMIT;
+      TPL_IOC_STORE_RELEASE(dq->lost, dq->lost + 1U);
+    }
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the tasks of the core  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if((ioc_result==IOC_E_OK) && (result!=E_OK))
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+
+/**
+ * service for receiving an IOC queued message from a single producer
+ * single consumer queue
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data struct to receive
+ *
+ * @retval IOC_E_OK no error
+ * @retval IOC_E_NO_DATA no data to receive
+ * @retval IOC_E_LOST_DATA a message is received and a previous send
+ *                         caused a queue overflow
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_receive_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+)
+{
+  P2CONST(tpl_ioc_spsc_mo, AUTOMATIC, OS_CONST)     ioc_stat;
+  P2VAR(tpl_ioc_spsc_queue_dyn, AUTOMATIC, OS_VAR)  dq;
+  VAR(uint32, AUTOMATIC)                            head;
+  VAR(uint32, AUTOMATIC)                            tail;
+  VAR(uint32, AUTOMATIC)                            lost;
+  VAR(uint32, AUTOMATIC)                            slot;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                        ioc_result=IOC_E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                      message;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the tasks of the core  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_Receive)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_READ_IOC_ID(core_id, ioc_id, result)
+
+#if IOC_SPSC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_spsc_table[ioc_id];
+    dq = ioc_stat->dyn_desc;
+
+    /* trace */
+    TRACE_IOC_RECEIVE(ioc_id)
+
+    /* the head is only written by this core, the tail is written by
+       the sender core */
+    head = dq->head;
+    tail = TPL_IOC_LOAD_ACQUIRE(dq->tail);
+
+    /* check the queue is not empty */
+    if (head != tail)
+    {
+      slot = (head < ioc_stat->length) ? head : (head - ioc_stat->length);
+
+      /* copy all the messages of the group from their slot */
+      for (message=0; message<ioc_stat->nb_mo; message++)
+      {
+        /* MISRA RULE 17.4 VIOLATION: performing pointer aritmetic here,
+           this is the fastest and most readable way to manage the buffer.
+           Furthermore the slot value is checked to be in bounds, this is
+           safe. */
+        tpl_ioc_copy(
+          ioc_data[message].data,
+          ioc_stat->buffer[message] + (slot * ioc_stat->element_size[message]),
+          ioc_stat->element_size[message]);
+      }
+
+      /* give the slot back to the sender core */
+      head++;
+      if (head == (2U * ioc_stat->length))
+      {
+        head = 0;
+      }
+      TPL_IOC_STORE_RELEASE(dq->head, head);
+
+      /* if an overflow has beed detected during send,
+         it is notified here to the receiver with the next message */
+      lost = TPL_IOC_LOAD_ACQUIRE(dq->lost);
+      if (lost != dq->lost_seen)
+      {
+        ioc_result = IOC_E_LOST_DATA;
+        dq->lost_seen = lost;
+      }
+    }
+    else
+    {
+      /* the queue is empty, there is nothing to receive */
+      ioc_result = IOC_E_NO_DATA;
+    }
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the tasks of the core  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if((ioc_result==IOC_E_OK) && (result!=E_OK))
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+
+/**
+ * service for sending several IOC queued messages in one call on a
+ * single producer single consumer queue. The messages are taken from
+ * arrays: ioc_data[i].data points to the first of count elements of the
+ * i-th data of the group. The messages are copied in at most two chunks
+ * per data and published at once to the receiver core.
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data structs to send
+ * @param count in: number of messages to send,
+ *              out: number of messages sent
+ *
+ * @retval IOC_E_OK no error
+ * @retval IOC_E_LIMIT queue is full, only the first messages were sent
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_send_n_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+)
+{
+  P2CONST(tpl_ioc_spsc_mo, AUTOMATIC, OS_CONST)     ioc_stat;
+  P2VAR(tpl_ioc_spsc_queue_dyn, AUTOMATIC, OS_VAR)  dq;
+  VAR(uint32, AUTOMATIC)                            head;
+  VAR(uint32, AUTOMATIC)                            tail;
+  VAR(uint32, AUTOMATIC)                            slot;
+  VAR(uint32, AUTOMATIC)                            first;
+  VAR(uint32, AUTOMATIC)                            sent = 0;
+  VAR(tpl_ioc_message_size, AUTOMATIC)              size;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                        ioc_result=IOC_E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                      message;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the tasks of the core  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_Send)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_WRITE_IOC_ID(core_id, ioc_id, result)
+
+  /* check count is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, count, result);
+
+#if IOC_SPSC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_spsc_table[ioc_id];
+    dq = ioc_stat->dyn_desc;
+
+    /* trace */
+    TRACE_IOC_SEND(ioc_id)
+
+    /* the tail is only written by this core, the head is written by
+       the receiver core */
+    tail = dq->tail;
+    head = TPL_IOC_LOAD_ACQUIRE(dq->head);
+
+    /* number of free slots */
+    sent = (tail >= head) ? (tail - head)
+                          : ((tail + (2U * ioc_stat->length)) - head);
+    sent = ioc_stat->length - sent;
+    if (sent >= *count)
+    {
+      sent = *count;
+    }
+    else
+    {
+      /* the queue is full, the overflow is notified to the receiver */
+      ioc_result = IOC_E_LIMIT;
+      TPL_IOC_STORE_RELEASE(dq->lost, dq->lost + 1U);
+    }
+
+    if (sent > 0U)
+    {
+      slot = (tail < ioc_stat->length) ? tail : (tail - ioc_stat->length);
+      /* number of messages before the end of the buffer */
+      first = ioc_stat->length - slot;
+      if (first > sent)
+      {
+        first = sent;
+      }
+
+      /* copy all the messages of the group in their slots */
+      for (message=0; message<ioc_stat->nb_mo; message++)
+      {
+        size = ioc_stat->element_size[message];
+        /* MISRA RULE 17.4 VIOLATION: performing pointer aritmetic here,
+           this is the fastest and most readable way to manage the buffer.
+           Furthermore the slot value is checked to be in bounds, this is
+           safe. */
+        tpl_ioc_copy(
+          ioc_stat->buffer[message] + (slot * size),
+          ioc_data[message].data,
+          first * size);
+        tpl_ioc_copy(
+          ioc_stat->buffer[message],
+          ioc_data[message].data + (first * size),
+          (sent - first) * size);
+      }
+
+      /* publish the messages to the receiver core */
+      tail += sent;
+      if (tail >= (2U * ioc_stat->length))
+      {
+        tail -= 2U * ioc_stat->length;
+      }
+      TPL_IOC_STORE_RELEASE(dq->tail, tail);
+    }
+
+    *count = sent;
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the tasks of the core  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if((ioc_result==IOC_E_OK) && (result!=E_OK))
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+
+/**
+ * service for receiving several IOC queued messages in one call from a
+ * single producer single consumer queue. The messages are stored in
+ * arrays: ioc_data[i].data points to the first of count elements of the
+ * i-th data of the group.
+ *
+ * @param ioc_id identifier of the ioc
+ * @param ioc_data pointer to the data structs to receive
+ * @param count in: maximum number of messages to receive,
+ *              out: number of messages received
+ *
+ * @retval IOC_E_OK no error
+ * @retval IOC_E_NO_DATA no data to receive
+ * @retval IOC_E_LOST_DATA messages are received and a previous send
+ *                         caused a queue overflow
+ *
+ */
+FUNC(tpl_status, OS_CODE) tpl_ioc_receive_n_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+)
+{
+  P2CONST(tpl_ioc_spsc_mo, AUTOMATIC, OS_CONST)     ioc_stat;
+  P2VAR(tpl_ioc_spsc_queue_dyn, AUTOMATIC, OS_VAR)  dq;
+  VAR(uint32, AUTOMATIC)                            head;
+  VAR(uint32, AUTOMATIC)                            tail;
+  VAR(uint32, AUTOMATIC)                            lost;
+  VAR(uint32, AUTOMATIC)                            slot;
+  VAR(uint32, AUTOMATIC)                            first;
+  VAR(uint32, AUTOMATIC)                            received = 0;
+  VAR(tpl_ioc_message_size, AUTOMATIC)              size;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                        ioc_result=IOC_E_OK;
+  VAR(tpl_ioc_size, AUTOMATIC)                      message;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the tasks of the core  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_Receive)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_READ_IOC_ID(core_id, ioc_id, result)
+
+  /* check count is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, count, result);
+
+#if IOC_SPSC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    ioc_stat = tpl_ioc_spsc_table[ioc_id];
+    dq = ioc_stat->dyn_desc;
+
+    /* trace */
+    TRACE_IOC_RECEIVE(ioc_id)
+
+    /* the head is only written by this core, the tail is written by
+       the sender core */
+    head = dq->head;
+    tail = TPL_IOC_LOAD_ACQUIRE(dq->tail);
+
+    /* number of messages in the queue */
+    received = (tail >= head) ? (tail - head)
+                              : ((tail + (2U * ioc_stat->length)) - head);
+    if (received > *count)
+    {
+      received = *count;
+    }
+
+    if (received > 0U)
+    {
+      slot = (head < ioc_stat->length) ? head : (head - ioc_stat->length);
+      /* number of messages before the end of the buffer */
+      first = ioc_stat->length - slot;
+      if (first > received)
+      {
+        first = received;
+      }
+
+      /* copy all the messages of the group from their slots */
+      for (message=0; message<ioc_stat->nb_mo; message++)
+      {
+        size = ioc_stat->element_size[message];
+        /* MISRA RULE 17.4 VIOLATION: performing pointer aritmetic here,
+           this is the fastest and most readable way to manage the buffer.
+           Furthermore the slot value is checked to be in bounds, this is
+           safe. */
+        tpl_ioc_copy(
+          ioc_data[message].data,
+          ioc_stat->buffer[message] + (slot * size),
+          first * size);
+        tpl_ioc_copy(
+          ioc_data[message].data + (first * size),
+          ioc_stat->buffer[message],
+          (received - first) * size);
+      }
+
+      /* give the slots back to the sender core */
+      head += received;
+      if (head >= (2U * ioc_stat->length))
+      {
+        head -= 2U * ioc_stat->length;
+      }
+      TPL_IOC_STORE_RELEASE(dq->head, head);
+
+      /* if an overflow has beed detected during send,
+         it is notified here to the receiver with the next messages */
+      lost = TPL_IOC_LOAD_ACQUIRE(dq->lost);
+      if (lost != dq->lost_seen)
+      {
+        ioc_result = IOC_E_LOST_DATA;
+        dq->lost_seen = lost;
+      }
+    }
+    else
+    {
+      /* the queue is empty, there is nothing to receive */
+      ioc_result = IOC_E_NO_DATA;
+    }
+
+    *count = received;
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the tasks of the core  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if((ioc_result==IOC_E_OK) && (result!=E_OK))
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+
+/**
+ * service for emptying a single producer single consumer IOC queue.
+ * The queue is emptied from the receiver side: the messages sent
+ * before are discarded. As head and lost_seen belong to the receiver,
+ * only the receiver may empty the queue. A call from the sender gets
+ * an access error.
+ *
+ * @param ioc_id identifier of the ioc
+ *
+ * @retval IOC_E_OK no error
+ *
+ */
+FUNC(StatusType, OS_CODE) tpl_ioc_empty_spsc_queue_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id
+)
+{
+  P2VAR(tpl_ioc_spsc_queue_dyn, AUTOMATIC, OS_VAR)  dq;
+  VAR(tpl_status, AUTOMATIC)                        result = E_OK;
+  VAR(tpl_status, AUTOMATIC)                        ioc_result=IOC_E_OK;
+  GET_CURRENT_CORE_ID(core_id)
+
+  /*  lock the tasks of the core  */
+  LOCK_KERNEL()
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(IOCServiceId_IOC_EmptyQueue)
+  STORE_IOC_ID(ioc_id)
+
+  /*  check a ioc_id error   */
+  /* MISRA RULE 13.7 VIOLATION: result is always E_OK here,
+     but this is a generic macro and it has to be tested */
+  CHECK_IOC_ID_ERROR(ioc_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_READ_IOC_ID(core_id, ioc_id, result)
+
+#if IOC_SPSC_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    dq = tpl_ioc_spsc_table[ioc_id]->dyn_desc;
+    TPL_IOC_STORE_RELEASE(dq->head, TPL_IOC_LOAD_ACQUIRE(dq->tail));
+    dq->lost_seen = TPL_IOC_LOAD_ACQUIRE(dq->lost);
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  /*  unlock the tasks of the core  */
+  UNLOCK_KERNEL()
+
+  /*
+   * in case ioc_result is IOC_E_OK but result is not E_OK,
+   * it means we detected an error not handled by IOC error codes
+   */
+  if(result!=E_OK)
+  {
+    ioc_result = IOC_E_NOT_OK;
+  }
+  return ioc_result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_ioc_spsc_kernel.c */
@@ -0,0 +1,103 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline AUTOSAR IOC single producer single consumer services
+ * declaration
+ *
+ * $Date$ - $Rev$
+ * $Author$
+ * $URL$
+ */
+/* MISRA RULE 3.1 VIOLATION: special character is used in comments for svn integration, the code can survive to this ! */
+
+#ifndef __TPL_IOC_SPSC_KERNEL_H__
+#define __TPL_IOC_SPSC_KERNEL_H__
+
+#include "tpl_ioc.h"
+#include "tpl_os_error.h"
+#include "tpl_as_app_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_as_definitions.h"
+#include "tpl_trace.h"
+
+/**
+ * @def TPL_IOC_LOAD_ACQUIRE
+ *
+ * Reads an index of a single producer single consumer queue written by
+ * the other core. The accesses to the queue done after cannot be moved
+ * before the read.
+ *
+ * @def TPL_IOC_STORE_RELEASE
+ *
+ * Writes an index of a single producer single consumer queue read by
+ * the other core. The accesses to the queue done before cannot be moved
+ * after the write.
+ *
+ * A port may define both macros in tpl_machine.h. Otherwise the atomic
+ * builtins are used with GCC and compatible compilers and volatile
+ * accesses are used with the other compilers, which is enough for
+ * cores that do not reorder memory accesses.
+ */
+#ifndef TPL_IOC_LOAD_ACQUIRE
+#if defined(__GNUC__)
+#define TPL_IOC_LOAD_ACQUIRE(var)                                              \
+  __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define TPL_IOC_STORE_RELEASE(var, value)                                      \
+  __atomic_store_n(&(var), (value), __ATOMIC_RELEASE)
+#else
+#define TPL_IOC_LOAD_ACQUIRE(var)                                              \
+  (*(volatile uint32 *)&(var))
+#define TPL_IOC_STORE_RELEASE(var, value)                                      \
+  (*(volatile uint32 *)&(var) = (value))
+#endif
+#endif
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+extern CONSTP2CONST(tpl_ioc_spsc_mo, OS_CONST, OS_CONST) tpl_ioc_spsc_table[];
+
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_send_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+);
+
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_receive_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data
+);
+
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_send_n_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+);
+
+extern FUNC(tpl_status, OS_CODE) tpl_ioc_receive_n_spsc_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id,
+  P2CONST(tpl_ioc_message, AUTOMATIC, OS_VAR) ioc_data,
+  P2VAR(uint32, AUTOMATIC, OS_VAR) count
+);
+
+extern FUNC(StatusType, OS_CODE) tpl_ioc_empty_spsc_queue_service(
+  VAR(tpl_ioc_id, AUTOMATIC) ioc_id
+);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+
+#endif /* __TPL_IOC_SPSC_KERNEL_H__ */
+
@@ -27,15 +27,46 @@ struct TPL_STACK {
 typedef struct TPL_STACK *tpl_stack;
 extern struct TPL_STACK idle_task_stack;
 
+#if WITH_POSIX_FAST_CONTEXT == YES
+/*
+ * With the fast context switch, the registers are saved on the stack of
+ * the context. Only the stack pointer is kept.
+ */
+struct TPL_CONTEXT {
+    void *current;
+};
+#else
 struct TPL_CONTEXT {
     jmp_buf initial;
     jmp_buf current;
 };
+#endif
 typedef struct TPL_CONTEXT *tpl_context;
 extern struct TPL_CONTEXT idle_task_context;
 
 extern void tpl_sleep(void);
 
+/*
+ * Size of the signal number to ISR2 table generated by goil. Signals are
+ * numbered from 1 to 64 on linux and from 1 to 31 on darwin.
+ */
+#define TPL_POSIX_SIGNAL_COUNT 65
+
+#if defined(SIGRTMIN)
+/*
+ * Real-time signals available as SOURCE of an ISR2. They are not constant
+ * expressions with glibc and are read by tpl_posix_init_isr_signals.
+ */
+#define SIGRTMIN_1 (SIGRTMIN + 1)
+#define SIGRTMIN_2 (SIGRTMIN + 2)
+#define SIGRTMIN_3 (SIGRTMIN + 3)
+#define SIGRTMIN_4 (SIGRTMIN + 4)
+#define SIGRTMIN_5 (SIGRTMIN + 5)
+#define SIGRTMIN_6 (SIGRTMIN + 6)
+#define SIGRTMIN_7 (SIGRTMIN + 7)
+#define SIGRTMIN_8 (SIGRTMIN + 8)
+#endif
+
 #define IDLE_CONTEXT    &idle_task_context 
 #define IDLE_ENTRY      tpl_sleep
 #define IDLE_STACK      &idle_task_stack
@@ -48,4 +79,21 @@ extern void tpl_sleep(void);
  */
 #define tpl_restore_cpu_priority()
 
+/*
+ * Size of a cache line of the host. Data written by different cores, like
+ * the queue nodes of a MCS spinlock, are kept this far apart.
+ */
+#define TPL_CACHE_LINE_SIZE 64U
+
+#if NUMBER_OF_CORES > 1
+/*
+ * In multicore, each core is a POSIX thread. tpl_get_core_id returns the
+ * identifier of the core the calling thread emulates and tpl_init_core
+ * does the core dependant initialization, it is called by each core in
+ * StartOS.
+ */
+extern FUNC(uint16, OS_CODE) tpl_get_core_id(void);
+extern FUNC(void, OS_CODE) tpl_init_core(void);
+#endif
+
 #endif /* TPL_MACHINE_H */
@@ -7,6 +7,7 @@
  *
  */
 
+#define _GNU_SOURCE /* pthread_setaffinity_np */
 #define _XOPEN_SOURCE 1000
 
 #include "tpl_posix_internal.h"
@@ -40,13 +41,25 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <sys/wait.h>
+#include <time.h>
 
 #include "tpl_machine_posix.h"
 #include "tpl_posixvp_irq_gen.h"
 
-extern volatile int tpl_locking_depth;
-extern char tpl_user_task_lock;
-extern char tpl_cpt_os_task_lock;
+#if NUMBER_OF_CORES > 1
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+extern volatile VAR(uint32, OS_VAR) tpl_locking_depth[NUMBER_OF_CORES];
+extern VAR(tpl_bool, OS_VAR) tpl_user_task_lock[NUMBER_OF_CORES];
+extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock[NUMBER_OF_CORES];
+#else
+extern volatile VAR(uint32, OS_VAR) tpl_locking_depth;
+extern VAR(tpl_bool, OS_VAR) tpl_user_task_lock;
+extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock;
+#endif
 
 #if TASK_COUNT > 0
 extern FUNC(void, OS_CODE) CallTerminateTask(void);
@@ -82,14 +95,16 @@ int cnt = 0;
  */
 void tpl_get_task_lock(void)
 {
+    GET_CURRENT_CORE_ID(core_id)
+
     /*
      * block the handling of signals
      */
-    if(0 == tpl_locking_depth) {
+    if(0 == GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id)) {
         tpl_posix_sigblock("tpl_get_lock failed");
     }
-    tpl_locking_depth++;
-    tpl_cpt_os_task_lock++;
+    GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id)++;
+    GET_LOCK_CNT_FOR_CORE(tpl_cpt_os_task_lock, core_id)++;
 }
 
 /*
@@ -98,15 +113,24 @@ void tpl_get_task_lock(void)
  */
 void tpl_release_task_lock(void)
 {
+    GET_CURRENT_CORE_ID(core_id)
+
 #if defined(__unix__) || defined(__APPLE__)
-    assert( tpl_locking_depth > 0 );
+    assert( GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id) > 0 );
 #endif
-    tpl_locking_depth--;
-    tpl_cpt_os_task_lock--;
+    GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id)--;
+    GET_LOCK_CNT_FOR_CORE(tpl_cpt_os_task_lock, core_id)--;
 
-    if ( (tpl_locking_depth == 0) && (FALSE == tpl_user_task_lock) )
+    if (0 == GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id))
     {
-        tpl_posix_sigunblock("tpl_release_lock failed");
+#if NUMBER_OF_CORES > 1
+        /* the core leaves the kernel */
+        tpl_release_kernel_lock();
+#endif
+        if (FALSE == GET_LOCK_CNT_FOR_CORE(tpl_user_task_lock, core_id))
+        {
+            tpl_posix_sigunblock("tpl_release_lock failed");
+        }
     }
 }
 
@@ -116,6 +140,13 @@ void tpl_release_task_lock(void)
             CONSTP2CONST(tpl_context, AUTOMATIC, OS_CONST) old_context,
             CONSTP2CONST(tpl_context, AUTOMATIC, OS_CONST) new_context)
 {
+#if WITH_POSIX_FAST_CONTEXT == YES
+    void *discarded_sp;
+
+    tpl_posix_swap_context(
+        (NULL == old_context) ? &discarded_sp : &(*old_context)->current,
+        (*new_context)->current);
+#else
     if( NULL == old_context)
     {
         _longjmp((*new_context)->current, 1);
@@ -124,6 +155,7 @@ void tpl_release_task_lock(void)
     {
         _longjmp((*new_context)->current, 1);
     }
+#endif
     return;
 }
 
@@ -133,7 +165,14 @@ void tpl_release_task_lock(void)
             CONSTP2CONST(tpl_context, AUTOMATIC, OS_CONST) old_context,
             CONSTP2CONST(tpl_context, AUTOMATIC, OS_CONST) new_context)
 {
-    if( NULL == old_context )
+#if WITH_POSIX_FAST_CONTEXT == YES
+    void *discarded_sp;
+
+    tpl_posix_swap_context(
+        (NULL == old_context) ? &discarded_sp : &(*old_context)->current,
+        (*new_context)->current);
+#else
+    if( NULL == old_context)
     {
         _longjmp((*new_context)->current, 1);
     }
@@ -141,6 +180,7 @@ void tpl_release_task_lock(void)
     {
         _longjmp((*new_context)->current, 1);
     }
+#endif
     return;
 }
 
@@ -149,9 +189,13 @@ void tpl_release_task_lock(void)
 FUNC(void, OS_CODE) tpl_init_context(
         CONST(tpl_proc_id, OS_APPL_DATA) proc_id)
 {
+#if WITH_POSIX_FAST_CONTEXT == YES
+    tpl_posix_build_context(proc_id);
+#else
     memcpy( tpl_stat_proc_table[proc_id]->context->current,
             tpl_stat_proc_table[proc_id]->context->initial,
             sizeof(jmp_buf));
+#endif
 }
 
 
@@ -183,6 +227,25 @@ void tpl_osek_func_stub( tpl_proc_id task_id )
     }
 }
 
+#if (WITH_STATISTICS == YES) || (WITH_SPINLOCK_STATISTICS == YES)
+/*
+ * Date used by the process and spinlock statistics, in microseconds.
+ * CLOCK_MONOTONIC is read through the vDSO on linux, without system call.
+ * The date is computed in 64 bits and truncated to tpl_stats_time, so it
+ * wraps around modulo 2^32 like the durations computed from it.
+ */
+FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_timer(void)
+{
+    struct timespec now;
+    unsigned long long usec;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    usec = (unsigned long long)now.tv_sec * 1000000ULL
+           + (unsigned long long)(now.tv_nsec / 1000);
+    return (tpl_stats_time)usec;
+}
+#endif /* WITH_STATISTICS || WITH_SPINLOCK_STATISTICS */
+
 void quit(int n)
 {
     (void) n;
@@ -200,11 +263,17 @@ void tpl_init_machine(void)
     // TODO: invert control flow between these 2 functions
     tpl_posixvp_irq_gen_init();
 
+#if WITH_TRACE == YES
+    /* in the trampoline process, so the flusher thread of the binary
+       trace runs there */
+    tpl_trace_init();
+#endif
+
     tpl_proc_id proc_id;
 
-    /* create the context of each tpl_proc */
+    /* create the context of each tpl_proc, idle tasks included */
     for(    proc_id = 0;
-            proc_id < TASK_COUNT+ISR_COUNT+1;
+            proc_id < TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES;
             proc_id++)
     {
         tpl_create_context(proc_id);
@@ -219,7 +288,11 @@ void tpl_init_machine(void)
     tpl_viper_init();
 
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
-    tpl_viper_start_auto_timer(signal_for_counters,10000);  /* 10 ms */
+#if TPL_OPTIMIZE_TICKS == YES
+    tpl_posix_tickless_init();
+#else
+    tpl_viper_start_auto_timer(signal_for_counters, TPL_POSIX_TICK_PERIOD_US);
+#endif
 #endif
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
@@ -227,3 +300,329 @@ void tpl_init_machine(void)
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 }
 
+#if NUMBER_OF_CORES > 1
+/*
+ * Multicore emulation. Each core is a POSIX thread pinned on a CPU of the
+ * host (core_id modulo the number of CPUs). The master core is the thread
+ * that calls main, the other ones are created by StartCore and call main
+ * too, as the slave cores of the ppc port do.
+ *
+ * The kernel lock is a spinlock owned by a core. It is taken by the
+ * services declared with LOCK_KERNEL = TRUE (see tpl_os_call_service),
+ * by the signal handler and released when the core leaves the kernel.
+ * Intercore interrupts are TPL_POSIX_INTERCORE_SIGNAL signals sent to the
+ * thread of the core with pthread_kill.
+ */
+#define TPL_POSIX_NO_OWNER 0xFFFF
+
+STATIC _Thread_local uint16 tpl_posix_core_id = OS_CORE_ID_MASTER;
+STATIC pthread_t tpl_posix_core_thread[NUMBER_OF_CORES];
+STATIC _Atomic uint16 tpl_posix_kernel_owner = TPL_POSIX_NO_OWNER;
+
+typedef _Atomic tpl_lock tpl_atomic_lock;
+#define TPL_ATOMIC_LOCK(lock) ((volatile tpl_atomic_lock *)(lock))
+
+typedef _Atomic uint16 tpl_atomic_uint16;
+#define TPL_ATOMIC_UINT16(value) ((volatile tpl_atomic_uint16 *)(value))
+
+#if defined(__i386__) || defined(__x86_64__)
+#define tpl_posix_cpu_relax() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define tpl_posix_cpu_relax() __asm__ __volatile__("yield")
+#else
+#define tpl_posix_cpu_relax()
+#endif
+
+extern int main(void);
+
+/*
+ * tpl_posix_core_main is the entry point of the thread of a slave core
+ */
+STATIC void *tpl_posix_core_main(void *arg)
+{
+    tpl_posix_core_id = (uint16)(uintptr_t)arg;
+    (void)main();
+    return NULL;
+}
+
+FUNC(uint16, OS_CODE) tpl_get_core_id(void)
+{
+    return tpl_posix_core_id;
+}
+
+/*
+ * tpl_init_core pins the thread of the calling core on its CPU and
+ * records it so that the other cores can interrupt it.
+ */
+FUNC(void, OS_CODE) tpl_init_core(void)
+{
+    GET_CURRENT_CORE_ID(core_id)
+    cpu_set_t cpus;
+    long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    tpl_posix_core_thread[core_id] = pthread_self();
+
+    if (cpu_count > 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(core_id % cpu_count, &cpus);
+        if (0 != pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus))
+        {
+            fprintf(stderr, "tpl_init_core: cannot pin core %d\n", core_id);
+        }
+    }
+}
+
+/**
+ * @internal
+ *
+ * This function starts the processing core given in the argument.
+ * The thread is created with all signals blocked, they are unblocked
+ * when the core starts its first task.
+ */
+FUNC(void, OS_CODE) tpl_start_core(
+  CONST(CoreIdType, AUTOMATIC) core_id)
+{
+    pthread_t thread;
+    sigset_t all_signals;
+    sigset_t saved_mask;
+
+    /* the trampoline process is forked from the virtual platform process
+       by tpl_init_machine. A fork only keeps the calling thread, so it
+       has to be done before the thread of the first slave core exists.
+       tpl_init_machine does not fork again. */
+    tpl_posixvp_irq_gen_init();
+
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_SETMASK, &all_signals, &saved_mask);
+    if (0 != pthread_create(&thread, NULL, tpl_posix_core_main,
+                            (void *)(uintptr_t)core_id))
+    {
+        perror("tpl_start_core failed");
+        exit(-1);
+    }
+    pthread_sigmask(SIG_SETMASK, &saved_mask, NULL);
+    pthread_detach(thread);
+}
+
+/**
+ * @internal
+ *
+ * This function sends an interrupt to the other core to force a context switch
+ */
+FUNC(void, OS_CODE) tpl_send_intercore_it(
+  CONST(CoreIdType, AUTOMATIC) to_core_id)
+{
+    union sigval value;
+
+    value.sival_int = 0;
+    tpl_posix_signal_core(to_core_id, TPL_POSIX_INTERCORE_SIGNAL, value);
+}
+
+/*
+ * tpl_posix_signal_core sends a signal with its value to the thread of
+ * a core
+ */
+void tpl_posix_signal_core(uint16 core_id, int sig, union sigval value)
+{
+    pthread_sigqueue(tpl_posix_core_thread[core_id], sig, value);
+}
+
+/**
+ * @internal
+ *
+ * tpl_get_lock is a test and test-and-set spinlock
+ */
+FUNC(void, OS_CODE) tpl_get_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock)
+{
+    while (UNLOCKED_LOCK != atomic_exchange_explicit(TPL_ATOMIC_LOCK(lock),
+                                                     LOCKED_LOCK,
+                                                     memory_order_acquire))
+    {
+        while (UNLOCKED_LOCK != atomic_load_explicit(TPL_ATOMIC_LOCK(lock),
+                                                     memory_order_relaxed))
+        {
+            tpl_posix_cpu_relax();
+        }
+    }
+}
+
+/**
+ * @internal
+ *
+ * tpl_release_lock releases a lock got by tpl_get_lock
+ */
+FUNC(void, OS_CODE) tpl_release_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock)
+{
+    atomic_store_explicit(TPL_ATOMIC_LOCK(lock), UNLOCKED_LOCK,
+                          memory_order_release);
+}
+
+/**
+ * @internal
+ *
+ * tpl_try_to_get_lock takes the lock if it is free and does not wait
+ * otherwise
+ */
+FUNC(void, OS_CODE) tpl_try_to_get_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
+  P2VAR(tpl_try_to_get_spinlock_type, AUTOMATIC, OS_VAR) success)
+{
+    if ((UNLOCKED_LOCK == atomic_load_explicit(TPL_ATOMIC_LOCK(lock),
+                                               memory_order_relaxed)) &&
+        (UNLOCKED_LOCK == atomic_exchange_explicit(TPL_ATOMIC_LOCK(lock),
+                                                   LOCKED_LOCK,
+                                                   memory_order_acquire)))
+    {
+        *success = TRYTOGETSPINLOCK_SUCCESS;
+    }
+    else
+    {
+        *success = TRYTOGETSPINLOCK_NOSUCCESS;
+    }
+}
+
+/**
+ * @internal
+ *
+ * tpl_fetch_and_add atomically adds increment to *counter
+ */
+FUNC(uint16, OS_CODE) tpl_fetch_and_add(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) counter,
+  CONST(uint16, AUTOMATIC)              increment)
+{
+    return atomic_fetch_add_explicit(TPL_ATOMIC_UINT16(counter), increment,
+                                     memory_order_acq_rel);
+}
+
+/**
+ * @internal
+ *
+ * tpl_atomic_load reads *value with an acquire semantic
+ */
+FUNC(uint16, OS_CODE) tpl_atomic_load(
+  CONSTP2CONST(uint16, AUTOMATIC, OS_VAR) value)
+{
+    return atomic_load_explicit(TPL_ATOMIC_UINT16(value),
+                                memory_order_acquire);
+}
+
+/**
+ * @internal
+ *
+ * tpl_atomic_exchange writes new_value in *value and returns the
+ * previous value
+ */
+FUNC(uint16, OS_CODE) tpl_atomic_exchange(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              new_value)
+{
+    return atomic_exchange_explicit(TPL_ATOMIC_UINT16(value), new_value,
+                                    memory_order_acq_rel);
+}
+
+/**
+ * @internal
+ *
+ * tpl_compare_and_swap writes new_value in *value if it is equal to
+ * expected
+ */
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              expected,
+  CONST(uint16, AUTOMATIC)              new_value)
+{
+    uint16 current = expected;
+
+    return atomic_compare_exchange_strong_explicit(
+        TPL_ATOMIC_UINT16(value), &current, new_value,
+        memory_order_acq_rel, memory_order_acquire) ? TRUE : FALSE;
+}
+
+/**
+ * @internal
+ *
+ * tpl_cpu_relax executes the spin wait hint of the host
+ */
+FUNC(void, OS_CODE) tpl_cpu_relax(void)
+{
+    tpl_posix_cpu_relax();
+}
+
+/*
+ * tpl_get_kernel_lock takes the kernel lock for the calling core. It
+ * does nothing if the core already owns it. The interrupts of the core
+ * have to be masked.
+ */
+void tpl_get_kernel_lock(void)
+{
+    GET_CURRENT_CORE_ID(core_id)
+    uint16 expected;
+
+    if (core_id != atomic_load_explicit(&tpl_posix_kernel_owner,
+                                        memory_order_relaxed))
+    {
+        do
+        {
+            while (TPL_POSIX_NO_OWNER !=
+                   atomic_load_explicit(&tpl_posix_kernel_owner,
+                                        memory_order_relaxed))
+            {
+                tpl_posix_cpu_relax();
+            }
+            expected = TPL_POSIX_NO_OWNER;
+        } while (!atomic_compare_exchange_weak_explicit(
+                     &tpl_posix_kernel_owner, &expected, core_id,
+                     memory_order_acquire, memory_order_relaxed));
+    }
+}
+
+/*
+ * tpl_release_kernel_lock releases the kernel lock if the calling core
+ * owns it.
+ */
+void tpl_release_kernel_lock(void)
+{
+    GET_CURRENT_CORE_ID(core_id)
+
+    if (core_id == atomic_load_explicit(&tpl_posix_kernel_owner,
+                                        memory_order_relaxed))
+    {
+        atomic_store_explicit(&tpl_posix_kernel_owner, TPL_POSIX_NO_OWNER,
+                              memory_order_release);
+    }
+}
+
+tpl_bool tpl_posix_lock_kernel(void)
+{
+    GET_CURRENT_CORE_ID(core_id)
+    tpl_bool locked = FALSE;
+
+    if (core_id != atomic_load_explicit(&tpl_posix_kernel_owner,
+                                        memory_order_relaxed))
+    {
+        tpl_posix_sigblock("tpl_posix_lock_kernel failed");
+        tpl_get_kernel_lock();
+        locked = TRUE;
+    }
+
+    return locked;
+}
+
+void tpl_posix_unlock_kernel(tpl_bool locked)
+{
+    GET_CURRENT_CORE_ID(core_id)
+
+    if (locked)
+    {
+        tpl_release_kernel_lock();
+        if ((0 == GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id)) &&
+            (FALSE == GET_LOCK_CNT_FOR_CORE(tpl_user_task_lock, core_id)))
+        {
+            tpl_posix_sigunblock("tpl_posix_unlock_kernel failed");
+        }
+    }
+}
+#endif /* NUMBER_OF_CORES > 1 */
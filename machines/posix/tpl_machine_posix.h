@@ -12,10 +12,67 @@
 
 #include "tpl_os_internal_types.h"
 
+/*
+ * Period of the timer driving the counters, in microseconds
+ */
+#define TPL_POSIX_TICK_PERIOD_US 10000
+
+#if NUMBER_OF_CORES > 1
+/*
+ * Signal sent with pthread_sigqueue to the thread of a core to make it
+ * switch its context (intercore interrupt)
+ */
+#define TPL_POSIX_INTERCORE_SIGNAL SIGRTMIN
+#endif
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 void tpl_osek_func_stub( tpl_proc_id task_id );
 void tpl_shutdown(void);
+#if TPL_OPTIMIZE_TICKS == YES
+/*
+ * Tickless mode: tpl_posix_elapsed_ticks returns the number of ticks
+ * elapsed since the date of the last tick taken into account by the
+ * counters, tpl_posix_consume_ticks moves this date forward and
+ * tpl_posix_set_next_tick programs the timer signal ticks ticks after it
+ * ((tpl_tick)-1 disarms the timer).
+ */
+void tpl_posix_tickless_init(void);
+tpl_tick tpl_posix_elapsed_ticks(void);
+void tpl_posix_consume_ticks(tpl_tick ticks);
+void tpl_posix_set_next_tick(tpl_tick ticks);
+#endif
+#if NUMBER_OF_CORES > 1
+/*
+ * Kernel lock of the multicore target. tpl_posix_lock_kernel is called
+ * before the services declared with LOCK_KERNEL = TRUE, it masks the
+ * interrupts of the core and takes the kernel lock.
+ * tpl_posix_unlock_kernel is called after the service and releases the
+ * kernel lock if it is still owned by the core and the service has not
+ * released it already. The lock is also released when the core leaves
+ * the kernel (see tpl_release_task_lock).
+ */
+tpl_bool tpl_posix_lock_kernel(void);
+void tpl_posix_unlock_kernel(tpl_bool locked);
+void tpl_get_kernel_lock(void);
+void tpl_release_kernel_lock(void);
+void tpl_posix_signal_core(uint16 core_id, int sig, union sigval value);
+#endif
+#if WITH_TRACE == YES
+/*
+ * tpl_trace_init prepares the trace backend when the machine starts, out
+ * of the kernel and of any signal handler.
+ */
+void tpl_trace_init(void);
+#endif
+#if ISR_COUNT > 0
+/*
+ * tpl_posix_isr_value returns the value sent with the signal that
+ * triggered the ISR2 isr_id (with sigqueue for instance). It may be called
+ * by the ISR2 to get data of the emulated interrupt.
+ */
+union sigval tpl_posix_isr_value(tpl_isr_id isr_id);
+#endif
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
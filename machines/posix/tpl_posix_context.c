@@ -28,6 +28,7 @@
 #define _XOPEN_SOURCE 501
 #include <setjmp.h>
 #include <signal.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -36,6 +37,165 @@
 #include "tpl_os_kernel.h"
 #include "tpl_os_types.h"
 #include "tpl_machine_posix.h"
+#include "tpl_posix_internal.h"
+
+#if WITH_POSIX_FAST_CONTEXT == YES
+/*
+ * Fast context switch.
+ *
+ * tpl_posix_swap_context pushes the callee saved registers on the current
+ * stack, stores the stack pointer in *old_sp, loads new_sp and pops the
+ * registers of the new context. It is called like a function so the
+ * caller saved registers are already saved by the compiler, and it does
+ * not touch the signal mask: no system call is done.
+ *
+ * A new context is a stack whose top is a frame as the one pushed by
+ * tpl_posix_swap_context, with tpl_posix_context_entry as return address.
+ */
+#if defined(__APPLE__)
+#define TPL_POSIX_ASM_SYMBOL(name) "_" #name
+#define TPL_POSIX_ASM_BEGIN        ".text\n"
+#define TPL_POSIX_ASM_END          ""
+#else
+#define TPL_POSIX_ASM_SYMBOL(name) #name
+#define TPL_POSIX_ASM_BEGIN        ".pushsection .text\n"
+#define TPL_POSIX_ASM_END          ".popsection\n"
+#endif
+
+#if defined(__x86_64__)
+/*
+ * frame (from the stack pointer): mxcsr and x87 control word, r15, r14,
+ * r13, r12, rbx, rbp, return address
+ */
+#define TPL_POSIX_FRAME_WORDS   8
+#define TPL_POSIX_FRAME_ENTRY   7
+
+__asm__(
+    TPL_POSIX_ASM_BEGIN
+    ".globl " TPL_POSIX_ASM_SYMBOL(tpl_posix_swap_context) "\n"
+    TPL_POSIX_ASM_SYMBOL(tpl_posix_swap_context) ":\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq  $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq  %rsp, (%rdi)\n"
+    "    movq  %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq  $8, %rsp\n"
+    "    popq  %r15\n"
+    "    popq  %r14\n"
+    "    popq  %r13\n"
+    "    popq  %r12\n"
+    "    popq  %rbx\n"
+    "    popq  %rbp\n"
+    "    ret\n"
+    TPL_POSIX_ASM_END
+);
+#elif defined(__aarch64__)
+/*
+ * frame (from the stack pointer): x19 to x28, x29 (fp), x30 (lr),
+ * d8 to d15
+ */
+#define TPL_POSIX_FRAME_WORDS   20
+#define TPL_POSIX_FRAME_ENTRY   11
+
+__asm__(
+    TPL_POSIX_ASM_BEGIN
+    ".globl " TPL_POSIX_ASM_SYMBOL(tpl_posix_swap_context) "\n"
+    ".p2align 2\n"
+    TPL_POSIX_ASM_SYMBOL(tpl_posix_swap_context) ":\n"
+    "    sub   sp, sp, #160\n"
+    "    stp   x19, x20, [sp, #0]\n"
+    "    stp   x21, x22, [sp, #16]\n"
+    "    stp   x23, x24, [sp, #32]\n"
+    "    stp   x25, x26, [sp, #48]\n"
+    "    stp   x27, x28, [sp, #64]\n"
+    "    stp   x29, x30, [sp, #80]\n"
+    "    stp   d8,  d9,  [sp, #96]\n"
+    "    stp   d10, d11, [sp, #112]\n"
+    "    stp   d12, d13, [sp, #128]\n"
+    "    stp   d14, d15, [sp, #144]\n"
+    "    mov   x9, sp\n"
+    "    str   x9, [x0]\n"
+    "    mov   sp, x1\n"
+    "    ldp   x19, x20, [sp, #0]\n"
+    "    ldp   x21, x22, [sp, #16]\n"
+    "    ldp   x23, x24, [sp, #32]\n"
+    "    ldp   x25, x26, [sp, #48]\n"
+    "    ldp   x27, x28, [sp, #64]\n"
+    "    ldp   x29, x30, [sp, #80]\n"
+    "    ldp   d8,  d9,  [sp, #96]\n"
+    "    ldp   d10, d11, [sp, #112]\n"
+    "    ldp   d12, d13, [sp, #128]\n"
+    "    ldp   d14, d15, [sp, #144]\n"
+    "    add   sp, sp, #160\n"
+    "    ret\n"
+    TPL_POSIX_ASM_END
+);
+#else
+#error "FASTCONTEXTSWITCH is only supported on x86_64 and aarch64 hosts"
+#endif
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+/*
+ * First function executed by a context. The task or ISR that owns it is
+ * the running one.
+ */
+STATIC FUNC(void, OS_CODE) tpl_posix_context_entry(void)
+{
+    GET_CURRENT_CORE_ID(core_id)
+    tpl_osek_func_stub(TPL_KERN(core_id).running_id);
+
+    /* We should not be there. Let's crash*/
+    abort();
+}
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+FUNC(void, OS_CODE) tpl_posix_build_context(
+        CONST(tpl_proc_id, OS_APPL_DATA) proc_id)
+{
+    CONSTP2CONST(struct TPL_STACK, AUTOMATIC, OS_APPL_DATA) stack =
+        tpl_stat_proc_table[proc_id]->stack;
+    /* the top of the stack is aligned on 16 bytes, as the ABI requires */
+    uintptr_t *frame = (uintptr_t *)
+        (((uintptr_t)stack->stack_zone + stack->stack_size) & ~(uintptr_t)15);
+
+#if defined(__x86_64__)
+    /*
+     * null return address of tpl_posix_context_entry. The stack pointer
+     * is 8 modulo 16 when it starts, as if it was called.
+     */
+    frame -= 1;
+    frame[0] = 0;
+#endif
+    frame -= TPL_POSIX_FRAME_WORDS;
+    memset(frame, 0, TPL_POSIX_FRAME_WORDS * sizeof(uintptr_t));
+#if defined(__x86_64__)
+    /* default mxcsr and x87 control word */
+    frame[0] = ((uintptr_t)0x037F << 32) | 0x1F80;
+#endif
+    frame[TPL_POSIX_FRAME_ENTRY] = (uintptr_t)tpl_posix_context_entry;
+
+    tpl_stat_proc_table[proc_id]->context->current = frame;
+}
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+FUNC(void, OS_CODE) tpl_create_context(
+        CONST(tpl_proc_id, OS_APPL_DATA) proc_id)
+{
+    tpl_posix_build_context(proc_id);
+}
+
+#else /* WITH_POSIX_FAST_CONTEXT */
 
 /**
  * global variables used to store the "old" context
@@ -45,6 +205,16 @@ VAR(sigset_t,OS_VAR)        saved_mask;
 VAR(sig_atomic_t,OS_VAR)    handler_has_been_triggered;
 VAR(tpl_proc_id,OS_VAR)     new_proc_id;
 
+/*
+ * The contexts are created by the master core. The context of its idle
+ * task is used to jump back to tpl_create_context.
+ */
+#if NUMBER_OF_CORES > 1
+#define TPL_CREATOR_ID IDLE_TASK_0_ID
+#else
+#define TPL_CREATOR_ID IDLE_TASK_ID
+#endif
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 FUNC(void, OS_CODE) tpl_create_context_boot(void)
@@ -64,11 +234,14 @@ FUNC(void, OS_CODE) tpl_create_context_boot(void)
     /* 12 & 13 : context is ready, jump back to the tpl_create_context */
     if( 0 == setjmp(tpl_stat_proc_table[context_owner_proc_id]->context->initial) )
     {
-        longjmp(tpl_stat_proc_table[IDLE_TASK_ID]->context->current, 1);
+        longjmp(tpl_stat_proc_table[TPL_CREATOR_ID]->context->current, 1);
     }
 
     /* We are back for the first dispatch. Let's go */
-    tpl_osek_func_stub(tpl_kern.running_id);
+    {
+        GET_CURRENT_CORE_ID(core_id)
+        tpl_osek_func_stub(TPL_KERN(core_id).running_id);
+    }
 
     /* We should not be there. Let's crash*/
     abort();
@@ -163,7 +336,7 @@ FUNC(void, OS_CODE) tpl_create_context(
      * 7 & 8 : we jump back to the created context.
      * This time, we are no more in signal handling mode
      */
-    if ( 0 == setjmp(tpl_stat_proc_table[IDLE_TASK_ID]->context->current) )
+    if ( 0 == setjmp(tpl_stat_proc_table[TPL_CREATOR_ID]->context->current) )
         longjmp(tpl_stat_proc_table[new_proc_id]->context->initial,1);
 
     /*
@@ -172,3 +345,4 @@ FUNC(void, OS_CODE) tpl_create_context(
     return;
 }
 
+#endif /* WITH_POSIX_FAST_CONTEXT */
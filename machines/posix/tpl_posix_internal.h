@@ -38,6 +38,10 @@ void tpl_start_tptimer ();
 #endif
 
 void tpl_create_context(tpl_proc_id proc_id);
+#if WITH_POSIX_FAST_CONTEXT == YES
+void tpl_posix_build_context(tpl_proc_id proc_id);
+void tpl_posix_swap_context(void **old_sp, void *new_sp);
+#endif
 
 void tpl_posix_sigblock(const char* error_message);
 void tpl_posix_sigunblock(const char* error_message);
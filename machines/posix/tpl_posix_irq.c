@@ -33,7 +33,9 @@
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
+#include <time.h>
 
 #include "tpl_app_config.h"
 #include "tpl_machine_posix.h"
@@ -48,7 +50,19 @@
  * IRQs.
  */
 #if ISR_COUNT > 0
-extern int signal_for_isr_id[ISR_COUNT];
+extern VAR(int, OS_VAR) signal_for_isr_id[ISR_COUNT];
+extern FUNC(void, OS_CODE) tpl_posix_init_isr_signals(void);
+
+/*
+ * ISR2 triggered by each signal: index of the ISR2 + 1, 0 when the signal
+ * is not the source of an ISR2. Filled by tpl_posix_siginit.
+ */
+STATIC VAR(uint16, OS_VAR) tpl_posix_isr_for_signal[TPL_POSIX_SIGNAL_COUNT];
+
+/*
+ * Value of the last signal received for each ISR2
+ */
+STATIC union sigval tpl_posix_isr_signal_value[ISR_COUNT];
 #endif
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
 const int signal_for_watchdog = SIGALRM;
@@ -57,9 +71,17 @@ const int signal_for_watchdog = SIGALRM;
 const int signal_for_counters = SIGUSR2;
 #endif
 
-extern volatile int tpl_locking_depth;
-extern char tpl_user_task_lock;
-extern char tpl_cpt_os_task_lock;
+#if NUMBER_OF_CORES > 1
+#include "tpl_os_definitions.h"
+#include "tpl_os_kernel.h"          /* LOCAL_SWITCH_CONTEXT */
+#include "tpl_machine_interface.h"  /* tpl_switch_context */
+
+extern volatile VAR(uint32, OS_VAR) tpl_locking_depth[NUMBER_OF_CORES];
+extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock[NUMBER_OF_CORES];
+#else
+extern volatile VAR(uint32, OS_VAR) tpl_locking_depth;
+extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock;
+#endif
 
 /*
  * The signal set corresponding to enabled interrupts
@@ -72,6 +94,102 @@ sigset_t signal_set;
  */
 extern void tpl_call_counter_tick(void);
 
+#if (TPL_OPTIMIZE_TICKS == YES) &&                                             \
+    (((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0))
+#if defined(__APPLE__)
+#error "The tickless mode (OPTIMIZETICKS) needs POSIX timers, not available on darwin"
+#endif
+
+/*
+ * In tickless mode, the counters are not driven by the periodic timer of
+ * viper but by a one shot POSIX timer programmed at the date of the next
+ * time object expiry. tpl_counter_date is the date of the last tick taken
+ * into account by the counters. The ticks elapsed since are added to the
+ * counters in one step when the timer signal is handled or when a service
+ * needs the current date of the counters.
+ */
+static timer_t tpl_counter_timer;
+static struct timespec tpl_counter_date;
+static int tpl_counter_timer_started = 0;
+
+#define TPL_POSIX_TICK_PERIOD_NS ((long long)TPL_POSIX_TICK_PERIOD_US * 1000)
+
+/*
+ * tpl_posix_date_after returns the date which is ticks ticks after
+ * tpl_counter_date
+ */
+static struct timespec tpl_posix_date_after(tpl_tick ticks)
+{
+  struct timespec date = tpl_counter_date;
+  long long ns = (long long)ticks * TPL_POSIX_TICK_PERIOD_NS + date.tv_nsec;
+
+  date.tv_sec += (time_t)(ns / 1000000000LL);
+  date.tv_nsec = (long)(ns % 1000000000LL);
+
+  return date;
+}
+
+void tpl_posix_tickless_init(void)
+{
+  struct sigevent event;
+
+  memset(&event, 0, sizeof(event));
+  event.sigev_notify = SIGEV_SIGNAL;
+  event.sigev_signo = signal_for_counters;
+  if (timer_create(CLOCK_MONOTONIC, &event, &tpl_counter_timer) == -1)
+  {
+    perror("tpl_posix_tickless_init failed");
+    exit(-1);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &tpl_counter_date);
+
+  /*
+   * The first tick is programmed now. The timer is programmed at the
+   * next expiry date from the first tick only, when the time objects
+   * started by StartOS are all in the queues.
+   */
+  tpl_counter_timer_started = 1;
+  tpl_posix_set_next_tick(1);
+  tpl_counter_timer_started = 0;
+}
+
+tpl_tick tpl_posix_elapsed_ticks(void)
+{
+  struct timespec now;
+  long long ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  ns = (long long)(now.tv_sec - tpl_counter_date.tv_sec) * 1000000000LL +
+       (now.tv_nsec - tpl_counter_date.tv_nsec);
+
+  return (ns > 0) ? (tpl_tick)(ns / TPL_POSIX_TICK_PERIOD_NS) : 0;
+}
+
+void tpl_posix_consume_ticks(tpl_tick ticks)
+{
+  tpl_counter_date = tpl_posix_date_after(ticks);
+}
+
+void tpl_posix_set_next_tick(tpl_tick ticks)
+{
+  struct itimerspec timer_spec;
+
+  memset(&timer_spec, 0, sizeof(timer_spec));
+  if (ticks != (tpl_tick)-1)
+  {
+    timer_spec.it_value = tpl_posix_date_after(ticks);
+  }
+  /* else it_value is 0 and the timer is disarmed */
+
+  if (tpl_counter_timer_started &&
+      (timer_settime(tpl_counter_timer, TIMER_ABSTIME, &timer_spec, NULL) == -1))
+  {
+    perror("tpl_posix_set_next_tick failed");
+    exit(-1);
+  }
+}
+#endif /* TPL_OPTIMIZE_TICKS */
+
 /**
  * Enable all interrupts
  */
@@ -114,70 +232,106 @@ void tpl_disable_os_interrupts(void)
   tpl_disable_interrupts();
 }
 
+#if ISR_COUNT > 0
+union sigval tpl_posix_isr_value(tpl_isr_id isr_id)
+{
+  return tpl_posix_isr_signal_value[isr_id - TASK_COUNT];
+}
+#endif
+
 /*
- * The signal handler used when interrupts are enabled
+ * The signal handler used when interrupts are enabled.
+ * The counters, watchdog and intercore signals are checked first, then the
+ * ISR2 of the signal, if any, is found with tpl_posix_isr_for_signal.
  */
-void tpl_signal_handler(int sig)
+void tpl_signal_handler(int sig, siginfo_t *info, void *context)
 {
+  GET_CURRENT_CORE_ID(core_id)
 
 #if ISR_COUNT > 0
-  unsigned int id;
-  unsigned char found;
+  uint16 isr;
+#endif
+
+  (void)context;
+#if ISR_COUNT == 0
+  (void)info;
 #endif
 
-  tpl_locking_depth++;
-  tpl_cpt_os_task_lock++;
+  GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id)++;
+  GET_LOCK_CNT_FOR_CORE(tpl_cpt_os_task_lock, core_id)++;
 
+#if NUMBER_OF_CORES > 1
+  tpl_get_kernel_lock();
+#endif
+
+#if ISR_COUNT > 0
+  isr = (sig < TPL_POSIX_SIGNAL_COUNT) ? tpl_posix_isr_for_signal[sig] : 0;
+#endif
+
+#if NUMBER_OF_CORES > 1
+  if (TPL_POSIX_INTERCORE_SIGNAL == sig)
+  {
+    /* the scheduling has been done by the core that sent the signal */
+    LOCAL_SWITCH_CONTEXT(core_id)
+  }
+  else
+#endif
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
   if (signal_for_counters == sig)
   {
+#if TPL_OPTIMIZE_TICKS == YES
+    /* from now on, the timer is programmed at the next expiry date */
+    tpl_counter_timer_started = 1;
+#endif
     tpl_call_counter_tick();
   }
   else
-  {
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
-    if (signal_for_watchdog == sig)
+  if (signal_for_watchdog == sig)
+  {
+    /* This function is defined in autosar/tpl_as_timing_protec.c */
+    tpl_watchdog_expiration();
+  }
+  else
+#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
+#if ISR_COUNT > 0
+  if (0 != isr)
+  {
+    isr--;
+#if NUMBER_OF_CORES > 1
+    GET_PROC_CORE_ID(isr + TASK_COUNT, isr_core_id)
+    if (isr_core_id != core_id)
     {
-      /* This function is defined in autosar/tpl_as_timing_protec.c */
-      tpl_watchdog_expiration();
+      /* the ISR runs on another core, forward the signal to it */
+      tpl_posix_signal_core(isr_core_id, sig, info->si_value);
     }
     else
+#endif
     {
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-#if ISR_COUNT > 0
-      id = 0;
-      found = (sig == signal_for_isr_id[id]);
-      while ((id < ISR_COUNT) && !found)
-      {
-        id++;
-        if (id < ISR_COUNT)
-        {
-          found = (sig == signal_for_isr_id[id]);
-        }
-      } /* while((id < ISR_COUNT) && !found) */
-
-      if (found)
-      {
-        tpl_central_interrupt_handler(id + TASK_COUNT);
-      }
-      else
-      {
-        /* Unknown interrupt request ! */
-        printf("No ISR is registered for signal %d\n", sig);
-        printf("Cowardly exiting!\n");
-        tpl_shutdown();
-      }
-#endif /* ISR_COUNT > 0 */
-#if WITH_AUTOSAR_TIMING_PROTECTION == YES
+      tpl_posix_isr_signal_value[isr] = info->si_value;
+      tpl_central_interrupt_handler(isr + TASK_COUNT);
     }
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
   }
-#endif /* (defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+  else
+#endif /* ISR_COUNT > 0 */
+  {
+    /* Unknown interrupt request ! */
+    printf("No ISR is registered for signal %d\n", sig);
+    printf("Cowardly exiting!\n");
+    tpl_shutdown();
+  }
+
+  GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id)--;
+  GET_LOCK_CNT_FOR_CORE(tpl_cpt_os_task_lock, core_id)--;
 
-  tpl_locking_depth--;
-  tpl_cpt_os_task_lock--;
+#if NUMBER_OF_CORES > 1
+  /* the core leaves the kernel */
+  if (0 == GET_LOCK_CNT_FOR_CORE(tpl_locking_depth, core_id))
+  {
+    tpl_release_kernel_lock();
+  }
+#endif
 }
 
 /* Posix platform internal functions */
@@ -209,6 +363,17 @@ void tpl_posix_siginit(void)
 
   sigemptyset(&signal_set);
 
+#if ISR_COUNT > 0
+  tpl_posix_init_isr_signals();
+  for (id = 0; id < ISR_COUNT; id++)
+  {
+    if (signal_for_isr_id[id] < TPL_POSIX_SIGNAL_COUNT)
+    {
+      tpl_posix_isr_for_signal[signal_for_isr_id[id]] = (uint16)(id + 1);
+    }
+  }
+#endif
+
   /*
    * init a signal mask to block all signals (aka interrupts)
    */
@@ -224,13 +389,16 @@ void tpl_posix_siginit(void)
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
   sigaddset(&signal_set, signal_for_counters);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+#if NUMBER_OF_CORES > 1
+  sigaddset(&signal_set, TPL_POSIX_INTERCORE_SIGNAL);
+#endif
 
   /*
    * init the sa structure to install the handler
    */
-  sa.sa_handler = tpl_signal_handler;
+  sa.sa_sigaction = tpl_signal_handler;
   sa.sa_mask = signal_set;
-  sa.sa_flags = SA_RESTART;
+  sa.sa_flags = SA_RESTART | SA_SIGINFO;
   /*
    * Install the signal handler used to emulate interruptions
    */
@@ -246,4 +414,7 @@ void tpl_posix_siginit(void)
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
   sigaction(signal_for_counters, &sa, NULL);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+#if NUMBER_OF_CORES > 1
+  sigaction(TPL_POSIX_INTERCORE_SIGNAL, &sa, NULL);
+#endif
 }
@@ -113,6 +113,13 @@ void tpl_posixvp_irq_gen_init(void)
   struct sigaction prev_chld_act;
   struct sigaction prev_int_act;
 
+  // the trampoline process has already been created (multicore: by the
+  // first StartCore, before the threads of the cores)
+  if (tpl_pid == 0)
+  {
+    return;
+  }
+
   // set handler for SIGCHLD and SIGINT to quit the virtual platform
   memset(&set_quit_vp_act, 0, sizeof(set_quit_vp_act));
   set_quit_vp_act.sa_handler = set_quit_vp;
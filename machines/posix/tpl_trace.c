@@ -18,10 +18,10 @@
  * This software is distributed under the Lesser GNU Public Licence
  *
  */
-#define TRACE_FILENAME "trace.json"
+#define _XOPEN_SOURCE 700
 
 #define TRACE_FORMAT_JSON 1
-#define TRACE_FORMAT_BIN 2
+#define TRACE_FORMAT_BINARY 2
 
 #include "tpl_app_define.h" /* WITH_TRACE */
 
@@ -30,11 +30,108 @@
 #include <stdlib.h> /* exit */
 
 #include "tpl_trace.h"
+#include "tpl_machine_posix.h" /* tpl_trace_init */
+
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+#include "tpl_machine_interface.h" /* tpl_get_core_id */
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TRACE_FILENAME "trace.bin"
+
+/*
+ * Number of records of the ring buffer of a core, between the kernel and
+ * the flusher thread. Must be a power of 2.
+ */
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE 8192
+#endif
+
+/*
+ * The trace file is grown by this number of records each time it is full.
+ */
+#ifndef TRACE_FILE_CHUNK
+#define TRACE_FILE_CHUNK 65536
+#endif
+
+/*
+ * Period of the flusher thread, in ns.
+ */
+#define TRACE_FLUSH_PERIOD 1000000
+
+#define TRACE_BIN_MAGIC "TPLTRACE"
+#define TRACE_BIN_VERSION 1
+
+/*
+ * A binary trace record. The layout has no padding and must be kept in sync
+ * with the decoder in extra/trace-tools/TraceReader.py.
+ * type and kind are the ids and sub types defined in tpl_trace.h.
+ */
+typedef struct
+{
+  uint32 ts;    /**< timestamp (date of the system counter)          */
+  uint8 type;   /**< PROC_TYPE, RES_TYPE, ...                         */
+  uint8 kind;   /**< EVENT_SET_KIND, TIMEOBJ_EXPIRE_KIND, ...         */
+  uint16 id;    /**< proc, resource, time object, message or ioc id   */
+  uint32 value; /**< target state, event mask or lost records count   */
+} tpl_trace_record;
+
+/*
+ * Header of the trace file. record_count is updated by the flusher thread
+ * each time records are written to the file.
+ */
+typedef struct
+{
+  char magic[8];
+  uint16 version;
+  uint16 record_size;
+  uint32 record_count;
+} tpl_trace_file_header;
+
+/*
+ * Single producer / single consumer ring buffer. The producer is the kernel
+ * of a core (traces are done in kernel critical sections), the consumer is
+ * the flusher thread. head and tail are free running indexes. Each core
+ * has its own ring, so that the cores never push in the same one.
+ */
+typedef struct
+{
+  tpl_trace_record records[TRACE_RING_SIZE];
+  _Atomic uint32 head;
+  _Atomic uint32 tail;
+  /* records dropped because the ring buffer was full. Producer side only */
+  uint32 lost;
+} tpl_trace_ring;
+
+_Static_assert(sizeof(tpl_trace_record) == 12, "tpl_trace_record is not packed");
+_Static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0,
+               "TRACE_RING_SIZE is not a power of 2");
+#else
+#define TRACE_FILENAME "trace.json"
+#endif
 
 #define OS_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
 #include "tpl_memmap.h"
 
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+static tpl_trace_ring trace_rings[NUMBER_OF_CORES];
+
+static atomic_bool trace_flusher_stop = 0;
+static pthread_t trace_flusher;
+
+/* trace file and its mapping. Owned by the flusher thread once started */
+static int trace_fd = -1;
+static uint8 *trace_map = NULL;
+static uint32 trace_map_records = 0;
+#else
 FILE *trace_file = NULL;
+#endif
 
 #define OS_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -55,10 +152,132 @@ FUNC(tpl_tick, OS_CODE) tpl_trace_get_timestamp()
   return timestamp;
 }
 
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+/*
+ * (Re)map the trace file so that it can hold records records.
+ */
+static void tpl_trace_map_file(CONST(uint32, AUTOMATIC) records)
+{
+  const size_t size =
+      sizeof(tpl_trace_file_header) + records * sizeof(tpl_trace_record);
+
+  if (trace_map != NULL)
+  {
+    munmap(trace_map, sizeof(tpl_trace_file_header) +
+                          trace_map_records * sizeof(tpl_trace_record));
+  }
+  if (ftruncate(trace_fd, (off_t)size) != 0)
+  {
+    perror("[trace] unable to grow trace file");
+    exit(1);
+  }
+  trace_map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, trace_fd, 0);
+  if (trace_map == MAP_FAILED)
+  {
+    perror("[trace] unable to map trace file");
+    exit(1);
+  }
+  trace_map_records = records;
+}
+
+/*
+ * Append a record to the trace file. Called by the flusher thread only,
+ * or once it has been stopped.
+ */
+static void tpl_trace_file_append(
+    CONSTP2CONST(tpl_trace_record, AUTOMATIC, OS_VAR) record)
+{
+  tpl_trace_file_header *header = (tpl_trace_file_header *)trace_map;
+  const uint32 count = header->record_count;
+
+  if (count == trace_map_records)
+  {
+    tpl_trace_map_file(trace_map_records + TRACE_FILE_CHUNK);
+    header = (tpl_trace_file_header *)trace_map;
+  }
+  memcpy(trace_map + sizeof(tpl_trace_file_header) +
+             count * sizeof(tpl_trace_record),
+         record, sizeof(tpl_trace_record));
+  header->record_count = count + 1;
+}
+
+/*
+ * Move the records available in the ring buffers to the trace file. The
+ * rings are drained one after the other, so the records of different
+ * cores are ordered by their timestamps only.
+ */
+static void tpl_trace_drain(void)
+{
+  uint32 core;
+
+  for (core = 0; core < NUMBER_OF_CORES; core++)
+  {
+    tpl_trace_ring *ring = &trace_rings[core];
+    uint32 tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    const uint32 head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    while (tail != head)
+    {
+      tpl_trace_file_append(&ring->records[tail & (TRACE_RING_SIZE - 1)]);
+      tail++;
+    }
+    atomic_store_explicit(&ring->tail, tail, memory_order_release);
+  }
+}
+
+static void *tpl_trace_flusher(void *arg)
+{
+  const struct timespec period = {0, TRACE_FLUSH_PERIOD};
+
+  (void)arg;
+  while (!atomic_load_explicit(&trace_flusher_stop, memory_order_acquire))
+  {
+    tpl_trace_drain();
+    nanosleep(&period, NULL);
+  }
+  tpl_trace_drain();
+  return NULL;
+}
+#endif /* TRACE_FORMAT == TRACE_FORMAT_BINARY */
+
 /* return 1 when the file is opened (first time)*/
 FUNC(uint8, OS_CODE) tpl_trace_start()
 {
   uint8 first = 0;
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  if (trace_fd == -1)
+  {
+    tpl_trace_file_header *header;
+    sigset_t all_signals;
+    sigset_t previous_signals;
+
+    trace_fd = open(TRACE_FILENAME, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (trace_fd == -1)
+    {
+      perror("[trace] unable to open trace file");
+      exit(1);
+    }
+    tpl_trace_map_file(TRACE_FILE_CHUNK);
+    header = (tpl_trace_file_header *)trace_map;
+    memcpy(header->magic, TRACE_BIN_MAGIC, sizeof(header->magic));
+    header->version = TRACE_BIN_VERSION;
+    header->record_size = sizeof(tpl_trace_record);
+    header->record_count = 0;
+    /*
+     * The flusher thread is created with all the signals blocked, so that
+     * it never gets the signals used to emulate the interrupts.
+     */
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_SETMASK, &all_signals, &previous_signals);
+    if (pthread_create(&trace_flusher, NULL, tpl_trace_flusher, NULL) != 0)
+    {
+      perror("[trace] unable to create the flusher thread");
+      exit(1);
+    }
+    pthread_sigmask(SIG_SETMASK, &previous_signals, NULL);
+    first = 1;
+  }
+#else
   if (trace_file == NULL)
   {
     // first time run (open file in write mode)
@@ -73,9 +292,78 @@ FUNC(uint8, OS_CODE) tpl_trace_start()
     fprintf(trace_file, "[\n");
 #endif
   }
+#endif /* TRACE_FORMAT == TRACE_FORMAT_BINARY */
   return first;
 }
 
+/*
+ * Called by tpl_init_machine, out of the kernel and of any signal handler:
+ * the binary trace file is opened and the flusher thread is started there,
+ * since tpl_trace_push cannot do system calls. The json trace file is still
+ * opened by the first trace.
+ */
+void tpl_trace_init(void)
+{
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_start();
+#endif
+}
+
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+/*
+ * Push a record in the ring buffer of the calling core. This is the only
+ * thing done in the kernel critical section: no system call, no formatting.
+ * When the ring buffer is full, the record is dropped and an OVERFLOW record
+ * giving the number of dropped records is pushed as soon as there is room
+ * again.
+ */
+static void tpl_trace_push(CONST(uint8, AUTOMATIC) type,
+                           CONST(uint8, AUTOMATIC) kind,
+                           CONST(uint16, AUTOMATIC) id,
+                           CONST(uint32, AUTOMATIC) value)
+{
+#if NUMBER_OF_CORES > 1
+  tpl_trace_ring *ring = &trace_rings[tpl_get_core_id()];
+#else
+  tpl_trace_ring *ring = &trace_rings[0];
+#endif
+  uint32 head;
+  uint32 used;
+  tpl_trace_record *record;
+  const uint32 ts = (uint32)tpl_trace_get_timestamp();
+
+  head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  used = head - atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+  if ((ring->lost != 0) && (used < (TRACE_RING_SIZE - 1)))
+  {
+    record = &ring->records[head & (TRACE_RING_SIZE - 1)];
+    record->ts = ts;
+    record->type = OVERFLOW;
+    record->kind = 0;
+    record->id = 0;
+    record->value = ring->lost;
+    ring->lost = 0;
+    head++;
+    used++;
+  }
+  if (used < TRACE_RING_SIZE)
+  {
+    record = &ring->records[head & (TRACE_RING_SIZE - 1)];
+    record->ts = ts;
+    record->type = type;
+    record->kind = kind;
+    record->id = id;
+    record->value = value;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+  }
+  else
+  {
+    ring->lost++;
+  }
+}
+#endif /* TRACE_FORMAT == TRACE_FORMAT_BINARY */
+
 /**
  * Trace ends (close the file for instance). This event is sent by
  * ShutdownOS() system call
@@ -83,11 +371,49 @@ FUNC(uint8, OS_CODE) tpl_trace_start()
  */
 FUNC(void, OS_CODE) tpl_trace_close()
 {
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
-  fprintf(trace_file, "]\n");
-#endif
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  if (trace_fd != -1)
+  {
+    const tpl_trace_file_header *header;
+    uint32 core;
+
+    atomic_store_explicit(&trace_flusher_stop, 1, memory_order_release);
+    pthread_join(trace_flusher, NULL);
+    for (core = 0; core < NUMBER_OF_CORES; core++)
+    {
+      if (trace_rings[core].lost != 0)
+      {
+        tpl_trace_record record;
+        record.ts = (uint32)tpl_trace_get_timestamp();
+        record.type = OVERFLOW;
+        record.kind = 0;
+        record.id = 0;
+        record.value = trace_rings[core].lost;
+        tpl_trace_file_append(&record);
+        trace_rings[core].lost = 0;
+      }
+    }
+    /* cut the unused part of the last chunk */
+    header = (const tpl_trace_file_header *)trace_map;
+    if (ftruncate(trace_fd, (off_t)(sizeof(tpl_trace_file_header) +
+                                    header->record_count *
+                                        sizeof(tpl_trace_record))) != 0)
+    {
+      perror("[trace] unable to truncate trace file");
+    }
+    munmap(trace_map, sizeof(tpl_trace_file_header) +
+                          trace_map_records * sizeof(tpl_trace_record));
+    trace_map = NULL;
+    close(trace_fd);
+    trace_fd = -1;
+  }
+#else
   if (trace_file)
+  {
+    fprintf(trace_file, "]\n");
     fclose(trace_file);
+  }
+#endif
 }
 
 /**
@@ -99,9 +425,11 @@ FUNC(void, OS_CODE)
 tpl_trace_proc_change_state(CONST(tpl_proc_id, AUTOMATIC) proc_id,
                             CONST(tpl_proc_state, AUTOMATIC) target_state)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(PROC_TYPE, 0, proc_id, target_state);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -128,9 +456,11 @@ tpl_trace_res_change_state(CONST(tpl_resource_id, AUTOMATIC) res_id,
                            CONST(tpl_trace_resource_state, AUTOMATIC)
                                target_state)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(RES_TYPE, 0, res_id, target_state);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -156,9 +486,12 @@ tpl_trace_time_obj_change_state(CONST(tpl_timeobj_id, AUTOMATIC) timeobj_id,
                                 CONST(tpl_time_obj_state, AUTOMATIC)
                                     target_state)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(TIMEOBJ_TYPE, TIMEOBJ_CHANGE_STATE_KIND, timeobj_id,
+                 target_state);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -182,9 +515,11 @@ tpl_trace_time_obj_change_state(CONST(tpl_timeobj_id, AUTOMATIC) timeobj_id,
 FUNC(void, OS_CODE)
 tpl_trace_time_obj_expire(CONST(tpl_timeobj_id, AUTOMATIC) timeobj_id)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(TIMEOBJ_TYPE, TIMEOBJ_EXPIRE_KIND, timeobj_id, 0);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -209,9 +544,11 @@ FUNC(void, OS_CODE)
 tpl_trace_event_set(CONST(tpl_task_id, AUTOMATIC) task_target_id,
                     CONST(tpl_event_mask, AUTOMATIC) event)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(EVENT_TYPE, EVENT_SET_KIND, task_target_id, event);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -236,9 +573,11 @@ tpl_trace_event_set(CONST(tpl_task_id, AUTOMATIC) task_target_id,
 FUNC(void, OS_CODE)
 tpl_trace_event_reset(CONST(tpl_event_mask, AUTOMATIC) event)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(EVENT_TYPE, EVENT_RESET_KIND, 0, event);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -262,9 +601,11 @@ tpl_trace_event_reset(CONST(tpl_event_mask, AUTOMATIC) event)
 #if (WITH_IOC == YES)
 FUNC(void, OS_CODE) tpl_trace_ioc_send(VAR(tpl_ioc_id, AUTOMATIC) ioc_id)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(IOC_TYPE, IOC_SEND_KIND, ioc_id, 0);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -277,7 +618,7 @@ FUNC(void, OS_CODE) tpl_trace_ioc_send(VAR(tpl_ioc_id, AUTOMATIC) ioc_id)
           ts, ioc_id);
 #else
 #error "unsupported trace mode: TRACE_FORMAT"
-#endif /* TRACE_FORMAT == TRACE_FORMAT_JSON */
+#endif /* TRACE_FORMAT */
 }
 /**
  * trace the ioc:
@@ -286,9 +627,11 @@ FUNC(void, OS_CODE) tpl_trace_ioc_send(VAR(tpl_ioc_id, AUTOMATIC) ioc_id)
  */
 FUNC(void, OS_CODE) tpl_trace_ioc_receive(VAR(tpl_ioc_id, AUTOMATIC) ioc_id)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(IOC_TYPE, IOC_RECEIVE_KIND, ioc_id, 0);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -301,7 +644,7 @@ FUNC(void, OS_CODE) tpl_trace_ioc_receive(VAR(tpl_ioc_id, AUTOMATIC) ioc_id)
           ts, ioc_id);
 #else
 #error "unsupported trace mode: TRACE_FORMAT"
-#endif /* TRACE_FORMAT == TRACE_FORMAT_JSON */
+#endif /* TRACE_FORMAT */
 }
 #endif /*WITH_IOC == YES*/
 
@@ -316,9 +659,14 @@ FUNC(void, OS_CODE)
 tpl_trace_msg_send(CONST(tpl_message_id, AUTOMATIC) mess_id,
                    CONST(tpl_bool, AUTOMATIC) is_zero_message)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(MESSAGE_TYPE,
+                 (is_zero_message == SEND_ZERO_MESSAGE) ? SEND_ZERO_MESSAGE_KIND
+                                                        : SEND_NONZERO_MESSAGE_KIND,
+                 mess_id, 0);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   if (is_zero_message == SEND_ZERO_MESSAGE)
@@ -346,7 +694,7 @@ tpl_trace_msg_send(CONST(tpl_message_id, AUTOMATIC) mess_id,
 
 #else
 #error "unsupported trace mode: TRACE_FORMAT"
-#endif /* TRACE_FORMAT == TRACE_FORMAT_JSON */
+#endif /* TRACE_FORMAT */
 }
 /**
  * trace the message:
@@ -356,9 +704,11 @@ tpl_trace_msg_send(CONST(tpl_message_id, AUTOMATIC) mess_id,
 FUNC(void, OS_CODE)
 tpl_trace_msg_receive(VAR(tpl_message_id, AUTOMATIC) mess_id)
 {
+#if TRACE_FORMAT == TRACE_FORMAT_BINARY
+  tpl_trace_push(MESSAGE_TYPE, MESSAGE_RECEIVE_KIND, mess_id, 0);
+#elif TRACE_FORMAT == TRACE_FORMAT_JSON
   const uint8 first = tpl_trace_start();
   const tpl_tick ts = tpl_trace_get_timestamp();
-#if TRACE_FORMAT == TRACE_FORMAT_JSON
   if (!first)
     fprintf(trace_file, ",");
   fprintf(trace_file,
@@ -371,7 +721,7 @@ tpl_trace_msg_receive(VAR(tpl_message_id, AUTOMATIC) mess_id)
           ts, mess_id);
 #else
 #error "unsupported trace mode: TRACE_FORMAT"
-#endif /* TRACE_FORMAT == TRACE_FORMAT_JSON */
+#endif /* TRACE_FORMAT */
 }
 #endif /* WITH_TRACE == YES */
 
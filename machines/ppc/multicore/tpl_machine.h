@@ -164,6 +164,12 @@ extern FUNC(uint16, OS_CODE) tpl_get_core_id(void);
 
 #define tpl_restore_cpu_priority() tpl_ack_irq()
 
+/*
+ * Size of a line of the e200 caches. Data written by different cores, like
+ * the queue nodes of a MCS spinlock, are kept this far apart.
+ */
+#define TPL_CACHE_LINE_SIZE 32U
+
 #define OS_START_SEC_VAR_32BIT
 #include "tpl_memmap.h"
 
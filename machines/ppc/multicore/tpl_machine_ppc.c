@@ -352,6 +352,21 @@ FUNC(tpl_time, OS_CODE) tpl_get_local_current_date(void)
 
 #endif
 
+#if (WITH_STATISTICS == YES) || (WITH_SPINLOCK_STATISTICS == YES)
+/**
+ * tpl_get_stats_timer returns the current date of the core. The unit is
+ * the tick of the decrementer, so the durations shorter than a tick
+ * are 0.
+ *
+ * @return the current date
+ */
+FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_timer(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  return (tpl_stats_time)GET_CURRENT_DATE(core_id);
+}
+#endif /* WITH_STATISTICS || WITH_SPINLOCK_STATISTICS */
+
 #if WITH_MULTICORE == YES
 
 /**
@@ -466,6 +481,89 @@ FUNC(void, OS_CODE) tpl_try_to_get_lock(
 }
 
 
+/**
+ * @internal
+ *
+ * tpl_fetch_and_add adds increment to *counter. The hardware semaphore
+ * gate makes it atomic for both cores.
+ */
+FUNC(uint16, OS_CODE) tpl_fetch_and_add(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) counter,
+  CONST(uint16, AUTOMATIC)              increment)
+{
+  VAR(uint16, AUTOMATIC) value;
+
+  tpl_get_spin_lock(TPL_GATE_LOCK);
+  value = *(volatile uint16 *)counter;
+  *(volatile uint16 *)counter = (uint16)(value + increment);
+  tpl_release_spin_lock(TPL_GATE_LOCK);
+
+  return value;
+}
+
+/**
+ * @internal
+ *
+ * tpl_atomic_load reads *value without taking the gate
+ */
+FUNC(uint16, OS_CODE) tpl_atomic_load(
+  CONSTP2CONST(uint16, AUTOMATIC, OS_VAR) value)
+{
+  return *(volatile const uint16 *)value;
+}
+
+/**
+ * @internal
+ *
+ * tpl_atomic_exchange writes new_value in *value under the gate
+ */
+FUNC(uint16, OS_CODE) tpl_atomic_exchange(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              new_value)
+{
+  VAR(uint16, AUTOMATIC) old_value;
+
+  tpl_get_spin_lock(TPL_GATE_LOCK);
+  old_value = *(volatile uint16 *)value;
+  *(volatile uint16 *)value = new_value;
+  tpl_release_spin_lock(TPL_GATE_LOCK);
+
+  return old_value;
+}
+
+/**
+ * @internal
+ *
+ * tpl_compare_and_swap writes new_value in *value under the gate if
+ * *value is equal to expected
+ */
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              expected,
+  CONST(uint16, AUTOMATIC)              new_value)
+{
+  VAR(tpl_bool, AUTOMATIC) swapped = FALSE;
+
+  tpl_get_spin_lock(TPL_GATE_LOCK);
+  if (*(volatile uint16 *)value == expected)
+  {
+    *(volatile uint16 *)value = new_value;
+    swapped = TRUE;
+  }
+  tpl_release_spin_lock(TPL_GATE_LOCK);
+
+  return swapped;
+}
+
+/**
+ * @internal
+ *
+ * tpl_cpu_relax does nothing, the e200 cores have no spin wait hint
+ */
+FUNC(void, OS_CODE) tpl_cpu_relax(void)
+{
+}
+
 /**
  * @internal
  *
@@ -262,6 +262,14 @@
 #error "Misconfiguration of the OS. SPINLOCKS can only be present in multicore"
 #endif
 
+#if WITH_BITMAP_READY_LIST == YES
+#if !defined(READY_LIST_LEVEL_COUNT) || !defined(READY_LIST_BITMAP_WORDS)
+#error "Misconfiguration of the OS. The bitmap ready list sizes are not defined"
+#elif READY_LIST_BITMAP_WORDS > 32
+#error "Misconfiguration of the OS. The bitmap ready list is limited to 1024 priority levels"
+#endif
+#endif
+
 #endif
 
 #endif /* TPL_CONFIG_CHECK_H */
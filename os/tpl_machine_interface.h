@@ -207,6 +207,21 @@ extern FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void);
 extern FUNC(tpl_time, OS_CODE) tpl_get_tptimer(void);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
+#if (WITH_STATISTICS == YES) || (WITH_SPINLOCK_STATISTICS == YES)
+/**
+ * @internal
+ *
+ * Gives the current date in tpl_stats_time unit. It is read at each context
+ * switch to update the process statistics and when a spinlock is taken to
+ * measure the wait, so it should be a free running counter that is cheap
+ * to read. See the os machine specifications to know what is the unit of
+ * tpl_stats_time.
+ *
+ * @return the current date when called
+ */
+extern FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_timer(void);
+#endif /* WITH_STATISTICS || WITH_SPINLOCK_STATISTICS */
+
 #if WITH_STACK_MONITORING == YES
 /**
  * @internal
@@ -285,6 +300,83 @@ FUNC(void, OS_CODE) tpl_get_lock(
 FUNC(void, OS_CODE) tpl_release_lock(
   CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
 
+/**
+ * @internal
+ *
+ * tpl_fetch_and_add adds increment to the value pointed by counter as an
+ * atomic operation for all the cores and returns the previous value.
+ * The memory accesses done before it are visible to the other cores
+ * before the new value and the ones done after are not done before it.
+ *
+ * It is not lock-free on every port: the posix port uses a hardware atomic
+ * instruction, while the ppc multicore port does the addition under its
+ * single hardware semaphore gate, so the cores calling it are serialized.
+ *
+ * @param counter     pointer to the counter
+ * @param increment   value to add (modulo 2^16, so 0xFFFF decrements)
+ *
+ * @retval the value of the counter before the addition
+ */
+FUNC(uint16, OS_CODE) tpl_fetch_and_add(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) counter,
+  CONST(uint16, AUTOMATIC)              increment);
+
+/**
+ * @internal
+ *
+ * tpl_atomic_load reads a value modified by tpl_fetch_and_add on
+ * another core. The memory accesses done after it are not done before.
+ *
+ * @param value       pointer to the value
+ *
+ * @retval the value
+ */
+FUNC(uint16, OS_CODE) tpl_atomic_load(
+  CONSTP2CONST(uint16, AUTOMATIC, OS_VAR) value);
+
+/**
+ * @internal
+ *
+ * tpl_atomic_exchange writes new_value in the value pointed by value as
+ * an atomic operation for all the cores and returns the previous value.
+ * It orders the memory accesses as tpl_fetch_and_add.
+ *
+ * @param value       pointer to the value
+ * @param new_value   value to write
+ *
+ * @retval the value before the exchange
+ */
+FUNC(uint16, OS_CODE) tpl_atomic_exchange(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              new_value);
+
+/**
+ * @internal
+ *
+ * tpl_compare_and_swap writes new_value in the value pointed by value if
+ * it is equal to expected, as an atomic operation for all the cores.
+ * It orders the memory accesses as tpl_fetch_and_add.
+ *
+ * @param value       pointer to the value
+ * @param expected    value expected
+ * @param new_value   value to write
+ *
+ * @retval TRUE if the value has been written, FALSE otherwise
+ */
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              expected,
+  CONST(uint16, AUTOMATIC)              new_value);
+
+/**
+ * @internal
+ *
+ * tpl_cpu_relax is called in each iteration of the loops waiting for
+ * another core. It tells the core it is spinning, when the architecture
+ * has an instruction for that.
+ */
+FUNC(void, OS_CODE) tpl_cpu_relax(void);
+
 #endif
 
 #define OS_STOP_SEC_CODE
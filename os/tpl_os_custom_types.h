@@ -44,6 +44,16 @@ typedef P2VAR(uint8, TYPEDEF, OS_APPL_DATA) tpl_buffer;
  */
 typedef uint32 tpl_time;
 
+/**
+ * Time data (duration or date) used by the process statistics. The unit is
+ * machine dependant (see #tpl_get_stats_timer). Durations are computed modulo
+ * 2^32, so the cumulative execution time wraps around and a load is computed
+ * from the difference of two readings.
+ *
+ * @see #tpl_get_stats_timer
+ */
+typedef uint32 tpl_stats_time;
+
 #endif /* TPL_OS_CUSTOM_TYPES_H */
 
 /* End of file tpl_os_custom_types.h */
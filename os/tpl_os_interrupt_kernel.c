@@ -48,6 +48,10 @@
 #include "tpl_as_timing_protec.h"
 #endif
 
+#if WITH_STATISTICS == YES
+#include "tpl_os_stats_kernel.h"
+#endif
+
 #define OS_START_SEC_VAR_32BIT
 #include "tpl_memmap.h"
 #if NUMBER_OF_CORES > 1
@@ -299,6 +303,9 @@ STATIC FUNC(void, OS_CODE) tpl_activate_isr(CONST(tpl_isr_id, AUTOMATIC) isr_id)
           TRACE_PROC_CHANGE_STATE(isr_id, READY_AND_NEW)
         }
       }
+#if WITH_STATISTICS == YES
+      tpl_stats_on_activate(isr_id);
+#endif /* WITH_STATISTICS */
       /*  put it in the list  */
       tpl_put_new_proc(isr_id);
       /*  inc the isr activation count. When the isr will terminate
@@ -57,6 +57,9 @@
 #if SPINLOCK_COUNT > 0
 #include "tpl_as_spinlock_kernel.h"
 #endif
+#if WITH_STATISTICS == YES
+#include "tpl_os_stats_kernel.h"
+#endif
 
 #define OS_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -209,6 +212,28 @@ FUNC(void, OS_CODE) printrl(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg)
 {
 #if NUMBER_OF_CORES > 1
   /* TODO */
+#elif WITH_BITMAP_READY_LIST == YES
+  uint32 prio;
+  uint32 i;
+  printf("ready list %s", msg);
+  for (prio = READY_LIST_LEVEL_COUNT; prio-- > 0;)
+  {
+    if (tpl_ready_list.bitmap[prio >> 5] & ((uint32)1 << (prio & 31)))
+    {
+      i = tpl_ready_list.head[prio];
+      do
+      {
+        printf(" {%d/%d,%s[%d](%d)}",
+               (int)(tpl_ready_list.fifo[prio][i].key >> PRIORITY_SHIFT),
+               (int)(tpl_ready_list.fifo[prio][i].key & RANK_MASK),
+               proc_name_table[tpl_ready_list.fifo[prio][i].id],
+               (int)tpl_ready_list.fifo[prio][i].id,
+               tpl_ready_list.fifo[prio][i].key);
+        i = (i + 1) & RANK_MASK;
+      } while (i != tpl_ready_list.tail[prio]);
+    }
+  }
+  printf("\n");
 #else
   uint32 i;
   printf("ready list %s [%d]", msg, tpl_ready_list[0].key);
@@ -246,6 +271,301 @@ FUNC(void, OS_CODE) print_kern(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg)
 
 #endif
 
+#if WITH_TPL_CLZ32 == YES
+/*
+ * tpl_clz32 counts the leading zeros of a non zero 32 bits word. It is used
+ * by TPL_CLZ32 when the compiler has no builtin for it.
+ */
+FUNC(uint32, OS_CODE) tpl_clz32(VAR(uint32, AUTOMATIC) word)
+{
+  VAR(uint32, AUTOMATIC) count = 0;
+
+  if ((word & 0xFFFF0000UL) == 0)
+  {
+    count += 16;
+    word <<= 16;
+  }
+  if ((word & 0xFF000000UL) == 0)
+  {
+    count += 8;
+    word <<= 8;
+  }
+  if ((word & 0xF0000000UL) == 0)
+  {
+    count += 4;
+    word <<= 4;
+  }
+  if ((word & 0xC0000000UL) == 0)
+  {
+    count += 2;
+    word <<= 2;
+  }
+  if ((word & 0x80000000UL) == 0)
+  {
+    count += 1;
+  }
+
+  return count;
+}
+#endif
+
+#if WITH_BITMAP_READY_LIST == YES
+
+/*
+ * Jobs are stored in a FIFO per priority level. Like in the heap, each entry
+ * has a key (the concatenation of the priority of the job and its rank) and
+ * the id of the process. The key is not used to sort the jobs, the FIFO
+ * order does it, but it is kept because it is used as the dynamic priority
+ * of the process when it starts.
+ *
+ * A bitmap tells which FIFOs are not empty, so the highest priority job
+ * is found by counting the leading zeros of the summary word and then of
+ * the bitmap word it designates. All the operations on the ready list are
+ * done in constant time, except tpl_remove_proc.
+ */
+
+/*
+ * @internal
+ *
+ * SET_READY_LEVEL marks the FIFO of a priority level as not empty
+ */
+#define SET_READY_LEVEL(a_ready_list, a_prio)                              \
+  a_ready_list.bitmap[(a_prio) >> 5] |= ((uint32)1 << ((a_prio) & 31));    \
+  a_ready_list.summary |= ((uint32)1 << ((a_prio) >> 5));
+
+/*
+ * @internal
+ *
+ * CLEAR_READY_LEVEL marks the FIFO of a priority level as empty
+ */
+#define CLEAR_READY_LEVEL(a_ready_list, a_prio)                            \
+  a_ready_list.bitmap[(a_prio) >> 5] &= ~((uint32)1 << ((a_prio) & 31));   \
+  if (a_ready_list.bitmap[(a_prio) >> 5] == 0)                             \
+  {                                                                        \
+    a_ready_list.summary &= ~((uint32)1 << ((a_prio) >> 5));               \
+  }
+
+/*
+ * @internal
+ *
+ * tpl_highest_ready_level returns the highest priority level which FIFO
+ * is not empty. The ready list must not be empty.
+ *
+ * @param  ready_list   the bitmap ready list
+ */
+STATIC FUNC(uint32, OS_CODE)
+tpl_highest_ready_level(CONSTP2CONST(tpl_bitmap_ready_list, AUTOMATIC, OS_VAR)
+                            ready_list)
+{
+  CONST(uint32, AUTOMATIC) word = 31 - TPL_CLZ32(ready_list->summary);
+
+  return (word << 5) | (31 - TPL_CLZ32(ready_list->bitmap[word]));
+}
+
+/*
+ * @internal
+ *
+ * tpl_put_new_proc puts a new proc in a ready list. In a multicore kernel
+ * it may be called from a core that does not own the ready list (for
+ * a partitioned scheduler). So the core_id field of the proc descriptor
+ * is used to get the corresponding ready list.
+ */
+FUNC(void, OS_CODE) tpl_put_new_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  GET_PROC_CORE_ID(proc_id, core_id)
+  GET_CORE_READY_LIST(core_id, ready_list)
+  GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+
+  CONST(tpl_priority, AUTOMATIC)
+  prio = tpl_stat_proc_table[proc_id]->base_priority;
+  CONST(uint32, AUTOMATIC) tail = READY_LIST(ready_list).tail[prio];
+
+  /*
+   * add the new entry at the tail of the FIFO of its priority level
+   */
+  READY_LIST(ready_list).fifo[prio][tail].key =
+      DYNAMIC_PRIO(prio, tail_for_prio);
+  READY_LIST(ready_list).fifo[prio][tail].id = proc_id;
+  READY_LIST(ready_list).tail[prio] = (tpl_rank_count)((tail + 1) & RANK_MASK);
+  SET_READY_LEVEL(READY_LIST(ready_list), prio)
+
+  DOW_DO(printf("put new %s, %d\n", proc_name_table[proc_id],
+                READY_LIST(ready_list).fifo[prio][tail].key);)
+  DOW_DO(printrl("put_new_proc");)
+}
+
+/*
+ * @internal
+ *
+ * tpl_put_preempted_proc puts a preempted proc in a ready list.
+ * In a multicore kernel it may be called from a core that does not own
+ * the ready list (for a partitioned scheduler). So the core_id field
+ * of the proc descriptor is used to get the corresponding ready list.
+ */
+FUNC(void, OS_CODE)
+tpl_put_preempted_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  GET_PROC_CORE_ID(proc_id, core_id)
+  GET_CORE_READY_LIST(core_id, ready_list)
+
+  CONST(tpl_priority, AUTOMATIC)
+  dyn_prio = tpl_dyn_proc_table[proc_id]->priority;
+  CONST(uint32, AUTOMATIC) prio = ACTUAL_PRIO(dyn_prio);
+  CONST(uint32, AUTOMATIC)
+  head = (uint32)(READY_LIST(ready_list).head[prio] - 1) & RANK_MASK;
+
+  DOW_DO(printf("put preempted %s, %d\n", proc_name_table[proc_id], dyn_prio));
+  /*
+   * A preempted proc is the oldest one of its priority level,
+   * so it is added at the head of the FIFO
+   */
+  READY_LIST(ready_list).fifo[prio][head].key = dyn_prio;
+  READY_LIST(ready_list).fifo[prio][head].id = proc_id;
+  READY_LIST(ready_list).head[prio] = (tpl_rank_count)head;
+  SET_READY_LEVEL(READY_LIST(ready_list), prio)
+
+  DOW_DO(printrl("put_preempted_proc"));
+}
+
+/**
+ * @internal
+ *
+ * tpl_front_proc returns the proc_id of the highest priority proc in the
+ * ready list on the current core. When the ready list is empty (the idle
+ * task is running), an entry with a null key is returned.
+ */
+FUNC(tpl_heap_entry, OS_CODE) tpl_front_proc(CORE_ID_OR_VOID(core_id))
+{
+  GET_CORE_READY_LIST(core_id, ready_list)
+
+  VAR(tpl_heap_entry, AUTOMATIC) proc = {0, INVALID_PROC_ID};
+
+  if (READY_LIST(ready_list).summary != 0)
+  {
+    CONST(uint32, AUTOMATIC)
+    prio = tpl_highest_ready_level(&READY_LIST(ready_list));
+    proc = READY_LIST(ready_list)
+               .fifo[prio][READY_LIST(ready_list).head[prio]];
+  }
+
+  return proc;
+}
+
+/*
+ * @internal
+ *
+ * tpl_remove_front_proc removes the highest priority proc from the
+ * ready list on the specified core and returns the heap_entry
+ */
+FUNC(tpl_heap_entry, OS_CODE) tpl_remove_front_proc(CORE_ID_OR_VOID(core_id))
+{
+  GET_CORE_READY_LIST(core_id, ready_list)
+
+  CONST(uint32, AUTOMATIC)
+  prio = tpl_highest_ready_level(&READY_LIST(ready_list));
+  CONST(uint32, AUTOMATIC) head = READY_LIST(ready_list).head[prio];
+  CONST(uint32, AUTOMATIC) next = (head + 1) & RANK_MASK;
+
+  /*
+   * Get the front proc and remove it from its FIFO
+   */
+  CONST(tpl_heap_entry, AUTOMATIC)
+  proc = READY_LIST(ready_list).fifo[prio][head];
+  READY_LIST(ready_list).head[prio] = (tpl_rank_count)next;
+
+  if (next == READY_LIST(ready_list).tail[prio])
+  {
+    CLEAR_READY_LEVEL(READY_LIST(ready_list), prio)
+  }
+
+  return proc;
+}
+
+#if WITH_OSAPPLICATION == YES
+
+/**
+ * @internal
+ *
+ * tpl_remove_proc removes all the process instances in the ready queue
+ */
+FUNC(void, OS_CODE) tpl_remove_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  GET_PROC_CORE_ID(proc_id, core_id)
+  GET_CORE_READY_LIST(core_id, ready_list)
+
+  VAR(uint32, AUTOMATIC) prio;
+  VAR(uint32, AUTOMATIC) read;
+  VAR(uint32, AUTOMATIC) write;
+  VAR(uint32, AUTOMATIC) count;
+  VAR(uint32, AUTOMATIC) kept;
+
+  DOW_DO(printf("\n**** remove proc %d ****\n", proc_id);)
+  DOW_DO(printrl("tpl_remove_proc - before");)
+
+  for (prio = 0; prio < READY_LIST_LEVEL_COUNT; prio++)
+  {
+    if ((READY_LIST(ready_list).bitmap[prio >> 5] &
+         ((uint32)1 << (prio & 31))) != 0)
+    {
+      /*
+       * the FIFO is compacted, the other entries keep their order.
+       * head == tail means the FIFO is full since it is not empty.
+       */
+      read = READY_LIST(ready_list).head[prio];
+      write = read;
+      kept = 0;
+      count = ((uint32)(READY_LIST(ready_list).tail[prio] - read - 1) &
+               RANK_MASK) + 1;
+      while (count > 0)
+      {
+        if (READY_LIST(ready_list).fifo[prio][read].id != proc_id)
+        {
+          READY_LIST(ready_list).fifo[prio][write] =
+              READY_LIST(ready_list).fifo[prio][read];
+          write = (write + 1) & RANK_MASK;
+          kept++;
+        }
+        read = (read + 1) & RANK_MASK;
+        count--;
+      }
+      READY_LIST(ready_list).tail[prio] = (tpl_rank_count)write;
+      if (kept == 0)
+      {
+        CLEAR_READY_LEVEL(READY_LIST(ready_list), prio)
+      }
+    }
+  }
+
+  DOW_DO(printrl("tpl_remove_proc - after");)
+}
+
+#endif /* WITH_OSAPPLICATION */
+
+/**
+ * @internal
+ *
+ * tpl_init_ready_list empties the ready list of a core
+ */
+FUNC(void, OS_CODE) tpl_init_ready_list(CORE_ID_OR_VOID(core_id))
+{
+  GET_CORE_READY_LIST(core_id, ready_list)
+
+  VAR(uint32, AUTOMATIC) i;
+
+  READY_LIST(ready_list).summary = 0;
+  for (i = 0; i < READY_LIST_BITMAP_WORDS; i++)
+  {
+    READY_LIST(ready_list).bitmap[i] = 0;
+  }
+  for (i = 0; i < READY_LIST_LEVEL_COUNT; i++)
+  {
+    READY_LIST(ready_list).head[i] = 0;
+    READY_LIST(ready_list).tail[i] = 0;
+  }
+}
+
+#else /* WITH_BITMAP_READY_LIST */
+
 /*
  * Jobs are stored in a heap. Each entry has a key (used to sort the heap)
  * and the id of the process. The size of the heap is computed by doing
@@ -524,6 +844,20 @@ FUNC(void, OS_CODE) tpl_remove_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
 
 #endif /* WITH_OSAPPLICATION */
 
+/**
+ * @internal
+ *
+ * tpl_init_ready_list empties the ready list of a core
+ */
+FUNC(void, OS_CODE) tpl_init_ready_list(CORE_ID_OR_VOID(core_id))
+{
+  GET_CORE_READY_LIST(core_id, ready_list)
+
+  READY_LIST(ready_list)[0].key = 0;
+}
+
+#endif /* WITH_BITMAP_READY_LIST */
+
 /**
  * @internal
  *
@@ -622,8 +956,8 @@ FUNC(void, OS_CODE) tpl_preempt(CORE_ID_OR_VOID(core_id))
      * is preempted but has not yet run. so it is put
      * back in the ready list. This occurs only in multicore
      * It is not a preemption actually so the PostTaskHook is not
-     * called, the trace is not done and the timing protection
-     * is not notified.
+     * called, the trace is not done and neither the timing protection
+     * nor the statistics are notified.
      */
     DOW_DO(print_kern("inside tpl_preempt"));
 
@@ -680,6 +1014,10 @@ tpl_run_elected(CONST(tpl_bool, AUTOMATIC) save)
     /* cancel the watchdog and update the budget                  */
     tpl_tp_on_preempt(TPL_KERN_REF(kern).running_id);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
+
+#if WITH_STATISTICS == YES
+    tpl_stats_on_preempt(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_STATISTICS */
   }
 
 #if WITH_ISR2_PRIORITY_MASKING == YES && ISR_COUNT > 0
@@ -725,6 +1063,10 @@ tpl_run_elected(CONST(tpl_bool, AUTOMATIC) save)
   tpl_tp_on_start(TPL_KERN_REF(kern).running_id);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
+#if WITH_STATISTICS == YES
+  tpl_stats_on_start(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_STATISTICS */
+
   /*
    * If an internal resource is assigned to the task
    * and it is not already taken by it, take it
@@ -805,19 +1147,29 @@ FUNC(void, OS_CODE) tpl_start(CORE_ID_OR_VOID(core_id))
  */
 FUNC(void, OS_CODE) tpl_schedule_from_running(CORE_ID_OR_VOID(core_id))
 {
+#if WITH_BITMAP_READY_LIST == NO
   GET_CORE_READY_LIST(core_id, ready_list)
+#endif
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
 
   VAR(uint8, AUTOMATIC) need_switch = NO_NEED_SWITCH;
+#if WITH_BITMAP_READY_LIST == YES
+  CONST(tpl_priority, AUTOMATIC)
+  front_key = tpl_front_proc(CORE_ID_OR_NOTHING(core_id)).key;
+#else
+  CONST(tpl_priority, AUTOMATIC) front_key = READY_LIST(ready_list)[1].key;
+#endif
 
   DOW_DO(print_kern("before tpl_schedule_from_running"));
-  DOW_ASSERT((uint32)READY_LIST(ready_list)[1].key > 0)
+#if WITH_BITMAP_READY_LIST == NO
+  DOW_ASSERT((uint32)front_key > 0)
+#endif
 
 #if WITH_STACK_MONITORING == YES
   tpl_check_stack((tpl_proc_id)TPL_KERN_REF(kern).elected_id);
 #endif /* WITH_STACK_MONITORING */
 
-  if ((READY_LIST(ready_list)[1].key) >
+  if (front_key >
       (tpl_dyn_proc_table[TPL_KERN_REF(kern).elected_id]->priority))
   {
     /* Preempts the RUNNING task */
@@ -905,6 +1257,11 @@ FUNC(void, OS_CODE) tpl_terminate(void)
   tpl_tp_reset_watchdogs(TPL_KERN_REF(kern).running_id);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
+#if WITH_STATISTICS == YES
+  /* update the execution and response times of the job */
+  tpl_stats_on_terminate(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_STATISTICS */
+
   /* copy it in old slot of tpl_kern */
   /*  TPL_KERN_REF(kern).old = TPL_KERN_REF(kern).running;
     TPL_KERN_REF(kern).s_old = TPL_KERN_REF(kern).s_running;*/
@@ -942,6 +1299,10 @@ FUNC(void, OS_CODE) tpl_block(void)
   TRACE_PROC_CHANGE_STATE(TPL_KERN_REF(kern).running_id,
                           (tpl_proc_state)WAITING)
 
+#if WITH_STATISTICS == YES
+  tpl_stats_on_wait(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_STATISTICS */
+
   /* The internal resource is released. */
   tpl_release_internal_resource((tpl_proc_id)TPL_KERN_REF(kern).running_id);
 
@@ -1025,6 +1386,10 @@ tpl_activate_task(CONST(tpl_task_id, AUTOMATIC) task_id)
 
       result = E_OK;
 
+#if WITH_STATISTICS == YES
+      tpl_stats_on_activate(task_id);
+#endif /* WITH_STATISTICS */
+
       /*  put it in the list                                            */
       tpl_put_new_proc(task_id);
       /*  inc the task activation count. When the task will terminate
@@ -1204,7 +1569,7 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
   idle = tpl_dyn_proc_table[IDLE_TASK_0_ID + tpl_get_core_id()];
 #endif
 
-  READY_LIST(ready_list)[0].key = 0;
+  tpl_init_ready_list(CORE_ID_OR_NOTHING(core_id));
   /* No running task static descriptor                                  */
   TPL_KERN_REF(kern).s_running = NULL;
   /* elected task to run is idle task                                   */
@@ -222,6 +222,34 @@ struct TPL_PROC_STATIC
  */
 typedef struct TPL_PROC_STATIC tpl_proc_static;
 
+#if WITH_STATISTICS == YES
+/**
+ * @typedef tpl_proc_stats
+ *
+ * Runtime statistics of a task or ISR2, updated by the kernel when the
+ * process gets or loses the CPU. Times are in tpl_stats_time unit.
+ */
+typedef struct
+{
+  VAR(tpl_stats_time, TYPEDEF)
+  start_date; /**< date the process got the CPU                */
+  VAR(tpl_stats_time, TYPEDEF)
+  activation_date; /**< date the current job was activated     */
+  VAR(tpl_stats_time, TYPEDEF)
+  job_time; /**< execution time of the current job             */
+  VAR(tpl_stats_time, TYPEDEF)
+  execution_time; /**< cumulative execution time               */
+  VAR(tpl_stats_time, TYPEDEF)
+  max_execution_time; /**< worst observed execution time of a job */
+  VAR(tpl_stats_time, TYPEDEF)
+  max_response_time; /**< worst observed response time of a job  */
+  VAR(uint32, TYPEDEF)
+  activation_count; /**< number of activations                 */
+  VAR(uint32, TYPEDEF)
+  preemption_count; /**< number of preemptions                 */
+} tpl_proc_stats;
+#endif /* WITH_STATISTICS */
+
 /**
  * @struct TPL_PROC
  *
@@ -242,6 +270,10 @@ struct TPL_PROC
   priority; /**< current priority                     */
   VAR(tpl_proc_state, TYPEDEF)
   state; /**< state (READY, RUNNING, ...)*/
+#if WITH_STATISTICS == YES
+  VAR(tpl_proc_stats, TYPEDEF)
+  stats; /**< runtime statistics                   */
+#endif
 };
 
 /**
@@ -299,6 +331,46 @@ typedef struct
   VAR(tpl_proc_id, TYPEDEF) id;
 } tpl_heap_entry;
 
+#if WITH_BITMAP_READY_LIST == YES
+/**
+ * @typedef tpl_bitmap_ready_list
+ *
+ * This type is the ready list used instead of the heap when the bitmap
+ * ready list is selected. Each priority level has a FIFO of heap entries,
+ * located from head (included) to tail (excluded). Bit n of bitmap word w
+ * is set when the FIFO of priority level 32 * w + n is not empty and bit w
+ * of summary is set when bitmap word w is not 0. So the highest priority
+ * level is found with 2 count leading zeros operations.
+ */
+typedef struct
+{
+  VAR(uint32, TYPEDEF) summary;
+  VAR(uint32, TYPEDEF) bitmap[READY_LIST_BITMAP_WORDS];
+  VAR(tpl_rank_count, TYPEDEF) head[READY_LIST_LEVEL_COUNT];
+  VAR(tpl_rank_count, TYPEDEF) tail[READY_LIST_LEVEL_COUNT];
+  VAR(tpl_heap_entry, TYPEDEF) fifo[READY_LIST_LEVEL_COUNT][RANK_MASK + 1];
+} tpl_bitmap_ready_list;
+#endif
+
+#if (WITH_BITMAP_READY_LIST == YES) || (WITH_TIMEOBJ_WHEEL == YES)
+/**
+ * @internal
+ *
+ * TPL_CLZ32 returns the number of leading zeros of a non zero 32 bits word.
+ * It is used to find the highest bit set in the bitmaps of the bitmap ready
+ * list and of the time object wheels.
+ */
+#if defined(__GNUC__) && (__SIZEOF_INT__ == 4)
+#define TPL_CLZ32(a_word) ((uint32)__builtin_clz(a_word))
+#define WITH_TPL_CLZ32 NO
+#else
+#define TPL_CLZ32(a_word) tpl_clz32(a_word)
+#define WITH_TPL_CLZ32 YES
+#endif
+#else
+#define WITH_TPL_CLZ32 NO
+#endif
+
 #define OS_START_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -399,7 +471,7 @@ extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
 #define SWITCH_CONTEXT_NOSAVE(a_core_id)                                       \
   if (a_core_id == tpl_get_core_id())                                          \
   {                                                                            \
-    LOCAL_SWITCH_CONTEXT(a_core_id)                                            \
+    LOCAL_SWITCH_CONTEXT_NOSAVE(a_core_id)                                     \
   }                                                                            \
   else                                                                         \
   {                                                                            \
@@ -435,6 +507,9 @@ extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
  *
  * In multicore implementation, tpl_ready_list is an array of pointers to
  * a heap per core. tpl_ready_list is indexed by the core identifier.
+ *
+ * When the bitmap ready list is used, the heap is replaced by
+ * a tpl_bitmap_ready_list.
  */
 
 /*
@@ -447,7 +522,11 @@ extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
 
 #define OS_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
+#if WITH_BITMAP_READY_LIST == YES
+extern CONSTP2VAR(tpl_bitmap_ready_list, OS_CONST, OS_VAR) tpl_ready_list[];
+#else
 extern CONSTP2VAR(tpl_heap_entry, OS_CONST, OS_VAR) tpl_ready_list[];
+#endif
 #define OS_STOP_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -455,7 +534,11 @@ extern CONSTP2VAR(tpl_heap_entry, OS_CONST, OS_VAR) tpl_ready_list[];
 
 #define OS_START_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
+#if WITH_BITMAP_READY_LIST == YES
+extern VAR(tpl_bitmap_ready_list, OS_VAR) tpl_ready_list;
+#else
 extern VAR(tpl_heap_entry, OS_VAR) tpl_ready_list[];
+#endif
 #define OS_STOP_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -570,6 +653,16 @@ FUNC(void, OS_CODE) tpl_release(CONST(tpl_task_id, AUTOMATIC) task_id);
  */
 FUNC(tpl_heap_entry, OS_CODE) tpl_front_proc(CORE_ID_OR_VOID(core_id));
 
+#if WITH_TPL_CLZ32 == YES
+/**
+ * @internal
+ *
+ * Count the leading zeros of a non zero 32 bits word when the compiler
+ * does not provide a builtin for it. Use TPL_CLZ32 instead.
+ */
+FUNC(uint32, OS_CODE) tpl_clz32(VAR(uint32, AUTOMATIC) word);
+#endif
+
 /**
  * @internal
  *
@@ -584,6 +677,13 @@ tpl_put_preempted_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id);
 
 FUNC(void, OS_CODE) tpl_put_new_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id);
 
+/**
+ * @internal
+ *
+ * Empty the ready list of a core
+ */
+FUNC(void, OS_CODE) tpl_init_ready_list(CORE_ID_OR_VOID(core_id));
+
 FUNC(void, OS_CODE)
 tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode);
 
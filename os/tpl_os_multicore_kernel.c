@@ -38,12 +38,21 @@ VAR(uint16, OS_VAR)
 VAR(uint16, OS_VAR)
   tpl_number_of_non_autosar_activated_cores = 0;
 
-VAR(uint16, OS_VAR) tpl_start_count_0 = 1;
-VAR(uint16, OS_VAR) tpl_start_count_1 = 1;
-
 #define OS_STOP_SEC_VAR_16BITS
 #include "tpl_memmap.h"
 
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+VAR(tpl_barrier, OS_VAR) tpl_start_barrier = {
+  /* count: the master core, StartCore adds the other ones  */  1,
+  /* sense                                                   */  0,
+  /* local sense of each core                                */  { 0 }
+};
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
 #define OS_START_SEC_VAR_8BITS
 #include "tpl_memmap.h"
 
@@ -62,24 +71,30 @@ extern VAR(CoreStatusType, OS_VAR) tpl_core_status[NUMBER_OF_CORES];
 /**
  * tpl_sync_barrier does a synchronization barrier
  *
- * @param   enter_count   the counter used to count the number of cores
- * @param   lock          the lock used to protect the critical section
+ * @param   barrier   the barrier
  */
 FUNC(void, OS_CODE) tpl_sync_barrier(
-  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR)   enter_count,
-  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock)
+  CONSTP2VAR(tpl_barrier, AUTOMATIC, OS_VAR) barrier)
 {
-  VAR(uint16, AUTOMATIC) count;
+  GET_CURRENT_CORE_ID(core_id)
+  CONST(uint16, AUTOMATIC) sense =
+    (uint16)(barrier->local_sense[core_id] ^ 1U);
 
-  tpl_get_lock(lock);
-  count = --*enter_count;
-  tpl_release_lock(lock);
+  barrier->local_sense[core_id] = sense;
 
-  while (count > 0)
+  if (1U == tpl_fetch_and_add(&barrier->count, (uint16)0xFFFFU))
+  {
+    /* last core: re-arm the barrier for the next phase and
+       release the other cores */
+    (void)tpl_fetch_and_add(&barrier->count, tpl_number_of_activated_cores);
+    (void)tpl_fetch_and_add(&barrier->sense, 1U);
+  }
+  else
   {
-    tpl_get_lock(lock);
-    count = *enter_count;
-    tpl_release_lock(lock);
+    while ((tpl_atomic_load(&barrier->sense) & 1U) != sense)
+    {
+      tpl_cpu_relax();
+    }
   }
 }
 
@@ -135,8 +150,7 @@ FUNC(void, OS_CODE) tpl_start_core_service(
   {
     tpl_core_status[core_id] = STARTED_CORE_AUTOSAR;
     tpl_number_of_activated_cores++;
-    tpl_start_count_0++;
-    tpl_start_count_1++;
+    (void)tpl_fetch_and_add(&tpl_start_barrier.count, 1U);
     tpl_start_core(core_id);
   }
 
@@ -42,14 +42,44 @@ extern VAR(CoreStatusType, OS_APPL_DATA) tpl_core_status[NUMBER_OF_CORES];
 #define OS_STOP_SEC_VAR_8BITS
 #include "tpl_memmap.h"
 
-#define OS_START_SEC_VAR_16BITS
+/**
+ * @struct TPL_BARRIER
+ *
+ * Sense reversing synchronization barrier. The cores that reach the
+ * barrier decrement count and wait for the low bit of sense to become
+ * their local sense. The last one re-arms count and flips sense, so the
+ * same barrier is used for each phase. Waiting cores only read sense.
+ */
+struct TPL_BARRIER {
+  VAR(uint16, TYPEDEF) count;       /**< number of cores that did not
+                                         reach the barrier yet          */
+  VAR(uint16, TYPEDEF) sense;       /**< incremented at the end of each
+                                         phase, its low bit is the sense */
+  VAR(uint16, TYPEDEF) local_sense[NUMBER_OF_CORES];  /**< sense of the
+                                         current phase of each core     */
+};
+
+/**
+ * @typedef tpl_barrier
+ *
+ * Synchronization barrier. See #TPL_BARRIER
+ */
+typedef struct TPL_BARRIER tpl_barrier;
+
+#define OS_START_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
 /**
- * tpl_start_count
+ * tpl_start_barrier is the barrier of the cores in StartOS. Its count is
+ * incremented by StartCore
  */
-extern VAR(uint16, OS_APPL_DATA) tpl_start_count_0;
-extern VAR(uint16, OS_APPL_DATA) tpl_start_count_1;
+extern VAR(tpl_barrier, OS_VAR) tpl_start_barrier;
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_VAR_16BITS
+#include "tpl_memmap.h"
 
 /**
  * tpl_number_of_activated_cores
@@ -144,12 +174,11 @@ FUNC(StatusType, OS_CODE) tpl_get_core_status_service(
 /**
  * tpl_sync_barrier does a synchronization barrier
  *
- * @param   enter_count   the counter used to count the number of cores
- * @param   lock          the lock used to protect the critical section
+ * @param   barrier   the barrier. All the activated cores have to reach
+ *                    it before any of them returns
  */
 FUNC(void, OS_CODE) tpl_sync_barrier(
-  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR)   enter_count,
-  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
+  CONSTP2VAR(tpl_barrier, AUTOMATIC, OS_VAR) barrier);
 
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
@@ -51,8 +51,13 @@
  * GET_CORE_READY_LIST initializes the constant ready_list
  * with the ready list belonging to core core_id
  */
+#if WITH_BITMAP_READY_LIST == YES
+#define GET_CORE_READY_LIST(a_core_id, a_ready_list) \
+  CONSTP2VAR(tpl_bitmap_ready_list, AUTOMATIC, OS_VAR) a_ready_list = tpl_ready_list[a_core_id];
+#else
 #define GET_CORE_READY_LIST(a_core_id, a_ready_list) \
   CONSTP2VAR(tpl_heap_entry, AUTOMATIC, OS_VAR) a_ready_list = tpl_ready_list[a_core_id];
+#endif
 /*
  * GET_TAIL_FOR_PRIO initializes the constant tail_for_prio
  * with the rank table of core core_id
@@ -94,9 +99,14 @@
   (*(tpl_kern[a_core_id]))
 
 /*
- * READY_LIST expands to the ready_list constant
+ * READY_LIST expands to the ready_list constant. The bitmap ready list
+ * is a structure so the constant is dereferenced like TPL_KERN_REF does.
  */
+#if WITH_BITMAP_READY_LIST == YES
+#define READY_LIST(a_ready_list)  (*a_ready_list)
+#else
 #define READY_LIST(a_ready_list)  a_ready_list
+#endif
 /*
  * TAIL_FOR_PRIO expands to the tail_for_prio constant
  */
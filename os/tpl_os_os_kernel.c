@@ -58,16 +58,6 @@ STATIC VAR(tpl_application_mode, OS_VAR) application_mode[NUMBER_OF_CORES];
 STATIC VAR(tpl_application_mode, OS_VAR) application_mode = NOAPPMODE;
 #endif
 
-#if NUMBER_OF_CORES > 1
-/**
- * @internal
- *
- * tpl_startos_sync_lock is the lock used in the critical section of
- * both synchronization barriers of tpl_start_os
- */
-VAR(tpl_lock, OS_VAR) tpl_startos_sync_lock = UNLOCKED_LOCK;
-#endif
-
 #define OS_STOP_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -126,7 +116,7 @@ tpl_start_os_service(CONST(tpl_application_mode, AUTOMATIC) mode)
     /*
      * Sync barrier at start of tpl_start_os_service.
      */
-    tpl_sync_barrier(&tpl_start_count_0, &tpl_startos_sync_lock);
+    tpl_sync_barrier(&tpl_start_barrier);
 
     application_mode[core_id] = mode;
 #else
@@ -152,7 +142,7 @@ tpl_start_os_service(CONST(tpl_application_mode, AUTOMATIC) mode)
     /*
      * Sync barrier just before starting the scheduling.
      */
-    tpl_sync_barrier(&tpl_start_count_1, &tpl_startos_sync_lock);
+    tpl_sync_barrier(&tpl_start_barrier);
 #endif
 
     /*
@@ -0,0 +1,76 @@
+/**
+ * @file tpl_os_stats.h
+ *
+ * @section desc File description
+ *
+ * Trampoline process statistics types header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_STATS_H
+#define TPL_OS_STATS_H
+
+#include "tpl_os_std_types.h"
+#include "tpl_os_custom_types.h"
+
+/**
+ * @struct TPL_TASK_STATS
+ *
+ * Runtime statistics of a task as returned by GetTaskStatistics. Times are
+ * in tpl_stats_time unit (see the os machine specifications). The execution
+ * time is cumulative and wraps around.
+ */
+struct TPL_TASK_STATS
+{
+  VAR(tpl_stats_time, TYPEDEF)
+  execution_time; /**< cumulative execution time               */
+  VAR(tpl_stats_time, TYPEDEF)
+  max_execution_time; /**< worst observed execution time of a job */
+  VAR(tpl_stats_time, TYPEDEF)
+  max_response_time; /**< worst observed response time of a job  */
+  VAR(uint32, TYPEDEF)
+  activation_count; /**< number of activations                 */
+  VAR(uint32, TYPEDEF)
+  preemption_count; /**< number of preemptions                 */
+};
+
+/**
+ * @typedef tpl_task_stats
+ *
+ * This is an alias for the #TPL_TASK_STATS structure
+ */
+typedef struct TPL_TASK_STATS tpl_task_stats;
+
+/**
+ * @typedef TaskStatisticsType
+ *
+ * Runtime statistics of a task
+ */
+typedef tpl_task_stats TaskStatisticsType;
+
+/**
+ * @typedef TaskStatisticsRefType
+ *
+ * References a #TaskStatisticsType
+ */
+typedef P2VAR(tpl_task_stats, TYPEDEF, OS_APPL_DATA) TaskStatisticsRefType;
+
+#endif /* TPL_OS_STATS_H */
+
+/* End of file tpl_os_stats.h */
@@ -0,0 +1,276 @@
+/**
+ * @file tpl_os_stats_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline process statistics implementation
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os_stats_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_os_errorhook.h"
+#include "tpl_machine_interface.h"
+
+#if WITH_MEMORY_PROTECTION == YES
+#include "tpl_os_mem_prot.h"
+#endif
+
+#if WITH_STATISTICS == YES
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * Adds the time elapsed since the process got the CPU to its execution
+ * time and to the execution time of its current job.
+ */
+STATIC FUNC(void, OS_CODE)
+tpl_stats_account(CONSTP2VAR(tpl_proc_stats, AUTOMATIC, OS_VAR) stats,
+                  CONST(tpl_stats_time, AUTOMATIC) now)
+{
+  CONST(tpl_stats_time, AUTOMATIC) elapsed = now - stats->start_date;
+
+  stats->execution_time += elapsed;
+  stats->job_time += elapsed;
+}
+
+/*
+ * Copies the public part of the statistics of a process. If the process
+ * is running, the time elapsed since it got the CPU is included in its
+ * execution time.
+ */
+STATIC FUNC(void, OS_CODE)
+tpl_stats_copy(CONST(tpl_proc_id, AUTOMATIC) proc_id,
+               CONSTP2VAR(tpl_task_stats, AUTOMATIC, OS_APPL_DATA) result)
+{
+  CONSTP2CONST(tpl_proc, AUTOMATIC, OS_APPL_DATA)
+  proc = tpl_dyn_proc_table[proc_id];
+  CONSTP2CONST(tpl_proc_stats, AUTOMATIC, OS_VAR) stats = &(proc->stats);
+
+  result->execution_time = stats->execution_time;
+  if (proc->state == (tpl_proc_state)RUNNING)
+  {
+    result->execution_time += tpl_get_stats_timer() - stats->start_date;
+  }
+  result->max_execution_time = stats->max_execution_time;
+  result->max_response_time = stats->max_response_time;
+  result->activation_count = stats->activation_count;
+  result->preemption_count = stats->preemption_count;
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_activate(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
+  proc = tpl_dyn_proc_table[proc_id];
+
+  /*
+   * The response time is measured from the activation of the job. The
+   * activation date of the other instances is not kept, see
+   * tpl_stats_on_terminate.
+   */
+  if (proc->activate_count == 0)
+  {
+    proc->stats.activation_date = tpl_get_stats_timer();
+  }
+  proc->stats.activation_count++;
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_start(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  tpl_dyn_proc_table[proc_id]->stats.start_date = tpl_get_stats_timer();
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_preempt(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2VAR(tpl_proc_stats, AUTOMATIC, OS_VAR)
+  stats = &(tpl_dyn_proc_table[proc_id]->stats);
+
+  tpl_stats_account(stats, tpl_get_stats_timer());
+  stats->preemption_count++;
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_wait(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  tpl_stats_account(&(tpl_dyn_proc_table[proc_id]->stats),
+                    tpl_get_stats_timer());
+}
+
+FUNC(void, OS_CODE)
+tpl_stats_on_terminate(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
+  proc = tpl_dyn_proc_table[proc_id];
+  CONST(tpl_stats_time, AUTOMATIC) now = tpl_get_stats_timer();
+  VAR(tpl_stats_time, AUTOMATIC) response_time;
+
+  tpl_stats_account(&(proc->stats), now);
+
+  if (proc->stats.job_time > proc->stats.max_execution_time)
+  {
+    proc->stats.max_execution_time = proc->stats.job_time;
+  }
+  response_time = now - proc->stats.activation_date;
+  if (response_time > proc->stats.max_response_time)
+  {
+    proc->stats.max_response_time = response_time;
+  }
+  proc->stats.job_time = 0;
+
+  /*
+   * If another instance is pending, its response time is measured from
+   * now. It is a lower bound since it was activated before.
+   */
+  if (proc->activate_count > 0)
+  {
+    proc->stats.activation_date = now;
+  }
+}
+
+FUNC(tpl_status, OS_CODE)
+tpl_get_task_statistics_service(
+    CONST(tpl_task_id, AUTOMATIC) task_id,
+    CONSTP2VAR(tpl_task_stats, AUTOMATIC, OS_APPL_DATA) stats)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_GetTaskStatistics)
+  STORE_TASK_ID(task_id)
+
+  /*  Check a task_id error       */
+  CHECK_TASK_ID_ERROR(task_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_RIGHTS_TASK_ID(core_id, task_id, result)
+
+  /* check stats is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, stats, result);
+
+#if TASK_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_stats_copy(task_id, stats);
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+FUNC(tpl_status, OS_CODE)
+tpl_get_idle_statistics_service(
+    CONSTP2VAR(tpl_task_stats, AUTOMATIC, OS_APPL_DATA) stats)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_GetIdleStatistics)
+
+  /* check stats is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, stats, result);
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+#if NUMBER_OF_CORES == 1
+    tpl_stats_copy(IDLE_TASK_ID, stats);
+#else
+    tpl_stats_copy(IDLE_TASK_0_ID + core_id, stats);
+#endif
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+FUNC(tpl_status, OS_CODE)
+tpl_reset_task_statistics_service(CONST(tpl_task_id, AUTOMATIC) task_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_ResetTaskStatistics)
+  STORE_TASK_ID(task_id)
+
+  /*  Check a task_id error       */
+  CHECK_TASK_ID_ERROR(task_id, result)
+
+  /* check access right */
+  CHECK_ACCESS_RIGHTS_TASK_ID(core_id, task_id, result)
+
+#if TASK_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    /*
+     * The dates of the current job are kept so that it is accounted
+     * correctly when it loses the CPU.
+     */
+    CONSTP2VAR(tpl_proc_stats, AUTOMATIC, OS_VAR)
+    task_stats = &(tpl_dyn_proc_table[task_id]->stats);
+
+    task_stats->execution_time = 0;
+    task_stats->max_execution_time = 0;
+    task_stats->max_response_time = 0;
+    task_stats->activation_count = 0;
+    task_stats->preemption_count = 0;
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_STATISTICS */
+
+/* End of file tpl_os_stats_kernel.c */
@@ -0,0 +1,132 @@
+/**
+ * @file tpl_os_stats_kernel.h
+ *
+ * @section desc File description
+ *
+ * Kernel functions for the process statistics
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_STATS_KERNEL_H
+#define TPL_OS_STATS_KERNEL_H
+
+#include "tpl_os_kernel.h"
+#include "tpl_os_stats.h"
+
+#if WITH_STATISTICS == YES
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Called when a new instance of a process is activated, before its
+ * activation count is incremented.
+ *
+ * @param proc_id   identifier of the process
+ */
+FUNC(void, OS_CODE) tpl_stats_on_activate(CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Called when a process gets the CPU.
+ *
+ * @param proc_id   identifier of the process
+ */
+FUNC(void, OS_CODE) tpl_stats_on_start(CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Called when a process loses the CPU because it is preempted.
+ *
+ * @param proc_id   identifier of the process
+ */
+FUNC(void, OS_CODE) tpl_stats_on_preempt(CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Called when a process loses the CPU because it waits for an event.
+ *
+ * @param proc_id   identifier of the process
+ */
+FUNC(void, OS_CODE) tpl_stats_on_wait(CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Called when a process terminates, after its activation count has been
+ * decremented. The execution and response times of the job are compared
+ * to the worst observed ones.
+ *
+ * @param proc_id   identifier of the process
+ */
+FUNC(void, OS_CODE)
+tpl_stats_on_terminate(CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * Gives the runtime statistics of a task
+ *
+ * @param task_id   identifier of the task
+ * @param stats     reference of the variable where the statistics
+ *                  of the specified task will be stored
+ *
+ * @retval  E_OK    no error
+ * @retval  E_OS_ID (extended error only) task_id is invalid
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_get_task_statistics_service(
+    CONST(tpl_task_id, AUTOMATIC) task_id,
+    CONSTP2VAR(tpl_task_stats, AUTOMATIC, OS_APPL_DATA) stats);
+
+/**
+ * Gives the runtime statistics of the idle task of the calling core.
+ * The CPU load is computed from the execution time of the idle task.
+ *
+ * @param stats     reference of the variable where the statistics
+ *                  of the idle task will be stored
+ *
+ * @retval  E_OK    no error
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_get_idle_statistics_service(
+    CONSTP2VAR(tpl_task_stats, AUTOMATIC, OS_APPL_DATA) stats);
+
+/**
+ * Resets the runtime statistics of a task
+ *
+ * @param task_id   identifier of the task
+ *
+ * @retval  E_OK    no error
+ * @retval  E_OS_ID (extended error only) task_id is invalid
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_reset_task_statistics_service(CONST(tpl_task_id, AUTOMATIC) task_id);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_STATISTICS */
+
+#endif /* TPL_OS_STATS_KERNEL_H */
+
+/* End of file tpl_os_stats_kernel.h */
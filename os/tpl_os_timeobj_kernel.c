@@ -52,6 +52,104 @@ FUNC(void, OS_CODE) tpl_enable_counters(void)
   tpl_counters_enabled = TRUE;
 }
 
+#if WITH_TIMEOBJ_WHEEL == YES
+/*
+ * The time object wheel of a counter is an index of its time object list.
+ * The slots cover consecutive ranges of dates, so the order of the slots is
+ * the order of the list and the time objects of a slot are consecutive in
+ * the list. The wheel only gives the place where a time object has to be
+ * inserted, the list itself, next_to and the processing of the BOOTSTRAP
+ * time objects are unchanged.
+ *
+ * TPL_WHEEL_SLOT returns the slot of a date in the wheel of a counter.
+ */
+#define TPL_WHEEL_SLOT(a_counter, a_date)                                    \
+  ((uint32)((a_date) >> (a_counter)->wheel_shift))
+
+/*
+ * tpl_wheel_set_last sets the last time object of a slot of the wheel
+ * of a counter and updates the bitmap of the non empty slots. time_obj
+ * is NULL when the slot becomes empty.
+ */
+STATIC FUNC(void, OS_CODE) tpl_wheel_set_last(
+  P2VAR(tpl_timeobj_wheel, AUTOMATIC, OS_APPL_DATA) wheel,
+  CONST(uint32, AUTOMATIC) slot,
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
+{
+  CONST(uint32, AUTOMATIC) word = slot >> 5;
+
+  wheel->last_to[slot] = time_obj;
+  if (time_obj != NULL)
+  {
+    wheel->bitmap[word] |= ((uint32)1 << (slot & 31));
+    wheel->summary |= ((uint32)1 << word);
+  }
+  else
+  {
+    wheel->bitmap[word] &= ~((uint32)1 << (slot & 31));
+    if (wheel->bitmap[word] == 0)
+    {
+      wheel->summary &= ~((uint32)1 << word);
+    }
+  }
+}
+
+/*
+ * tpl_wheel_last_before returns the last time object of the closest non
+ * empty slot before slot in the wheel of a counter, or NULL if all the
+ * slots before slot are empty.
+ */
+STATIC FUNC(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA), OS_CODE)
+  tpl_wheel_last_before(
+    P2VAR(tpl_timeobj_wheel, AUTOMATIC, OS_APPL_DATA) wheel,
+    CONST(uint32, AUTOMATIC) slot)
+{
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) last_to = NULL;
+  VAR(uint32, AUTOMATIC) word = slot >> 5;
+  VAR(uint32, AUTOMATIC) bits =
+    wheel->bitmap[word] & (((uint32)1 << (slot & 31)) - 1);
+
+  if (bits == 0)
+  {
+    /*  no slot before in the same bitmap word, look at the previous
+        non empty bitmap word                                           */
+    CONST(uint32, AUTOMATIC) words =
+      wheel->summary & (((uint32)1 << word) - 1);
+    if (words != 0)
+    {
+      word = 31 - TPL_CLZ32(words);
+      bits = wheel->bitmap[word];
+    }
+  }
+  if (bits != 0)
+  {
+    last_to = wheel->last_to[(word << 5) + 31 - TPL_CLZ32(bits)];
+  }
+
+  return last_to;
+}
+
+/*
+ * tpl_wheel_remove_last updates a slot of the wheel of a counter when the
+ * last time object of the slot has been removed from the list. prev_to is
+ * the time object which preceded the removed one(s) in the list.
+ */
+STATIC FUNC(void, OS_CODE) tpl_wheel_remove_last(
+  P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
+  CONST(uint32, AUTOMATIC) slot,
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) prev_to)
+{
+  if ((prev_to != NULL) && (TPL_WHEEL_SLOT(counter, prev_to->date) == slot))
+  {
+    tpl_wheel_set_last(counter->wheel, slot, prev_to);
+  }
+  else
+  {
+    tpl_wheel_set_last(counter->wheel, slot, NULL);
+  }
+}
+#endif /* WITH_TIMEOBJ_WHEEL */
+
 /*
  * tpl_insert_time_obj
  * insert a time object in the time object queue of the counter
@@ -59,7 +157,10 @@ FUNC(void, OS_CODE) tpl_enable_counters(void)
  *
  * The time object list of a counter is a double-linked list
  * and a time object is inserted starting from the
- * head of the list
+ * head of the list. With the time object wheel, the search starts from
+ * the last time object of the slot of the date and goes backward. It stops
+ * at once when the date is the greatest of its slot, otherwise it walks
+ * the time objects of the slot with a greater date.
  */
 FUNC(void, OS_CODE)
 tpl_insert_time_obj(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
@@ -73,6 +174,12 @@ tpl_insert_time_obj(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
   /*  initialize the time object that precede the current one to NULL     */
   P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA)
   prev_to = NULL_PTR;
+#if WITH_TIMEOBJ_WHEEL == YES
+  P2VAR(tpl_timeobj_wheel, AUTOMATIC, OS_APPL_DATA) wheel = counter->wheel;
+  CONST(uint32, AUTOMATIC) slot = TPL_WHEEL_SLOT(counter, time_obj->date);
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) slot_last_to =
+    wheel->last_to[slot];
+#endif
 
   if (current_to == NULL)
   {
@@ -81,16 +188,45 @@ tpl_insert_time_obj(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
     counter->first_to = time_obj;
     counter->next_to = time_obj;
     time_obj->next_to = time_obj->prev_to = NULL;
+#if WITH_TIMEOBJ_WHEEL == YES
+    tpl_wheel_set_last(wheel, slot, time_obj);
+#endif
   }
   else
   {
     /*  The time object queue is not empty
         look for the place to insert the time object                    */
+#if WITH_TIMEOBJ_WHEEL == YES
+    if (slot_last_to == NULL)
+    {
+      /*  the slot is empty, the time object goes after the last
+          time object of the previous non empty slot                    */
+      prev_to = tpl_wheel_last_before(wheel, slot);
+    }
+    else
+    {
+      prev_to = slot_last_to;
+      while ((prev_to != NULL) && (prev_to->date > time_obj->date))
+      {
+        prev_to = prev_to->prev_to;
+      }
+    }
+    if ((slot_last_to == NULL) || (slot_last_to == prev_to))
+    {
+      /*  the time object becomes the last one of its slot             */
+      tpl_wheel_set_last(wheel, slot, time_obj);
+    }
+    if (prev_to != NULL)
+    {
+      current_to = prev_to->next_to;
+    }
+#else
     while ((current_to != NULL) && (current_to->date <= time_obj->date))
     {
       prev_to = current_to;
       current_to = current_to->next_to;
     }
+#endif
 
     time_obj->next_to = current_to;
     time_obj->prev_to = prev_to;
@@ -147,6 +283,16 @@ tpl_remove_time_obj(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA)
   counter = time_obj->stat_part->counter;
 
+#if WITH_TIMEOBJ_WHEEL == YES
+  /*  adjust the slot of the wheel if the
+      removed alarm is the last of its slot   */
+  CONST(uint32, AUTOMATIC) slot = TPL_WHEEL_SLOT(counter, time_obj->date);
+  if (counter->wheel->last_to[slot] == time_obj)
+  {
+    tpl_wheel_remove_last(counter, slot, time_obj->prev_to);
+  }
+#endif
+
   /*  adjust the head of the queue if the
       removed alarm is at the head            */
   if (time_obj == counter->first_to)
@@ -258,6 +404,17 @@ STATIC FUNC(P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA), OS_CODE)
       af_to->prev_to = t_obj;
     }
 
+#if WITH_TIMEOBJ_WHEEL == YES
+    /*  if the next object is not in the same slot of the wheel, the
+        last object of the slot was in the chain and it is now the
+        object before the chain, if any.                            */
+    if ((af_to == NULL) ||
+        (TPL_WHEEL_SLOT(counter, af_to->date) != TPL_WHEEL_SLOT(counter, date)))
+    {
+      tpl_wheel_remove_last(counter, TPL_WHEEL_SLOT(counter, date), t_obj);
+    }
+#endif
+
     /*  if first_to is also the first_to of the queue, update the
         first_to of the counter                     */
     if (counter->first_to == first_to)
@@ -425,8 +582,12 @@ tpl_time_before_next_tick(P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
     return -1; /* FIXME : 0 is a possible value */
 
   /* FIXME : Ternaire ? */
+  /* a time object at the current date (SetAbsAlarm with start equal to
+     the counter value) expires when the counter reaches this date again,
+     after a full cycle, like with tpl_counter_tick. The result is at
+     least 1, so the callers never see 0 and never subtract 1 from 0. */
   date = counter->next_to->date;
-  if (date < counter->current_date)
+  if (date <= counter->current_date)
   {
     date += counter->max_allowed_value + 1;
   }
@@ -436,32 +597,66 @@ tpl_time_before_next_tick(P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
          (counter->ticks_per_base - counter->current_tick);
 }
 
+/*
+ * tpl_increment_counter adds ticks to a counter without processing the
+ * time objects. The caller ensures no time object expires in between.
+ */
 FUNC(void, OS_CODE)
 tpl_increment_counter(P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
                       VAR(tpl_tick, AUTOMATIC) ticks)
 {
+  VAR(tpl_tick, AUTOMATIC) dates;
   VAR(tpl_tick, AUTOMATIC) date;
-  VAR(tpl_tick, AUTOMATIC) i;
 
   if (tpl_counters_enabled)
   {
-    /* FIXME Should be done without a for */
-    for (i = 0; i < ticks; i++)
+    /*  split the ticks in a number of dates and the remaining ticks  */
+    ticks += counter->current_tick;
+    dates = ticks / counter->ticks_per_base;
+    counter->current_tick = ticks % counter->ticks_per_base;
+
+    /*  add the dates modulo max_allowed_value + 1                    */
+    if (counter->max_allowed_value != (tpl_tick)-1)
     {
-      /*  inc the current tick value of the counter     */
-      counter->current_tick++;
-      /*  if tickperbase is reached, the counter is inc */
-      if (counter->current_tick == counter->ticks_per_base)
-      {
-        date = counter->current_date;
-        date++;
-        if (date > counter->max_allowed_value)
-        {
-          date = 0;
-        }
-        counter->current_date = date;
-        counter->current_tick = 0;
-      }
+      dates %= counter->max_allowed_value + 1;
+    }
+    date = counter->current_date;
+    if (dates > (counter->max_allowed_value - date))
+    {
+      date = dates - (counter->max_allowed_value - date) - 1;
+    }
+    else
+    {
+      date += dates;
+    }
+    counter->current_date = date;
+  }
+}
+
+/*
+ * tpl_advance_counter adds ticks to a counter and processes the time
+ * objects expiring in between. The counter jumps from an expiry date to
+ * the next one, so the cost does not depend on the number of ticks.
+ */
+FUNC(void, OS_CODE)
+tpl_advance_counter(P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
+                    VAR(tpl_tick, AUTOMATIC) ticks)
+{
+  VAR(tpl_tick, AUTOMATIC) next_tick;
+
+  while (ticks > 0)
+  {
+    next_tick = tpl_time_before_next_tick(counter);
+    if (next_tick > ticks)
+    {
+      tpl_increment_counter(counter, ticks);
+      ticks = 0;
+    }
+    else
+    {
+      tpl_increment_counter(counter, next_tick - 1);
+      tpl_counter_tick(counter);
+      ticks -= next_tick;
     }
   }
 }
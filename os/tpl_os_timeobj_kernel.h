@@ -120,6 +120,25 @@ struct TPL_TIME_OBJ {
  */
 typedef struct TPL_TIME_OBJ tpl_time_obj;
 
+#if WITH_TIMEOBJ_WHEEL == YES
+/**
+ * @typedef tpl_timeobj_wheel
+ *
+ * This is the wheel indexing the time object list of a counter. The dates
+ * of the counter are divided in TIMEOBJ_WHEEL_SLOTS consecutive ranges
+ * (slots) and last_to gives, for each slot, the last time object of the
+ * list with a date in the range. Bit n of bitmap word w is set when slot
+ * 32 * w + n is not empty and bit w of summary is set when bitmap word w
+ * is not 0.
+ */
+typedef struct
+{
+  VAR(uint32, TYPEDEF) summary;
+  VAR(uint32, TYPEDEF) bitmap[TIMEOBJ_WHEEL_BITMAP_WORDS];
+  P2VAR(tpl_time_obj, TYPEDEF, OS_APPL_DATA) last_to[TIMEOBJ_WHEEL_SLOTS];
+} tpl_timeobj_wheel;
+#endif
+
 /**
  * @struct TPL_COUNTER
  *
@@ -152,6 +171,13 @@ struct TPL_COUNTER {
     first_to;           /**< active time object list head                     */
   P2VAR(tpl_time_obj, TYPEDEF, OS_APPL_DATA)
     next_to;            /**< next active time object                          */
+#if WITH_TIMEOBJ_WHEEL == YES
+  P2VAR(tpl_timeobj_wheel, TYPEDEF, OS_APPL_DATA)
+    wheel;              /**< wheel indexing the active time object list       */
+  CONST(uint8, TYPEDEF)
+    wheel_shift;        /**< a date is shifted right by wheel_shift to get
+                             its slot in the wheel                            */
+#endif
 };
 
 /**
@@ -188,7 +214,8 @@ FUNC(void, OS_CODE) tpl_enable_counters(void);
  *
  * The time object list of a counter is a double-linked list
  * and a time object is inserted starting from the
- * head of the list
+ * head of the list. When the time object wheel is used, the search
+ * starts from the last time object of the slot of the date instead.
  *
  * @param time_obj  The time object to insert.
  */
@@ -228,6 +255,20 @@ FUNC(void, OS_CODE) tpl_increment_counter(
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
   VAR(tpl_tick, AUTOMATIC) ticks);
 
+/**
+ * @internal
+ *
+ * tpl_advance_counter adds ticks to a counter in one step and processes
+ * the time objects expiring in between, like ticks calls to
+ * tpl_counter_tick would do.
+ *
+ * @param counter    A pointer to the counter
+ * @param ticks      The number of ticks to add
+ */
+FUNC(void, OS_CODE) tpl_advance_counter(
+  P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter,
+  VAR(tpl_tick, AUTOMATIC) ticks);
+
 extern FUNC(void, OS_CODE) tpl_enable_sharedsource(
   VAR(uint16, OS_APPL_DATA) core_id);
 extern FUNC(void, OS_CODE) tpl_update_counters(
@@ -236,17 +277,21 @@ extern FUNC(void, OS_CODE) tpl_update_counters(
 # if NUMBER_OF_CORES == 1
 #  define TPL_ENABLE_SHAREDSOURCE(a_time_obj) tpl_enable_sharedsource(0)
 #  define TPL_UPDATE_COUNTERS(a_time_obj) tpl_update_counters(0)
+#  define TPL_UPDATE_COUNTER(a_counter) tpl_update_counters(0)
 # else /* NUMBER_OF_CORES > 1 */
 extern VAR(tpl_core_id, OS_VAR) tpl_core_id_for_app[APP_COUNT];
 #  define TPL_ENABLE_SHAREDSOURCE(a_time_obj)                                  \
-   tpl_enable_sharedsource(tpl_core_id_for_app[a_time_obj->stat_part->app_id])
+   tpl_enable_sharedsource(tpl_core_id_for_app[(a_time_obj)->stat_part->app_id])
 #  define TPL_UPDATE_COUNTERS(a_time_obj)                                      \
-   tpl_update_counters(tpl_core_id_for_app[a_time_obj->stat_part->app_id])
+   tpl_update_counters(tpl_core_id_for_app[(a_time_obj)->stat_part->app_id])
+#  define TPL_UPDATE_COUNTER(a_counter)                                        \
+   tpl_update_counters(tpl_core_id_for_app[(a_counter)->app_id])
 # endif /* NUMBER_OF_CORES */
 
 #else /* TPL_OPTIMIZE_TICS == NO */
 # define TPL_ENABLE_SHAREDSOURCE(a_time_obj)
 # define TPL_UPDATE_COUNTERS(a_time_obj)
+# define TPL_UPDATE_COUNTER(a_counter)
 #endif
 
 #define OS_STOP_SEC_CODE
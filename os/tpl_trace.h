@@ -61,6 +61,9 @@ typedef uint8 tpl_trace_resource_state;
 #define EVENT_SET_KIND            0
 #define EVENT_RESET_KIND          1
 
+#define IOC_SEND_KIND             0
+#define IOC_RECEIVE_KIND          1
+
 /* define the trace output types */
 #if WITH_TRACE == YES
      /**
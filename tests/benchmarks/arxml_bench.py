@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+# ARXML parsing benchmark.
+#
+# For each size of the sweep, this script:
+# - generates an arxml file in a build directory (build/arxml_<size>MB)
+#   from the blink_2c_arxml example, with a filler AR-PACKAGE of software
+#   components and interfaces that is not used by goil, as in the arxml
+#   files exported by the AUTOSAR tools;
+# - runs goil on this file with the streaming reader and with the legacy
+#   parser (--arxmlLegacyParser), and measures the wall time and the peak
+#   resident memory of goil.
+# All the results are written as a JSON list (stdout by default), so that
+# runs can be compared across sizes and revisions.
+
+import argparse
+import json
+import os
+import sys
+import time
+from os.path import abspath, dirname, getsize, join
+
+scriptDir = dirname(abspath(__file__))
+trampolineDir = abspath(join(scriptDir, '..', '..'))
+exampleDir = join(trampolineDir, 'examples', 'ppc', 'multicore', 'blink_2c_arxml')
+
+parsers = ['streaming', 'legacy']
+
+fillerComponent = '''        <APPLICATION-SW-COMPONENT-TYPE>
+          <SHORT-NAME>FillerComponent_{index}</SHORT-NAME>
+          <DESC>
+            <L-2 L="EN">Filler component {index}, not used by goil &amp; skipped by the reader</L-2>
+          </DESC>
+          <PORTS>
+            <P-PORT-PROTOTYPE>
+              <SHORT-NAME>FillerPort_{index}</SHORT-NAME>
+            </P-PORT-PROTOTYPE>
+          </PORTS>
+        </APPLICATION-SW-COMPONENT-TYPE>
+        <SENDER-RECEIVER-INTERFACE>
+          <SHORT-NAME>FillerInterface_{index}</SHORT-NAME>
+          <DATA-ELEMENTS>
+            <VARIABLE-DATA-PROTOTYPE>
+              <SHORT-NAME>FillerData_{index}</SHORT-NAME>
+            </VARIABLE-DATA-PROTOTYPE>
+          </DATA-ELEMENTS>
+        </SENDER-RECEIVER-INTERFACE>
+'''
+
+def generateArxml(buildDir, size):
+    ''' write blink.arxml in buildDir, with a filler package inserted before
+        the packages of the example, so that the file is about size MB.
+    '''
+    with open(join(exampleDir, 'blink.arxml')) as exampleFile:
+        example = exampleFile.read()
+    packagesStart = example.index('<AR-PACKAGES>') + len('<AR-PACKAGES>\n')
+    target = size * 1024 * 1024 - len(example)
+    with open(join(buildDir, 'blink.arxml'), 'w') as arxml:
+        arxml.write(example[:packagesStart])
+        arxml.write('    <AR-PACKAGE>\n      <SHORT-NAME>Filler</SHORT-NAME>\n      <ELEMENTS>\n')
+        written = 0
+        index = 0
+        while written < target:
+            element = fillerComponent.format(index = index)
+            arxml.write(element)
+            written += len(element)
+            index += 1
+        arxml.write('      </ELEMENTS>\n    </AR-PACKAGE>\n')
+        arxml.write(example[packagesStart:])
+
+def runGoil(buildDir, parser, target, goil, verbose):
+    ''' returns the wall time in s and the peak resident memory in kB of
+        goil, or None
+    '''
+    templates = join(trampolineDir, 'goil', 'templates')
+    command = [goil, '--target=' + target, '--templates=' + templates, 'blink.arxml']
+    if parser == 'legacy':
+        command.append('--arxmlLegacyParser')
+    start = time.perf_counter()
+    pid = os.fork()
+    if pid == 0:
+        os.chdir(buildDir)
+        if not verbose:
+            devnull = os.open(os.devnull, os.O_WRONLY)
+            os.dup2(devnull, 1)
+            os.dup2(devnull, 2)
+        try:
+            os.execvp(command[0], command)
+        finally:
+            os._exit(127)
+    _, status, usage = os.wait4(pid, 0)
+    wallTime = time.perf_counter() - start
+    if not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0:
+        print('{0} failed in {1}'.format(' '.join(command), buildDir), file=sys.stderr)
+        return None
+    # ru_maxrss is in bytes on macOS and in kB on linux
+    peakMemory = usage.ru_maxrss // 1024 if sys.platform == 'darwin' else usage.ru_maxrss
+    return wallTime, peakMemory
+
+def intList(arg):
+    return [int(value) for value in arg.split(',')]
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Time the parsing of large arxml files by goil.')
+    parser.add_argument('-s', '--sizes', type=intList, default=[4, 16, 64],
+                        help='comma separated sizes of the arxml files, in MB (default: 4,16,64)')
+    parser.add_argument('-p', '--parsers', type=lambda arg: arg.split(','), default=parsers,
+                        help='comma separated list of parsers among {0} (default: all)'.format(', '.join(parsers)))
+    parser.add_argument('-r', '--runs', type=int, default=3,
+                        help='number of runs, the best one is kept (default: %(default)s)')
+    parser.add_argument('-o', '--output', type=str, default=None,
+                        help='JSON output file (default: stdout)')
+    parser.add_argument('--target', type=str, default='ppc/mpc5643l/multicore',
+                        help='goil target (default: %(default)s)')
+    parser.add_argument('--goil', type=str, default='goil',
+                        help='goil executable (default: %(default)s)')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='show goil outputs')
+    args = parser.parse_args()
+
+    results = []
+    for size in args.sizes:
+        buildDir = join(scriptDir, 'build', 'arxml_{0}MB'.format(size))
+        os.makedirs(buildDir, exist_ok=True)
+        generateArxml(buildDir, size)
+        fileSize = getsize(join(buildDir, 'blink.arxml'))
+        for parserName in args.parsers:
+            if parserName not in parsers:
+                print('unknown parser ' + parserName, file=sys.stderr)
+                sys.exit(1)
+            measures = [runGoil(buildDir, parserName, args.target, args.goil, args.verbose)
+                        for run in range(args.runs)]
+            if None in measures:
+                continue
+            wallTime = min(measure[0] for measure in measures)
+            results.append({
+                'parser': parserName,
+                'file_size': fileSize,
+                'runs': args.runs,
+                'wall_time_s': round(wallTime, 3),
+                'throughput_MBps': round(fileSize / (1024 * 1024) / wallTime, 2),
+                'peak_rss_kB': max(measure[1] for measure in measures)
+            })
+            print('{0} MB, {1} parser: done'.format(size, parserName), file=sys.stderr)
+
+    if args.output:
+        with open(args.output, 'w') as outputFile:
+            json.dump(results, outputFile, indent=2)
+    else:
+        json.dump(results, sys.stdout, indent=2)
+        print()
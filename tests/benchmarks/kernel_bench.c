@@ -0,0 +1,389 @@
+/*
+ * Kernel services benchmark.
+ *
+ * This application is built by kernel_bench.py for each configuration of
+ * the sweep (see README.md). The configuration is in kernel_bench_config.h,
+ * generated with the oil file:
+ * - BENCH_SUITE_AUTOSAR / BENCH_SUITE_COM: services of the suite are timed
+ *   in addition to the OSEK ones;
+ * - FILLER_COUNT filler tasks spread on PRIORITY_LEVELS priority levels,
+ *   listed by FILLER_TASKS. Their bodies are in kernel_bench_config.h too;
+ * - BENCH_ROUNDS: number of rounds.
+ *
+ * In each round, the bench task activates all the filler tasks, which have
+ * a lower priority, so that FILLER_COUNT jobs are in the ready list while
+ * the other services are timed. Then the drain task, which has the lowest
+ * priority, runs after the fillers and starts the next round. After the
+ * last round, ChainTask is timed by two tasks chaining each other.
+ *
+ * Costs are in cycles on x86 (rdtsc), in ticks of the virtual counter on
+ * aarch64 and in nanoseconds elsewhere. The results are printed on stdout
+ * as a JSON object on a single line.
+ */
+#include <signal.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "tpl_os.h"
+#include "kernel_bench_config.h"
+#if BENCH_SUITE_AUTOSAR == 1
+#include "Os.h" /* IOC API */
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_UNIT "cycles"
+#elif defined(__aarch64__)
+#define BENCH_UNIT "ticks"
+#else
+#define BENCH_UNIT "ns"
+#endif
+
+/* number of IOC messages sent, then received, in a round */
+#define IOC_BATCH 16
+
+static uint64_t bench_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/*
+ * Statistics of a timed service
+ */
+typedef struct
+{
+  const char *name;
+  uint64_t count;
+  uint64_t total;
+  uint64_t min;
+  uint64_t max;
+} bench_stat;
+
+enum
+{
+  STAT_ACTIVATE,
+  STAT_ACTIVATE_SWITCH,
+  STAT_TERMINATE_SWITCH,
+  STAT_CHAIN,
+  STAT_EVENT_ROUND_TRIP,
+  STAT_RESOURCE,
+  STAT_SET_REL_ALARM,
+  STAT_CANCEL_ALARM,
+  STAT_ISR2_ENTRY,
+#if BENCH_SUITE_AUTOSAR == 1
+  STAT_INCREMENT_COUNTER,
+  STAT_IOC_SEND,
+  STAT_IOC_RECEIVE,
+  STAT_IOC_SEND_N,
+  STAT_IOC_RECEIVE_N,
+#endif
+#if BENCH_SUITE_COM == 1
+  STAT_SEND_MESSAGE,
+  STAT_RECEIVE_MESSAGE,
+  STAT_SEND_FAN_OUT,
+  STAT_SEND_FAN_OUT_ZERO_COPY,
+  STAT_RECEIVE_ZERO_COPY,
+#endif
+  STAT_COUNT
+};
+
+static bench_stat stats[STAT_COUNT] = {
+  [STAT_ACTIVATE]         = {"ActivateTask", 0, 0, UINT64_MAX, 0},
+  [STAT_ACTIVATE_SWITCH]  = {"ActivateTask+switch", 0, 0, UINT64_MAX, 0},
+  [STAT_TERMINATE_SWITCH] = {"TerminateTask+switch", 0, 0, UINT64_MAX, 0},
+  [STAT_CHAIN]            = {"ChainTask", 0, 0, UINT64_MAX, 0},
+  [STAT_EVENT_ROUND_TRIP] = {"SetEvent+WaitEvent", 0, 0, UINT64_MAX, 0},
+  [STAT_RESOURCE]         = {"GetResource+ReleaseResource", 0, 0, UINT64_MAX, 0},
+  [STAT_SET_REL_ALARM]    = {"SetRelAlarm", 0, 0, UINT64_MAX, 0},
+  [STAT_CANCEL_ALARM]     = {"CancelAlarm", 0, 0, UINT64_MAX, 0},
+  [STAT_ISR2_ENTRY]       = {"ISR2 entry", 0, 0, UINT64_MAX, 0},
+#if BENCH_SUITE_AUTOSAR == 1
+  [STAT_INCREMENT_COUNTER] = {"IncrementCounter", 0, 0, UINT64_MAX, 0},
+  [STAT_IOC_SEND]          = {"IocSend", 0, 0, UINT64_MAX, 0},
+  [STAT_IOC_RECEIVE]       = {"IocReceive", 0, 0, UINT64_MAX, 0},
+  [STAT_IOC_SEND_N]        = {"IocSendN", 0, 0, UINT64_MAX, 0},
+  [STAT_IOC_RECEIVE_N]     = {"IocReceiveN", 0, 0, UINT64_MAX, 0},
+#endif
+#if BENCH_SUITE_COM == 1
+  [STAT_SEND_MESSAGE]    = {"SendMessage", 0, 0, UINT64_MAX, 0},
+  [STAT_RECEIVE_MESSAGE] = {"ReceiveMessage", 0, 0, UINT64_MAX, 0},
+  [STAT_SEND_FAN_OUT]    = {"SendMessage fan-out", 0, 0, UINT64_MAX, 0},
+  [STAT_SEND_FAN_OUT_ZERO_COPY] = {"SendMessage fan-out zero copy", 0, 0, UINT64_MAX, 0},
+  [STAT_RECEIVE_ZERO_COPY] = {"ReceiveMessage zero copy", 0, 0, UINT64_MAX, 0},
+#endif
+};
+
+static void bench_record(int stat, uint64_t cost)
+{
+  stats[stat].count++;
+  stats[stat].total += cost;
+  if (cost < stats[stat].min)
+  {
+    stats[stat].min = cost;
+  }
+  if (cost > stats[stat].max)
+  {
+    stats[stat].max = cost;
+  }
+}
+
+static void bench_report(void)
+{
+  int stat;
+
+  printf("{\"suite\": \"%s\", \"tasks\": %d, \"priority_levels\": %d, "
+         "\"rounds\": %d, \"unit\": \"%s\", \"services\": {",
+         BENCH_SUITE_NAME, FILLER_COUNT, PRIORITY_LEVELS, BENCH_ROUNDS,
+         BENCH_UNIT);
+  for (stat = 0; stat < STAT_COUNT; stat++)
+  {
+    printf("%s\"%s\": {\"count\": %llu, \"mean\": %llu, \"min\": %llu, "
+           "\"max\": %llu}",
+           (stat == 0) ? "" : ", ", stats[stat].name,
+           (unsigned long long)stats[stat].count,
+           (unsigned long long)(stats[stat].count ?
+                                stats[stat].total / stats[stat].count : 0),
+           (unsigned long long)(stats[stat].count ? stats[stat].min : 0),
+           (unsigned long long)stats[stat].max);
+  }
+  printf("}}\n");
+  fflush(stdout);
+}
+
+DeclareTask(bench);
+DeclareTask(hi);
+DeclareTask(pong);
+DeclareTask(chain_a);
+DeclareTask(chain_b);
+DeclareTask(drain);
+DeclareEvent(wake);
+DeclareResource(bench_resource);
+DeclareAlarm(bench_alarm);
+#if BENCH_SUITE_AUTOSAR == 1
+DeclareTask(ioc_receiver);
+DeclareCounter(bench_counter);
+#endif
+
+static unsigned int round_count = 0;
+static unsigned int chain_count = 0;
+static volatile uint64_t hi_start;
+static volatile uint64_t hi_end;
+static volatile uint64_t isr_start;
+static uint64_t chain_start;
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(bench)
+{
+  /* task ids are constant objects, not constant expressions */
+  const TaskType fillers[FILLER_COUNT] = { FILLER_TASKS };
+  int filler;
+  uint64_t start;
+#if BENCH_SUITE_AUTOSAR == 1
+  int message;
+  uint32 batch[IOC_BATCH];
+  uint32 count;
+#endif
+#if BENCH_SUITE_COM == 1
+  uint32_t data = round_count;
+  uint64_t wide = round_count;
+#endif
+
+  /* populate the ready list */
+  for (filler = 0; filler < FILLER_COUNT; filler++)
+  {
+    start = bench_now();
+    ActivateTask(fillers[filler]);
+    bench_record(STAT_ACTIVATE, bench_now() - start);
+  }
+
+  /* activation of a higher priority task and back */
+  start = bench_now();
+  ActivateTask(hi);
+  bench_record(STAT_ACTIVATE_SWITCH, hi_start - start);
+  bench_record(STAT_TERMINATE_SWITCH, bench_now() - hi_end);
+
+  /* pong has a higher priority and waits for the wake event */
+  start = bench_now();
+  SetEvent(pong, wake);
+  bench_record(STAT_EVENT_ROUND_TRIP, bench_now() - start);
+
+  start = bench_now();
+  GetResource(bench_resource);
+  ReleaseResource(bench_resource);
+  bench_record(STAT_RESOURCE, bench_now() - start);
+
+  start = bench_now();
+  SetRelAlarm(bench_alarm, 1000, 0);
+  bench_record(STAT_SET_REL_ALARM, bench_now() - start);
+  start = bench_now();
+  CancelAlarm(bench_alarm);
+  bench_record(STAT_CANCEL_ALARM, bench_now() - start);
+
+  /* the signal is delivered before raise returns */
+  start = bench_now();
+  raise(SIGPIPE);
+  bench_record(STAT_ISR2_ENTRY, isr_start - start);
+
+#if BENCH_SUITE_AUTOSAR == 1
+  start = bench_now();
+  IncrementCounter(bench_counter);
+  bench_record(STAT_INCREMENT_COUNTER, bench_now() - start);
+
+  for (message = 0; message < IOC_BATCH; message++)
+  {
+    start = bench_now();
+    IocSend_bench_ioc((uint32)message);
+    bench_record(STAT_IOC_SEND, bench_now() - start);
+  }
+  /* ioc_receiver has a higher priority */
+  ActivateTask(ioc_receiver);
+
+  /* the same messages in a single call */
+  for (message = 0; message < IOC_BATCH; message++)
+  {
+    batch[message] = (uint32)message;
+  }
+  count = IOC_BATCH;
+  start = bench_now();
+  IocSendN_bench_ioc(batch, &count);
+  bench_record(STAT_IOC_SEND_N, bench_now() - start);
+  ActivateTask(ioc_receiver);
+#endif
+
+#if BENCH_SUITE_COM == 1
+  start = bench_now();
+  SendMessage(bench_out, &data);
+  bench_record(STAT_SEND_MESSAGE, bench_now() - start);
+  start = bench_now();
+  ReceiveMessage(bench_in, &data);
+  bench_record(STAT_RECEIVE_MESSAGE, bench_now() - start);
+  start = bench_now();
+  SendMessage(bench_fan_out, &wide);
+  bench_record(STAT_SEND_FAN_OUT, bench_now() - start);
+  start = bench_now();
+  SendMessage(bench_zc_out, &wide);
+  bench_record(STAT_SEND_FAN_OUT_ZERO_COPY, bench_now() - start);
+  start = bench_now();
+  ReceiveMessage(bench_zc_in_0, &wide);
+  bench_record(STAT_RECEIVE_ZERO_COPY, bench_now() - start);
+#endif
+
+  ActivateTask(drain);
+  TerminateTask();
+}
+
+TASK(hi)
+{
+  hi_start = bench_now();
+  hi_end = bench_now();
+  TerminateTask();
+}
+
+TASK(pong)
+{
+  while (1)
+  {
+    WaitEvent(wake);
+    ClearEvent(wake);
+  }
+}
+
+ISR(isr_bench)
+{
+  isr_start = bench_now();
+}
+
+#if BENCH_SUITE_AUTOSAR == 1
+/* receives the messages one by one, then in a single call */
+static int ioc_batched = 0;
+
+TASK(ioc_receiver)
+{
+  int message;
+  uint32 data;
+  uint32 batch[IOC_BATCH];
+  uint32 count = IOC_BATCH;
+  uint64_t start;
+
+  if (ioc_batched)
+  {
+    start = bench_now();
+    IocReceiveN_bench_ioc(batch, &count);
+    bench_record(STAT_IOC_RECEIVE_N, bench_now() - start);
+  }
+  else
+  {
+    for (message = 0; message < IOC_BATCH; message++)
+    {
+      start = bench_now();
+      IocReceive_bench_ioc(&data);
+      bench_record(STAT_IOC_RECEIVE, bench_now() - start);
+    }
+  }
+  ioc_batched = !ioc_batched;
+  TerminateTask();
+}
+#endif
+
+/*
+ * The drain task runs when all the fillers are done
+ */
+TASK(drain)
+{
+  round_count++;
+  if (round_count < BENCH_ROUNDS)
+  {
+    ChainTask(bench);
+  }
+  else
+  {
+    chain_start = bench_now();
+    ChainTask(chain_a);
+  }
+  TerminateTask();
+}
+
+static void bench_chain(TaskType next)
+{
+  bench_record(STAT_CHAIN, bench_now() - chain_start);
+  chain_count++;
+  if (chain_count < BENCH_ROUNDS)
+  {
+    chain_start = bench_now();
+    ChainTask(next);
+  }
+  else
+  {
+    bench_report();
+    ShutdownOS(E_OK);
+  }
+}
+
+TASK(chain_a)
+{
+  bench_chain(chain_b);
+  TerminateTask();
+}
+
+TASK(chain_b)
+{
+  bench_chain(chain_a);
+  TerminateTask();
+}
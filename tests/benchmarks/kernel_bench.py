@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+# Kernel services benchmark on the posix target.
+#
+# For each configuration of the sweep (suite, number of filler tasks and
+# number of priority levels), this script:
+# - generates the oil file and kernel_bench_config.h in a build directory
+#   (build/<suite>_t<tasks>_p<levels>);
+# - runs goil and compiles the application kernel_bench.c;
+# - runs it and gets the JSON object it prints.
+# All the results are written as a JSON list (stdout by default), so that
+# runs can be compared across configurations and revisions.
+
+import argparse
+import json
+import os
+import sys
+from os.path import abspath, dirname, join
+from subprocess import run, PIPE, DEVNULL, TimeoutExpired
+
+scriptDir = dirname(abspath(__file__))
+trampolineDir = abspath(join(scriptDir, '..', '..'))
+
+suites = ['osek', 'autosar', 'com']
+
+oilHeader = '''OIL_VERSION = "{oilVersion}";
+
+IMPLEMENTATION trampoline {{
+  TASK {{
+    UINT32 STACKSIZE = 32768 ;
+  }} ;
+  ISR {{
+    UINT32 STACKSIZE = 32768 ;
+  }} ;
+}};
+
+CPU kernel_bench {{
+  OS config {{
+    STATUS = {status};
+    BUILD = TRUE {{
+      APP_SRC = "{appSrc}";
+      TRAMPOLINE_BASE_PATH = "{trampolineDir}";
+      CFLAGS = "-O2 -I{buildDir}";
+      APP_NAME = "kernel_bench_exe";
+      LINKER = "gcc";
+      SYSTEM = PYTHON;
+    }};
+  }};
+
+  APPMODE stdAppmode {{}};
+
+  EVENT wake {{
+    MASK = AUTO;
+  }};
+
+  RESOURCE bench_resource {{
+    RESOURCEPROPERTY = STANDARD;
+  }};
+
+  ALARM bench_alarm {{
+    COUNTER = {alarmCounter};
+    ACTION = ACTIVATETASK {{ TASK = hi; }};
+    AUTOSTART = FALSE;
+  }};
+
+  ISR isr_bench {{
+    SOURCE = SIGPIPE;
+    CATEGORY = 2;
+    PRIORITY = 1;
+  }};
+
+  TASK drain {{
+    PRIORITY = 1;
+    AUTOSTART = FALSE;
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+  }};
+
+  TASK chain_a {{
+    PRIORITY = {chainPriority};
+    AUTOSTART = FALSE;
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+  }};
+
+  TASK chain_b {{
+    PRIORITY = {chainPriority};
+    AUTOSTART = FALSE;
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+  }};
+
+  TASK bench {{
+    PRIORITY = {benchPriority};
+    AUTOSTART = TRUE {{ APPMODE = stdAppmode; }};
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+    RESOURCE = bench_resource;
+  }};
+
+  TASK hi {{
+    PRIORITY = {hiPriority};
+    AUTOSTART = FALSE;
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+  }};
+
+  TASK pong {{
+    PRIORITY = {hiPriority};
+    AUTOSTART = TRUE {{ APPMODE = stdAppmode; }};
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+    EVENT = wake;
+  }};
+'''
+
+oilFiller = '''
+  TASK filler_{index} {{
+    PRIORITY = {priority};
+    AUTOSTART = FALSE;
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+  }};
+'''
+
+oilAutosar = '''
+  APPLICATION bench_application {{
+    TRUSTED = TRUE;
+    TASK = drain;
+    TASK = chain_a;
+    TASK = chain_b;
+    TASK = bench;
+    TASK = hi;
+    TASK = pong;
+{fillerTasks}    ISR = isr_bench;
+    ALARM = bench_alarm;
+    RESOURCE = bench_resource;
+    COUNTER = bench_counter;
+  }};
+
+  APPLICATION ioc_application {{
+    TASK = ioc_receiver;
+  }};
+
+  COUNTER bench_counter {{
+    MAXALLOWEDVALUE = 65535;
+    TICKSPERBASE = 1;
+    MINCYCLE = 1;
+    TYPE = SOFTWARE;
+  }};
+
+  TASK ioc_receiver {{
+    PRIORITY = {hiPriority};
+    AUTOSTART = FALSE;
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+    ACCESSING_APPLICATION = bench_application;
+  }};
+
+  IOC bench_ioc {{
+    DATATYPENAME uint32 {{
+      DATATYPEPROPERTY = DATA;
+    }};
+    SEMANTICS = QUEUED {{
+      BUFFER_LENGTH = 16;
+    }};
+    RECEIVER rcv {{
+      RCV_OSAPPLICATION = ioc_application;
+    }};
+    SENDER snd {{
+      SND_OSAPPLICATION = bench_application;
+    }};
+  }};
+'''
+
+oilCom = '''
+  MESSAGE bench_out {
+    MESSAGEPROPERTY = SEND_STATIC_INTERNAL {
+      CDATATYPE = "uint32_t";
+    };
+  };
+
+  MESSAGE bench_in {
+    MESSAGEPROPERTY = RECEIVE_UNQUEUED_INTERNAL {
+      SENDINGMESSAGE = bench_out;
+      INITIALVALUE = 0;
+    };
+  };
+
+  MESSAGE bench_fan_out {
+    MESSAGEPROPERTY = SEND_STATIC_INTERNAL {
+      CDATATYPE = "uint64_t";
+    };
+  };
+
+  MESSAGE bench_zc_out {
+    MESSAGEPROPERTY = SEND_STATIC_INTERNAL {
+      CDATATYPE = "uint64_t";
+      ZERO_COPY = TRUE;
+    };
+  };
+''' + ''.join('''
+  MESSAGE bench_{0}_in_{1} {{
+    MESSAGEPROPERTY = RECEIVE_UNQUEUED_INTERNAL {{
+      SENDINGMESSAGE = bench_{0}_out;
+      INITIALVALUE = 0;
+    }};
+  }};
+'''.format(sender, index) for sender in ('fan', 'zc') for index in range(4))
+
+def generateConfig(buildDir, suite, tasks, levels, rounds):
+    ''' write the oil file and kernel_bench_config.h in buildDir.
+        The fillers get priorities 2 to levels+1, round robin. In the
+        autosar suite, the alarm is driven by the software counter, which
+        belongs to the application of the bench task.
+    '''
+    fillerPriority = lambda index: 2 + index % levels
+    oil = oilHeader.format(
+        oilVersion = '4.0' if suite == 'autosar' else '2.5',
+        status = 'EXTENDED' if suite == 'autosar' else 'STANDARD',
+        appSrc = join(scriptDir, 'kernel_bench.c'),
+        trampolineDir = trampolineDir,
+        buildDir = buildDir,
+        alarmCounter = 'bench_counter' if suite == 'autosar' else 'SystemCounter',
+        chainPriority = levels + 2,
+        benchPriority = levels + 3,
+        hiPriority = levels + 4)
+    for index in range(tasks):
+        oil += oilFiller.format(index = index, priority = fillerPriority(index))
+    if suite == 'autosar':
+        oil += oilAutosar.format(
+            fillerTasks = ''.join('    TASK = filler_{0};\n'.format(i) for i in range(tasks)),
+            hiPriority = levels + 4)
+    elif suite == 'com':
+        oil += oilCom
+    oil += '};\n'
+    with open(join(buildDir, 'kernel_bench.oil'), 'w') as oilFile:
+        oilFile.write(oil)
+
+    with open(join(buildDir, 'kernel_bench_config.h'), 'w') as header:
+        header.write('/* Generated by kernel_bench.py, do not edit */\n')
+        header.write('#define BENCH_SUITE_NAME    "{0}"\n'.format(suite))
+        header.write('#define BENCH_SUITE_AUTOSAR {0}\n'.format(1 if suite == 'autosar' else 0))
+        header.write('#define BENCH_SUITE_COM     {0}\n'.format(1 if suite == 'com' else 0))
+        header.write('#define BENCH_ROUNDS        {0}\n'.format(rounds))
+        header.write('#define FILLER_COUNT        {0}\n'.format(tasks))
+        header.write('#define PRIORITY_LEVELS     {0}\n'.format(levels))
+        for index in range(tasks):
+            header.write('DeclareTask(filler_{0});\n'.format(index))
+        header.write('#define FILLER_TASKS ' +
+                     ', '.join('filler_{0}'.format(i) for i in range(tasks)) + '\n')
+        # the filler tasks only terminate
+        for index in range(tasks):
+            header.write('TASK(filler_{0}) {{ TerminateTask(); }}\n'.format(index))
+
+def buildAndRun(buildDir, target, goil, timeout, verbose):
+    ''' returns the JSON object printed by the benchmark, or None '''
+    output = None if verbose else DEVNULL
+    templates = join(trampolineDir, 'goil', 'templates')
+    steps = [[goil, '--target=' + target, '--templates=' + templates, 'kernel_bench.oil'],
+             ['./make.py']]
+    for step in steps:
+        if run(step, cwd=buildDir, stdout=output, stderr=output).returncode != 0:
+            print('{0} failed in {1}'.format(' '.join(step), buildDir), file=sys.stderr)
+            return None
+    try:
+        result = run(['./kernel_bench_exe'], cwd=buildDir, stdout=PIPE,
+                     stderr=output, timeout=timeout, universal_newlines=True)
+    except TimeoutExpired:
+        print('timeout in {0}'.format(buildDir), file=sys.stderr)
+        return None
+    for line in result.stdout.splitlines():
+        if line.startswith('{'):
+            return json.loads(line)
+    print('no result in {0}'.format(buildDir), file=sys.stderr)
+    return None
+
+def intList(arg):
+    return [int(value) for value in arg.split(',')]
+
+if __name__ == '__main__':
+    defaultTarget = 'posix/darwin' if sys.platform == 'darwin' else 'posix/linux'
+    parser = argparse.ArgumentParser(description='Time the kernel services of Trampoline on the posix target.')
+    parser.add_argument('-s', '--suites', type=lambda arg: arg.split(','), default=suites,
+                        help='comma separated list of suites among {0} (default: all)'.format(', '.join(suites)))
+    parser.add_argument('-t', '--tasks', type=intList, default=[1, 8, 32, 128],
+                        help='comma separated numbers of filler tasks (default: 1,8,32,128)')
+    parser.add_argument('-p', '--priorities', type=intList, default=[1, 4, 16],
+                        help='comma separated numbers of priority levels of the fillers (default: 1,4,16)')
+    parser.add_argument('-r', '--rounds', type=int, default=1000,
+                        help='number of rounds (default: %(default)s)')
+    parser.add_argument('-o', '--output', type=str, default=None,
+                        help='JSON output file (default: stdout)')
+    parser.add_argument('--target', type=str, default=defaultTarget,
+                        help='goil target (default: %(default)s)')
+    parser.add_argument('--goil', type=str, default='goil',
+                        help='goil executable (default: %(default)s)')
+    parser.add_argument('--timeout', type=int, default=60,
+                        help='timeout of a run, in seconds (default: %(default)s)')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='show goil, compilation and run outputs')
+    args = parser.parse_args()
+
+    results = []
+    for suite in args.suites:
+        if suite not in suites:
+            print('unknown suite ' + suite, file=sys.stderr)
+            sys.exit(1)
+        for tasks in args.tasks:
+            for levels in args.priorities:
+                if levels > tasks:
+                    continue
+                buildDir = join(scriptDir, 'build', '{0}_t{1}_p{2}'.format(suite, tasks, levels))
+                os.makedirs(buildDir, exist_ok=True)
+                generateConfig(buildDir, suite, tasks, levels, args.rounds)
+                result = buildAndRun(buildDir, args.target, args.goil, args.timeout, args.verbose)
+                if result is not None:
+                    results.append(result)
+                    print('{0}, {1} tasks, {2} priority levels: done'.format(suite, tasks, levels),
+                          file=sys.stderr)
+
+    if args.output:
+        with open(args.output, 'w') as outputFile:
+            json.dump(results, outputFile, indent=2)
+    else:
+        json.dump(results, sys.stdout, indent=2)
+        print()
@@ -0,0 +1,111 @@
+/*
+ * Multicore start-up benchmark.
+ *
+ * This application is built by startup_bench.py for each number of cores
+ * of the sweep (see README.md). The configuration is in startup_bench_config.h,
+ * generated with the oil file:
+ * - BENCH_CORES: number of cores. Each core has an AUTOSTART task,
+ *   core_<n>, in an OS application located on it;
+ * - CORE_TASKS: the list of these tasks.
+ *
+ * The master core starts the other ones with StartCore, then all the cores
+ * call StartOS. The date of the call of StartOS by the master core, of the
+ * StartupHook of each core (after the first barrier of StartOS) and of the
+ * start of the task of each core (after the second barrier) are recorded.
+ * The task of the master core waits for the other tasks, prints the
+ * results on stdout as a JSON object on a single line and shuts down.
+ *
+ * Dates are read with clock_gettime(CLOCK_MONOTONIC), which is consistent
+ * across the threads that emulate the cores, and are in nanoseconds.
+ */
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "tpl_os.h"
+#include "startup_bench_config.h"
+
+static uint64_t bench_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t start_date;
+static uint64_t hook_date[BENCH_CORES];
+static uint64_t task_date[BENCH_CORES];
+static atomic_int started_tasks;
+
+static void bench_report(void)
+{
+  uint64_t hook_min = hook_date[0], hook_max = hook_date[0];
+  uint64_t task_min = task_date[0], task_max = task_date[0];
+  int core;
+
+  for (core = 1; core < BENCH_CORES; core++)
+  {
+    if (hook_date[core] < hook_min) hook_min = hook_date[core];
+    if (hook_date[core] > hook_max) hook_max = hook_date[core];
+    if (task_date[core] < task_min) task_min = task_date[core];
+    if (task_date[core] > task_max) task_max = task_date[core];
+  }
+  /*
+   * - StartOS: from the call of StartOS by the master core to the start
+   *   of the last task;
+   * - first barrier skew / second barrier skew: time between the first
+   *   and the last core leaving the barrier;
+   * - second barrier: from the last StartupHook to the last task.
+   */
+  printf("{\"cores\": %d, \"unit\": \"ns\", \"phases\": {"
+         "\"StartOS\": %llu, \"first barrier skew\": %llu, "
+         "\"second barrier\": %llu, \"second barrier skew\": %llu}}\n",
+         BENCH_CORES,
+         (unsigned long long)(task_max - start_date),
+         (unsigned long long)(hook_max - hook_min),
+         (unsigned long long)(task_max - hook_max),
+         (unsigned long long)(task_max - task_min));
+  fflush(stdout);
+}
+
+static void bench_task(void)
+{
+  CoreIdType core = GetCoreID();
+
+  task_date[core] = bench_now();
+  atomic_fetch_add(&started_tasks, 1);
+  if (core == OS_CORE_ID_MASTER)
+  {
+    while (atomic_load(&started_tasks) < BENCH_CORES)
+    {
+    }
+    bench_report();
+    ShutdownOS(E_OK);
+  }
+}
+
+/* the task of each core, in startup_bench_config.h */
+#define CORE_TASK(n) TASK(core_##n) { bench_task(); TerminateTask(); }
+CORE_TASKS
+
+FUNC(void, OS_CODE) StartupHook(void)
+{
+  hook_date[GetCoreID()] = bench_now();
+}
+
+int main(void)
+{
+  if (GetCoreID() == OS_CORE_ID_MASTER)
+  {
+    StatusType status;
+    int core;
+
+    for (core = 1; core < BENCH_CORES; core++)
+    {
+      StartCore(OS_CORE_ID_MASTER + core, &status);
+    }
+    start_date = bench_now();
+  }
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
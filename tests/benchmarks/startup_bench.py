@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+# Multicore start-up benchmark on the posix target.
+#
+# For each number of cores of the sweep, this script:
+# - generates the oil file and startup_bench_config.h in a build directory
+#   (build/startup_c<cores>);
+# - runs goil and compiles the application startup_bench.c;
+# - runs it several times, since StartOS can be called once per process,
+#   and gets the JSON object it prints at each run.
+# All the results are written as a JSON list (stdout by default), so that
+# runs can be compared across configurations and revisions.
+
+import argparse
+import json
+import os
+import sys
+from os.path import abspath, dirname, join
+from subprocess import run, PIPE, DEVNULL, TimeoutExpired
+
+scriptDir = dirname(abspath(__file__))
+trampolineDir = abspath(join(scriptDir, '..', '..'))
+
+oilHeader = '''OIL_VERSION = "4.0";
+
+IMPLEMENTATION trampoline {{
+  TASK {{
+    UINT32 STACKSIZE = 32768 ;
+  }} ;
+}};
+
+CPU startup_bench {{
+  OS config {{
+    STATUS = EXTENDED;
+    NUMBER_OF_CORES = {cores};
+    STARTUPHOOK = TRUE;
+    SCALABILITYCLASS = SC1;
+    BUILD = TRUE {{
+      APP_SRC = "{appSrc}";
+      TRAMPOLINE_BASE_PATH = "{trampolineDir}";
+      CFLAGS = "-O2 -I{buildDir}";
+      APP_NAME = "startup_bench_exe";
+      LINKER = "gcc";
+      SYSTEM = PYTHON;
+    }};
+  }};
+
+  APPMODE stdAppmode {{}};
+'''
+
+oilCore = '''
+  APPLICATION core_{index}_application {{
+    CORE = {index};
+    TRUSTED = TRUE;
+    TASK = core_{index};
+  }};
+
+  TASK core_{index} {{
+    PRIORITY = 1;
+    AUTOSTART = TRUE {{ APPMODE = stdAppmode; }};
+    ACTIVATION = 1;
+    SCHEDULE = FULL;
+  }};
+'''
+
+def generateConfig(buildDir, cores):
+    ''' write the oil file and startup_bench_config.h in buildDir.
+        Each core gets an OS application with an AUTOSTART task. The
+        applications are trusted so that ShutdownOS is allowed.
+    '''
+    oil = oilHeader.format(
+        cores = cores,
+        appSrc = join(scriptDir, 'startup_bench.c'),
+        trampolineDir = trampolineDir,
+        buildDir = buildDir)
+    for index in range(cores):
+        oil += oilCore.format(index = index)
+    oil += '};\n'
+    with open(join(buildDir, 'startup_bench.oil'), 'w') as oilFile:
+        oilFile.write(oil)
+
+    with open(join(buildDir, 'startup_bench_config.h'), 'w') as header:
+        header.write('/* Generated by startup_bench.py, do not edit */\n')
+        header.write('#define BENCH_CORES {0}\n'.format(cores))
+        for index in range(cores):
+            header.write('DeclareTask(core_{0});\n'.format(index))
+        header.write('#define CORE_TASKS ' +
+                     ' '.join('CORE_TASK({0})'.format(i) for i in range(cores)) + '\n')
+
+def build(buildDir, target, goil, verbose):
+    ''' returns True if goil and the compilation succeed '''
+    output = None if verbose else DEVNULL
+    templates = join(trampolineDir, 'goil', 'templates')
+    steps = [[goil, '--target=' + target, '--templates=' + templates, 'startup_bench.oil'],
+             ['./make.py']]
+    for step in steps:
+        if run(step, cwd=buildDir, stdout=output, stderr=output).returncode != 0:
+            print('{0} failed in {1}'.format(' '.join(step), buildDir), file=sys.stderr)
+            return False
+    return True
+
+def runOnce(buildDir, timeout, verbose):
+    ''' returns the JSON object printed by the benchmark, or None '''
+    output = None if verbose else DEVNULL
+    try:
+        result = run(['./startup_bench_exe'], cwd=buildDir, stdout=PIPE,
+                     stderr=output, timeout=timeout, universal_newlines=True)
+    except TimeoutExpired:
+        print('timeout in {0}'.format(buildDir), file=sys.stderr)
+        return None
+    for line in result.stdout.splitlines():
+        if line.startswith('{'):
+            return json.loads(line)
+    print('no result in {0}'.format(buildDir), file=sys.stderr)
+    return None
+
+def summarize(cores, samples):
+    ''' count, mean, min and max of each phase over the runs '''
+    phases = {}
+    for name in samples[0]['phases']:
+        values = [sample['phases'][name] for sample in samples]
+        phases[name] = {'count': len(values), 'mean': sum(values) // len(values),
+                        'min': min(values), 'max': max(values)}
+    return {'cores': cores, 'runs': len(samples), 'unit': samples[0]['unit'],
+            'phases': phases}
+
+def intList(arg):
+    return [int(value) for value in arg.split(',')]
+
+if __name__ == '__main__':
+    defaultTarget = 'posix/darwin' if sys.platform == 'darwin' else 'posix/linux'
+    parser = argparse.ArgumentParser(description='Time the start-up of Trampoline on several cores of the posix target.')
+    parser.add_argument('-c', '--cores', type=intList, default=[2, 4, 8],
+                        help='comma separated numbers of cores (default: 2,4,8)')
+    parser.add_argument('-r', '--runs', type=int, default=20,
+                        help='number of runs of each configuration (default: %(default)s)')
+    parser.add_argument('-o', '--output', type=str, default=None,
+                        help='JSON output file (default: stdout)')
+    parser.add_argument('--target', type=str, default=defaultTarget,
+                        help='goil target (default: %(default)s)')
+    parser.add_argument('--goil', type=str, default='goil',
+                        help='goil executable (default: %(default)s)')
+    parser.add_argument('--timeout', type=int, default=60,
+                        help='timeout of a run, in seconds (default: %(default)s)')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='show goil, compilation and run outputs')
+    args = parser.parse_args()
+
+    results = []
+    for cores in args.cores:
+        if cores < 2:
+            print('at least 2 cores are needed', file=sys.stderr)
+            sys.exit(1)
+        buildDir = join(scriptDir, 'build', 'startup_c{0}'.format(cores))
+        os.makedirs(buildDir, exist_ok=True)
+        generateConfig(buildDir, cores)
+        if not build(buildDir, args.target, args.goil, args.verbose):
+            continue
+        samples = []
+        for _ in range(args.runs):
+            sample = runOnce(buildDir, args.timeout, args.verbose)
+            if sample is not None:
+                samples.append(sample)
+        if samples:
+            results.append(summarize(cores, samples))
+            print('{0} cores: done'.format(cores), file=sys.stderr)
+
+    if args.output:
+        with open(args.output, 'w') as outputFile:
+            json.dump(results, outputFile, indent=2)
+    else:
+        json.dump(results, sys.stdout, indent=2)
+        print()
@@ -0,0 +1,318 @@
+/*
+ * @file ioc_spsc_stress.c
+ *
+ * @section desc File description
+ *
+ * Stress test of the single producer single consumer IOC queues on the
+ * host. ioc/tpl_ioc_spsc_kernel.c is compiled with the stubs of the
+ * stubs directory and two threads emulate the sender core and the
+ * receiver core of a channel that carries a group of two data: a 32 bit
+ * sequence number and a 3 byte pattern computed from it.
+ *
+ * The sender sends the sequence numbers in order, alternating IocSend and
+ * IocSendN, and sends again the messages refused by a full queue. The
+ * receiver alternates IocReceive and IocReceiveN and checks that every
+ * message is received once, in order, with its pattern, and that a queue
+ * overflow is reported with IOC_E_LOST_DATA. The queue is short so that it
+ * is often full and often empty. At the end, the sender may not empty the
+ * queue and the receiver can.
+ *
+ * Build with ThreadSanitizer (-fsanitize=thread) to check the ordering of
+ * the accesses to the queue, see ioc_spsc_stress.py.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "tpl_ioc_spsc_kernel.h"
+
+#define QUEUE_LENGTH  5U
+#define BATCH_LENGTH  7U
+#define PATTERN_SIZE  3U
+
+_Static_assert(offsetof(tpl_ioc_spsc_queue_dyn, tail) -
+               offsetof(tpl_ioc_spsc_queue_dyn, head) >= TPL_CACHE_LINE_SIZE,
+               "the sender and receiver indexes share a cache line");
+
+_Thread_local uint16 test_core_id;
+
+/*
+ * The channel, as goil generates it.
+ */
+static VAR(uint32, OS_VAR) sequence_buffer[QUEUE_LENGTH];
+static VAR(uint8, OS_VAR) pattern_buffer[QUEUE_LENGTH * PATTERN_SIZE];
+
+static CONST(tpl_ioc_buffer, OS_CONST) channel_buffers[2] = {
+  (tpl_ioc_buffer)sequence_buffer,
+  pattern_buffer
+};
+
+static CONST(tpl_ioc_message_size, OS_CONST) channel_element_sizes[2] = {
+  sizeof(uint32),
+  PATTERN_SIZE
+};
+
+static VAR(tpl_ioc_spsc_queue_dyn, OS_VAR) channel_dyn = {
+  0, 0, { 0 }, 0, 0
+};
+
+static CONST(tpl_ioc_spsc_mo, OS_CONST) channel = {
+  &channel_dyn,
+  channel_buffers,
+  channel_element_sizes,
+  QUEUE_LENGTH,
+  0,
+  2
+};
+
+CONSTP2CONST(tpl_ioc_spsc_mo, OS_CONST, OS_CONST) tpl_ioc_spsc_table[1] = {
+  &channel
+};
+
+static uint32 message_count = 3000000U;
+
+/* number of sends refused because the queue was full */
+static uint32 refused_count;
+
+static void fail(const char *what, uint32 sequence)
+{
+  fprintf(stderr, "ioc_spsc_stress: %s (message %u)\n", what,
+          (unsigned)sequence);
+  exit(EXIT_FAILURE);
+}
+
+static void pattern_of(uint32 sequence, uint8 *pattern)
+{
+  pattern[0] = (uint8)sequence;
+  pattern[1] = (uint8)(sequence >> 8);
+  pattern[2] = (uint8)(sequence * 7U);
+}
+
+static void *sender(void *unused)
+{
+  uint32 sequences[BATCH_LENGTH];
+  uint8 patterns[BATCH_LENGTH * PATTERN_SIZE];
+  tpl_ioc_message messages[2];
+  uint32 next = 0;
+  uint32 count;
+  uint32 i;
+  tpl_status status;
+
+  (void)unused;
+  test_core_id = TEST_SENDER_CORE;
+  messages[0].data = (tpl_ioc_data *)sequences;
+  messages[0].length = sizeof(uint32);
+  messages[1].data = patterns;
+  messages[1].length = PATTERN_SIZE;
+
+  while (next < message_count)
+  {
+    count = ((next & 1U) == 0U) ? 1U : BATCH_LENGTH;
+    if (count > message_count - next)
+    {
+      count = message_count - next;
+    }
+    for (i = 0; i < count; i++)
+    {
+      sequences[i] = next + i;
+      pattern_of(next + i, patterns + (i * PATTERN_SIZE));
+    }
+
+    if (count == 1U)
+    {
+      status = tpl_ioc_send_spsc_service(0, messages);
+      if (status == IOC_E_OK)
+      {
+        next++;
+      }
+      else if (status != IOC_E_LIMIT)
+      {
+        fail("IocSend failed", next);
+      }
+    }
+    else
+    {
+      status = tpl_ioc_send_n_spsc_service(0, messages, &count);
+      if ((status != IOC_E_OK) && (status != IOC_E_LIMIT))
+      {
+        fail("IocSendN failed", next);
+      }
+      next += count;
+    }
+
+    if (status == IOC_E_LIMIT)
+    {
+      /* the messages left are sent again */
+      refused_count++;
+      sched_yield();
+    }
+  }
+
+  /* the sender is not allowed to empty the queue */
+  if (tpl_ioc_empty_spsc_queue_service(0) != IOC_E_NOT_OK)
+  {
+    fail("IocEmptyQueue allowed to the sender", next);
+  }
+
+  return NULL;
+}
+
+static void check_message(uint32 expected, uint32 sequence,
+                          const uint8 *pattern)
+{
+  uint8 expected_pattern[PATTERN_SIZE];
+
+  if (sequence != expected)
+  {
+    fprintf(stderr, "ioc_spsc_stress: got message %u\n", (unsigned)sequence);
+    fail("message lost, duplicated or out of order", expected);
+  }
+  pattern_of(sequence, expected_pattern);
+  if ((pattern[0] != expected_pattern[0]) ||
+      (pattern[1] != expected_pattern[1]) ||
+      (pattern[2] != expected_pattern[2]))
+  {
+    fail("pattern does not match the sequence number", expected);
+  }
+}
+
+static void *receiver(void *unused)
+{
+  uint32 sequences[BATCH_LENGTH];
+  uint8 patterns[BATCH_LENGTH * PATTERN_SIZE];
+  tpl_ioc_message messages[2];
+  uint32 expected = 0;
+  uint32 lost_reports = 0;
+  uint32 round = 0;
+  uint32 count;
+  uint32 i;
+  tpl_status status;
+
+  (void)unused;
+  test_core_id = TEST_RECEIVER_CORE;
+  messages[0].data = (tpl_ioc_data *)sequences;
+  messages[0].length = sizeof(uint32);
+  messages[1].data = patterns;
+  messages[1].length = PATTERN_SIZE;
+
+  while (expected < message_count)
+  {
+    round++;
+    if ((round & 1U) == 0U)
+    {
+      count = 1U;
+      status = tpl_ioc_receive_spsc_service(0, messages);
+    }
+    else
+    {
+      count = BATCH_LENGTH;
+      status = tpl_ioc_receive_n_spsc_service(0, messages, &count);
+    }
+
+    if (status == IOC_E_NO_DATA)
+    {
+      sched_yield();
+    }
+    else if ((status == IOC_E_OK) || (status == IOC_E_LOST_DATA))
+    {
+      if (status == IOC_E_LOST_DATA)
+      {
+        lost_reports++;
+      }
+      for (i = 0; i < count; i++)
+      {
+        check_message(expected, sequences[i], patterns + (i * PATTERN_SIZE));
+        expected++;
+      }
+    }
+    else
+    {
+      fail("IocReceive failed", expected);
+    }
+  }
+
+  /* several overflows may be reported with the same messages */
+  return (void *)(unsigned long)lost_reports;
+}
+
+int main(int argc, char *argv[])
+{
+  pthread_t sender_thread;
+  pthread_t receiver_thread;
+  void *lost_reports;
+  uint32 sequence = 0;
+  uint8 pattern[PATTERN_SIZE];
+  tpl_ioc_message messages[2];
+
+  if (argc > 1)
+  {
+    message_count = (uint32)strtoul(argv[1], NULL, 10);
+  }
+
+  if ((pthread_create(&receiver_thread, NULL, receiver, NULL) != 0) ||
+      (pthread_create(&sender_thread, NULL, sender, NULL) != 0))
+  {
+    fail("cannot create the threads", 0);
+  }
+  pthread_join(sender_thread, NULL);
+  pthread_join(receiver_thread, &lost_reports);
+
+  if ((refused_count > 0U) && ((unsigned long)lost_reports == 0U))
+  {
+    fail("queue overflows were not reported", message_count);
+  }
+  if ((unsigned long)lost_reports > refused_count)
+  {
+    fail("more overflows reported than happened", message_count);
+  }
+
+  /* the receiver empties the queue */
+  messages[0].data = (tpl_ioc_data *)&sequence;
+  messages[0].length = sizeof(uint32);
+  messages[1].data = pattern;
+  messages[1].length = PATTERN_SIZE;
+  test_core_id = TEST_SENDER_CORE;
+  if (tpl_ioc_send_spsc_service(0, messages) != IOC_E_OK)
+  {
+    fail("IocSend failed on an empty queue", message_count);
+  }
+  test_core_id = TEST_RECEIVER_CORE;
+  if (tpl_ioc_empty_spsc_queue_service(0) != IOC_E_OK)
+  {
+    fail("IocEmptyQueue failed for the receiver", message_count);
+  }
+  if (tpl_ioc_receive_spsc_service(0, messages) != IOC_E_NO_DATA)
+  {
+    fail("IocEmptyQueue did not empty the queue", message_count);
+  }
+
+  printf("ioc_spsc_stress: %u messages received in order, "
+         "%u full queues, %lu overflows reported\n",
+         (unsigned)message_count, (unsigned)refused_count,
+         (unsigned long)lost_reports);
+  return EXIT_SUCCESS;
+}
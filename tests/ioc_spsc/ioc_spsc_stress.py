@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+# Stress test of the single producer single consumer IOC queues on the host.
+#
+# This script compiles ioc_spsc_stress.c with ioc/tpl_ioc_spsc_kernel.c and
+# the stubs of the stubs directory, in a build directory, then runs it:
+# - optimized (-O2), with the number of messages given by -n;
+# - with ThreadSanitizer, with -n / 10 messages, unless --no-tsan is given.
+# The script exits with a non zero status if a build or a run fails.
+
+import argparse
+import os
+import sys
+from os.path import abspath, dirname, join
+from subprocess import run
+
+scriptDir = dirname(abspath(__file__))
+trampolineDir = abspath(join(scriptDir, '..', '..'))
+
+variants = [
+  ('ioc_spsc_stress', ['-O2'], 1),
+  ('ioc_spsc_stress_tsan', ['-O1', '-g', '-fsanitize=thread'], 10),
+]
+
+def build(cc, exe, flags):
+  command = [cc, '-std=c11', '-Wall', '-Wextra'] + flags + [
+    '-I' + join(scriptDir, 'stubs'),
+    '-I' + join(trampolineDir, 'ioc'),
+    '-o', exe,
+    join(scriptDir, 'ioc_spsc_stress.c'),
+    join(trampolineDir, 'ioc', 'tpl_ioc_spsc_kernel.c'),
+    '-lpthread']
+  return run(command).returncode == 0
+
+def main():
+  parser = argparse.ArgumentParser(description='IOC SPSC queue stress test')
+  parser.add_argument('-n', '--messages', type=int, default=3000000,
+                      help='number of messages sent (default 3000000)')
+  parser.add_argument('--cc', default=os.environ.get('CC', 'gcc'),
+                      help='C compiler (default $CC or gcc)')
+  parser.add_argument('--no-tsan', action='store_true',
+                      help='do not run the ThreadSanitizer build')
+  args = parser.parse_args()
+
+  buildDir = join(scriptDir, 'build')
+  os.makedirs(buildDir, exist_ok=True)
+  ok = True
+  for name, flags, divider in variants:
+    if args.no_tsan and divider != 1:
+      continue
+    exe = join(buildDir, name)
+    if not build(args.cc, exe, flags):
+      print('{}: build failed'.format(name), file=sys.stderr)
+      ok = False
+    elif run([exe, str(max(1, args.messages // divider))]).returncode != 0:
+      print('{}: failed'.format(name), file=sys.stderr)
+      ok = False
+  return 0 if ok else 1
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,11 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ */
+#ifndef TPL_APP_CUSTOM_TYPES_H
+#define TPL_APP_CUSTOM_TYPES_H
+
+typedef uint8 tpl_ioc_id;
+typedef uint8 tpl_ioc_size;
+typedef uint32 tpl_ioc_queue_size;
+
+#endif
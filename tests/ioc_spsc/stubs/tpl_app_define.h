@@ -0,0 +1,18 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ *
+ * One SPSC channel, sent from core 0 and received on core 1.
+ */
+#ifndef TPL_APP_DEFINE_H
+#define TPL_APP_DEFINE_H
+
+#define NUMBER_OF_CORES   2
+#define APP_COUNT         0
+#define IOC_COUNT         1
+#define IOC_SPSC_COUNT    1
+
+#define WITH_OS_EXTENDED        YES
+#define WITH_IOC                YES
+#define WITH_MEMORY_PROTECTION  NO
+
+#endif
@@ -0,0 +1,7 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ */
+#ifndef TPL_AS_APP_KERNEL_H
+#define TPL_AS_APP_KERNEL_H
+
+#endif
@@ -0,0 +1,11 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ */
+#ifndef TPL_AS_DEFINITIONS_H
+#define TPL_AS_DEFINITIONS_H
+
+#define IOCServiceId_IOC_Send       0
+#define IOCServiceId_IOC_Receive    1
+#define IOCServiceId_IOC_EmptyQueue 2
+
+#endif
@@ -0,0 +1,10 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test: the
+ * cache line of the posix port.
+ */
+#ifndef TPL_MACHINE_H
+#define TPL_MACHINE_H
+
+#define TPL_CACHE_LINE_SIZE 64U
+
+#endif
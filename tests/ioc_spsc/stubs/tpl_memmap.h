@@ -0,0 +1,11 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ *
+ * No memory mapping on the host: the section macros are only undefined.
+ */
+#undef OS_START_SEC_CODE
+#undef OS_STOP_SEC_CODE
+#undef OS_START_SEC_CONST_UNSPECIFIED
+#undef OS_STOP_SEC_CONST_UNSPECIFIED
+#undef OS_START_SEC_VAR_UNSPECIFIED
+#undef OS_STOP_SEC_VAR_UNSPECIFIED
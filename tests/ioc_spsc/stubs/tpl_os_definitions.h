@@ -0,0 +1,33 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ *
+ * Compiler abstraction and status codes. Only what the IOC services use
+ * is defined.
+ */
+#ifndef TPL_OS_DEFINITIONS_H
+#define TPL_OS_DEFINITIONS_H
+
+#define YES 1
+#define NO  0
+
+#define TRUE  1
+#define FALSE 0
+
+#define STATIC static
+#define FUNC(type, memclass) type
+#define VAR(type, memclass) type
+#define CONST(type, memclass) const type
+#define P2VAR(type, ptrclass, memclass) type *
+#define P2CONST(type, ptrclass, memclass) const type *
+#define CONSTP2VAR(type, ptrclass, memclass) type * const
+#define CONSTP2CONST(type, ptrclass, memclass) const type * const
+
+#define E_OK            0
+#define E_NOT_OK        1
+#define E_OS_ACCESS     1
+#define E_OS_ID         3
+#define E_OS_LIMIT      4
+#define E_OS_NO_DATA    100
+#define E_OS_LOST_DATA  101
+
+#endif
@@ -0,0 +1,42 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ *
+ * The access checks allow the sender core to send and the receiver core
+ * to receive, as an OS application on each core would.
+ */
+#ifndef TPL_OS_ERROR_H
+#define TPL_OS_ERROR_H
+
+#include "tpl_os_definitions.h"
+#include "tpl_os_internal_types.h"
+
+#define TEST_SENDER_CORE    0U
+#define TEST_RECEIVER_CORE  1U
+
+#define STORE_SERVICE(service)
+#define STORE_IOC_ID(ioc_id)
+#define PROCESS_ERROR(result)
+
+#define IF_NO_EXTENDED_ERROR(result) if ((result) == E_OK)
+
+#define CHECK_IOC_ID_ERROR(ioc_id, result)                                     \
+  if (((result) == E_OK) && ((ioc_id) >= IOC_COUNT))                           \
+  {                                                                            \
+    (result) = E_OS_ID;                                                        \
+  }
+
+#define CHECK_ACCESS_WRITE_IOC_ID(a_core_id, obj_id, result)                   \
+  if (((result) == E_OK) && ((a_core_id) != TEST_SENDER_CORE))                 \
+  {                                                                            \
+    (result) = E_OS_ACCESS;                                                    \
+  }
+
+#define CHECK_ACCESS_READ_IOC_ID(a_core_id, obj_id, result)                    \
+  if (((result) == E_OK) && ((a_core_id) != TEST_RECEIVER_CORE))               \
+  {                                                                            \
+    (result) = E_OS_ACCESS;                                                    \
+  }
+
+#define CHECK_DATA_LOCATION(a_core_id, data_ptr, result)
+
+#endif
@@ -0,0 +1,18 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ */
+#ifndef TPL_OS_INTERNAL_TYPES_H
+#define TPL_OS_INTERNAL_TYPES_H
+
+#include <stdint.h>
+
+#include "tpl_machine.h"
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint8 tpl_bool;
+typedef uint8 tpl_status;
+typedef tpl_status StatusType;
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ *
+ * Each thread of the test emulates a core with a single task, so the
+ * kernel lock of a core has nothing to serialize.
+ */
+#ifndef TPL_OS_KERNEL_H
+#define TPL_OS_KERNEL_H
+
+#include "tpl_os_internal_types.h"
+
+extern _Thread_local uint16 test_core_id;
+
+#define GET_CURRENT_CORE_ID(a_core_id)                                         \
+  VAR(uint16, AUTOMATIC) a_core_id = test_core_id;
+
+#define LOCK_KERNEL()
+#define UNLOCK_KERNEL()
+
+#endif
@@ -0,0 +1,10 @@
+/*
+ * Host stubs for the IOC single producer single consumer stress test.
+ */
+#ifndef TPL_TRACE_H
+#define TPL_TRACE_H
+
+#define TRACE_IOC_SEND(ioc_id)
+#define TRACE_IOC_RECEIVE(ioc_id)
+
+#endif
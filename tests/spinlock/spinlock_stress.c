@@ -0,0 +1,535 @@
+/*
+ * @file spinlock_stress.c
+ *
+ * @section desc File description
+ *
+ * Stress test of the AUTOSAR spinlocks on the host. The spinlock kernel
+ * files are compiled with the stubs of the stubs directory and a thread
+ * emulates each of the 4 cores. A spinlock of each LOCKTYPE is taken by
+ * all the cores in turn, with GetSpinlock and with TryToGetSpinlock.
+ *
+ * In the critical section, a core checks that it is alone and updates
+ * counters without atomic accesses. It sometimes sleeps there, so that
+ * the other cores queue for the lock even on a host with a single CPU.
+ * For the TICKET lock, it checks that the locks are given in the order of
+ * the tickets; for the MCS lock, that it got the lock from the core it
+ * queued behind. At the end, the
+ * counters of GetSpinlockStatistics are compared with the calls and wait
+ * loop iterations seen by the machine hooks, and ResetSpinlockStatistics
+ * is checked.
+ *
+ * The machine hooks are the ones of the posix port, with the same memory
+ * orders. They also record the ticket or the predecessor of the calling
+ * core, yield in the wait loops so that the test runs on a host with less
+ * CPUs than cores, and sometimes sleep before a core links itself to its
+ * MCS predecessor, so that the predecessor often releases the lock while
+ * its successor is not linked yet.
+ *
+ * Build with ThreadSanitizer (-fsanitize=thread) to check that the locks
+ * order the accesses of the critical sections, see spinlock_stress.py.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "tpl_as_spinlock_kernel.h"
+#include "tpl_as_spinlock_stats_kernel.h"
+#include "tpl_machine_interface.h"
+
+#define TAS_SPINLOCK     0U
+#define TICKET_SPINLOCK  1U
+#define MCS_SPINLOCK     2U
+
+/* one TryToGetSpinlock loop every TRY_PERIOD acquisitions */
+#define TRY_PERIOD       4U
+/* the owner sleeps in one critical section every YIELD_PERIOD */
+#define YIELD_PERIOD     8U
+
+_Static_assert(sizeof(tpl_mcs_node) == TPL_CACHE_LINE_SIZE,
+               "a MCS node does not fill a cache line");
+_Static_assert(offsetof(tpl_mcs_lock, nodes) >= TPL_CACHE_LINE_SIZE,
+               "the tail of a MCS lock is in the line of the first node");
+_Static_assert(offsetof(tpl_spinlock_core_stats, stats) >=
+               TPL_CACHE_LINE_SIZE,
+               "the statistics of two cores may share a cache line");
+
+_Thread_local uint16 test_core_id;
+
+/*
+ * The spinlocks, as goil generates them.
+ */
+static VAR(tpl_ticket_lock, OS_VAR) ticket_lock = { 0, 0 };
+static VAR(tpl_mcs_lock, OS_VAR) mcs_lock;
+
+static VAR(tpl_spinlock, OS_VAR) tas_spinlock_desc = {
+  UNLOCKED_LOCK, LOCK_NOTHING, SPINLOCK_TEST_AND_SET, NULL, NULL
+};
+static VAR(tpl_spinlock, OS_VAR) ticket_spinlock_desc = {
+  UNLOCKED_LOCK, LOCK_NOTHING, SPINLOCK_TICKET, &ticket_lock, NULL
+};
+static VAR(tpl_spinlock, OS_VAR) mcs_spinlock_desc = {
+  UNLOCKED_LOCK, LOCK_NOTHING, SPINLOCK_MCS, NULL, &mcs_lock
+};
+
+CONSTP2VAR(tpl_spinlock, OS_CONST, OS_VAR)
+tpl_spinlock_table[SPINLOCK_COUNT] = {
+  &tas_spinlock_desc,
+  &ticket_spinlock_desc,
+  &mcs_spinlock_desc
+};
+
+VAR(tpl_spinlock_id, OS_VAR)
+tpl_taken_spinlocks[NUMBER_OF_CORES][MAX_POSSESSED_SPINLOCKS];
+VAR(tpl_spinlock_id, OS_VAR) tpl_taken_spinlock_counter[NUMBER_OF_CORES];
+VAR(tpl_spinlock_core_stats, OS_VAR) tpl_spinlock_stats_table[NUMBER_OF_CORES];
+
+static const char *const lock_names[SPINLOCK_COUNT] = {
+  "TEST_AND_SET", "TICKET", "MCS"
+};
+
+/*
+ * State of the critical section of a spinlock. Only inside is atomic, and
+ * it is accessed with relaxed loads and stores so that ThreadSanitizer
+ * only sees the ordering given by the spinlock.
+ */
+typedef struct {
+  atomic_int inside;
+  uint32 count;           /* critical sections done                    */
+  uint16 grants;          /* TICKET: ticket of the next owner          */
+  uint16 last_owner;      /* MCS: last owner, numbered from 1          */
+} critical_section;
+
+static critical_section sections[SPINLOCK_COUNT];
+
+/* what the hooks saw, summed over the cores */
+typedef struct {
+  uint32 attempts;        /* GetSpinlock and TryToGetSpinlock calls    */
+  uint32 spins;           /* iterations of the wait loop of GetSpinlock */
+  uint32 handoff_waits;   /* iterations of the wait of ReleaseSpinlock */
+} lock_counts;
+
+static lock_counts counts[SPINLOCK_COUNT];
+static pthread_mutex_t counts_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const struct timespec owner_nap = { 0, 1000 };
+static const struct timespec link_nap = { 0, 20000 };
+
+static pthread_barrier_t phase_barrier;
+static uint32 round_count = 100000U;
+
+/* per core state of the hooks */
+static _Thread_local const uint16 *enqueue_word;
+static _Thread_local uint16 enqueued;
+static _Thread_local int in_get;
+static _Thread_local int in_release;
+static _Thread_local uint32 get_spins;
+static _Thread_local uint32 handoff_waits;
+static _Thread_local uint32 link_count;
+
+static void fail(const char *what, uint32 spinlock_id)
+{
+  fprintf(stderr, "spinlock_stress: %s (%s lock)\n", what,
+          lock_names[spinlock_id]);
+  exit(EXIT_FAILURE);
+}
+
+/*
+ * Interrupt and resource services, not used by LOCK_NOTHING spinlocks
+ */
+FUNC(void, OS_CODE) tpl_enable_interrupts(void) {}
+FUNC(void, OS_CODE) tpl_reset_interrupt_lock_status(void) {}
+FUNC(void, OS_CODE) tpl_suspend_all_interrupts_service(void) {}
+FUNC(void, OS_CODE) tpl_suspend_os_interrupts_service(void) {}
+FUNC(tpl_status, OS_CODE) tpl_get_resource_service(uint8 res_id)
+{
+  (void)res_id;
+  return E_OK;
+}
+FUNC(tpl_status, OS_CODE) tpl_release_resource_service(uint8 res_id)
+{
+  (void)res_id;
+  return E_OK;
+}
+
+/*
+ * Machine hooks of the posix port (machines/posix/tpl_machine_posix.c)
+ */
+typedef _Atomic uint16 test_atomic_uint16;
+#define TEST_ATOMIC(value) ((volatile test_atomic_uint16 *)(value))
+
+FUNC(void, OS_CODE) tpl_get_lock(CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock)
+{
+  while (UNLOCKED_LOCK != atomic_exchange_explicit(TEST_ATOMIC(lock),
+                                                   LOCKED_LOCK,
+                                                   memory_order_acquire))
+  {
+    while (UNLOCKED_LOCK != atomic_load_explicit(TEST_ATOMIC(lock),
+                                                 memory_order_relaxed))
+    {
+      sched_yield();
+    }
+  }
+}
+
+FUNC(void, OS_CODE) tpl_release_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock)
+{
+  atomic_store_explicit(TEST_ATOMIC(lock), UNLOCKED_LOCK,
+                        memory_order_release);
+}
+
+FUNC(void, OS_CODE) tpl_try_to_get_lock(
+  CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock,
+  P2VAR(tpl_try_to_get_spinlock_type, AUTOMATIC, OS_VAR) success)
+{
+  if ((UNLOCKED_LOCK == atomic_load_explicit(TEST_ATOMIC(lock),
+                                             memory_order_relaxed)) &&
+      (UNLOCKED_LOCK == atomic_exchange_explicit(TEST_ATOMIC(lock),
+                                                 LOCKED_LOCK,
+                                                 memory_order_acquire)))
+  {
+    *success = TRYTOGETSPINLOCK_SUCCESS;
+  }
+  else
+  {
+    *success = TRYTOGETSPINLOCK_NOSUCCESS;
+    if (in_get)
+    {
+      /* an iteration of the wait loop of a TEST_AND_SET GetSpinlock */
+      get_spins++;
+    }
+    sched_yield();
+  }
+}
+
+FUNC(uint16, OS_CODE) tpl_fetch_and_add(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) counter,
+  CONST(uint16, AUTOMATIC)              increment)
+{
+  const uint16 value = atomic_fetch_add_explicit(TEST_ATOMIC(counter),
+                                                 increment,
+                                                 memory_order_acq_rel);
+  if (counter == enqueue_word)
+  {
+    /* the ticket of the core */
+    enqueued = value;
+  }
+  return value;
+}
+
+FUNC(uint16, OS_CODE) tpl_atomic_load(
+  CONSTP2CONST(uint16, AUTOMATIC, OS_VAR) value)
+{
+  return atomic_load_explicit(TEST_ATOMIC(value), memory_order_acquire);
+}
+
+FUNC(uint16, OS_CODE) tpl_atomic_exchange(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              new_value)
+{
+  uint16 previous;
+
+  if (in_get && (value != enqueue_word) && ((++link_count & 1U) == 0U))
+  {
+    /* the core is linking itself to its MCS predecessor, let the
+       predecessor release the lock meanwhile */
+    nanosleep(&link_nap, NULL);
+  }
+  previous = atomic_exchange_explicit(TEST_ATOMIC(value), new_value,
+                                      memory_order_acq_rel);
+  if (value == enqueue_word)
+  {
+    /* the MCS predecessor of the core */
+    enqueued = previous;
+  }
+  return previous;
+}
+
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              expected,
+  CONST(uint16, AUTOMATIC)              new_value)
+{
+  uint16 current = expected;
+
+  if (atomic_compare_exchange_strong_explicit(
+        TEST_ATOMIC(value), &current, new_value,
+        memory_order_acq_rel, memory_order_acquire))
+  {
+    if (value == enqueue_word)
+    {
+      /* TryToGetSpinlock: the ticket, or no MCS predecessor */
+      enqueued = expected;
+    }
+    return TRUE;
+  }
+  return FALSE;
+}
+
+FUNC(void, OS_CODE) tpl_cpu_relax(void)
+{
+  if (in_get)
+  {
+    get_spins++;
+  }
+  else if (in_release)
+  {
+    handoff_waits++;
+  }
+  sched_yield();
+}
+
+FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_timer(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (tpl_stats_time)((unsigned long long)now.tv_sec * 1000000ULL
+                          + (unsigned long long)(now.tv_nsec / 1000));
+}
+
+/*
+ * Critical section of a core. The counters are updated without atomic
+ * accesses and are only consistent if the spinlock excludes the other
+ * cores.
+ */
+static void critical_section_of(uint32 spinlock_id, uint16 core_id)
+{
+  critical_section *section = &sections[spinlock_id];
+
+  if (atomic_exchange_explicit(&section->inside, 1, memory_order_relaxed))
+  {
+    fail("two cores in the critical section", spinlock_id);
+  }
+  if (spinlock_id == TICKET_SPINLOCK)
+  {
+    if (section->grants != enqueued)
+    {
+      fail("lock not given in the order of the tickets", spinlock_id);
+    }
+    section->grants++;
+  }
+  else if (spinlock_id == MCS_SPINLOCK)
+  {
+    if ((enqueued != 0) && (section->last_owner != enqueued))
+    {
+      fail("lock not given by the predecessor in the queue", spinlock_id);
+    }
+    section->last_owner = (uint16)(core_id + 1U);
+  }
+  section->count++;
+  if ((section->count % YIELD_PERIOD) == 0U)
+  {
+    /* let the other cores queue for the lock. sched_yield is not enough,
+       the scheduler of the host may run the owner again at once */
+    nanosleep(&owner_nap, NULL);
+  }
+  atomic_store_explicit(&section->inside, 0, memory_order_relaxed);
+}
+
+static void hammer(uint32 spinlock_id, uint16 core_id)
+{
+  tpl_try_to_get_spinlock_type success;
+  lock_counts seen = { 0, 0, 0 };
+  uint32 round;
+
+  if (spinlock_id == TICKET_SPINLOCK)
+  {
+    enqueue_word = &ticket_lock.next_ticket;
+  }
+  else if (spinlock_id == MCS_SPINLOCK)
+  {
+    enqueue_word = &mcs_lock.tail;
+  }
+  else
+  {
+    enqueue_word = NULL;
+  }
+  get_spins = 0;
+  handoff_waits = 0;
+
+  for (round = 0; round < round_count; round++)
+  {
+    enqueued = 0;
+    if ((round % TRY_PERIOD) == (TRY_PERIOD - 1U))
+    {
+      do
+      {
+        seen.attempts++;
+        if (tpl_try_to_get_spinlock_service((tpl_spinlock_id)spinlock_id,
+                                            &success) != E_OK)
+        {
+          fail("TryToGetSpinlock failed", spinlock_id);
+        }
+        if (success != TRYTOGETSPINLOCK_SUCCESS)
+        {
+          sched_yield();
+        }
+      } while (success != TRYTOGETSPINLOCK_SUCCESS);
+    }
+    else
+    {
+      seen.attempts++;
+      in_get = 1;
+      if (tpl_get_spinlock_service((tpl_spinlock_id)spinlock_id) != E_OK)
+      {
+        fail("GetSpinlock failed", spinlock_id);
+      }
+      in_get = 0;
+    }
+
+    critical_section_of(spinlock_id, core_id);
+
+    in_release = 1;
+    if (tpl_release_spinlock_service((tpl_spinlock_id)spinlock_id) != E_OK)
+    {
+      fail("ReleaseSpinlock failed", spinlock_id);
+    }
+    in_release = 0;
+  }
+
+  seen.spins = get_spins;
+  seen.handoff_waits = handoff_waits;
+  pthread_mutex_lock(&counts_mutex);
+  counts[spinlock_id].attempts += seen.attempts;
+  counts[spinlock_id].spins += seen.spins;
+  counts[spinlock_id].handoff_waits += seen.handoff_waits;
+  pthread_mutex_unlock(&counts_mutex);
+}
+
+static void *core(void *arg)
+{
+  uint32 spinlock_id;
+
+  test_core_id = (uint16)(uintptr_t)arg;
+  for (spinlock_id = 0; spinlock_id < SPINLOCK_COUNT; spinlock_id++)
+  {
+    /* all the cores take the same spinlock at the same time */
+    pthread_barrier_wait(&phase_barrier);
+    hammer(spinlock_id, test_core_id);
+  }
+  return NULL;
+}
+
+static void check_statistics(uint32 spinlock_id, tpl_stats_time duration)
+{
+  tpl_spinlock_stats stats;
+
+  if (tpl_get_spinlock_statistics_service((tpl_spinlock_id)spinlock_id,
+                                          &stats) != E_OK)
+  {
+    fail("GetSpinlockStatistics failed", spinlock_id);
+  }
+  if (stats.attempt_count != counts[spinlock_id].attempts)
+  {
+    fail("wrong attempt count", spinlock_id);
+  }
+  if (stats.spin_count != counts[spinlock_id].spins)
+  {
+    fail("wrong spin count", spinlock_id);
+  }
+  if (stats.max_wait > duration)
+  {
+    fail("max wait longer than the test", spinlock_id);
+  }
+  printf("spinlock_stress: %-12s %u critical sections, %u attempts, "
+         "%u spins, %u handover waits, max wait %u us\n",
+         lock_names[spinlock_id], (unsigned)sections[spinlock_id].count,
+         (unsigned)stats.attempt_count, (unsigned)stats.spin_count,
+         (unsigned)counts[spinlock_id].handoff_waits,
+         (unsigned)stats.max_wait);
+}
+
+int main(int argc, char *argv[])
+{
+  pthread_t threads[NUMBER_OF_CORES];
+  tpl_spinlock_stats stats;
+  tpl_stats_time start_date;
+  tpl_stats_time duration;
+  uint32 spinlock_id;
+  uint16 core_id;
+
+  if (argc > 1)
+  {
+    round_count = (uint32)strtoul(argv[1], NULL, 10);
+  }
+
+  start_date = tpl_get_stats_timer();
+  pthread_barrier_init(&phase_barrier, NULL, NUMBER_OF_CORES);
+  for (core_id = 0; core_id < NUMBER_OF_CORES; core_id++)
+  {
+    if (pthread_create(&threads[core_id], NULL, core,
+                       (void *)(uintptr_t)core_id) != 0)
+    {
+      fail("cannot create the threads", 0);
+    }
+  }
+  for (core_id = 0; core_id < NUMBER_OF_CORES; core_id++)
+  {
+    pthread_join(threads[core_id], NULL);
+  }
+  duration = tpl_get_stats_timer() - start_date;
+
+  test_core_id = 0;
+  for (spinlock_id = 0; spinlock_id < SPINLOCK_COUNT; spinlock_id++)
+  {
+    if (sections[spinlock_id].count != round_count * NUMBER_OF_CORES)
+    {
+      fail("critical sections lost", spinlock_id);
+    }
+    check_statistics(spinlock_id, duration);
+  }
+
+  if (counts[MCS_SPINLOCK].handoff_waits == 0U)
+  {
+    fail("no release waited for a successor to link", MCS_SPINLOCK);
+  }
+
+  /* reset one spinlock, the other ones keep their statistics */
+  if (tpl_reset_spinlock_statistics_service(TICKET_SPINLOCK) != E_OK)
+  {
+    fail("ResetSpinlockStatistics failed", TICKET_SPINLOCK);
+  }
+  (void)tpl_get_spinlock_statistics_service(TICKET_SPINLOCK, &stats);
+  if ((stats.attempt_count != 0U) || (stats.spin_count != 0U) ||
+      (stats.max_wait != 0U))
+  {
+    fail("statistics not reset", TICKET_SPINLOCK);
+  }
+  (void)tpl_get_spinlock_statistics_service(MCS_SPINLOCK, &stats);
+  if (stats.attempt_count != counts[MCS_SPINLOCK].attempts)
+  {
+    fail("statistics reset by the reset of another spinlock",
+         MCS_SPINLOCK);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+# Stress test of the AUTOSAR spinlocks on the host.
+#
+# This script compiles spinlock_stress.c with the spinlock kernel files of
+# autosar and the stubs of the stubs directory, in a build directory, then
+# runs it:
+# - optimized (-O2), with the number of rounds per core given by -n;
+# - with ThreadSanitizer, with -n / 10 rounds, unless --no-tsan is given.
+# The kernel files are copied in the build directory first, so that the
+# stubs are found before the headers of the autosar directory they include.
+# The script exits with a non zero status if a build or a run fails.
+
+import argparse
+import os
+import shutil
+import sys
+from os.path import abspath, dirname, join
+from subprocess import run
+
+scriptDir = dirname(abspath(__file__))
+trampolineDir = abspath(join(scriptDir, '..', '..'))
+
+kernelFiles = ['tpl_as_spinlock_kernel.c', 'tpl_as_spinlock_stats_kernel.c']
+
+variants = [
+  ('spinlock_stress', ['-O2'], 1),
+  ('spinlock_stress_tsan', ['-O1', '-g', '-fsanitize=thread'], 10),
+]
+
+def build(cc, buildDir, exe, flags):
+  command = [cc, '-std=c11', '-Wall', '-Wextra'] + flags + [
+    '-I' + join(scriptDir, 'stubs'),
+    '-I' + join(trampolineDir, 'autosar'),
+    '-o', exe,
+    join(scriptDir, 'spinlock_stress.c')] + [
+    join(buildDir, name) for name in kernelFiles] + ['-lpthread']
+  return run(command).returncode == 0
+
+def main():
+  parser = argparse.ArgumentParser(description='spinlock stress test')
+  parser.add_argument('-n', '--rounds', type=int, default=100000,
+                      help='critical sections per core and spinlock '
+                           '(default 100000)')
+  parser.add_argument('--cc', default=os.environ.get('CC', 'gcc'),
+                      help='C compiler (default $CC or gcc)')
+  parser.add_argument('--no-tsan', action='store_true',
+                      help='do not run the ThreadSanitizer build')
+  args = parser.parse_args()
+
+  buildDir = join(scriptDir, 'build')
+  os.makedirs(buildDir, exist_ok=True)
+  for name in kernelFiles:
+    shutil.copy(join(trampolineDir, 'autosar', name), buildDir)
+  ok = True
+  for name, flags, divider in variants:
+    if args.no_tsan and divider != 1:
+      continue
+    exe = join(buildDir, name)
+    if not build(args.cc, buildDir, exe, flags):
+      print('{}: build failed'.format(name), file=sys.stderr)
+      ok = False
+    elif run([exe, str(max(1, args.rounds // divider))]).returncode != 0:
+      print('{}: failed'.format(name), file=sys.stderr)
+      ok = False
+  return 0 if ok else 1
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,13 @@
+/*
+ * Host stubs for the spinlock stress test: the services are called
+ * without system call.
+ */
+#ifndef OS_H
+#define OS_H
+
+#include "tpl_as_spinlock_kernel.h"
+
+#define TryToGetSpinlock(spinlock_id, success)                                 \
+  tpl_try_to_get_spinlock_service((spinlock_id), (success))
+
+#endif
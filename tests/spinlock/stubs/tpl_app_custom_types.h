@@ -0,0 +1,15 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_APP_CUSTOM_TYPES_H
+#define TPL_APP_CUSTOM_TYPES_H
+
+#include "tpl_os_internal_types.h"
+
+typedef uint8 tpl_spinlock_id;
+
+typedef uint8 tpl_try_to_get_spinlock_type;
+#define TRYTOGETSPINLOCK_SUCCESS    1
+#define TRYTOGETSPINLOCK_NOSUCCESS  0
+
+#endif
@@ -0,0 +1,17 @@
+/*
+ * Host stubs for the spinlock stress test.
+ *
+ * One spinlock of each LOCKTYPE, 4 cores and the contention statistics.
+ */
+#ifndef TPL_APP_DEFINE_H
+#define TPL_APP_DEFINE_H
+
+#define NUMBER_OF_CORES           4
+#define SPINLOCK_COUNT            3
+#define MAX_POSSESSED_SPINLOCKS   1
+
+#define WITH_OS_EXTENDED          NO
+#define WITH_MEMORY_PROTECTION    NO
+#define WITH_SPINLOCK_STATISTICS  YES
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_AS_DEFINITIONS_H
+#define TPL_AS_DEFINITIONS_H
+
+#define OSServiceId_GetSpinlock               0
+#define OSServiceId_ReleaseSpinlock           1
+#define OSServiceId_TryToGetSpinlock          2
+#define OSServiceId_GetSpinlockStatistics     3
+#define OSServiceId_ResetSpinlockStatistics   4
+
+#endif
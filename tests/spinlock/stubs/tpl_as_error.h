@@ -0,0 +1,18 @@
+/*
+ * Host stubs for the spinlock stress test. The test only uses valid
+ * spinlocks in the right order, so the checks do nothing.
+ */
+#ifndef TPL_AS_ERROR_H
+#define TPL_AS_ERROR_H
+
+#define STORE_SPINLOCK_ID(spinlock_id)
+
+#define CHECK_SPINLOCK_ID_ERROR(spinlock_id, result)
+#define CHECK_ACCESS_RIGHTS_SPINLOCK_ID(core_id, spinlock_id, result) \
+  (void)(core_id);
+#define CHECK_SPINLOCK_INTERFERENCE_DEADLOCK_ERROR(core_id, spinlock_id, result)
+#define CHECK_SPINLOCK_NESTING_ORDER_ERROR(core_id, spinlock_id, result)
+#define CHECK_SPINLOCK_NOT_TAKEN_ERROR(core_id, spinlock_id, result)
+#define CHECK_SPINLOCK_UNNESTING_ORDER_ERROR(core_id, spinlock_id, result)
+
+#endif
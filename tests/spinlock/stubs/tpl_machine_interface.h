@@ -0,0 +1,30 @@
+/*
+ * Host stubs for the spinlock stress test. The hooks are defined by
+ * spinlock_stress.c.
+ */
+#ifndef TPL_MACHINE_INTERFACE_H
+#define TPL_MACHINE_INTERFACE_H
+
+#include "tpl_os_definitions.h"
+#include "tpl_os_custom_types.h"
+
+FUNC(void, OS_CODE) tpl_enable_interrupts(void);
+FUNC(void, OS_CODE) tpl_reset_interrupt_lock_status(void);
+FUNC(void, OS_CODE) tpl_get_lock(CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
+FUNC(void, OS_CODE) tpl_release_lock(CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
+FUNC(uint16, OS_CODE) tpl_fetch_and_add(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) counter,
+  CONST(uint16, AUTOMATIC)              increment);
+FUNC(uint16, OS_CODE) tpl_atomic_load(
+  CONSTP2CONST(uint16, AUTOMATIC, OS_VAR) value);
+FUNC(uint16, OS_CODE) tpl_atomic_exchange(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              new_value);
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(uint16, AUTOMATIC, OS_VAR) value,
+  CONST(uint16, AUTOMATIC)              expected,
+  CONST(uint16, AUTOMATIC)              new_value);
+FUNC(void, OS_CODE) tpl_cpu_relax(void);
+FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_timer(void);
+
+#endif
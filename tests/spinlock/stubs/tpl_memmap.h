@@ -0,0 +1,9 @@
+/*
+ * Host stubs for the spinlock stress test.
+ *
+ * No memory mapping on the host: the section macros are only undefined.
+ */
+#undef OS_START_SEC_CODE
+#undef OS_STOP_SEC_CODE
+#undef API_START_SEC_CODE
+#undef API_STOP_SEC_CODE
@@ -0,0 +1,12 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_OS_CUSTOM_TYPES_H
+#define TPL_OS_CUSTOM_TYPES_H
+
+#include "tpl_os_internal_types.h"
+#include "tpl_app_define.h"
+
+typedef uint32 tpl_stats_time;
+
+#endif
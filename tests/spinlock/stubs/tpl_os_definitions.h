@@ -0,0 +1,31 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_OS_DEFINITIONS_H
+#define TPL_OS_DEFINITIONS_H
+
+#define YES 1
+#define NO  0
+
+#define TRUE  1
+#define FALSE 0
+
+#define STATIC static
+#define FUNC(type, memclass) type
+#define VAR(type, memclass) type
+#define CONST(type, memclass) const type
+#define P2VAR(type, ptrclass, memclass) type *
+#define P2CONST(type, ptrclass, memclass) const type *
+#define CONSTP2VAR(type, ptrclass, memclass) type * const
+#define CONSTP2CONST(type, ptrclass, memclass) const type * const
+
+#define E_OK            0
+#define E_OS_ACCESS     1
+#define E_OS_ID         3
+
+#define UNLOCKED_LOCK   0
+#define LOCKED_LOCK     1
+
+#define RES_SCHEDULER   0
+
+#endif
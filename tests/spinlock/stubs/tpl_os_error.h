@@ -0,0 +1,14 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_OS_ERROR_H
+#define TPL_OS_ERROR_H
+
+#define STORE_SERVICE(service)
+#define PROCESS_ERROR(result)
+
+#define IF_NO_EXTENDED_ERROR(result) if ((result) == E_OK)
+
+#define CHECK_DATA_LOCATION(a_core_id, data_ptr, result)
+
+#endif
@@ -0,0 +1,7 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_OS_ERRORHOOK_H
+#define TPL_OS_ERRORHOOK_H
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_OS_INTERNAL_TYPES_H
+#define TPL_OS_INTERNAL_TYPES_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int32_t sint32;
+typedef uint8 tpl_bool;
+typedef uint8 tpl_status;
+typedef tpl_status StatusType;
+typedef uint16 tpl_lock;
+
+#include "tpl_machine.h"
+
+#endif
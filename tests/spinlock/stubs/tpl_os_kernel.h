@@ -0,0 +1,22 @@
+/*
+ * Host stubs for the spinlock stress test. A thread plays each core and
+ * the interrupt and resource services do nothing: the spinlocks of the
+ * test use LOCK_NOTHING.
+ */
+#ifndef TPL_OS_KERNEL_H
+#define TPL_OS_KERNEL_H
+
+#include "tpl_os_definitions.h"
+#include "tpl_os_internal_types.h"
+
+extern _Thread_local uint16 test_core_id;
+
+#define GET_CURRENT_CORE_ID(a_core_id)                                         \
+  VAR(uint16, AUTOMATIC) a_core_id = test_core_id;
+
+FUNC(void, OS_CODE) tpl_suspend_all_interrupts_service(void);
+FUNC(void, OS_CODE) tpl_suspend_os_interrupts_service(void);
+FUNC(tpl_status, OS_CODE) tpl_get_resource_service(uint8 res_id);
+FUNC(tpl_status, OS_CODE) tpl_release_resource_service(uint8 res_id);
+
+#endif
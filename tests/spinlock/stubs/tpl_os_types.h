@@ -0,0 +1,10 @@
+/*
+ * Host stubs for the spinlock stress test.
+ */
+#ifndef TPL_OS_TYPES_H
+#define TPL_OS_TYPES_H
+
+#include "tpl_os_definitions.h"
+#include "tpl_app_custom_types.h"
+
+#endif